@@ -50,11 +50,21 @@ int main(int argc, char *argv[])
         qtout << "6e .. string utils vs.regex" << Qt::endl;
         qtout << "6f .. string concatenation (+=, arg, ..)" << Qt::endl;
         qtout << "6g .. const &QString vs. QStringLiteral" << Qt::endl;
+        qtout << "6h .. remote aircraft situations, 5Hz writers vs. 60Hz reader" << Qt::endl;
+        qtout << "6i .. 500 aircraft interpolation, linear vs. spline" << Qt::endl;
+        qtout << "6j .. airports range queries, linear vs. spatial index" << Qt::endl;
+        qtout << "6k .. 1000 aircraft position updates at 5Hz, property index map vs. typed" << Qt::endl;
+        qtout << "6l .. VATSIM data file, DOM vs. streaming parser (optional: 6l <recorded file>)" << Qt::endl;
+        qtout << "6m .. 50,000 models memoized JSON, save / load" << Qt::endl;
+        qtout << "6n .. 50,000 models value cache, JSON vs. binary files" << Qt::endl;
+        qtout << "6o .. 500 aircraft restricted airspace snapshots, rebuild vs. incremental" << Qt::endl;
+        qtout << "6p .. 500 aircraft in range for remote GUI, full list vs. deltas" << Qt::endl;
         qtout << "7 .. Algorithms" << Qt::endl;
         qtout << "8 .. File/Directory" << Qt::endl;
         qtout << "-----" << Qt::endl;
         qtout << "x .. Bye" << Qt::endl;
-        const QString s = qtin.readLine().toLower().trimmed();
+        const QString line = qtin.readLine().trimmed();
+        const QString s = line.toLower();
 
         if (s.startsWith("1")) { CSamplesJson::samples(); }
         else if (s.startsWith("2")) { CSamplesChangeObject::samples(); }
@@ -68,6 +78,15 @@ int main(int argc, char *argv[])
         else if (s.startsWith("6e")) { CSamplesPerformance::samplesStringUtilsVsRegEx(qtout); }
         else if (s.startsWith("6f")) { CSamplesPerformance::samplesStringConcat(qtout); }
         else if (s.startsWith("6g")) { CSamplesPerformance::samplesStringLiteralVsConstQString(qtout); }
+        else if (s.startsWith("6h")) { CSamplesPerformance::samplesRemoteAircraftSituationsStress(qtout, 300, 10); }
+        else if (s.startsWith("6i")) { CSamplesPerformance::samplesSituationInterpolation(qtout, 500, 1000); }
+        else if (s.startsWith("6j")) { CSamplesPerformance::samplesAirportsSpatialIndex(qtout, 10000); }
+        else if (s.startsWith("6k")) { CSamplesPerformance::samplesAircraftKinematicsReplay(qtout, 1000, 60); }
+        else if (s.startsWith("6l")) { CSamplesPerformance::samplesVatsimDataFileStreaming(qtout, line.mid(2).trimmed()); }
+        else if (s.startsWith("6m")) { CSamplesPerformance::samplesMemoizedModelsJson(qtout, 50000); }
+        else if (s.startsWith("6n")) { CSamplesPerformance::samplesModelCacheFormats(qtout, 50000); }
+        else if (s.startsWith("6o")) { CSamplesPerformance::samplesAirspaceSnapshots(qtout, 500, 1000); }
+        else if (s.startsWith("6p")) { CSamplesPerformance::samplesAircraftInRangeDeltas(qtout, 500, 120); }
         else if (s.startsWith("7")) { CSamplesAlgorithm::samples(); }
         else if (s.startsWith("8")) { CSamplesFile::samples(qtout); }
         else if (s.startsWith("x")) { break; }
@@ -6,27 +6,46 @@
 
 #include "samplesperformance.h"
 #include "blackcore/db/databasereader.h"
+#include "blackcore/db/databaseutils.h"
 #include "blackmisc/simulation/aircraftmodellist.h"
+#include "blackmisc/simulation/airspaceaircraftsnapshotbuilder.h"
+#include "blackmisc/simulation/simulatedaircraftlistdelta.h"
 #include "blackmisc/simulation/distributorlist.h"
+#include "blackmisc/simulation/remoteaircraftprovider.h"
+#include "blackmisc/simulation/simulatedaircraft.h"
+#include "blackmisc/simulation/interpolatorlinear.h"
+#include "blackmisc/simulation/interpolatorspline.h"
 #include "blackmisc/aviation/aircrafticaocodelist.h"
+#include "blackmisc/aviation/airportlist.h"
 #include "blackmisc/aviation/aircraftsituation.h"
 #include "blackmisc/aviation/aircraftsituationlist.h"
+#include "blackmisc/aviation/aircraftsituationchange.h"
 #include "blackmisc/aviation/altitude.h"
 #include "blackmisc/aviation/atcstation.h"
 #include "blackmisc/aviation/atcstationlist.h"
 #include "blackmisc/aviation/callsign.h"
 #include "blackmisc/aviation/liverylist.h"
+#include "blackmisc/aviation/transponder.h"
 #include "blackmisc/geo/coordinategeodetic.h"
+#include "blackmisc/geo/geokdtree.h"
 #include "blackmisc/math/mathutils.h"
+#include "blackmisc/memotable.h"
+#include "blackmisc/propertyindexvariantmap.h"
+#include "blackmisc/sharedstate/deltaevent.h"
 #include "blackmisc/pq/units.h"
 #include "blackmisc/test/testing.h"
 #include "blackmisc/swiftdirectories.h"
 #include "blackmisc/directoryutils.h"
+#include "blackmisc/fileutils.h"
+#include "blackmisc/jsonstreamreader.h"
 #include "blackmisc/stringutils.h"
+#include "blackmisc/valuecache.h"
 
+#include <QDataStream>
 #include <QDateTime>
 #include <QHash>
 #include <QList>
+#include <QMap>
 #include <QRegExp>
 #include <QRegularExpression>
 #include <QRegularExpressionMatch>
@@ -35,10 +54,22 @@
 #include <QStringBuilder>
 #include <QTextStream>
 #include <QElapsedTimer>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QRandomGenerator>
+#include <QReadWriteLock>
+#include <QTemporaryDir>
+#include <QThread>
 #include <QVector>
 #include <Qt>
 #include <algorithm>
+#include <atomic>
 #include <iterator>
+#include <thread>
+#include <utility>
 
 using namespace BlackMisc;
 using namespace BlackMisc::Aviation;
@@ -680,6 +711,363 @@ namespace BlackSample
         return EXIT_SUCCESS;
     }
 
+    int CSamplesPerformance::samplesRemoteAircraftSituationsStress(QTextStream &out, int numberOfCallsigns, int seconds)
+    {
+        QVector<CCallsign> callsigns;
+        for (int cs = 0; cs < numberOfCallsigns; cs++) { callsigns.push_back(CCallsign("CS" + QString::number(cs))); }
+        out << "Situations stress: " << numberOfCallsigns << " callsigns written at 5Hz, read at 60Hz, " << seconds << "s per run" << Qt::endl;
+
+        // former implementation, one global lock held while the list is updated
+        QReadWriteLock globalLock;
+        QHash<CCallsign, CAircraftSituationList> situationsByCallsign;
+        const CAircraftModel model;
+        StressResult global = situationsStress(
+            callsigns, seconds,
+            [&](const CAircraftSituation &situation) {
+                QElapsedTimer lockTimer;
+                lockTimer.start();
+                QWriteLocker l(&globalLock);
+                const qint64 waitNs = lockTimer.nsecsElapsed();
+                CAircraftSituationList &situations = situationsByCallsign[situation.getCallsign()];
+                situations.push_frontKeepLatestFirstAdjustOffset(situation, true, IRemoteAircraftProvider::MaxSituationsPerCallsign);
+                situations.transferElevationForward();
+                const CAircraftSituationChange change(situations, CLength::null(), false, true, false);
+                change.guessOnGround(situations.front(), model);
+                return waitNs;
+            },
+            [&](const CCallsign &callsign) {
+                QElapsedTimer lockTimer;
+                lockTimer.start();
+                QReadLocker l(&globalLock);
+                const qint64 waitNs = lockTimer.nsecsElapsed();
+                const CAircraftSituationList situations = situationsByCallsign.value(callsign);
+                Q_UNUSED(situations)
+                return waitNs;
+            });
+        printStressResult(out, "global lock", global);
+
+        // current implementation, lock striped writers publishing snapshots
+        // lock wait is not visible from outside, the complete access times are reported
+        CRemoteAircraftProvider provider(nullptr);
+        StressResult snapshots = situationsStress(
+            callsigns, seconds,
+            [&](const CAircraftSituation &situation) {
+                QElapsedTimer timer;
+                timer.start();
+                provider.storeAircraftSituation(situation, false);
+                return timer.nsecsElapsed();
+            },
+            [&](const CCallsign &callsign) {
+                QElapsedTimer timer;
+                timer.start();
+                const CAircraftSituationListSnapshot situations = provider.remoteAircraftSituationsSnapshot(callsign);
+                Q_UNUSED(situations)
+                return timer.nsecsElapsed();
+            });
+        printStressResult(out, "snapshots (access time)", snapshots);
+
+        out << Qt::endl;
+        return EXIT_SUCCESS;
+    }
+
+    int CSamplesPerformance::samplesSituationInterpolation(QTextStream &out, int numberOfAircraft, int numberOfFrames)
+    {
+        const qint64 baseTimeEpoch = QDateTime::currentMSecsSinceEpoch();
+        const CAltitude groundElevation(0, CAltitude::MeanSeaLevel, CLengthUnit::ft());
+
+        QVector<CInterpolatorLinear::CInterpolant> linearInterpolants;
+        QVector<CInterpolatorSpline::CInterpolant> splineInterpolants;
+        QVector<CAircraftSituation> currentSituations;
+        for (int cs = 0; cs < numberOfAircraft; cs++)
+        {
+            // 3 situations moving north east and climbing, oldest first
+            const CCallsign callsign("CS" + QString::number(cs));
+            CAircraftSituationList sorted;
+            for (int t = 0; t < 3; t++)
+            {
+                const double lat = -60.0 + (cs % 120) + 0.01 * t;
+                const double lng = -170.0 + (cs % 340) + 0.01 * t;
+                CAircraftSituation s(callsign, CCoordinateGeodetic(lat, lng, 1000.0 + 100.0 * t));
+                s.setGroundElevation(groundElevation, CAircraftSituation::Test);
+                s.setOnGround(false);
+                s.setMSecsSinceEpoch(baseTimeEpoch + 5000 * t);
+                sorted.push_back(s);
+            }
+            const CAircraftSituation &oldSituation = sorted[1];
+            const CAircraftSituation &newSituation = sorted[2];
+            linearInterpolants.push_back({ oldSituation, newSituation, 0.5, (oldSituation.getMSecsSinceEpoch() + newSituation.getMSecsSinceEpoch()) / 2 });
+
+            // derivatives do not change the costs of the evaluation, 0 is good enough here
+            CInterpolatorSpline::PosArray pa;
+            pa.initToZero();
+            for (int i = 0; i < 3; i++)
+            {
+                const std::array<double, 3> v = sorted[i].getPosition().normalVectorDouble();
+                pa.x[i] = v[0];
+                pa.y[i] = v[1];
+                pa.z[i] = v[2];
+                pa.a[i] = sorted[i].getAltitude().value(CLengthUnit::ft());
+                pa.t[i] = static_cast<double>(sorted[i].getAdjustedMSecsSinceEpoch());
+            }
+            CInterpolatorSpline::CInterpolant spline(pa, CLengthUnit::ft(), CInterpolatorPbh(oldSituation, newSituation));
+            spline.setTimes(static_cast<qint64>((pa.t[1] + pa.t[2]) / 2), 0.5, (oldSituation.getMSecsSinceEpoch() + newSituation.getMSecsSinceEpoch()) / 2);
+            splineInterpolants.push_back(spline);
+
+            currentSituations.push_back(oldSituation);
+        }
+
+        const int n = linearInterpolants.size();
+        const double interpolations = static_cast<double>(n) * numberOfFrames;
+        out << "Interpolations of " << n << " aircraft, " << numberOfFrames << " frames" << Qt::endl;
+        const auto printRate = [&](const QString &name, qint64 ns, double checksum) {
+            out << name << ": " << qRound64(interpolations * 1.0e9 / qMax(ns, 1LL)) << " interpolations/s, " << (ns / 1000000) << "ms (" << checksum << ")" << Qt::endl;
+        };
+
+        QElapsedTimer timer;
+        double checksum = 0;
+        timer.start();
+        for (int f = 0; f < numberOfFrames; f++)
+        {
+            for (int i = 0; i < n; i++)
+            {
+                const CAircraftSituation s = linearInterpolants[i].interpolatePositionAndAltitude(currentSituations[i], true);
+                checksum += s.getAltitude().value();
+            }
+        }
+        printRate("linear", timer.nsecsElapsed(), checksum);
+
+        checksum = 0;
+        timer.start();
+        for (int f = 0; f < numberOfFrames; f++)
+        {
+            for (int i = 0; i < n; i++)
+            {
+                const CAircraftSituation s = splineInterpolants[i].interpolatePositionAndAltitude(currentSituations[i], true);
+                checksum += s.getAltitude().value();
+            }
+        }
+        printRate("spline", timer.nsecsElapsed(), checksum);
+
+        out << Qt::endl;
+        return EXIT_SUCCESS;
+    }
+
+    int CSamplesPerformance::samplesAirportsSpatialIndex(QTextStream &out, int numberOfQueries)
+    {
+        const QString airportsFileName = QDir(CSwiftDirectories::staticDbFilesDirectory()).filePath("airports.json");
+        const CAirportList airports = CAirportList::fromMultipleJsonFormats(CDatabaseUtils::readQJsonObjectFromDatabaseFile(airportsFileName));
+        out << "Loaded " << airports.size() << " airports from " << airportsFileName << Qt::endl;
+        if (airports.isEmpty()) { return EXIT_FAILURE; }
+
+        // half of the queries close to airports, half anywhere
+        QRandomGenerator random(4711);
+        QVector<CCoordinateGeodetic> queries;
+        for (int i = 0; i < numberOfQueries; i++)
+        {
+            if (i % 2 == 0)
+            {
+                const CAirport &airport = airports[random.bounded(airports.size())];
+                queries.push_back(CCoordinateGeodetic(airport.latitude().value(CAngleUnit::deg()) + random.bounded(0.5), airport.longitude().value(CAngleUnit::deg()) + random.bounded(0.5), 0));
+            }
+            else
+            {
+                queries.push_back(CCoordinateGeodetic(random.bounded(160.0) - 80.0, random.bounded(360.0) - 180.0, 0));
+            }
+        }
+
+        QElapsedTimer timer;
+        timer.start();
+        const CGeoKdTree index = airports.createSpatialIndex();
+        out << "Index of " << index.size() << " airports built in " << timer.elapsed() << "ms" << Qt::endl;
+
+        for (const CLength &range : { CLength(10, CLengthUnit::km()), CLength(100, CLengthUnit::NM()) })
+        {
+            int found = 0;
+            timer.start();
+            for (const CCoordinateGeodetic &query : std::as_const(queries)) { found += airports.findWithinRange(query, range).size(); }
+            const qint64 linearNs = timer.nsecsElapsed();
+
+            int foundIndexed = 0;
+            timer.start();
+            for (const CCoordinateGeodetic &query : std::as_const(queries)) { foundIndexed += airports.findWithinRange(query, range, index).size(); }
+            const qint64 indexedNs = timer.nsecsElapsed();
+
+            out << numberOfQueries << " x findWithinRange " << range.valueRoundedWithUnit() << ": linear " << (linearNs / 1000000) << "ms, indexed " << (indexedNs / 1000000)
+                << "ms (" << found << "/" << foundIndexed << " airports)" << Qt::endl;
+
+            int same = 0;
+            timer.start();
+            QVector<CAirport> closest;
+            closest.reserve(queries.size());
+            for (const CCoordinateGeodetic &query : std::as_const(queries)) { closest.push_back(airports.findClosestWithinRange(query, range)); }
+            const qint64 closestLinearNs = timer.nsecsElapsed();
+
+            timer.start();
+            for (int i = 0; i < queries.size(); i++)
+            {
+                if (airports.findClosestWithinRange(queries[i], range, index) == closest[i]) { same++; }
+            }
+            const qint64 closestIndexedNs = timer.nsecsElapsed();
+
+            out << numberOfQueries << " x findClosestWithinRange " << range.valueRoundedWithUnit() << ": linear " << (closestLinearNs / 1000000) << "ms, indexed " << (closestIndexedNs / 1000000)
+                << "ms (" << same << " same results)" << Qt::endl;
+        }
+
+        // closest airports, as ISimulator::getAirportsInRange
+        for (int number : { 20, 100 })
+        {
+            int found = 0;
+            timer.start();
+            for (const CCoordinateGeodetic &query : std::as_const(queries)) { found += airports.findClosest(number, query).size(); }
+            const qint64 linearNs = timer.nsecsElapsed();
+
+            int foundIndexed = 0;
+            timer.start();
+            for (const CCoordinateGeodetic &query : std::as_const(queries)) { foundIndexed += airports.findClosest(number, query, index).size(); }
+            const qint64 indexedNs = timer.nsecsElapsed();
+
+            out << numberOfQueries << " x findClosest " << number << ": linear " << (linearNs / 1000000) << "ms, indexed " << (indexedNs / 1000000)
+                << "ms (" << found << "/" << foundIndexed << " airports)" << Qt::endl;
+        }
+
+        out << Qt::endl;
+        return EXIT_SUCCESS;
+    }
+
+    int CSamplesPerformance::samplesAircraftKinematicsReplay(QTextStream &out, int numberOfAircraft, int seconds)
+    {
+        //! Provider allowing to add aircraft
+        class CReplayProvider : public CRemoteAircraftProvider
+        {
+        public:
+            CReplayProvider() : CRemoteAircraftProvider(nullptr) {}
+            using CRemoteAircraftProvider::addNewAircraftInRange;
+        };
+
+        // one second of position packets, 5 per aircraft
+        constexpr int updatesPerSecond = 5;
+        QVector<CAircraftSituation> situations;
+        situations.reserve(numberOfAircraft * updatesPerSecond);
+        CReplayProvider mapProvider;
+        CReplayProvider typedProvider;
+        for (int cs = 0; cs < numberOfAircraft; cs++)
+        {
+            const CCallsign callsign("CS" + QString::number(cs));
+            CSimulatedAircraft aircraft;
+            aircraft.setCallsign(callsign);
+            mapProvider.addNewAircraftInRange(aircraft);
+            typedProvider.addNewAircraftInRange(aircraft);
+            for (int u = 0; u < updatesPerSecond; u++)
+            {
+                CAircraftSituation situation(callsign, CCoordinateGeodetic(-60.0 + (cs % 120) + 0.001 * u, -170.0 + (cs % 340), 5000.0));
+                situation.setGroundSpeed(CSpeed(250, CSpeedUnit::kts()));
+                situations.push_back(situation);
+            }
+        }
+        const CTransponder transponder(2000, CTransponder::ModeC);
+        const CLength distance(25, CLengthUnit::NM());
+        const CAngle bearing(45, CAngleUnit::deg());
+        const int updates = situations.size() * seconds;
+        out << "Kinematics replay: " << numberOfAircraft << " aircraft at " << updatesPerSecond << "Hz, " << seconds << "s, " << updates << " updates" << Qt::endl;
+
+        QElapsedTimer timer;
+        timer.start();
+        for (int s = 0; s < seconds; s++)
+        {
+            for (const CAircraftSituation &situation : std::as_const(situations))
+            {
+                CPropertyIndexVariantMap vm;
+                vm.addValue(CSimulatedAircraft::IndexTransponder, transponder);
+                vm.addValue(CSimulatedAircraft::IndexSituation, situation);
+                vm.addValue(CSimulatedAircraft::IndexRelativeDistance, distance);
+                vm.addValue(CSimulatedAircraft::IndexRelativeBearing, bearing);
+                mapProvider.updateAircraftInRange(situation.getCallsign(), vm);
+            }
+        }
+        const qint64 mapNs = qMax(timer.nsecsElapsed(), 1LL);
+
+        timer.start();
+        for (int s = 0; s < seconds; s++)
+        {
+            for (const CAircraftSituation &situation : std::as_const(situations))
+            {
+                typedProvider.updateAircraftKinematics(situation.getCallsign(), situation, transponder, distance, bearing);
+            }
+        }
+        const qint64 typedNs = qMax(timer.nsecsElapsed(), 1LL);
+
+        const bool same = mapProvider.getAircraftInRange() == typedProvider.getAircraftInRange();
+        out << "property index map: " << (mapNs / 1000000) << "ms, " << (mapNs / updates) << "ns/update" << Qt::endl;
+        out << "typed update:       " << (typedNs / 1000000) << "ms, " << (typedNs / updates) << "ns/update" << Qt::endl;
+        out << "same aircraft: " << boolToYesNo(same) << Qt::endl;
+        out << Qt::endl;
+        return EXIT_SUCCESS;
+    }
+
+    CSamplesPerformance::StressResult CSamplesPerformance::situationsStress(const QVector<CCallsign> &callsigns, int seconds,
+                                                                            const std::function<qint64(const CAircraftSituation &)> &writer,
+                                                                            const std::function<qint64(const CCallsign &)> &reader)
+    {
+        StressResult result;
+        std::atomic_bool stop { false };
+
+        std::thread writerThread([&] {
+            int position = 0;
+            while (!stop)
+            {
+                QElapsedTimer cycle;
+                cycle.start();
+                const qint64 now = QDateTime::currentMSecsSinceEpoch();
+                position++;
+                for (const CCallsign &callsign : callsigns)
+                {
+                    CAircraftSituation situation(callsign, CCoordinateGeodetic(position * 0.0001, position * 0.0001, 1000));
+                    situation.setMSecsSinceEpoch(now);
+                    situation.setTimeOffsetMs(200);
+                    QElapsedTimer timer;
+                    timer.start();
+                    result.writerLockNs += writer(situation);
+                    result.writerNs += timer.nsecsElapsed();
+                    result.writes++;
+                }
+                const qint64 sleepMs = 200 - cycle.elapsed(); // 5Hz
+                if (sleepMs > 0) { QThread::msleep(static_cast<unsigned long>(sleepMs)); }
+            }
+        });
+
+        QElapsedTimer runTimer;
+        runTimer.start();
+        while (runTimer.elapsed() < seconds * 1000)
+        {
+            QElapsedTimer frame;
+            frame.start();
+            for (const CCallsign &callsign : callsigns) { result.readerLockNs += reader(callsign); }
+            const qint64 frameNs = frame.nsecsElapsed();
+            result.frameNs.push_back(frameNs);
+            const qint64 sleepMs = 16 - frameNs / 1000000; // 60Hz
+            if (sleepMs > 0) { QThread::msleep(static_cast<unsigned long>(sleepMs)); }
+        }
+
+        stop = true;
+        writerThread.join();
+        return result;
+    }
+
+    void CSamplesPerformance::printStressResult(QTextStream &out, const QString &name, StressResult &result)
+    {
+        if (result.frameNs.isEmpty() || result.writes < 1) { return; }
+        std::sort(result.frameNs.begin(), result.frameNs.end());
+        const int frames = result.frameNs.size();
+        const qint64 p50 = result.frameNs[frames / 2];
+        const qint64 p99 = result.frameNs[qMin(frames - 1, frames * 99 / 100)];
+        const qint64 max = result.frameNs.last();
+
+        out << name << ": " << frames << " frames, " << result.writes << " writes" << Qt::endl;
+        out << "  reader frame p50/p99/max: " << p50 / 1000 << "/" << p99 / 1000 << "/" << max / 1000 << "us" << Qt::endl;
+        out << "  reader lock wait: " << result.readerLockNs / 1000000 << "ms total, " << result.readerLockNs / frames << "ns per frame" << Qt::endl;
+        out << "  writer lock wait: " << result.writerLockNs / 1000000 << "ms total, writer " << result.writerNs / result.writes << "ns per update" << Qt::endl;
+    }
+
     CAircraftSituationList CSamplesPerformance::createSituations(qint64 baseTimeEpoch, int numberOfCallsigns, int numberOfTimes)
     {
         CAircraftSituationList situations;
@@ -721,6 +1109,377 @@ namespace BlackSample
         return models;
     }
 
+    int CSamplesPerformance::samplesVatsimDataFileStreaming(QTextStream &out, const QString &recordedFile)
+    {
+        QByteArray data;
+        if (recordedFile.isEmpty())
+        {
+            data = CSamplesPerformance::generateVatsimDataFile(6000, 400);
+            out << "Generated VATSIM data file: " << data.size() / 1024 << "kB" << Qt::endl;
+        }
+        else
+        {
+            QFile file(recordedFile);
+            if (!file.open(QIODevice::ReadOnly))
+            {
+                out << "Cannot open " << recordedFile << Qt::endl;
+                return EXIT_FAILURE;
+            }
+            data = file.readAll();
+            out << "Recorded VATSIM data file " << recordedFile << ": " << data.size() / 1024 << "kB" << Qt::endl;
+        }
+
+        // streaming first, so it cannot profit from memory kept by the allocator after the DOM run
+        QElapsedTimer timer;
+        qint64 baseRss = CSamplesPerformance::resetPeakRssKb();
+        timer.start();
+        int pilots = 0;
+        int stations = 0;
+        QString timestamp;
+        CJsonStreamReader reader;
+        reader.onValue("general", [&](const QJsonValue &general) { timestamp = general["update_timestamp"].toString(); return true; });
+        reader.onArrayObject("pilots", [&](const QJsonObject &pilot) { pilots += CCallsign(pilot["callsign"].toString()).isEmpty() ? 0 : 1; return true; });
+        reader.onArrayObject("controllers", [&](const QJsonObject &controller) { stations += CCallsign(controller["callsign"].toString()).isEmpty() ? 0 : 1; return true; });
+        reader.onArrayObject("atis", [&](const QJsonObject &atis) { stations += CCallsign(atis["callsign"].toString()).isEmpty() ? 0 : 1; return true; });
+        const bool parsed = reader.parse(data);
+        qint64 ms = timer.elapsed();
+        qint64 peakRss = CSamplesPerformance::peakRssKb();
+        out << "Streaming: " << (parsed ? QStringLiteral("ok") : reader.getLastError()) << " " << pilots << " pilots " << stations << " stations in " << ms << "ms, peak RSS +"
+            << (baseRss < 0 ? QStringLiteral("n/a") : QString::number(peakRss - baseRss) + "kB") << Qt::endl;
+
+        // like before: QString conversion and DOM of the whole file
+        pilots = 0;
+        stations = 0;
+        baseRss = CSamplesPerformance::resetPeakRssKb();
+        timer.start();
+        {
+            const QString dataFileData = data;
+            const QJsonDocument jsonDoc = QJsonDocument::fromJson(dataFileData.toUtf8());
+            timestamp = jsonDoc["general"]["update_timestamp"].toString();
+            for (const QJsonValue &pilot : jsonDoc["pilots"].toArray()) { pilots += CCallsign(pilot["callsign"].toString()).isEmpty() ? 0 : 1; }
+            for (const QJsonValue &controller : jsonDoc["controllers"].toArray()) { stations += CCallsign(controller["callsign"].toString()).isEmpty() ? 0 : 1; }
+            for (const QJsonValue &atis : jsonDoc["atis"].toArray()) { stations += CCallsign(atis["callsign"].toString()).isEmpty() ? 0 : 1; }
+        }
+        ms = timer.elapsed();
+        peakRss = CSamplesPerformance::peakRssKb();
+        out << "DOM:       " << pilots << " pilots " << stations << " stations in " << ms << "ms, peak RSS +"
+            << (baseRss < 0 ? QStringLiteral("n/a") : QString::number(peakRss - baseRss) + "kB") << Qt::endl;
+
+        return EXIT_SUCCESS;
+    }
+
+    int CSamplesPerformance::samplesMemoizedModelsJson(QTextStream &out, int numberOfModels)
+    {
+        CAircraftModelList models = createModels(numberOfModels, numberOfModels / 10);
+        out << "Created " << models.size() << " models with " << numberOfModels / 10 << " aircraft ICAO codes, liveries and distributors" << Qt::endl;
+
+        // memo tables only, ordered map like before vs. hash index
+        QElapsedTimer timer;
+        timer.start();
+        {
+            QMap<CAircraftIcaoCode, int> aircraftIcaos;
+            QMap<CLivery, int> liveries;
+            QMap<CDistributor, int> distributors;
+            for (const CAircraftModel &model : std::as_const(models))
+            {
+                aircraftIcaos.insert(model.getAircraftIcaoCode(), aircraftIcaos.size());
+                liveries.insert(model.getLivery(), liveries.size());
+                distributors.insert(model.getDistributor(), distributors.size());
+            }
+        }
+        out << "Memo tables (QMap):     " << timer.elapsed() << "ms" << Qt::endl;
+
+        timer.start();
+        {
+            CMemoTable<CAircraftIcaoCode> aircraftIcaos;
+            CMemoTable<CLivery> liveries;
+            CMemoTable<CDistributor> distributors;
+            for (const CAircraftModel &model : std::as_const(models))
+            {
+                aircraftIcaos.getIndex(model.getAircraftIcaoCode());
+                liveries.getIndex(model.getLivery());
+                distributors.getIndex(model.getDistributor());
+            }
+        }
+        out << "Memo tables (hash):     " << timer.elapsed() << "ms" << Qt::endl;
+
+        // like the model set cache: memoized JSON written to and read from a string
+        timer.start();
+        const QByteArray data = QJsonDocument(models.toMemoizedJson()).toJson(QJsonDocument::Compact);
+        out << "Save memoized JSON:     " << timer.elapsed() << "ms " << data.size() / 1024 << "kB" << Qt::endl;
+
+        timer.start();
+        CAircraftModelList loaded;
+        loaded.convertFromMemoizedJson(QJsonDocument::fromJson(data).object(), false);
+        out << "Load memoized JSON:     " << timer.elapsed() << "ms " << loaded.size() << " models" << Qt::endl;
+        out << "Loaded models equal: " << boolToYesNo(loaded == models) << Qt::endl;
+
+        return EXIT_SUCCESS;
+    }
+
+    int CSamplesPerformance::samplesModelCacheFormats(QTextStream &out, int numberOfModels)
+    {
+        const QTemporaryDir tempDir;
+        if (!tempDir.isValid())
+        {
+            out << "Cannot create temporary directory" << Qt::endl;
+            return EXIT_FAILURE;
+        }
+
+        const QString key("modelsetbenchmark");
+        const CAircraftModelList models = createModels(numberOfModels, numberOfModels / 10);
+        out << "Created " << models.size() << " models" << Qt::endl;
+
+        QElapsedTimer timer;
+        for (const bool binary : { false, true })
+        {
+            const QString dir = CFileUtils::appendFilePaths(tempDir.path(), binary ? "binary" : "json");
+            qint64 saveMs = 0;
+            {
+                CValueCache cache(1);
+                cache.setBinaryFiles(binary);
+                cache.insertValues({ CVariantMap { { key, CVariant::from(models) } }, QDateTime::currentMSecsSinceEpoch() });
+                timer.start();
+                cache.saveToFiles(dir);
+                saveMs = timer.elapsed();
+            }
+
+            // new cache, like at the start of the application
+            CValueCache cache(1);
+            timer.start();
+            const CStatusMessage status = cache.loadFromFiles(dir);
+            const CAircraftModelList loaded = cache.getAllValues().value(key).to<CAircraftModelList>();
+            const qint64 loadMs = timer.elapsed();
+            const qint64 fileSize = QFileInfo(CFileUtils::appendFilePaths(dir, cache.filenameForKey(key))).size();
+            out << (binary ? "Binary: " : "JSON:   ") << "save " << saveMs << "ms, load " << loadMs << "ms, " << fileSize / 1024 << "kB, "
+                << loaded.size() << " models " << (status.isFailure() ? status.getMessage() : QString()) << Qt::endl;
+        }
+        out << "Note: the files are in the OS file cache, a real cold start also reads them from disk" << Qt::endl;
+        return EXIT_SUCCESS;
+    }
+
+    int CSamplesPerformance::samplesAirspaceSnapshots(QTextStream &out, int numberOfAircraft, int numberOfSnapshots)
+    {
+        QRandomGenerator random(4711);
+        const CAircraftModel airplane("B737", CAircraftModel::TypeUnknown, "", CAircraftIcaoCode("B737", "L2J"));
+        const CAircraftModel helicopter("EC35", CAircraftModel::TypeUnknown, "", CAircraftIcaoCode("EC35", "H2T"));
+        CSimulatedAircraftList aircraft;
+        for (int i = 0; i < numberOfAircraft; i++)
+        {
+            CSimulatedAircraft a(i % 10 == 0 ? helicopter : airplane);
+            a.setCallsign(CCallsign(QStringLiteral("DLH%1").arg(i)));
+            a.setRelativeDistance(CLength(random.bounded(200.0), CLengthUnit::NM()));
+            a.setEnabled(i % 20 != 0);
+            aircraft.push_back(a);
+        }
+
+        // aircraft move a bit between the snapshots
+        QVector<CSimulatedAircraftList> ticks;
+        for (int t = 0; t < 10; t++)
+        {
+            for (CSimulatedAircraft &a : aircraft)
+            {
+                const double nm = a.getRelativeDistance().value(CLengthUnit::NM()) + random.bounded(2.0) - 1.0;
+                a.setRelativeDistance(CLength(qMax(0.0, nm), CLengthUnit::NM()));
+            }
+            ticks.push_back(aircraft);
+        }
+
+        const int maxAircraft = 50;
+        const CLength maxDistance(100, CLengthUnit::NM());
+        QElapsedTimer timer;
+        int enabled = 0;
+        timer.start();
+        for (int s = 0; s < numberOfSnapshots; s++)
+        {
+            // what the snapshot constructor did before, copy, sort and find
+            CSimulatedAircraftList sorted(ticks[s % ticks.size()]);
+            sorted.sortByDistanceToReferencePositionRenderedCallsign();
+            const CCallsignSet vtol = sorted.findBy(&CSimulatedAircraft::isVtol, true).getCallsigns();
+            CCallsignSet enabledCallsigns;
+            for (const CSimulatedAircraft &a : std::as_const(sorted))
+            {
+                if (enabledCallsigns.size() >= maxAircraft) { break; }
+                if (a.isEnabled() && a.getRelativeDistance() < maxDistance) { enabledCallsigns.push_back(a.getCallsign()); }
+            }
+            enabled += enabledCallsigns.size() + (vtol.isEmpty() ? 0 : 1);
+        }
+        const qint64 rebuildMs = timer.elapsed();
+
+        int enabledIncremental = 0;
+        int changes = 0;
+        CAirspaceAircraftSnapshotBuilder builder;
+        timer.start();
+        for (int s = 0; s < numberOfSnapshots; s++)
+        {
+            const CAirspaceAircraftSnapshot snapshot = builder.buildSnapshot(ticks[s % ticks.size()], true, true, maxAircraft, maxDistance);
+            enabledIncremental += snapshot.getEnabledAircraftCallsignsByDistance().size() + (snapshot.getVtolAircraftCallsignsByDistance().isEmpty() ? 0 : 1);
+            changes += snapshot.getChangedCallsigns().size();
+        }
+        const qint64 incrementalMs = timer.elapsed();
+
+        out << numberOfSnapshots << " snapshots of " << numberOfAircraft << " aircraft, max. " << maxAircraft << " rendered" << Qt::endl;
+        out << "Rebuild: " << rebuildMs << "ms, incremental: " << incrementalMs << "ms (" << enabled << "/" << enabledIncremental << " enabled)" << Qt::endl;
+        out << "Changed callsigns per snapshot: " << (changes / qMax(1, numberOfSnapshots)) << Qt::endl;
+        return EXIT_SUCCESS;
+    }
+
+    int CSamplesPerformance::samplesAircraftInRangeDeltas(QTextStream &out, int numberOfAircraft, int numberOfTicks)
+    {
+        const auto serialize = [](const CVariant &value) {
+            QByteArray bytes;
+            QDataStream stream(&bytes, QIODevice::WriteOnly);
+            stream << value;
+            return bytes;
+        };
+        const auto deserialize = [](const QByteArray &bytes) {
+            CVariant value;
+            QDataStream stream(bytes);
+            stream >> value;
+            return value;
+        };
+
+        QRandomGenerator random(4711);
+        const CAircraftModelList models = createModels(numberOfAircraft, 50);
+        CSimulatedAircraftList aircraft;
+        for (int i = 0; i < numberOfAircraft; i++)
+        {
+            CSimulatedAircraft a(models[i]);
+            a.setCallsign(CCallsign(QStringLiteral("DLH%1").arg(i)));
+            a.setPosition(CCoordinateGeodetic(random.bounded(10.0) + 45.0, random.bounded(10.0) + 5.0, 10000.0));
+            a.setRelativeDistance(CLength(random.bounded(200.0), CLengthUnit::NM()));
+            a.setNetworkModel(models[i]);
+            aircraft.push_back(a);
+        }
+
+        // every tick (0.5s) all aircraft move, some change parts/transponder, every 10th tick one aircraft is replaced
+        QVector<CSimulatedAircraftList> ticks;
+        for (int t = 0; t < numberOfTicks; t++)
+        {
+            for (CSimulatedAircraft &a : aircraft)
+            {
+                a.setPosition(CCoordinateGeodetic(a.latitude().value(CAngleUnit::deg()) + 0.001, a.longitude().value(CAngleUnit::deg()), 10000.0));
+                a.setRelativeDistance(CLength(random.bounded(200.0), CLengthUnit::NM()));
+            }
+            for (int c = 0; c < numberOfAircraft / 50; c++) { aircraft[random.bounded(numberOfAircraft)].setTransponderCode(random.bounded(7777)); }
+            if (t % 10 == 0)
+            {
+                CSimulatedAircraft replaced(aircraft.front());
+                aircraft.pop_front();
+                replaced.setCallsign(CCallsign(QStringLiteral("EZY%1").arg(t)));
+                aircraft.push_back(replaced);
+            }
+            ticks.push_back(aircraft);
+        }
+
+        // full list: core marshals the list, GUI unmarshals it
+        QElapsedTimer timer;
+        qint64 fullBytes = 0;
+        qint64 fullCoreNs = 0;
+        qint64 fullGuiNs = 0;
+        int received = 0;
+        for (const CSimulatedAircraftList &tick : std::as_const(ticks))
+        {
+            timer.start();
+            const QByteArray bytes = serialize(CVariant::from(tick));
+            fullCoreNs += timer.nsecsElapsed();
+            fullBytes += bytes.size();
+
+            timer.start();
+            received += deserialize(bytes).to<CSimulatedAircraftList>().size();
+            fullGuiNs += timer.nsecsElapsed();
+        }
+
+        // deltas: core diffs against the previous tick and marshals the delta, GUI unmarshals and applies it
+        qint64 deltaBytes = 0;
+        qint64 deltaCoreNs = 0;
+        qint64 deltaGuiNs = 0;
+        CSimulatedAircraftList published = ticks.front();
+        CSimulatedAircraftList replica = ticks.front(); // initial snapshot not counted
+        for (int t = 1; t < ticks.size(); t++)
+        {
+            timer.start();
+            const CSimulatedAircraftListDelta delta = CSimulatedAircraftListDelta::fromDiff(published, ticks[t]);
+            published = ticks[t];
+            const QByteArray bytes = serialize(CVariant::from(SharedState::CDeltaEvent(t, false, CVariant::from(delta))));
+            deltaCoreNs += timer.nsecsElapsed();
+            deltaBytes += bytes.size();
+
+            timer.start();
+            deserialize(bytes).to<SharedState::CDeltaEvent>().getValue().to<CSimulatedAircraftListDelta>().applyTo(replica);
+            deltaGuiNs += timer.nsecsElapsed();
+        }
+
+        const double seconds = numberOfTicks * 0.5;
+        out << numberOfTicks << " ticks (2Hz) of " << numberOfAircraft << " aircraft in range" << Qt::endl;
+        out << "Full list: " << qRound(fullBytes / seconds / 1024) << "kB/s, core " << fullCoreNs / 1000000 << "ms, GUI " << fullGuiNs / 1000000 << "ms (" << received / numberOfTicks << " aircraft per tick)" << Qt::endl;
+        out << "Deltas: " << qRound(deltaBytes / seconds / 1024) << "kB/s, core " << deltaCoreNs / 1000000 << "ms, GUI " << deltaGuiNs / 1000000 << "ms" << Qt::endl;
+        out << "Replica equals last tick: " << boolToYesNo(replica == ticks.back()) << Qt::endl;
+        return EXIT_SUCCESS;
+    }
+
+    QByteArray CSamplesPerformance::generateVatsimDataFile(int numberOfPilots, int numberOfControllers)
+    {
+        static const QString pilotJson(R"({"cid":%1,"name":"Pilot %1 EDDM","callsign":"%2","server":"GERMANY","pilot_rating":1,"latitude":%3,"longitude":%4,"altitude":%5,"groundspeed":%6,"transponder":"%7","heading":%8,"qnh_i_hg":29.92,"qnh_mb":1013,)"
+                                      R"("flight_plan":{"flight_rules":"I","aircraft":"A320/M-SDE2E3FGHIJ1RWXY/LB1","aircraft_faa":"H/A320/L","aircraft_short":"A320","departure":"EDDM","arrival":"EGLL","alternate":"EGKK","cruise_tas":"450","altitude":"36000",)"
+                                      R"("deptime":"1200","enroute_time":"0145","fuel_time":"0330","remarks":"PBN/A1B1C1D1O1S1 DOF/230101 REG/DAIAB EET/EDUU0010 EBUR0050 RVR/200 OPR/DLH PER/C /V/","route":"MERSI2S MERSI DCT DKB UZ650 TOSPA DCT BOMBI UL984 MATUG","revision_id":1,"assigned_transponder":"1000"},)"
+                                      R"("logon_time":"2023-01-01T10:00:00.0000000Z","last_updated":"2023-01-01T12:00:00.0000000Z"})");
+        static const QString controllerJson(R"({"cid":%1,"name":"Controller %1","callsign":"%2_CTR","frequency":"1%3.%4","facility":6,"rating":5,"server":"GERMANY","visual_range":300,)"
+                                           R"("text_atis":["Controller %2 center","For charts visit https://example.com","Feedback welcome"],"last_updated":"2023-01-01T12:00:00.0000000Z","logon_time":"2023-01-01T10:00:00.0000000Z"})");
+
+        QByteArray data;
+        data.reserve(numberOfPilots * 1000 + numberOfControllers * 400);
+        data.append(R"({"general":{"version":3,"reload":1,"update":"20230101120000","update_timestamp":"2023-01-01T12:00:00.0000000Z","connected_clients":)");
+        data.append(QByteArray::number(numberOfPilots + numberOfControllers));
+        data.append(R"(,"unique_users":)");
+        data.append(QByteArray::number(numberOfPilots + numberOfControllers));
+        data.append(R"(},"pilots":[)");
+        for (int p = 0; p < numberOfPilots; p++)
+        {
+            if (p > 0) { data.append(','); }
+            const QString cs = QStringLiteral("DLH%1").arg(p);
+            data.append(pilotJson.arg(1000000 + p).arg(cs).arg(CMathUtils::randomDouble(180) - 90.0).arg(CMathUtils::randomDouble(360) - 180.0).arg(CMathUtils::randomInteger(0, 40000)).arg(CMathUtils::randomInteger(0, 500)).arg(CMathUtils::randomInteger(1000, 7777)).arg(CMathUtils::randomInteger(0, 359)).toUtf8());
+        }
+        data.append(R"(],"controllers":[)");
+        for (int c = 0; c < numberOfControllers; c++)
+        {
+            if (c > 0) { data.append(','); }
+            data.append(controllerJson.arg(2000000 + c).arg(QStringLiteral("EDMM%1").arg(c)).arg(18 + c % 20).arg(c % 1000, 3, 10, QChar('0')).toUtf8());
+        }
+        data.append(R"(],"atis":[],"servers":[],"prefiles":[],"facilities":[],"ratings":[],"pilot_ratings":[]})");
+        return data;
+    }
+
+    qint64 CSamplesPerformance::resetPeakRssKb()
+    {
+#ifdef Q_OS_LINUX
+        // writing 5 to clear_refs resets the peak RSS to the current RSS
+        QFile clearRefs("/proc/self/clear_refs");
+        if (!clearRefs.open(QIODevice::WriteOnly) || clearRefs.write("5") != 1) { return -1; }
+        clearRefs.close();
+        return CSamplesPerformance::peakRssKb();
+#else
+        return -1;
+#endif
+    }
+
+    qint64 CSamplesPerformance::peakRssKb()
+    {
+#ifdef Q_OS_LINUX
+        QFile status("/proc/self/status");
+        if (!status.open(QIODevice::ReadOnly | QIODevice::Text)) { return -1; }
+        const QList<QByteArray> lines = status.readAll().split('\n');
+        for (const QByteArray &line : lines)
+        {
+            if (!line.startsWith("VmHWM:")) { continue; }
+            return line.mid(6).trimmed().split(' ').first().toLongLong();
+        }
+        return -1;
+#else
+        return -1;
+#endif
+    }
+
     void CSamplesPerformance::calculateDistance(int n)
     {
         if (n < 1) { return; }
@@ -15,6 +15,8 @@
 #include <QtGlobal>
 #include <QMap>
 #include <QHash>
+#include <QVector>
+#include <functional>
 
 class QTextStream;
 
@@ -48,9 +50,66 @@ namespace BlackSample
         //! Callsign based hash/map comparison
         static int sampleQMapVsQHashByCallsign(QTextStream &out);
 
+        //! Remote aircraft situations, writers at 5Hz vs. a 60Hz reader (global lock vs. snapshots)
+        static int samplesRemoteAircraftSituationsStress(QTextStream &out, int numberOfCallsigns, int seconds);
+
+        //! Interpolations per second, linear vs. spline
+        static int samplesSituationInterpolation(QTextStream &out, int numberOfAircraft, int numberOfFrames);
+
+        //! Range queries on the DB airports, linear search vs. spatial index
+        static int samplesAirportsSpatialIndex(QTextStream &out, int numberOfQueries);
+
+        //! Replay of position updates at 5Hz, property index map vs. typed update
+        static int samplesAircraftKinematicsReplay(QTextStream &out, int numberOfAircraft, int seconds);
+
+        //! Parse time and peak RSS of the VATSIM data file, DOM vs. streaming
+        //! \remark uses the given recorded data file, or a generated one of about 5MB if empty
+        static int samplesVatsimDataFileStreaming(QTextStream &out, const QString &recordedFile);
+
+        //! Memoized JSON of a model list, memo tables and save/load like the model set cache
+        static int samplesMemoizedModelsJson(QTextStream &out, int numberOfModels);
+
+        //! Save and load of a model set with the value cache, JSON vs. binary files
+        static int samplesModelCacheFormats(QTextStream &out, int numberOfModels);
+
+        //! Restricted airspace snapshots, full rebuild vs. incremental builder
+        static int samplesAirspaceSnapshots(QTextStream &out, int numberOfAircraft, int numberOfSnapshots);
+
+        //! Aircraft in range for a remote GUI, polling the full list vs. deltas at 2Hz
+        //! \remark bytes as serialized with QDataStream, as estimate of the DBus traffic
+        static int samplesAircraftInRangeDeltas(QTextStream &out, int numberOfAircraft, int numberOfTicks);
+
     private:
         static const qint64 DeltaTime = 10;
 
+        //! Results of one stress run
+        struct StressResult
+        {
+            QVector<qint64> frameNs; //!< reader time per frame (all callsigns)
+            qint64 readerLockNs = 0; //!< reader time waiting for locks
+            qint64 writerLockNs = 0; //!< writer time waiting for locks
+            qint64 writerNs = 0; //!< writer time in total
+            int writes = 0; //!< number of stored situations
+        };
+
+        //! Run writers at 5Hz and a reader at 60Hz
+        //! \remark the functors return the time spent waiting for locks in ns
+        static StressResult situationsStress(const QVector<BlackMisc::Aviation::CCallsign> &callsigns, int seconds,
+                                             const std::function<qint64(const BlackMisc::Aviation::CAircraftSituation &)> &writer,
+                                             const std::function<qint64(const BlackMisc::Aviation::CCallsign &)> &reader);
+
+        //! Print the stress results
+        static void printStressResult(QTextStream &out, const QString &name, StressResult &result);
+
+        //! VATSIM data file (v3 JSON format) with the given number of pilots and controllers
+        static QByteArray generateVatsimDataFile(int numberOfPilots, int numberOfControllers);
+
+        //! Reset the peak RSS, returns the current RSS in kB, -1 if not supported
+        static qint64 resetPeakRssKb();
+
+        //! Peak RSS in kB since last reset, -1 if not supported
+        static qint64 peakRssKb();
+
         //! Situation values for testing
         static BlackMisc::Aviation::CAircraftSituationList createSituations(qint64 baseTimeEpoch, int numberOfCallsigns, int numberOfTimes);
 
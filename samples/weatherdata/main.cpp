@@ -32,12 +32,14 @@ int main(int argc, char *argv[])
     CLineReader lineReader(&a);
     CWeatherDataPrinter printer(&a);
     QObject::connect(&lineReader, &CLineReader::weatherDataRequest, &printer, &CWeatherDataPrinter::fetchAndPrintWeatherData);
+    QObject::connect(&lineReader, &CLineReader::benchmarkRequest, &printer, &CWeatherDataPrinter::benchmarkGribFixture);
     QObject::connect(&lineReader, &CLineReader::wantsToQuit, &lineReader, &CLineReader::terminate);
     QObject::connect(&lineReader, &CLineReader::finished, &a, &QCoreApplication::quit);
 
     QTextStream qtout(stdout);
     qtout << "Usage: <lat> <lon>" << Qt::endl;
     qtout << "Example: 48.5 11.5" << Qt::endl;
+    qtout << "Type b [iterations] to benchmark decoding the bundled GRIB test file" << Qt::endl;
     qtout << "Type x to quit" << Qt::endl;
 
     lineReader.start();
@@ -40,7 +40,17 @@ void CLineReader::run()
         }
 
         const QStringList parts = line.split(' ');
-        if (parts.size() == 2)
+        if (parts.front() == "b" && parts.size() <= 2)
+        {
+            const int iterations = parts.size() == 2 ? parts.back().toInt() : 10;
+            if (iterations > 0)
+            {
+                emit benchmarkRequest(iterations);
+                continue;
+            }
+        }
+
+        if (parts.size() == 2 && parts.front() != "b")
         {
             const CLatitude latitude(CAngle::parsedFromString(parts.front(), CPqString::SeparatorBestGuess, CAngleUnit::deg()));
             const CLongitude longitude(CAngle::parsedFromString(parts.back(), CPqString::SeparatorBestGuess, CAngleUnit::deg()));
@@ -54,6 +64,7 @@ void CLineReader::run()
             QTextStream qtout(stdout);
             qtout << "Invalid command." << Qt::endl;
             qtout << "Usage: <lat> <lon>" << Qt::endl;
+            qtout << "       b [iterations]" << Qt::endl;
         }
     }
 }
@@ -31,6 +31,9 @@ signals:
     //! User is asking for weather data
     void weatherDataRequest(const BlackMisc::Geo::CCoordinateGeodetic &position);
 
+    //! User is asking to benchmark decoding the bundled GRIB file
+    void benchmarkRequest(int iterations);
+
     //! User is asking to quit
     void wantsToQuit();
 };
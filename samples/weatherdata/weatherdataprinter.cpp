@@ -10,6 +10,7 @@
 
 #include "weatherdataprinter.h"
 #include "blackmisc/aviation/altitude.h"
+#include "blackmisc/fileutils.h"
 #include "blackmisc/geo/latitude.h"
 #include "blackmisc/geo/longitude.h"
 #include "blackmisc/pq/angle.h"
@@ -19,6 +20,7 @@
 #include "blackmisc/pq/temperature.h"
 #include "blackmisc/range.h"
 #include "blackmisc/sequence.h"
+#include "blackmisc/swiftdirectories.h"
 #include "blackmisc/weather/cloudlayer.h"
 #include "blackmisc/weather/cloudlayerlist.h"
 #include "blackmisc/weather/gridpoint.h"
@@ -29,6 +31,8 @@
 
 #include <stdio.h>
 #include <QTextStream>
+#include <algorithm>
+#include <numeric>
 
 using namespace BlackMisc;
 using namespace BlackMisc::Weather;
@@ -52,7 +56,51 @@ void CWeatherDataPrinter::fetchAndPrintWeatherData(const CCoordinateGeodetic &po
 void CWeatherDataPrinter::printWeatherData(const CWeatherGrid &weatherGrid)
 {
     QTextStream qtout(stdout);
-    qtout << "... finished." << endl;
+    qtout << "... finished." << Qt::endl;
     qtout << weatherGrid.getDescription();
-    qtout << endl;
+    qtout << Qt::endl;
+}
+
+void CWeatherDataPrinter::benchmarkGribFixture(int iterations)
+{
+    QTextStream qtout(stdout);
+    if (m_benchmarkIterations > 0)
+    {
+        qtout << "Benchmark already running" << Qt::endl;
+        return;
+    }
+    qtout << "Decoding GRIB fixture " << iterations << " times..." << Qt::endl;
+    m_benchmarkIterations = qMax(1, iterations);
+    m_benchmarkTimesMs.clear();
+    this->benchmarkNextIteration();
+}
+
+void CWeatherDataPrinter::benchmarkNextIteration()
+{
+    // a few grid points spread around the world
+    static const CWeatherGrid weatherGrid {
+        { "EDDM", CCoordinateGeodetic(48.35, 11.78) },
+        { "KJFK", CCoordinateGeodetic(40.64, -73.78) },
+        { "YSSY", CCoordinateGeodetic(-33.95, 151.18) }
+    };
+    static const QString fixture = CFileUtils::appendFilePaths(CSwiftDirectories::testFilesDirectory(), "gfs.grib2");
+    m_benchmarkTimer.start();
+    m_weatherManger.requestWeatherGridFromFile(fixture, weatherGrid, { this, &CWeatherDataPrinter::benchmarkIterationFinished });
+}
+
+void CWeatherDataPrinter::benchmarkIterationFinished(const CWeatherGrid &weatherGrid)
+{
+    m_benchmarkTimesMs.push_back(m_benchmarkTimer.elapsed());
+    if (m_benchmarkTimesMs.size() < m_benchmarkIterations)
+    {
+        this->benchmarkNextIteration();
+        return;
+    }
+
+    const qint64 totalMs = std::accumulate(m_benchmarkTimesMs.cbegin(), m_benchmarkTimesMs.cend(), qint64(0));
+    const qint64 minMs = *std::min_element(m_benchmarkTimesMs.cbegin(), m_benchmarkTimesMs.cend());
+    QTextStream qtout(stdout);
+    qtout << "Grid points: " << weatherGrid.size() << Qt::endl;
+    qtout << "Iterations: " << m_benchmarkTimesMs.size() << " min: " << minMs << "ms avg: " << (totalMs / m_benchmarkTimesMs.size()) << "ms" << Qt::endl;
+    m_benchmarkIterations = 0;
 }
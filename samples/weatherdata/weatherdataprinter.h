@@ -11,7 +11,9 @@
 #include "blackmisc/geo/coordinategeodetic.h"
 #include "blackmisc/weather/weathergrid.h"
 
+#include <QElapsedTimer>
 #include <QObject>
+#include <QVector>
 
 /*!
  * CWeatherDataPrinter fetches and prints weather data
@@ -27,11 +29,23 @@ public:
     //! Fetch new weather data for given position and print it once received
     void fetchAndPrintWeatherData(const BlackMisc::Geo::CCoordinateGeodetic &position);
 
+    //! Decode the bundled GRIB fixture n times and print the decoding times
+    void benchmarkGribFixture(int iterations);
+
 private:
     //! Print weather data to stdout
     void printWeatherData(const BlackMisc::Weather::CWeatherGrid &weatherGrid);
 
+    //! Next benchmark iteration
+    void benchmarkNextIteration();
+
+    //! One benchmark iteration finished
+    void benchmarkIterationFinished(const BlackMisc::Weather::CWeatherGrid &weatherGrid);
+
     BlackCore::CWeatherManager m_weatherManger { this };
+    QElapsedTimer m_benchmarkTimer; //!< time of the current iteration
+    QVector<qint64> m_benchmarkTimesMs; //!< times of finished iterations
+    int m_benchmarkIterations = 0; //!< requested iterations
 };
 
 #endif // guard
@@ -44,7 +44,7 @@ namespace BlackCore::Afv::Audio
         m_hfWhiteNoise->setLooping(true);
         m_hfWhiteNoise->setGain(0.0);
         m_acBusNoise = new CSawToothGenerator(400, m_mixer);
-        m_audioInput = new CBufferedWaveProvider(audioFormat, m_mixer);
+        m_audioInput = new CBufferedWaveProvider(audioFormat, 2000, m_mixer); // 2secs, far more than the max. delay and a few packets
 
         // Create the compressor
         m_simpleCompressorEffect = new CSimpleCompressorEffect(m_audioInput, m_mixer);
@@ -65,17 +65,17 @@ namespace BlackCore::Afv::Audio
         connect(m_timer, &QTimer::timeout, this, &CCallsignSampleProvider::timerElapsed);
     }
 
-    int CCallsignSampleProvider::readSamples(QVector<float> &samples, qint64 count)
+    int CCallsignSampleProvider::readSamples(float *samples, qint64 count)
     {
         const int noOfSamples = m_mixer->readSamples(samples, count);
 
-        if (m_inUse && m_lastPacketLatch && m_audioInput->getBufferedBytes() == 0)
+        if (m_inUse && m_lastPacketLatch && m_audioInput->getBufferedSamples() == 0)
         {
             idle();
             m_lastPacketLatch = false;
         }
 
-        if (m_inUse && !m_underflow && m_audioInput->getBufferedBytes() == 0)
+        if (m_inUse && !m_underflow && m_audioInput->getBufferedSamples() == 0)
         {
             if (verbose()) { CLogMessage(this).debug(u"[%1] [Delay++]") << m_callsign; }
             CallsignDelayCache::instance().underflow(m_callsign);
@@ -87,7 +87,7 @@ namespace BlackCore::Afv::Audio
 
     void CCallsignSampleProvider::timerElapsed()
     {
-        if (m_inUse && m_audioInput->getBufferedBytes() == 0 && m_lastSamplesAddedUtc.msecsTo(QDateTime::currentDateTimeUtc()) > m_idleTimeoutMs)
+        if (m_inUse && m_audioInput->getBufferedSamples() == 0 && m_lastSamplesAddedUtc.msecsTo(QDateTime::currentDateTimeUtc()) > m_idleTimeoutMs)
         {
             idle();
         }
@@ -108,8 +108,7 @@ namespace BlackCore::Afv::Audio
         if (delayMs > 0)
         {
             const int phaseDelayLength = (m_audioFormat.sampleRate() / 1000) * delayMs;
-            const QVector<float> phaseDelay(phaseDelayLength * 2, 0);
-            m_audioInput->addSamples(phaseDelay);
+            m_audioInput->addSilence(phaseDelayLength * 2);
         }
     }
 
@@ -36,7 +36,7 @@ namespace BlackCore::Afv::Audio
         CCallsignSampleProvider(const QAudioFormat &audioFormat, const BlackCore::Afv::Audio::CReceiverSampleProvider *receiver, QObject *parent = nullptr);
 
         //! Read samples
-        int readSamples(QVector<float> &samples, qint64 count) override;
+        int readSamples(float *samples, qint64 count) override;
 
         //! The callsign
         const QString &callsign() const { return m_callsign; }
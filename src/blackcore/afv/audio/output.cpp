@@ -9,7 +9,9 @@
 
 #include <QDebug>
 #include <QStringBuilder>
+#include <algorithm>
 #include <cmath>
+#include <cstring>
 
 using namespace BlackMisc;
 using namespace BlackMisc::Audio;
@@ -31,16 +33,19 @@ namespace BlackCore::Afv::Audio
         const int sampleBytes = m_outputFormat.sampleSize() / 8;
         const int channelCount = m_outputFormat.channelCount();
         const qint64 count = maxlen / (sampleBytes * channelCount);
-        QVector<float> buffer;
-        m_sampleProvider->readSamples(buffer, count);
+        if (count > m_buffer.size()) { m_buffer.resize(static_cast<int>(count)); } // no allocation once the max. size is reached
 
-        for (float sample : std::as_const(buffer))
+        float *buffer = m_buffer.data();
+        const int samplesRead = qMax(m_sampleProvider->readSamples(buffer, count), 0);
+        std::fill(buffer + samplesRead, buffer + count, 0.0f);
+
+        for (qint64 i = 0; i < count; i++)
         {
-            const float absSample = qAbs(sample);
+            const float absSample = qAbs(buffer[i]);
             if (absSample > m_maxSampleOutput) { m_maxSampleOutput = absSample; }
         }
 
-        m_sampleCount += buffer.size();
+        m_sampleCount += static_cast<int>(count);
         if (m_sampleCount >= SampleCountPerEvent)
         {
             OutputVolumeStreamArgs outputVolumeStreamArgs;
@@ -56,12 +61,23 @@ namespace BlackCore::Afv::Audio
             m_maxSampleOutput = 0;
         }
 
+        // mono to stereo directly into the device buffer
+        float *output = reinterpret_cast<float *>(data);
         if (channelCount == 2)
         {
-            buffer = convertFromMonoToStereo(buffer);
+            for (qint64 i = 0; i < count; i++)
+            {
+                output[2 * i] = buffer[i];
+                output[2 * i + 1] = buffer[i];
+            }
+        }
+        else
+        {
+            memcpy(output, buffer, static_cast<size_t>(count) * sizeof(float));
         }
 
-        memcpy(data, buffer.constData(), static_cast<size_t>(maxlen));
+        const qint64 written = count * channelCount * static_cast<qint64>(sizeof(float));
+        if (written < maxlen) { memset(data + written, 0, static_cast<size_t>(maxlen - written)); }
         return maxlen;
     }
 
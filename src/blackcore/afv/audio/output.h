@@ -50,6 +50,7 @@ namespace BlackCore::Afv::Audio
 
         static constexpr int SampleCountPerEvent = 4800;
         QAudioFormat m_outputFormat;
+        QVector<float> m_buffer; //!< mono samples, reused, only grows
         float m_maxSampleOutput = 0.0;
         int m_sampleCount = 0;
         const double m_maxDb = 0;
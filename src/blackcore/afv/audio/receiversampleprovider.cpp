@@ -84,7 +84,7 @@ namespace BlackCore::Afv::Audio
         }
     }
 
-    int CReceiverSampleProvider::readSamples(QVector<float> &samples, qint64 count)
+    int CReceiverSampleProvider::readSamples(float *samples, qint64 count)
     {
         int numberOfInUseInputs = activeCallsigns();
         if (numberOfInUseInputs > 1 && m_doBlockWhenAppropriate)
@@ -58,7 +58,7 @@ namespace BlackCore::Afv::Audio
         //! @}
 
         //! \copydoc BlackSound::SampleProvider::ISampleProvider::readSamples
-        virtual int readSamples(QVector<float> &samples, qint64 count) override;
+        virtual int readSamples(float *samples, qint64 count) override;
 
         //! @{
         //! Add samples
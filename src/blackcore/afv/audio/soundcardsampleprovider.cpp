@@ -78,7 +78,7 @@ namespace BlackCore::Afv::Audio
         }
     }
 
-    int CSoundcardSampleProvider::readSamples(QVector<float> &samples, qint64 count)
+    int CSoundcardSampleProvider::readSamples(float *samples, qint64 count)
     {
         return m_mixer->readSamples(samples, count);
     }
@@ -35,7 +35,7 @@ namespace BlackCore::Afv::Audio
         void pttUpdate(bool active, const QVector<TxTransceiverDto> &txTransceivers);
 
         //! \copydoc BlackSound::SampleProvider::ISampleProvider::readSamples
-        virtual int readSamples(QVector<float> &samples, qint64 count) override;
+        virtual int readSamples(float *samples, qint64 count) override;
 
         //! Add OPUS samples
         void addOpusSamples(const IAudioDto &audioDto, const QVector<RxTransceiverDto> &rxTransceivers);
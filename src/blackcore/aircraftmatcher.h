@@ -11,11 +11,14 @@
 #include "blackmisc/simulation/aircraftmodelsetprovider.h"
 #include "blackmisc/simulation/aircraftmatchersetup.h"
 #include "blackmisc/simulation/aircraftmodellist.h"
+#include "blackmisc/simulation/aircraftmodelsetindex.h"
 #include "blackmisc/simulation/matchingscriptmisc.h"
 #include "blackmisc/simulation/matchingstatistics.h"
 #include "blackmisc/simulation/matchinglog.h"
 #include "blackmisc/simulation/categorymatcher.h"
+#include "blackmisc/simulation/simulatedaircraftlist.h"
 #include "blackmisc/statusmessage.h"
+#include "blackmisc/statusmessagelist.h"
 #include "blackmisc/valueobject.h"
 #include "blackmisc/variant.h"
 
@@ -24,19 +27,18 @@
 #include <QString>
 #include <QPair>
 #include <QSet>
+#include <QVector>
+#include <atomic>
+#include <functional>
+#include <memory>
 
 namespace BlackMisc
 {
     class CLogCategoryList;
-    class CStatusMessageList;
     namespace Aviation
     {
         class CCallsign;
     }
-    namespace Simulation
-    {
-        class CSimulatedAircraft;
-    }
 }
 
 namespace BlackCore
@@ -77,6 +79,17 @@ namespace BlackCore
         //! Get the setup
         BlackMisc::Simulation::CAircraftMatcherSetup getSetup() const { return m_setup; }
 
+        //! Result of matching a remote aircraft
+        struct MatchingResult
+        {
+            BlackMisc::Simulation::CSimulatedAircraft remoteAircraft; //!< the remote aircraft as passed for matching
+            BlackMisc::Simulation::CAircraftModel matchedModel; //!< the matched model
+            BlackMisc::CStatusMessageList log; //!< matching log, empty if nothing is logged
+        };
+
+        //! Results of matching several remote aircraft
+        using MatchingResults = QVector<MatchingResult>;
+
         //! Get the closest matching aircraft model from set.
         //! Result depends on setup.
         //! \sa BlackMisc::Simulation::CAircraftMatcherSetup
@@ -87,6 +100,19 @@ namespace BlackCore
             BlackMisc::CStatusMessageList *log,
             bool useMatchingScript) const;
 
+        //! Get the closest matching models for several remote aircraft, matched in parallel in background threads.
+        //! The callback is called in the thread of the receiver, once per aircraft.
+        //! \remark the model set and setup at the time of the call are used
+        //! \remark results of cancelled batches are dropped, see CAircraftMatcher::cancelBatchMatching
+        void getClosestMatchesAsync(
+            const BlackMisc::Simulation::CSimulatedAircraftList &remoteAircraft,
+            BlackMisc::Simulation::MatchingLog whatToLog, bool useMatchingScript,
+            QObject *receiver, const std::function<void(const MatchingResult &)> &callback);
+
+        //! Cancel all pending batch matchings
+        //! \threadsafe
+        void cancelBatchMatching();
+
         //! Return an valid airline ICAO code
         //! \threadsafe
         static BlackMisc::Aviation::CAirlineIcaoCode failoverValidAirlineIcaoDesignator(
@@ -311,12 +337,36 @@ namespace BlackCore
         void setupChanged();
 
     private:
+        //! Ids (positions) of models in the indexed model set
+        using ModelIds = BlackMisc::Simulation::CAircraftModelSetIndex::ModelIds;
+
+        //! Everything a matching uses, captured so matchings can run in parallel to changes of the matcher
+        struct MatchingContext
+        {
+            BlackMisc::Simulation::CAircraftMatcherSetup setup; //!< setup
+            std::shared_ptr<const BlackMisc::Simulation::CAircraftModelSetIndex> modelSet; //!< indexed model set
+            BlackMisc::Simulation::CAircraftModel defaultModel; //!< default model
+            BlackMisc::Simulation::CCategoryMatcher categoryMatcher; //!< category matcher
+        };
+
+        //! Current matching context
+        MatchingContext getMatchingContext() const;
+
+        //! Set the model set and build the indexes
+        void setModelSetAndIndex(const BlackMisc::Simulation::CAircraftModelList &models);
+
         //! Save the disabled models if any
         bool saveDisabledForMatchingModels();
 
+        //! Closest match implementation
+        //! \threadsafe
+        static BlackMisc::Simulation::CAircraftModel getClosestMatchImplementation(
+            const MatchingContext &context, const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft,
+            BlackMisc::Simulation::MatchingLog whatToLog, BlackMisc::CStatusMessageList *log, bool useMatchingScript);
+
         //! The search based implementation
-        static BlackMisc::Simulation::CAircraftModelList getClosestMatchStepwiseReduceImplementation(
-            const BlackMisc::Simulation::CAircraftModelList &modelSet, const BlackMisc::Simulation::CAircraftMatcherSetup &setup,
+        static ModelIds getClosestMatchStepwiseReduceImplementation(
+            const BlackMisc::Simulation::CAircraftModelSetIndex &index, const ModelIds &modelSet, const BlackMisc::Simulation::CAircraftMatcherSetup &setup,
             const BlackMisc::Simulation::CCategoryMatcher &categoryMatcher, const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft,
             BlackMisc::Simulation::MatchingLog whatToLog, BlackMisc::CStatusMessageList *log = nullptr);
 
@@ -330,28 +380,28 @@ namespace BlackCore
 
         //! Search in models by key (aka model string)
         //! \threadsafe
-        static BlackMisc::Simulation::CAircraftModel matchByExactModelString(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, const BlackMisc::Simulation::CAircraftModelList &models, BlackMisc::Simulation::MatchingLog whatToLog, BlackMisc::CStatusMessageList *log);
+        static BlackMisc::Simulation::CAircraftModel matchByExactModelString(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, const BlackMisc::Simulation::CAircraftModelSetIndex &index, BlackMisc::Simulation::MatchingLog whatToLog, BlackMisc::CStatusMessageList *log);
 
         //! Installed models by ICAO data
         //! \threadsafe
-        static BlackMisc::Simulation::CAircraftModelList ifPossibleReduceByIcaoData(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, const BlackMisc::Simulation::CAircraftModelList &models, const BlackMisc::Simulation::CAircraftMatcherSetup &setup, bool &reduced, BlackMisc::CStatusMessageList *log);
+        static ModelIds ifPossibleReduceByIcaoData(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, const BlackMisc::Simulation::CAircraftModelSetIndex &index, const ModelIds &inIds, const BlackMisc::Simulation::CAircraftMatcherSetup &setup, bool &reduced, BlackMisc::CStatusMessageList *log);
 
         //! Find model by aircraft family
         //! \threadsafe
-        static BlackMisc::Simulation::CAircraftModelList ifPossibleReduceByFamily(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, bool allowPseudoFamily, const BlackMisc::Simulation::CAircraftModelList &inList, bool &reduced, QString &usedFamily, BlackMisc::CStatusMessageList *log);
+        static ModelIds ifPossibleReduceByFamily(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, bool allowPseudoFamily, const BlackMisc::Simulation::CAircraftModelSetIndex &index, const ModelIds &inIds, bool &reduced, QString &usedFamily, BlackMisc::CStatusMessageList *log);
 
         //! Find model by aircraft family
         //! \remark pseudo family searches for same combined type and manufacturer
         //! \threadsafe
-        static BlackMisc::Simulation::CAircraftModelList ifPossibleReduceByFamily(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, const QString &family, bool allowPseudoFamily, const BlackMisc::Simulation::CAircraftModelList &inList, const QString &hint, bool &reduced, BlackMisc::CStatusMessageList *log);
+        static ModelIds ifPossibleReduceByFamily(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, const QString &family, bool allowPseudoFamily, const BlackMisc::Simulation::CAircraftModelSetIndex &index, const ModelIds &inIds, const QString &hint, bool &reduced, BlackMisc::CStatusMessageList *log);
 
         //! Search for exact livery and aircraft ICAO code
         //! \threadsafe
-        static BlackMisc::Simulation::CAircraftModelList ifPossibleReduceByLiveryAndAircraftIcaoCode(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, const BlackMisc::Simulation::CAircraftModelList &inList, bool &reduced, BlackMisc::CStatusMessageList *log);
+        static ModelIds ifPossibleReduceByLiveryAndAircraftIcaoCode(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, const BlackMisc::Simulation::CAircraftModelSetIndex &index, const ModelIds &inIds, bool &reduced, BlackMisc::CStatusMessageList *log);
 
         //! Reduce by manufacturer
         //! \threadsafe
-        static BlackMisc::Simulation::CAircraftModelList ifPossibleReduceByManufacturer(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, const BlackMisc::Simulation::CAircraftModelList &inList, const QString &info, bool &reduced, BlackMisc::CStatusMessageList *log);
+        static ModelIds ifPossibleReduceByManufacturer(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, const BlackMisc::Simulation::CAircraftModelSetIndex &index, const ModelIds &inIds, const QString &info, bool &reduced, BlackMisc::CStatusMessageList *log);
 
         //! Reduce by manufacturer
         //! \threadsafe
@@ -359,15 +409,15 @@ namespace BlackCore
 
         //! Reduce by aircraft ICAO
         //! \threadsafe
-        static BlackMisc::Simulation::CAircraftModelList ifPossibleReduceByAircraft(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, const BlackMisc::Simulation::CAircraftModelList &inList, const QString &info, bool &reduced, BlackMisc::CStatusMessageList *log);
+        static ModelIds ifPossibleReduceByAircraft(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, const BlackMisc::Simulation::CAircraftModelSetIndex &index, const ModelIds &inIds, const QString &info, bool &reduced, BlackMisc::CStatusMessageList *log);
 
         //! Reduce by aircraft ICAO or family
         //! \threadsafe
-        static BlackMisc::Simulation::CAircraftModelList ifPossibleReduceByAircraftOrFamily(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, bool allowPseudoFamily, const BlackMisc::Simulation::CAircraftModelList &inList, const BlackMisc::Simulation::CAircraftMatcherSetup &setup, const QString &info, bool &reduced, BlackMisc::CStatusMessageList *log);
+        static ModelIds ifPossibleReduceByAircraftOrFamily(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, bool allowPseudoFamily, const BlackMisc::Simulation::CAircraftModelSetIndex &index, const ModelIds &inIds, const BlackMisc::Simulation::CAircraftMatcherSetup &setup, const QString &info, bool &reduced, BlackMisc::CStatusMessageList *log);
 
         //! Reduce by airline ICAO
         //! \threadsafe
-        static BlackMisc::Simulation::CAircraftModelList ifPossibleReduceByAirline(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, const BlackMisc::Simulation::CAircraftModelList &inList, const BlackMisc::Simulation::CAircraftMatcherSetup &setup, const QString &info, bool &reduced, BlackMisc::CStatusMessageList *log);
+        static ModelIds ifPossibleReduceByAirline(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, const BlackMisc::Simulation::CAircraftModelSetIndex &index, const ModelIds &inIds, const BlackMisc::Simulation::CAircraftMatcherSetup &setup, const QString &info, bool &reduced, BlackMisc::CStatusMessageList *log);
 
         //! Reduce by airline name/telephone designator
         //! \threadsafe
@@ -375,15 +425,15 @@ namespace BlackCore
 
         //! Installed models by combined code (ie L2J, L1P, ...)
         //! \threadsafe
-        static BlackMisc::Simulation::CAircraftModelList ifPossibleReduceByCombinedType(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, const BlackMisc::Simulation::CAircraftModelList &inList, const BlackMisc::Simulation::CAircraftMatcherSetup &setup, bool &reduced, BlackMisc::CStatusMessageList *log);
+        static ModelIds ifPossibleReduceByCombinedType(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, const BlackMisc::Simulation::CAircraftModelSetIndex &index, const ModelIds &inIds, const BlackMisc::Simulation::CAircraftMatcherSetup &setup, bool &reduced, BlackMisc::CStatusMessageList *log);
 
         //! By military flag
         //! \threadsafe
-        static BlackMisc::Simulation::CAircraftModelList ifPossibleReduceByMilitaryFlag(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, const BlackMisc::Simulation::CAircraftModelList &inList, bool &reduced, BlackMisc::CStatusMessageList *log);
+        static ModelIds ifPossibleReduceByMilitaryFlag(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, const BlackMisc::Simulation::CAircraftModelSetIndex &index, const ModelIds &inIds, bool &reduced, BlackMisc::CStatusMessageList *log);
 
         //! By VTOL flag
         //! \threadsafe
-        static BlackMisc::Simulation::CAircraftModelList ifPossibleReduceByVTOLFlag(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, const BlackMisc::Simulation::CAircraftModelList &inList, bool &reduced, BlackMisc::CStatusMessageList *log);
+        static ModelIds ifPossibleReduceByVTOLFlag(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, const BlackMisc::Simulation::CAircraftModelSetIndex &index, const ModelIds &inIds, bool &reduced, BlackMisc::CStatusMessageList *log);
 
         //! Scores to string for debugging
         //! \threadsafe
@@ -403,6 +453,8 @@ namespace BlackCore
         BlackMisc::Simulation::CAircraftMatcherSetup m_setup; //!< setup
         BlackMisc::Simulation::CAircraftModel m_defaultModel; //!< model to be used as default model
         BlackMisc::Simulation::CAircraftModelList m_modelSet; //!< models used for model matching
+        std::shared_ptr<const BlackMisc::Simulation::CAircraftModelSetIndex> m_modelSetIndex { std::make_shared<const BlackMisc::Simulation::CAircraftModelSetIndex>() }; //!< indexes of m_modelSet, shared with running matchings
+        std::shared_ptr<std::atomic_int> m_batchGeneration { std::make_shared<std::atomic_int>(0) }; //!< incremented to cancel running batch matchings
         BlackMisc::Simulation::CAircraftModelList m_disabledModels; //!< disabled models for matching
         BlackMisc::Simulation::CSimulatorInfo m_simulator; //!< simulator (optional)
         BlackMisc::Simulation::CMatchingStatistics m_statistics; //!< matching statistics
@@ -411,4 +463,6 @@ namespace BlackCore
     };
 } // namespace
 
+Q_DECLARE_METATYPE(BlackCore::CAircraftMatcher::MatchingResults)
+
 #endif // guard
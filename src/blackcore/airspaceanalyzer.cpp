@@ -143,6 +143,7 @@ namespace BlackCore
     {
         m_aircraftCallsignTimestamps.clear();
         m_atcCallsignTimestamps.clear();
+        m_snapshotBuilder.clear();
 
         QWriteLocker l(&m_lockSnapshot);
         m_latestAircraftSnapshot = CAirspaceAircraftSnapshot();
@@ -195,7 +196,7 @@ namespace BlackCore
         const QList<CCallsign> callsignsAtc = m_atcCallsignTimestamps.keys();
         for (const CCallsign &callsign : callsignsAtc) // clazy:exclude=container-anti-pattern,range-loop
         {
-            if (!enabled) { m_aircraftCallsignTimestamps[callsign] = timeoutAtcEpochMs + 1000; } // fake value so it can be re-enabled
+            if (!enabled) { m_atcCallsignTimestamps[callsign] = timeoutAtcEpochMs + 1000; } // fake value so it can be re-enabled
             const qint64 tsv = m_atcCallsignTimestamps.value(callsign);
             if (tsv > timeoutAtcEpochMs) { continue; }
             CLogMessage(this).debug() << QStringLiteral("ATC '%1' timed out after %2ms").arg(callsign.toQString()).arg(currentTimeMsEpoch - tsv);
@@ -223,8 +224,8 @@ namespace BlackCore
         // remark for simulation snapshot is used when there are restrictions
         // nevertheless we calculate all the time as the snapshot could be used in other scenarios
 
-        CSimulatedAircraftList aircraftInRange(this->getAircraftInRange()); // thread safe copy from provider
-        CAirspaceAircraftSnapshot snapshot(
+        const CSimulatedAircraftList aircraftInRange(this->getAircraftInRange()); // thread safe copy from provider
+        CAirspaceAircraftSnapshot snapshot = m_snapshotBuilder.buildSnapshot(
             aircraftInRange,
             restricted, enabled,
             maxAircraft, maxRenderedDistance);
@@ -10,6 +10,7 @@
 #include "blackcore/fsd/fsdclient.h"
 #include "blackmisc/network/connectionstatus.h"
 #include "blackmisc/simulation/airspaceaircraftsnapshot.h"
+#include "blackmisc/simulation/airspaceaircraftsnapshotbuilder.h"
 #include "blackmisc/simulation/ownaircraftprovider.h"
 #include "blackmisc/simulation/remoteaircraftprovider.h"
 #include "blackmisc/aviation/atcstation.h"
@@ -131,6 +132,7 @@ namespace BlackCore
 
         // snapshot
         BlackMisc::Simulation::CAirspaceAircraftSnapshot m_latestAircraftSnapshot;
+        BlackMisc::Simulation::CAirspaceAircraftSnapshotBuilder m_snapshotBuilder; //!< incremental snapshots, only used in analyzer thread
         bool m_simulatorRenderedAircraftRestricted = false;
         bool m_simulatorRenderingEnabled = true;
         int m_simulatorMaxRenderedAircraft = -1;
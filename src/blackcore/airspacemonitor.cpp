@@ -197,14 +197,15 @@ namespace BlackCore
 
     CAtcStationList CAirspaceMonitor::getAtcStationsOnlineRecalculated()
     {
-        m_atcStationsOnline.calculcateAndUpdateRelativeDistanceAndBearing(this->getOwnAircraftSituation());
-        return m_atcStationsOnline;
+        const CAircraftSituation ownSituation = this->getOwnAircraftSituation();
+        m_atcStationsOnline.modify([&](CAtcStationList &stations) { stations.calculcateAndUpdateRelativeDistanceAndBearing(ownSituation); });
+        return m_atcStationsOnline.getList();
     }
 
     CUserList CAirspaceMonitor::getUsers() const
     {
         CUserList users;
-        for (const CAtcStation &station : m_atcStationsOnline)
+        for (const CAtcStation &station : m_atcStationsOnline.getList())
         {
             CUser user = station.getController();
             if (!user.hasCallsign()) { user.setCallsign(station.getCallsign()); }
@@ -246,7 +247,7 @@ namespace BlackCore
             }
         }
 
-        for (const CAtcStation &station : m_atcStationsOnline)
+        for (const CAtcStation &station : m_atcStationsOnline.getList())
         {
             if (searchList.isEmpty()) { break; }
             const CCallsign callsign = station.getCallsign();
@@ -278,7 +279,7 @@ namespace BlackCore
 
     CAtcStation CAirspaceMonitor::getAtcStationForComUnit(const CComSystem &comSystem) const
     {
-        CAtcStationList stations = m_atcStationsOnline.findIfComUnitTunedInChannelSpacing(comSystem);
+        CAtcStationList stations = m_atcStationsOnline.getList().findIfComUnitTunedInChannelSpacing(comSystem);
         if (stations.isEmpty()) { return {}; }
         stations.sortByDistanceToReferencePosition();
         return stations.front();
@@ -326,7 +327,7 @@ namespace BlackCore
     void CAirspaceMonitor::testCreateDummyOnlineAtcStations(int number)
     {
         if (number < 1) { return; }
-        m_atcStationsOnline.push_back(CTesting::createAtcStations(number));
+        m_atcStationsOnline.modify([&](CAtcStationList &stations) { stations.push_back(CTesting::createAtcStations(number)); });
         emit this->changedAtcStationsOnline();
     }
 
@@ -669,7 +670,7 @@ namespace BlackCore
         Q_ASSERT_X(CThreadUtils::isInThisThread(this), Q_FUNC_INFO, "wrong thread");
         if (!this->isConnectedAndNotShuttingDown()) { return; }
 
-        const CAtcStationList stationsWithCallsign = m_atcStationsOnline.findByCallsign(callsign);
+        const CAtcStationList stationsWithCallsign = m_atcStationsOnline.getList().findByCallsign(callsign);
         if (stationsWithCallsign.isEmpty())
         {
             CAtcStation station;
@@ -687,13 +688,14 @@ namespace BlackCore
             station.setOnline(true);
             station.calculcateAndUpdateRelativeDistanceAndBearing(this->getOwnAircraftPosition());
 
-            m_atcStationsOnline.push_back(station);
+            m_atcStationsOnline.modify([&](CAtcStationList &stations) { stations.push_back(station); });
 
             // subsequent queries
             this->sendInitialAtcQueries(callsign);
 
             // update distances
-            m_atcStationsOnline.calculcateAndUpdateRelativeDistanceAndBearing(this->getOwnAircraftSituation());
+            const CAircraftSituation ownSituation = this->getOwnAircraftSituation();
+            m_atcStationsOnline.modify([&](CAtcStationList &stations) { stations.calculcateAndUpdateRelativeDistanceAndBearing(ownSituation); });
 
             emit this->changedAtcStationsOnline();
         }
@@ -704,8 +706,7 @@ namespace BlackCore
             vm.addValue(CAtcStation::IndexFrequency, frequency);
             vm.addValue(CAtcStation::IndexPosition, position);
             vm.addValue(CAtcStation::IndexRange, range);
-            const int changed = m_atcStationsOnline.applyIfCallsign(callsign, vm, true);
-            if (changed > 0) { emit this->changedAtcStationsOnline(); }
+            this->updateOnlineStation(callsign, vm, true, true);
         }
     }
 
@@ -715,10 +716,10 @@ namespace BlackCore
         if (!this->isConnectedAndNotShuttingDown()) { return; }
 
         this->removeClient(callsign);
-        if (m_atcStationsOnline.containsCallsign(callsign))
+        if (m_atcStationsOnline.getList().containsCallsign(callsign))
         {
-            const CAtcStation removedStation = m_atcStationsOnline.findFirstByCallsign(callsign);
-            m_atcStationsOnline.removeByCallsign(callsign);
+            const CAtcStation removedStation = m_atcStationsOnline.getList().findFirstByCallsign(callsign);
+            m_atcStationsOnline.modify([&](CAtcStationList &stations) { stations.removeByCallsign(callsign); });
             emit this->changedAtcStationsOnline();
             emit this->atcStationDisconnected(removedStation);
         }
@@ -728,7 +729,8 @@ namespace BlackCore
     {
         Q_ASSERT(CThreadUtils::isInThisThread(this));
         if (!this->isConnectedAndNotShuttingDown() || callsign.isEmpty()) return;
-        const bool changedAtis = m_atcStationsOnline.updateIfMessageChanged(atisMessage, callsign, true);
+        bool changedAtis = false;
+        m_atcStationsOnline.modify([&](CAtcStationList &stations) { changedAtis = stations.updateIfMessageChanged(atisMessage, callsign, true); });
 
         // signal
         if (changedAtis) { emit this->changedAtisReceived(callsign); }
@@ -771,7 +773,7 @@ namespace BlackCore
         if (!this->isConnectedAndNotShuttingDown()) { return; }
 
         const bool isAircraft = this->isAircraftInRange(callsign);
-        const bool isAtc = m_atcStationsOnline.containsCallsign(callsign);
+        const bool isAtc = m_atcStationsOnline.getList().containsCallsign(callsign);
         if (!isAircraft && !isAtc)
         {
             // we have no idea what we are dealing with, so we store it
@@ -1070,7 +1072,8 @@ namespace BlackCore
 
     int CAirspaceMonitor::updateOnlineStation(const CCallsign &callsign, const CPropertyIndexVariantMap &vm, bool skipEqualValues, bool sendSignal)
     {
-        const int c = m_atcStationsOnline.applyIfCallsign(callsign, vm, skipEqualValues);
+        int c = 0;
+        m_atcStationsOnline.modify([&](CAtcStationList &stations) { c = stations.applyIfCallsign(callsign, vm, skipEqualValues); });
         if (c > 0 && sendSignal)
         {
             emit this->changedAtcStationsOnline();
@@ -1208,12 +1211,9 @@ namespace BlackCore
         else if (existsInRange)
         {
             // update, aircraft already exists
-            CPropertyIndexVariantMap vm;
-            vm.addValue(CSimulatedAircraft::IndexTransponder, transponder);
-            vm.addValue(CSimulatedAircraft::IndexSituation, situation);
-            vm.addValue(CSimulatedAircraft::IndexRelativeDistance, this->calculateDistanceToOwnAircraft(situation));
-            vm.addValue(CSimulatedAircraft::IndexRelativeBearing, this->calculateBearingToOwnAircraft(situation));
-            this->updateAircraftInRange(callsign, vm);
+            this->updateAircraftKinematics(callsign, situation, transponder,
+                                           this->calculateDistanceToOwnAircraft(situation),
+                                           this->calculateBearingToOwnAircraft(situation));
         }
     }
 
@@ -1646,7 +1646,7 @@ namespace BlackCore
         if (m_queryAtis.isEmpty()) { return false; }
         if (!this->isConnectedAndNotShuttingDown()) { return false; }
         const CCallsign cs = m_queryAtis.dequeue();
-        if (!m_atcStationsOnline.containsCallsign(cs)) { return false; }
+        if (!m_atcStationsOnline.getList().containsCallsign(cs)) { return false; }
         m_fsdClient->sendClientQueryAtis(cs);
         return true;
     }
@@ -28,6 +28,7 @@
 #include "blackmisc/aviation/callsignset.h"
 #include "blackmisc/aviation/flightplan.h"
 #include "blackmisc/geo/coordinategeodetic.h"
+#include "blackmisc/geo/geoobjectlist.h"
 #include "blackmisc/pq/frequency.h"
 #include "blackmisc/pq/length.h"
 #include "blackmisc/pq/angle.h"
@@ -103,7 +104,11 @@ namespace BlackCore
         BlackMisc::Aviation::CFlightPlanRemarks tryToGetFlightPlanRemarks(const BlackMisc::Aviation::CCallsign &callsign) const;
 
         //! Returns the current online ATC stations
-        BlackMisc::Aviation::CAtcStationList getAtcStationsOnline() const { return m_atcStationsOnline; }
+        BlackMisc::Aviation::CAtcStationList getAtcStationsOnline() const { return m_atcStationsOnline.getList(); }
+
+        //! Closest online ATC stations, using the spatial index of the stations
+        //! \remark stations without position are not returned
+        BlackMisc::Aviation::CAtcStationList getClosestAtcStationsOnline(int number, const BlackMisc::Geo::ICoordinateGeodetic &position) const { return m_atcStationsOnline.findClosest(number, position); }
 
         //! Recalculate distance to own aircraft
         BlackMisc::Aviation::CAtcStationList getAtcStationsOnlineRecalculated();
@@ -265,7 +270,7 @@ namespace BlackCore
             }
         };
 
-        BlackMisc::Aviation::CAtcStationList m_atcStationsOnline; //!< online ATC stations
+        BlackMisc::Geo::CGeoIndexedList<BlackMisc::Aviation::CAtcStationList> m_atcStationsOnline; //!< online ATC stations, index built by the closest stations query
         QHash<BlackMisc::Aviation::CCallsign, FsInnPacket> m_tempFsInnPackets; //!< unhandled FsInn packets
         QHash<BlackMisc::Aviation::CCallsign, BlackMisc::Aviation::CFlightPlan> m_flightPlanCache; //!< flight plan information retrieved from network and cached
         QHash<BlackMisc::Aviation::CCallsign, Readiness> m_readiness; //!< readiness
@@ -345,7 +345,21 @@ namespace BlackCore
             if (this->isSet(m_cmdClearCache))
             {
                 const QStringList files(CApplication::clearCaches());
-                msgs.push_back(CLogMessage(this).debug() << "Cleared cache, " << files.size() << " files");
+                msgs.push_back(CStatusMessage(this).debug() << "Cleared cache, " << files.size() << " files");
+            }
+
+            // log file written in background
+            if (this->isSet(m_cmdAsyncLog) && m_fileLogger)
+            {
+                m_fileLogger->setAsynchronous(true);
+                msgs.push_back(CStatusMessage(this).info(u"Writing the log file in a background thread"));
+            }
+
+            // data caches in binary format
+            if (this->isSet(m_cmdBinaryCache))
+            {
+                CDataCache::instance()->setBinaryFiles(true);
+                msgs.push_back(CStatusMessage(this).info(u"Saving the data caches in binary format"));
             }
 
             // crashpad dump
@@ -797,6 +811,7 @@ namespace BlackCore
 
         const CStatusMessageList msgs(CStatusMessage(this).info(u"Will start core facade now"));
         m_coreFacade.reset(new CCoreFacade(m_coreFacadeConfig));
+        this->updateLocalLogListenerPatterns();
         emit this->coreFacadeStarted();
         return msgs;
     }
@@ -834,6 +849,30 @@ namespace BlackCore
         connect(CLogHandler::instance(), &CLogHandler::localMessageLogged, m_fileLogger.data(), &CFileLogger::writeStatusMessageToFile);
         connect(CLogHandler::instance(), &CLogHandler::remoteMessageLogged, m_fileLogger.data(), &CFileLogger::writeStatusMessageToFile);
         m_fileLogger->changeLogPattern(CLogPattern().withSeverityAtOrAbove(CStatusMessage::SeverityDebug));
+
+        // debug messages not needed by the subscribers or the console are skipped
+        connect(CLogHandler::instance(), &CLogHandler::subscriptionAdded, this, &CApplication::updateLocalLogListenerPatterns);
+        connect(CLogHandler::instance(), &CLogHandler::subscriptionRemoved, this, &CApplication::updateLocalLogListenerPatterns);
+        this->updateLocalLogListenerPatterns();
+    }
+
+    void CApplication::updateLocalLogListenerPatterns()
+    {
+        // the file logger, the log history and the simulator relay are always connected,
+        // counting them for debug messages would enable all messages, so they only get the debug messages
+        // a subscriber or the console needs (all of them in local developer builds)
+        const bool allDebugMessages = CBuildConfig::isLocalDeveloperDebugBuild();
+        const auto alwaysConnected = [allDebugMessages](const CLogPattern &pattern) {
+            if (allDebugMessages) { return pattern; }
+            QSet<CStatusMessage::StatusSeverity> severities = pattern.getSeverities();
+            severities.remove(CStatusMessage::SeverityDebug);
+            return pattern.withSeverities(severities);
+        };
+
+        QList<CLogPattern> patterns = CLogHandler::instance()->getAllSubscriptions();
+        if (m_fileLogger) { patterns.push_back(alwaysConnected(m_fileLogger->getLogPattern())); }
+        if (m_coreFacade) { patterns.push_back(alwaysConnected(CLogPattern())); } // log history and simulator relay take all local messages
+        CLogHandler::instance()->setLocalListenerPatterns(patterns);
     }
 
     void CApplication::initParser()
@@ -864,6 +903,16 @@ namespace BlackCore
         m_cmdTestCrashpad = QCommandLineOption({ "testcp", "testcrashpad" },
                                                QCoreApplication::translate("application", "Trigger crashpad situation."));
         this->addParserOption(m_cmdTestCrashpad);
+
+        // log file written in background
+        m_cmdAsyncLog = QCommandLineOption({ "alog", "asynclog" },
+                                           QCoreApplication::translate("application", "Write the log file in a background thread."));
+        this->addParserOption(m_cmdAsyncLog);
+
+        // data caches in binary format
+        m_cmdBinaryCache = QCommandLineOption({ "bcache", "binarycache" },
+                                              QCoreApplication::translate("application", "Save the data caches in binary format."));
+        this->addParserOption(m_cmdBinaryCache);
     }
 
     bool CApplication::isSet(const QCommandLineOption &option) const
@@ -922,6 +971,7 @@ namespace BlackCore
             // clean up facade
             m_coreFacade->gracefulShutdown();
             m_coreFacade.reset();
+            this->updateLocalLogListenerPatterns();
         }
 
         if (m_webDataServices)
@@ -570,6 +570,8 @@ namespace BlackCore
         QCommandLineOption m_cmdDevelopment { "dev" }; //!< Development flag
         QCommandLineOption m_cmdClearCache { "clearcache" }; //!< Clear cache
         QCommandLineOption m_cmdTestCrashpad { "testcrashpad" }; //!< Test a crasphpad upload
+        QCommandLineOption m_cmdAsyncLog { "asynclog" }; //!< Write the log file in a background thread
+        QCommandLineOption m_cmdBinaryCache { "binarycache" }; //!< Save the data caches in binary format
         QCommandLineOption m_cmdSkipSingleApp { "skipsa" }; //!< Skip test for single application
         bool m_parsed = false; //!< Parsing accomplished?
         bool m_started = false; //!< Started with success?
@@ -594,6 +596,10 @@ namespace BlackCore
         //! init logging system
         void initLogging();
 
+        //! Messages needed by the receivers of CLogHandler::localMessageLogged
+        //! \remark the always connected receivers do not enable debug messages, except in local developer builds
+        void updateLocalLogListenerPatterns();
+
         //! Init parser
         void initParser();
 
@@ -11,6 +11,8 @@
 #include "blackcore/corefacade.h"
 #include "blackcore/fsd/fsdclient.h"
 #include "blackcore/webdataservices.h"
+#include "blackmisc/sharedstate/datalinkdbus.h"
+#include "blackmisc/simulation/aircraftinrangejournal.h"
 #include "blackmisc/simulation/simulatorplugininfo.h"
 #include "blackmisc/aviation/aircrafticaocode.h"
 #include "blackmisc/aviation/aircraftparts.h"
@@ -100,9 +102,17 @@ namespace BlackCore::Context
         connect(m_airspace, &CAirspaceMonitor::atcStationDisconnected, this, &CContextNetwork::atcStationDisconnected, Qt::QueuedConnection);
         connect(m_airspace, &CAirspaceMonitor::changedAtcStationsOnline, this, &CContextNetwork::changedAtcStationsOnline, Qt::QueuedConnection);
         connect(m_airspace, &CAirspaceMonitor::changedAircraftInRange, this, &CContextNetwork::changedAircraftInRange, Qt::QueuedConnection);
-        connect(m_airspace, &CAirspaceMonitor::removedAircraft, this, &IContextNetwork::removedAircraft, Qt::QueuedConnection); // DBus
         connect(m_airspace, &CAirspaceMonitor::readyForModelMatching, this, &CContextNetwork::onReadyForModelMatching); // intentionally NOT QueuedConnection
-        connect(m_airspace, &CAirspaceMonitor::addedAircraft, this, &CContextNetwork::addedAircraft, Qt::QueuedConnection);
+
+        // remote contexts get the aircraft in range before the signals, so both agree (DBus)
+        connect(m_airspace, &CAirspaceMonitor::removedAircraft, this, [this](const CCallsign &callsign) {
+            this->publishAircraftInRange();
+            emit this->removedAircraft(callsign);
+        }, Qt::QueuedConnection);
+        connect(m_airspace, &CAirspaceMonitor::addedAircraft, this, [this](const CSimulatedAircraft &aircraft) {
+            this->publishAircraftInRange();
+            emit this->addedAircraft(aircraft);
+        }, Qt::QueuedConnection);
         connect(m_airspace, &CAirspaceMonitor::changedAtisReceived, this, &CContextNetwork::onChangedAtisReceived, Qt::QueuedConnection);
     }
 
@@ -110,6 +120,17 @@ namespace BlackCore::Context
     {
         if (!server || m_mode != CCoreFacadeConfig::LocalInDBusServer) return this;
         server->addObject(IContextNetwork::ObjectPath(), this);
+
+        // aircraft in range as deltas, so remote contexts do not need to poll the whole list
+        if (this->getRuntime()->getDataLinkDBus())
+        {
+            m_aircraftInRangeJournal = new CAircraftInRangeJournal(this);
+            m_aircraftInRangeJournal->initialize(this->getRuntime()->getDataLinkDBus());
+            m_aircraftInRangeJournalTimer = new QTimer(this);
+            connect(m_aircraftInRangeJournalTimer, &QTimer::timeout, this, &CContextNetwork::publishAircraftInRange);
+            m_aircraftInRangeJournalTimer->start(500); // max. rate of deltas
+            m_aircraftInRangeJournalTimer->setObjectName("CContextNetwork::m_aircraftInRangeJournalTimer");
+        }
         return this;
     }
 
@@ -753,6 +774,12 @@ namespace BlackCore::Context
         m_dsAtcStationsOnlineChanged.inputSignal(); // the ATIS data are stored in the station object
     }
 
+    void CContextNetwork::publishAircraftInRange()
+    {
+        if (!m_aircraftInRangeJournal || !this->canUseAirspaceMonitor()) { return; }
+        m_aircraftInRangeJournal->update(m_airspace->getAircraftInRange());
+    }
+
     void CContextNetwork::onTextMessagesReceived(const CTextMessageList &messages)
     {
         if (messages.isEmpty()) { return; }
@@ -873,7 +900,7 @@ namespace BlackCore::Context
     {
         if (!this->getIContextOwnAircraft()) { return CAtcStationList(); }
         const CAircraftSituation ownSituation = this->getIContextOwnAircraft()->getOwnAircraftSituation();
-        const CAtcStationList stations = m_airspace->getAtcStationsOnline().findClosest(number, ownSituation);
+        const CAtcStationList stations = m_airspace->getClosestAtcStationsOnline(number, ownSituation);
         return stations;
     }
 
@@ -1068,6 +1095,7 @@ namespace BlackCore::Context
         {
             const CSimulatedAircraft aircraft(this->getAircraftInRangeForCallsign(callsign));
             Q_ASSERT_X(!aircraft.getCallsign().isEmpty(), Q_FUNC_INFO, "missing callsign");
+            this->publishAircraftInRange();
             emit this->changedRemoteAircraftEnabled(aircraft);
         }
         return c;
@@ -1162,6 +1190,7 @@ namespace BlackCore::Context
     {
         if (!canUseAirspaceMonitor()) { return false; }
         const bool c = m_airspace->updateAircraftRendered(callsign, rendered);
+        if (c) { this->publishAircraftInRange(); }
         return c;
     }
 
@@ -1169,6 +1198,7 @@ namespace BlackCore::Context
     {
         if (!canUseAirspaceMonitor()) { return 0; }
         const int c = m_airspace->updateMultipleAircraftRendered(callsigns, rendered);
+        if (c > 0) { this->publishAircraftInRange(); }
         return c;
     }
 
@@ -1176,6 +1206,7 @@ namespace BlackCore::Context
     {
         if (!canUseAirspaceMonitor()) { return 0; }
         const int c = m_airspace->updateMultipleAircraftEnabled(callsigns, enabled);
+        if (c > 0) { this->publishAircraftInRange(); }
         return c;
     }
 
@@ -1189,6 +1220,7 @@ namespace BlackCore::Context
     {
         if (!canUseAirspaceMonitor()) { return; }
         m_airspace->updateMarkAllAsNotRendered();
+        this->publishAircraftInRange();
     }
 
     CLength CContextNetwork::getCGFromDB(const CCallsign &callsign) const
@@ -58,6 +58,10 @@ namespace BlackMisc
         class CAircraftSituation;
         class CCallsign;
     }
+    namespace Simulation
+    {
+        class CAircraftInRangeJournal;
+    }
 }
 
 namespace BlackCore
@@ -412,6 +416,8 @@ namespace BlackCore
             QTimer *m_requestAircraftDataTimer = nullptr; //!< general updates such as frequencies, see requestAircraftDataUpdates()
             QTimer *m_requestAtisTimer = nullptr; //!< general updates such as ATIS
             QTimer *m_staggeredMatchingTimer = nullptr; //!< staggered update
+            QTimer *m_aircraftInRangeJournalTimer = nullptr; //!< caps the rate of published aircraft in range deltas
+            BlackMisc::Simulation::CAircraftInRangeJournal *m_aircraftInRangeJournal = nullptr; //!< aircraft in range for remote contexts (shared state)
             int m_simulatorConnected = 0; //!< how often a simulator has been connected
             BlackMisc::Simulation::CSimulatorInfo m_lastConnectedSim; //!< last connected sim.
 
@@ -439,6 +445,10 @@ namespace BlackCore
             //! An ATIS has been received
             void onChangedAtisReceived(const BlackMisc::Aviation::CCallsign &callsign);
 
+            //! Publish the changed aircraft in range to the remote contexts
+            //! \remark called periodically and before signals about added, removed, enabled or rendered aircraft
+            void publishAircraftInRange();
+
             //! Connection status changed
             void onFsdConnectionStatusChanged(const BlackMisc::Network::CConnectionStatus &from, const BlackMisc::Network::CConnectionStatus &to);
 
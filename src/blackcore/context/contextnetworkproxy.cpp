@@ -2,6 +2,9 @@
 // SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
 
 #include "blackcore/context/contextnetworkproxy.h"
+#include "blackcore/corefacade.h"
+#include "blackmisc/simulation/aircraftinrangejournal.h"
+#include "blackmisc/sharedstate/datalinkdbus.h"
 #include "blackmisc/dbus.h"
 #include "blackmisc/dbusserver.h"
 #include "blackmisc/genericdbusinterface.h"
@@ -27,6 +30,13 @@ namespace BlackCore::Context
             serviceName, IContextNetwork::ObjectPath(), IContextNetwork::InterfaceName(),
             connection, this);
         this->relaySignals(serviceName, connection);
+
+        // aircraft in range published as deltas by the core, see CContextNetwork::publishAircraftInRange
+        if (runtime && runtime->getDataLinkDBus())
+        {
+            m_aircraftInRange = new CAircraftInRangeReplica(this);
+            m_aircraftInRange->initialize(runtime->getDataLinkDBus());
+        }
     }
 
     void CContextNetworkProxy::unitTestRelaySignals()
@@ -100,29 +110,39 @@ namespace BlackCore::Context
 
     CSimulatedAircraftList CContextNetworkProxy::getAircraftInRange() const
     {
+        if (this->isAircraftInRangeSynchronized()) { return m_aircraftInRange->getAircraftInRange(); }
         return m_dBusInterface->callDBusRet<BlackMisc::Simulation::CSimulatedAircraftList>(QLatin1String("getAircraftInRange"));
     }
 
     CCallsignSet CContextNetworkProxy::getAircraftInRangeCallsigns() const
     {
+        if (this->isAircraftInRangeSynchronized()) { return m_aircraftInRange->getAircraftInRange().getCallsigns(); }
         return m_dBusInterface->callDBusRet<BlackMisc::Aviation::CCallsignSet>(QLatin1String("getAircraftInRangeCallsigns"));
     }
 
     int CContextNetworkProxy::getAircraftInRangeCount() const
     {
+        if (this->isAircraftInRangeSynchronized()) { return m_aircraftInRange->getAircraftInRange().sizeInt(); }
         return m_dBusInterface->callDBusRet<int>(QLatin1String("getAircraftInRangeCount"));
     }
 
     bool CContextNetworkProxy::isAircraftInRange(const CCallsign &callsign) const
     {
+        if (this->isAircraftInRangeSynchronized()) { return m_aircraftInRange->getAircraftInRange().containsCallsign(callsign); }
         return m_dBusInterface->callDBusRet<bool>(QLatin1String("isAircraftInRange"), callsign);
     }
 
     CSimulatedAircraft CContextNetworkProxy::getAircraftInRangeForCallsign(const CCallsign &callsign) const
     {
+        if (this->isAircraftInRangeSynchronized()) { return m_aircraftInRange->getAircraftInRange().findFirstByCallsign(callsign); }
         return m_dBusInterface->callDBusRet<BlackMisc::Simulation::CSimulatedAircraft>(QLatin1String("getAircraftInRangeForCallsign"), callsign);
     }
 
+    bool CContextNetworkProxy::isAircraftInRangeSynchronized() const
+    {
+        return m_aircraftInRange && m_aircraftInRange->isSynchronized();
+    }
+
     CAtcStationList CContextNetworkProxy::getOnlineStationsForFrequency(const CFrequency &frequency) const
     {
         return m_dBusInterface->callDBusRet<BlackMisc::Aviation::CAtcStationList>(QLatin1String("getOnlineStationsForFrequency"), frequency);
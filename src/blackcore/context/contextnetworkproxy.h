@@ -46,6 +46,7 @@ namespace BlackMisc
     namespace Simulation
     {
         class CAircraftModel;
+        class CAircraftInRangeReplica;
     }
 }
 
@@ -254,10 +255,14 @@ namespace BlackCore
 
         private:
             BlackMisc::CGenericDBusInterface *m_dBusInterface; /*!< DBus interface */
+            BlackMisc::Simulation::CAircraftInRangeReplica *m_aircraftInRange = nullptr; //!< aircraft in range as published by the core, receiving only deltas
 
             //! Relay connection signals to local signals.
             void relaySignals(const QString &serviceName, QDBusConnection &connection);
 
+            //! Aircraft in range replica synchronized with the core, otherwise the aircraft are fetched via DBus
+            bool isAircraftInRangeSynchronized() const;
+
         protected:
             //! Constructor
             CContextNetworkProxy(CCoreFacadeConfig::ContextMode mode, CCoreFacade *runtime) : IContextNetwork(mode, runtime), m_dBusInterface(nullptr) {}
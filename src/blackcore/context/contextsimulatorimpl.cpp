@@ -538,6 +538,7 @@ namespace BlackCore::Context
         m_wasSimulating = false;
         m_matchingMessages.clear();
         m_failoverAddingCounts.clear();
+        m_pendingBatchMatching.clear();
 
         // try to connect to simulator
         const bool connected = simulator->connectTo();
@@ -632,6 +633,7 @@ namespace BlackCore::Context
 
     void CContextSimulator::unloadSimulatorPlugin()
     {
+        m_aircraftMatcher.cancelBatchMatching();
         if (!m_simulatorPlugin.first.isUnspecified())
         {
             ISimulator *simulator = m_simulatorPlugin.second;
@@ -671,6 +673,7 @@ namespace BlackCore::Context
         const CCallsign callsign = remoteAircraft.getCallsign();
         BLACK_VERIFY_X(!callsign.isEmpty(), Q_FUNC_INFO, "Remote aircraft with empty callsign");
         if (callsign.isEmpty()) { return; }
+        m_pendingBatchMatching.remove(callsign); // outdates a pending batch result
 
         // here we find the best simulator model for a resolved model
         // in the first step we already tried to find accurate ICAO codes etc.
@@ -678,8 +681,19 @@ namespace BlackCore::Context
         MatchingLog whatToLog = m_logMatchingMessages;
         CStatusMessageList matchingMessages;
         CStatusMessageList *pMatchingMessages = m_logMatchingMessages > 0 ? &matchingMessages : nullptr;
-        CAircraftModel aircraftModel = m_aircraftMatcher.getClosestMatch(remoteAircraft, whatToLog, pMatchingMessages, true);
-        Q_ASSERT_X(remoteAircraft.getCallsign() == aircraftModel.getCallsign(), Q_FUNC_INFO, "Mismatching callsigns");
+        const CAircraftModel aircraftModel = m_aircraftMatcher.getClosestMatch(remoteAircraft, whatToLog, pMatchingMessages, true);
+        this->applyMatchedModel(remoteAircraft, aircraftModel, matchingMessages);
+    }
+
+    void CContextSimulator::applyMatchedModel(const CSimulatedAircraft &remoteAircraft, const CAircraftModel &matchedModel, const CStatusMessageList &matchingMessages)
+    {
+        if (!this->isSimulatorPluginAvailable()) { return; }
+
+        const CCallsign callsign = remoteAircraft.getCallsign();
+        CAircraftModel aircraftModel(matchedModel);
+        CStatusMessageList messages(matchingMessages);
+        CStatusMessageList *pMatchingMessages = m_logMatchingMessages > 0 ? &messages : nullptr;
+        Q_ASSERT_X(callsign == aircraftModel.getCallsign(), Q_FUNC_INFO, "Mismatching callsigns");
 
         // decide CG
         const CLength cgModel = aircraftModel.getCG();
@@ -729,7 +743,7 @@ namespace BlackCore::Context
         CCallsign::addLogDetailsToList(pMatchingMessages, callsign, QStringLiteral("Logically added remote aircraft: %1").arg(aircraftAfterModelApplied.toQString()));
 
         this->clearMatchingMessages(callsign);
-        this->addMatchingMessages(callsign, matchingMessages);
+        this->addMatchingMessages(callsign, messages);
 
         // done
         emit this->modelMatchingCompleted(aircraftAfterModelApplied);
@@ -737,6 +751,7 @@ namespace BlackCore::Context
 
     void CContextSimulator::xCtxRemovedRemoteAircraft(const CCallsign &callsign)
     {
+        m_pendingBatchMatching.remove(callsign);
         if (!this->isSimulatorAvailable()) { return; }
         m_simulatorPlugin.second->logicallyRemoveRemoteAircraft(callsign);
         m_failoverAddingCounts.remove(callsign);
@@ -752,13 +767,21 @@ namespace BlackCore::Context
             Q_ASSERT_X(networkContext, Q_FUNC_INFO, "Need context");
             Q_ASSERT_X(networkContext->isLocalObject(), Q_FUNC_INFO, "Need local object");
 
-            // initially add aircraft
+            // initially add aircraft, matched in parallel
             const CSimulatedAircraftList aircraft = networkContext->getAircraftInRange();
-            for (const CSimulatedAircraft &simulatedAircraft : aircraft)
-            {
-                BLACK_VERIFY_X(!simulatedAircraft.getCallsign().isEmpty(), Q_FUNC_INFO, "Need callsign");
-                this->xCtxAddedRemoteAircraftReadyForModelMatching(simulatedAircraft);
-            }
+            BLACK_VERIFY_X(!aircraft.containsBy([](const CSimulatedAircraft &a) { return a.getCallsign().isEmpty(); }), Q_FUNC_INFO, "Need callsign");
+            const CSimulatedAircraftList batch = aircraft.findBy([](const CSimulatedAircraft &a) { return !a.getCallsign().isEmpty(); });
+            const quint64 batchGeneration = ++m_batchMatchingGeneration;
+            for (const CSimulatedAircraft &a : batch) { m_pendingBatchMatching.insert(a.getCallsign(), batchGeneration); }
+            m_aircraftMatcher.getClosestMatchesAsync(batch, m_logMatchingMessages, true, this, [this, batchGeneration](const CAircraftMatcher::MatchingResult &result) {
+                // the aircraft can have left, been rematched or changed while being matched
+                const CCallsign &callsign = result.remoteAircraft.getCallsign();
+                const auto it = m_pendingBatchMatching.find(callsign);
+                if (it == m_pendingBatchMatching.end() || it.value() != batchGeneration) { return; }
+                m_pendingBatchMatching.erase(it);
+                if (!this->isAircraftInRange(callsign)) { return; }
+                this->applyMatchedModel(result.remoteAircraft, result.matchedModel, result.log);
+            });
             m_initallyAddAircraft = false;
         }
 
@@ -793,6 +816,7 @@ namespace BlackCore::Context
     void CContextSimulator::xCtxChangedRemoteAircraftModel(const CSimulatedAircraft &aircraft, const BlackMisc::CIdentifier &originator)
     {
         if (CIdentifiable::isMyIdentifier(originator)) { return; }
+        m_pendingBatchMatching.remove(aircraft.getCallsign());
         if (!this->isSimulatorAvailable()) { return; }
         m_simulatorPlugin.second->changeRemoteAircraftModel(aircraft);
     }
@@ -829,6 +853,7 @@ namespace BlackCore::Context
             m_aircraftMatcher.clearMatchingStatistics();
             m_matchingMessages.clear();
             m_failoverAddingCounts.clear();
+            m_pendingBatchMatching.clear();
 
             if (m_simulatorPlugin.second) // check in case the plugin has been unloaded
             {
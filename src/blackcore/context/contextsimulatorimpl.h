@@ -295,6 +295,9 @@ namespace BlackCore
             //! \ingroup crosscontextfunction
             void xCtxAddedRemoteAircraftReadyForModelMatching(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft);
 
+            //! Apply the matched model and logically add the remote aircraft to the simulator
+            void applyMatchedModel(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, const BlackMisc::Simulation::CAircraftModel &matchedModel, const BlackMisc::CStatusMessageList &matchingMessages);
+
             //! Remove remote aircraft
             //! \ingroup crosscontextfunction
             void xCtxRemovedRemoteAircraft(const BlackMisc::Aviation::CCallsign &callsign);
@@ -389,6 +392,8 @@ namespace BlackCore
             QPair<BlackMisc::Simulation::CSimulatorPluginInfo, QPointer<ISimulator>> m_simulatorPlugin; //!< Currently loaded simulator plugin
             QMap<BlackMisc::Aviation::CCallsign, BlackMisc::CStatusMessageList> m_matchingMessages; //!< all matching log messages per callsign
             QMap<BlackMisc::Aviation::CCallsign, int> m_failoverAddingCounts;
+            QMap<BlackMisc::Aviation::CCallsign, quint64> m_pendingBatchMatching; //!< aircraft with a pending batch matching result, removed when matched, rematched, changed or removed
+            quint64 m_batchMatchingGeneration = 0; //!< increased for each batch matching
             CPluginManagerSimulator *m_plugins = nullptr; //!< plugin manager
             BlackMisc::CRegularThread m_listenersThread; //!< waiting for plugin
             CWeatherManager m_weatherManager { this }; //!< weather management
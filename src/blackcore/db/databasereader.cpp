@@ -14,9 +14,11 @@
 #include "blackmisc/logcategories.h"
 #include "blackmisc/logmessage.h"
 #include "blackmisc/verify.h"
+#include "blackmisc/jsonstreamreader.h"
 
 #include <QStringBuilder>
 #include <QByteArray>
+#include <QJsonArray>
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QPointer>
@@ -229,7 +231,7 @@ namespace BlackCore::Db
         const bool ok = this->setHeaderInfoPart(datastoreResponse, nwReply);
         if (ok)
         {
-            const QString dataFileData = nwReply->readAll();
+            const QByteArray dataFileData = nwReply->readAll();
             nwReply->close(); // close asap
             datastoreResponse.setStringSize(dataFileData.size());
             if (dataFileData.isEmpty())
@@ -238,7 +240,7 @@ namespace BlackCore::Db
             }
             else
             {
-                CDatabaseReader::stringToDatastoreResponse(dataFileData, datastoreResponse);
+                CDatabaseReader::utf8ToDatastoreResponse(dataFileData, datastoreResponse);
             }
         }
         return datastoreResponse;
@@ -747,6 +749,61 @@ namespace BlackCore::Db
         }
     }
 
+    void CDatabaseReader::utf8ToDatastoreResponse(const QByteArray &jsonContent, JsonDatastoreResponse &datastoreResponse)
+    {
+        const int status = datastoreResponse.getHttpStatusCode();
+        if (jsonContent.isEmpty())
+        {
+            static const QString errorMsg = "Empty JSON string, status: %1, URL: '%2', load time: %3";
+            datastoreResponse.setMessage(CStatusMessage(static_cast<CDatabaseReader *>(nullptr),
+                                                        CStatusMessage::SeverityError,
+                                                        errorMsg.arg(status).arg(datastoreResponse.getUrlString(), datastoreResponse.getLoadTimeStringWithStartedHint())));
+            return;
+        }
+
+        const QByteArray utf8 = CDatabaseUtils::databaseJsonToUtf8(jsonContent);
+        QJsonArray data;
+        QString latest;
+        bool restricted = false;
+        CJsonStreamReader reader;
+        reader.onArrayObject({}, [&](const QJsonObject &object) { data.append(object); return true; });
+        reader.onArrayObject("data", [&](const QJsonObject &object) { data.append(object); return true; });
+        reader.onValue("latest", [&](const QJsonValue &value) { latest = value.toString(); return true; });
+        reader.onValue("restricted", [&](const QJsonValue &value) { restricted = value.toBool(); return true; });
+        if (utf8.isEmpty() || !reader.parse(utf8) || reader.isEmptyDocument())
+        {
+            const QString content = QString::fromUtf8(jsonContent);
+            if (CNetworkUtils::looksLikePhpErrorMessage(content))
+            {
+                static const QString errorMsg = "Looks like PHP errror, status %1, URL: '%2', msg: %3";
+                const QString phpErrorMessage = CNetworkUtils::removeHtmlPartsFromPhpErrorMessage(content);
+                datastoreResponse.setMessage(CStatusMessage(static_cast<CDatabaseReader *>(nullptr),
+                                                            CStatusMessage::SeverityError,
+                                                            errorMsg.arg(status).arg(datastoreResponse.getUrlString(), phpErrorMessage)));
+            }
+            else
+            {
+                static const QString errorMsg = "Empty JSON document, URL: '%1', load time: %2";
+                datastoreResponse.setMessage(CStatusMessage(static_cast<CDatabaseReader *>(nullptr),
+                                                            CStatusMessage::SeverityError,
+                                                            errorMsg.arg(datastoreResponse.getUrlString(), datastoreResponse.getLoadTimeStringWithStartedHint())));
+            }
+            return;
+        }
+
+        datastoreResponse.setJsonArray(data);
+        if (reader.isArrayDocument())
+        {
+            // directly an array, no further info
+            datastoreResponse.setLastModifiedTimestamp(QDateTime::currentDateTimeUtc());
+        }
+        else
+        {
+            datastoreResponse.setLastModifiedTimestamp(latest.isEmpty() ? QDateTime::currentDateTimeUtc() : CDatastoreUtility::parseTimestamp(latest));
+            datastoreResponse.setRestricted(restricted);
+        }
+    }
+
     bool CDatabaseReader::JsonDatastoreResponse::isLoadedFromDb() const
     {
         return this->getUrl().getHost() == getDbUrl().getHost();
@@ -281,6 +281,12 @@ namespace BlackCore::Db
         //! \private used also for samples, that`s why it is declared public
         static void stringToDatastoreResponse(const QString &jsonContent, CDatabaseReader::JsonDatastoreResponse &datastoreResponse);
 
+        //! Transform UTF-8 JSON data to response struct data
+        //! \remark parses the "data" array element by element without a QString conversion or a DOM of the whole content,
+        //!         the elements are collected in the JSON array of the response
+        //! \remark like stringToDatastoreResponse, an empty or malformed document is an error
+        static void utf8ToDatastoreResponse(const QByteArray &jsonContent, CDatabaseReader::JsonDatastoreResponse &datastoreResponse);
+
     signals:
         //! DB have been read
         void swiftDbDataRead(bool success);
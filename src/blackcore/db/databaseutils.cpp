@@ -8,12 +8,26 @@
 #include "blackmisc/fileutils.h"
 #include "blackmisc/compressutils.h"
 #include <QElapsedTimer>
+#include <QFile>
 
 using namespace BlackMisc;
 using namespace BlackMisc::Json;
 using namespace BlackMisc::Aviation;
 using namespace BlackMisc::Simulation;
 
+namespace
+{
+    //! Like BlackMisc::Json::looksLikeJson, but without copying the trimmed data
+    bool looksLikeJsonObject(const QByteArray &content)
+    {
+        const char *first = content.constBegin();
+        const char *last = content.constEnd() - 1;
+        while (first < last && QChar::isSpace(static_cast<uchar>(*first))) { ++first; }
+        while (last > first && QChar::isSpace(static_cast<uchar>(*last))) { --last; }
+        return first < last && *first == '{' && *last == '}';
+    }
+} // ns
+
 namespace BlackCore::Db
 {
     const QStringList &CDatabaseUtils::getLogCategories()
@@ -395,56 +409,67 @@ namespace BlackCore::Db
 
     QJsonDocument CDatabaseUtils::databaseJsonToQJsonDocument(const QString &content)
     {
-        static const QString compressed("swift:");
         if (content.isEmpty()) { return QJsonDocument(); }
-        QByteArray byteData;
-        if (Json::looksLikeJson(content))
+        const QByteArray byteData = CDatabaseUtils::databaseJsonToUtf8(content.toUtf8());
+        if (byteData.isEmpty()) { return QJsonDocument(); }
+        return QJsonDocument::fromJson(byteData);
+    }
+
+    QByteArray CDatabaseUtils::databaseJsonToUtf8(const QByteArray &content)
+    {
+        static const QByteArray compressed("swift:");
+        if (content.isEmpty()) { return QByteArray(); }
+        if (looksLikeJsonObject(content))
         {
             // uncompressed
-            byteData = content.toUtf8();
+            return content;
         }
-        else if (content.startsWith(compressed) && content.length() > compressed.length() + 3)
+
+        if (content.startsWith(compressed) && content.length() > compressed.length() + 3)
         {
-            do
-            {
-                // "swift:1234:base64encoded
-                const int cl = compressed.length();
-                const int contentIndex = content.indexOf(':', cl);
-                if (contentIndex < cl) break; // should not happen, malformed
-                const QString ls = content.mid(cl, contentIndex - cl); // content length
-                bool ok;
-                const qint32 size = ls.toInt(&ok);
-                if (!ok) break; // malformed size
-                if (size < 1) break;
-
-                QByteArray ba;
-                ba.append(content.mid(contentIndex));
-                ba = QByteArray::fromBase64(ba);
-                ba.insert(0, CCompressUtils::lengthHeader(size)); // adding 4 bytes length header
-                byteData = qUncompress(ba);
-            }
-            while (false);
+            // "swift:1234:base64encoded
+            const int cl = compressed.length();
+            const int contentIndex = content.indexOf(':', cl);
+            if (contentIndex < cl) { return QByteArray(); } // should not happen, malformed
+            bool ok;
+            const qint32 size = content.mid(cl, contentIndex - cl).toInt(&ok); // content length
+            if (!ok || size < 1) { return QByteArray(); } // malformed size
+
+            QByteArray ba = QByteArray::fromBase64(QByteArray::fromRawData(content.constData() + contentIndex, content.size() - contentIndex));
+            ba.insert(0, CCompressUtils::lengthHeader(size)); // adding 4 bytes length header
+            return qUncompress(ba);
         }
+        return QByteArray();
+    }
 
-        if (byteData.isEmpty()) { return QJsonDocument(); }
-        return QJsonDocument::fromJson(byteData);
+    QByteArray CDatabaseUtils::readUtf8FromDatabaseFile(const QString &filename)
+    {
+        QFile file(filename);
+        if (!file.open(QIODevice::ReadOnly)) { return QByteArray(); }
+        const qint64 size = file.size();
+        if (size < 1) { return QByteArray(); }
+
+        // memory mapped, the compressed format is decoded straight from the mapping
+        uchar *mapped = file.map(0, size);
+        if (!mapped) { return CDatabaseUtils::databaseJsonToUtf8(file.readAll()); }
+        const QByteArray raw = QByteArray::fromRawData(reinterpret_cast<const char *>(mapped), static_cast<int>(size));
+        QByteArray utf8 = CDatabaseUtils::databaseJsonToUtf8(raw);
+        if (utf8.constData() == raw.constData()) { utf8.detach(); } // uncompressed, copy before unmapping
+        file.unmap(mapped);
+        return utf8;
     }
 
     QJsonDocument CDatabaseUtils::readQJsonDocumentFromDatabaseFile(const QString &filename)
     {
-        const QString raw = CFileUtils::readFileToString(filename);
-        if (raw.isEmpty()) { return QJsonDocument(); }
-        return CDatabaseUtils::databaseJsonToQJsonDocument(raw);
+        const QByteArray utf8 = CDatabaseUtils::readUtf8FromDatabaseFile(filename);
+        if (utf8.isEmpty()) { return QJsonDocument(); }
+        return QJsonDocument::fromJson(utf8);
     }
 
     QJsonObject CDatabaseUtils::readQJsonObjectFromDatabaseFile(const QString &filename)
     {
-        const QString raw = CFileUtils::readFileToString(filename);
-        if (raw.isEmpty()) { return QJsonObject(); }
-
         // allow also compressed format
-        const QJsonDocument jsonDoc = CDatabaseUtils::databaseJsonToQJsonDocument(raw);
-        return jsonDoc.object();
+        return CDatabaseUtils::readQJsonDocumentFromDatabaseFile(filename).object();
     }
 
     QJsonObject CDatabaseUtils::readQJsonObjectFromDatabaseFile(const QString &directory, const QString &filename)
@@ -74,6 +74,13 @@ namespace BlackCore::Db
         //! Database JSON from content string, which can be compressed
         static QJsonDocument databaseJsonToQJsonDocument(const QString &content);
 
+        //! UTF-8 JSON from database content, which can be compressed
+        //! \remark works on the raw bytes, no QString conversion of multi-MB data
+        static QByteArray databaseJsonToUtf8(const QByteArray &content);
+
+        //! UTF-8 JSON from database JSON file (normally shared file), file is memory mapped
+        static QByteArray readUtf8FromDatabaseFile(const QString &filename);
+
         //! QJsonDocument from database JSON file (normally shared file)
         static QJsonDocument readQJsonDocumentFromDatabaseFile(const QString &filename);
 
@@ -703,7 +703,7 @@ namespace BlackCore::Db
 
         for (const auto &pair : fileContents)
         {
-            CWorker::fromTask(this, Q_FUNC_INFO, [pair, directory] {
+            CWorker::fromLongTask(this, Q_FUNC_INFO, [pair, directory] {
                 CFileUtils::writeStringToFile(CFileUtils::appendFilePaths(directory.absolutePath(), CDbInfo::entityToSharedName(pair.first)), pair.second);
             });
         }
@@ -610,7 +610,7 @@ namespace BlackCore::Db
 
         for (const auto &pair : fileContents)
         {
-            CWorker::fromTask(this, Q_FUNC_INFO, [pair, directory] {
+            CWorker::fromLongTask(this, Q_FUNC_INFO, [pair, directory] {
                 CFileUtils::writeStringToFile(CFileUtils::appendFilePaths(directory.absolutePath(), pair.first), pair.second);
             });
         }
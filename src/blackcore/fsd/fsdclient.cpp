@@ -36,6 +36,7 @@
 #include "blackcore/fsd/revbclientparts.h"
 #include "blackcore/fsd/rehost.h"
 #include "blackcore/fsd/mute.h"
+#include "blackcore/fsd/messagetokens.h"
 
 #include "blackmisc/aviation/flightplan.h"
 #include "blackmisc/network/rawfsdmessage.h"
@@ -47,11 +48,14 @@
 
 #include "blackconfig/buildconfig.h"
 
+#include <QElapsedTimer>
 #include <QHostAddress>
 #include <QStringBuilder>
 #include <QStringView>
 #include <QNetworkReply>
 
+#include <cstring>
+
 using namespace BlackConfig;
 using namespace BlackCore::Vatsim;
 using namespace BlackMisc;
@@ -64,6 +68,12 @@ using namespace BlackMisc::Simulation;
 
 namespace BlackCore::Fsd
 {
+    //! Whitespace as used for trimming raw lines
+    static bool isAsciiWhitespace(char c)
+    {
+        return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\v' || c == '\f';
+    }
+
     QString convertToUnicodeEscaped(const QString &str)
     {
         QString escaped;
@@ -160,6 +170,7 @@ namespace BlackCore::Fsd
         m_server = server;
         m_protocolRevision = protocolRev;
         m_fsdTextCodec = textCodec;
+        m_messageWriter.setCodec(textCodec);
     }
 
     void CFSDClient::setCallsign(const CCallsign &callsign)
@@ -813,28 +824,31 @@ namespace BlackCore::Fsd
         sendQueuedMessage(clientQuery);
     }
 
-    void CFSDClient::sendMessageString(const QString &message)
+    void CFSDClient::sendEncodedMessage(const QByteArray &message)
     {
         if (message.isEmpty()) { return; }
-        const QByteArray bufferEncoded = m_fsdTextCodec->fromUnicode(message);
-        if (m_printToConsole) { qDebug() << "FSD Sent=>" << bufferEncoded; }
-        if (!m_unitTestMode) { m_socket->write(bufferEncoded); }
+        if (m_printToConsole) { qDebug() << "FSD Sent=>" << message; }
+        if (!m_unitTestMode) { m_socket->write(message); }
 
-        // remove CR/LF and emit
-        emitRawFsdMessage(message.trimmed(), true);
+        // only decoded if raw messages are used, remove CR/LF and emit
+        if (m_unitTestMode || m_rawFsdMessagesEnabled)
+        {
+            const QString decoded = m_fsdTextCodec ? m_fsdTextCodec->toUnicode(message) : QString::fromUtf8(message);
+            emitRawFsdMessage(decoded.trimmed(), true);
+        }
     }
 
     void CFSDClient::sendQueuedMessage()
     {
         if (m_queuedFsdMessages.isEmpty()) { return; }
         const int s = m_queuedFsdMessages.size();
-        this->sendMessageString(m_queuedFsdMessages.dequeue());
+        this->sendEncodedMessage(m_queuedFsdMessages.dequeue());
 
         // send up to 6 at once
-        if (s > 5) { this->sendMessageString(m_queuedFsdMessages.dequeue()); }
-        if (s > 10) { this->sendMessageString(m_queuedFsdMessages.dequeue()); }
-        if (s > 20) { this->sendMessageString(m_queuedFsdMessages.dequeue()); }
-        if (s > 30) { this->sendMessageString(m_queuedFsdMessages.dequeue()); }
+        if (s > 5) { this->sendEncodedMessage(m_queuedFsdMessages.dequeue()); }
+        if (s > 10) { this->sendEncodedMessage(m_queuedFsdMessages.dequeue()); }
+        if (s > 20) { this->sendEncodedMessage(m_queuedFsdMessages.dequeue()); }
+        if (s > 30) { this->sendEncodedMessage(m_queuedFsdMessages.dequeue()); }
 
         // overload
         // no idea, if we ever get here
@@ -848,7 +862,7 @@ namespace BlackCore::Fsd
 
             for (int i = 0; i < sendNo; i++)
             {
-                this->sendMessageString(m_queuedFsdMessages.dequeue());
+                this->sendEncodedMessage(m_queuedFsdMessages.dequeue());
             }
         }
     }
@@ -856,7 +870,7 @@ namespace BlackCore::Fsd
     void CFSDClient::sendFsdMessage(const QString &message)
     {
         // UNIT tests
-        parseMessage(message);
+        parseMessage(m_fsdTextCodec ? m_fsdTextCodec->fromUnicode(message) : message.toUtf8());
     }
 
     QString CFSDClient::getConfiguredModelString(const CSimulatedAircraft &myAircraft) const
@@ -1228,7 +1242,7 @@ namespace BlackCore::Fsd
         }
     }
 
-    void CFSDClient::handlePilotDataUpdate(const QStringList &tokens)
+    void CFSDClient::handlePilotDataUpdate(const MessageTokens &tokens)
     {
         const PilotDataUpdate dataUpdate = PilotDataUpdate::fromTokens(tokens);
         const CCallsign callsign(dataUpdate.sender(), CCallsign::Aircraft);
@@ -1295,15 +1309,15 @@ namespace BlackCore::Fsd
         emit euroscopeSimDataUpdatedReceived(situation, parts, currentOffsetTime(data.sender()), data.m_model, data.m_livery);
     }
 
-    void CFSDClient::handleVisualPilotDataUpdate(const QStringList & /*tokens*/, MessageType /*messageType*/)
+    void CFSDClient::handleVisualPilotDataUpdate(const MessageTokens & /*tokens*/, MessageType /*messageType*/)
     {
 #if 0
         VisualPilotDataUpdate dataUpdate;
         switch (messageType)
         {
-        case MessageType::VisualPilotDataUpdate: dataUpdate = VisualPilotDataUpdate::fromTokens(tokens); break;
-        case MessageType::VisualPilotDataPeriodic: dataUpdate = VisualPilotDataPeriodic::fromTokens(tokens).toUpdate(); break;
-        case MessageType::VisualPilotDataStopped: dataUpdate = VisualPilotDataStopped::fromTokens(tokens).toUpdate(); break;
+        case MessageType::VisualPilotDataUpdate: dataUpdate = VisualPilotDataUpdate::fromTokens(tokens.toStringList()); break;
+        case MessageType::VisualPilotDataPeriodic: dataUpdate = VisualPilotDataPeriodic::fromTokens(tokens.toStringList()).toUpdate(); break;
+        case MessageType::VisualPilotDataStopped: dataUpdate = VisualPilotDataStopped::fromTokens(tokens.toStringList()).toUpdate(); break;
         default: qFatal("Precondition violated"); break;
         }
         const CCallsign callsign(dataUpdate.sender(), CCallsign::Aircraft);
@@ -1661,6 +1675,7 @@ namespace BlackCore::Fsd
         connect(rehostingSocket.get(), &QTcpSocket::connected, this, [this, rehostingSocket] {
             readDataFromSocket();
             CLogMessage(this).debug(u"Successfully switched server");
+            this->clearReadBuffer(); // incomplete line of the former server
             m_socket = rehostingSocket;
             m_rehosting = false;
             rehostingSocket->disconnect(this);
@@ -1980,6 +1995,7 @@ namespace BlackCore::Fsd
         m_queuedFsdMessages.clear();
         m_sentAircraftConfig = CAircraftParts::null();
         m_loginSince = -1;
+        this->clearReadBuffer();
     }
 
     void CFSDClient::clearState(const CCallsign &callsign)
@@ -2016,7 +2032,7 @@ namespace BlackCore::Fsd
     qint64 CFSDClient::averageOffsetTimeMs(const CCallsign &callsign, int maxLastValues) const
     {
         int count = 0;
-        return this->averageOffsetTimeMs(callsign, maxLastValues, count);
+        return this->averageOffsetTimeMs(callsign, count, maxLastValues);
     }
 
     bool CFSDClient::isInterimPositionSendingEnabledForServer() const
@@ -2144,6 +2160,24 @@ namespace BlackCore::Fsd
         return increaseStatisticsValue(identifier, QString::number(value));
     }
 
+    int CFSDClient::addToStatisticsValue(const QString &identifier, int value)
+    {
+        if (identifier.isEmpty() || !m_statistics) { return -1; }
+
+        QWriteLocker l(&m_lockStatistics);
+        int &v = m_callStatistics[identifier];
+        v += value;
+        return v;
+    }
+
+    void CFSDClient::setStatisticsValue(const QString &identifier, int value)
+    {
+        if (identifier.isEmpty() || !m_statistics) { return; }
+
+        QWriteLocker l(&m_lockStatistics);
+        m_callStatistics[identifier] = value;
+    }
+
     void CFSDClient::clearStatistics()
     {
         QWriteLocker l(&m_lockStatistics);
@@ -2207,38 +2241,140 @@ namespace BlackCore::Fsd
         quitAndWait();
     }
 
-    void CFSDClient::readDataFromSocketMaxLines(int maxLines)
+    void CFSDClient::readDataFromSocket()
     {
-        if (m_socket->bytesAvailable() < 1) { return; }
+        // re-entrant call, data are picked up by the running batch
+        if (m_readingFromSocket) { return; }
+        m_readingFromSocket = true;
 
-        int lines = 0;
+        // drain the socket into the reusable read buffer
+        const qint64 available = m_socket->bytesAvailable();
+        if (available > 0)
+        {
+            // drop the processed lines, only the unprocessed backlog is moved to the front
+            if (m_readBufferOffset > 0)
+            {
+                m_readBuffer.remove(0, m_readBufferOffset);
+                m_readBufferOffset = 0;
+            }
+
+            const int oldSize = m_readBuffer.size();
+            m_readBuffer.resize(oldSize + static_cast<int>(available));
+            const qint64 read = m_socket->read(m_readBuffer.data() + oldSize, available);
+            m_readBuffer.resize(oldSize + static_cast<int>(qMax(read, 0LL)));
+        }
+
+        const bool pendingLines = this->processReadBuffer();
+        m_readingFromSocket = false;
+
+        // deferred clear, the buffer is no longer referenced
+        if (m_readBufferClearPending) { this->clearReadBuffer(); }
+
+        if (pendingLines || m_socket->bytesAvailable() > 0)
+        {
+            // continue in the next event loop turn, timers and sending are not starved
+            QPointer<CFSDClient> myself(this);
+            QTimer::singleShot(0, this, [=] {
+                if (!sApp || sApp->isShuttingDown()) { return; }
+                if (myself) { myself->readDataFromSocket(); }
+            });
+        }
+    }
 
-        // reads at least one line if available
-        while (m_socket->canReadLine())
+    bool CFSDClient::processReadBuffer()
+    {
+        const char *data = m_readBuffer.constData();
+        const int size = m_readBuffer.size();
+
+        // split all complete lines in one pass
+        m_readBufferLines.clear();
+        for (int begin = m_readBufferOffset; begin < size;)
         {
-            const QByteArray dataEncoded = m_socket->readLine();
-            if (dataEncoded.isEmpty()) { continue; }
-            const QString data = m_fsdTextCodec->toUnicode(dataEncoded);
-            this->parseMessage(data);
-            lines++;
+            const void *lf = std::memchr(data + begin, '\n', static_cast<size_t>(size - begin));
+            if (!lf) { break; }
+            const int end = static_cast<int>(static_cast<const char *>(lf) - data) + 1;
+            m_readBufferLines.push_back(qMakePair(begin, end));
+            begin = end;
+        }
+        if (m_readBufferLines.isEmpty()) { return false; }
 
-            static constexpr int MaxLines = 75 - 1;
-            if (maxLines < 0) { maxLines = MaxLines; }
+        // only the latest position of a callsign in this batch is processed
+        QHash<QByteArray, int> latestPositions;
+        for (int i = 0; i < m_readBufferLines.size(); ++i)
+        {
+            const QByteArray callsign = positionCallsignFromRawLine(data + m_readBufferLines[i].first, m_readBufferLines[i].second - m_readBufferLines[i].first);
+            if (!callsign.isEmpty()) { latestPositions.insert(callsign, i); }
+        }
+
+        QElapsedTimer budget;
+        budget.start();
+        const qint64 budgetNs = static_cast<qint64>(m_readTimeBudgetMs) * 1000 * 1000;
+        int processed = 0;
+        int coalesced = 0;
+        for (int i = 0; i < m_readBufferLines.size(); ++i)
+        {
+            const int begin = m_readBufferLines[i].first;
+            const int length = m_readBufferLines[i].second - begin;
+            m_readBufferOffset = m_readBufferLines[i].second;
 
-            if (lines > maxLines)
+            const QByteArray callsign = positionCallsignFromRawLine(data + begin, length);
+            if (!callsign.isEmpty() && latestPositions.value(callsign) != i)
             {
-                static constexpr int DelayMs = 10;
-                const int newMax = qRound(1.2 * lines); // 20% more
-
-                CLogMessage(this).debug(u"ReadDataFromSocket has too many lines (>%1), will read again in %2ms") << MaxLines << DelayMs;
-                QPointer<CFSDClient> myself(this);
-                QTimer::singleShot(DelayMs, this, [=] {
-                    if (!sApp || sApp->isShuttingDown()) { return; }
-                    if (myself) { myself->readDataFromSocketMaxLines(newMax); }
-                });
-                break;
+                coalesced++;
+                continue;
             }
+
+            // raw data, buffer is not modified while parsing (see m_readingFromSocket)
+            this->parseMessage(QByteArray::fromRawData(data + begin, length));
+            processed++;
+
+            // disconnected by a handler, remaining lines are obsolete
+            if (m_readBufferClearPending) { break; }
+            if (budget.nsecsElapsed() > budgetNs) { break; }
+        }
+
+        const bool clear = m_readBufferClearPending;
+        const bool pendingLines = !clear && m_readBufferOffset < m_readBufferLines.back().second;
+        if (m_statistics)
+        {
+            this->addToStatisticsValue(QStringLiteral("readDataFromSocket.batches"), 1);
+            this->addToStatisticsValue(QStringLiteral("readDataFromSocket.lines"), processed);
+            this->addToStatisticsValue(QStringLiteral("readDataFromSocket.coalescedPositions"), coalesced);
+            if (pendingLines) { this->addToStatisticsValue(QStringLiteral("readDataFromSocket.budgetExceeded"), 1); }
+            this->setStatisticsValue(QStringLiteral("readDataFromSocket.linesLastBatch"), processed);
+            this->setStatisticsValue(QStringLiteral("readDataFromSocket.backlogBytes"), clear ? 0 : size - m_readBufferOffset);
+        }
+        return pendingLines;
+    }
+
+    QByteArray CFSDClient::positionCallsignFromRawLine(const char *line, int size)
+    {
+        // @N:CALLSIGN:...
+        int begin = 0;
+        while (begin < size && isAsciiWhitespace(line[begin])) { ++begin; }
+        if (begin >= size || line[begin] != '@') { return {}; }
+
+        const char *end = line + size;
+        const char *first = static_cast<const char *>(std::memchr(line + begin, ':', static_cast<size_t>(size - begin)));
+        if (!first) { return {}; }
+        const char *second = static_cast<const char *>(std::memchr(first + 1, ':', static_cast<size_t>(end - first - 1)));
+        if (!second || second == first + 1) { return {}; }
+        return QByteArray::fromRawData(first + 1, static_cast<int>(second - first - 1));
+    }
+
+    void CFSDClient::clearReadBuffer()
+    {
+        // called by a handler (e.g. disconnect) while the lines of the buffer are parsed
+        if (m_readingFromSocket)
+        {
+            m_readBufferClearPending = true;
+            return;
         }
+
+        m_readBuffer.clear();
+        m_readBufferOffset = 0;
+        m_readBufferLines.clear();
+        m_readBufferClearPending = false;
     }
 
     QString CFSDClient::socketErrorString(QAbstractSocket::SocketError error) const
@@ -2257,93 +2393,98 @@ namespace BlackCore::Fsd
         return metaEnum.valueToKey(error);
     }
 
-    void CFSDClient::parseMessage(const QString &lineRaw)
+    void CFSDClient::parseMessage(const QByteArray &lineEncoded)
     {
-        MessageType messageType = MessageType::Unknown;
-        QString cmd;
-        const QString line = lineRaw.trimmed();
+        // trim on the raw data, the line is only decoded if really needed
+        const char *data = lineEncoded.constData();
+        int begin = 0;
+        int end = lineEncoded.size();
+        while (begin < end && isAsciiWhitespace(data[begin])) { ++begin; }
+        while (end > begin && isAsciiWhitespace(data[end - 1])) { --end; }
 
-        if (m_printToConsole) { qDebug() << "FSD Recv=>" << line; }
-        emitRawFsdMessage(line, false);
+        const auto decodedLine = [&] {
+            return m_fsdTextCodec ? m_fsdTextCodec->toUnicode(data + begin, end - begin) : QString::fromUtf8(data + begin, end - begin);
+        };
 
-        for (const QString &str : makeKeysRange(std::as_const(m_messageTypeMapping)))
+        if (m_printToConsole || m_unitTestMode || m_rawFsdMessagesEnabled)
         {
-            if (line.startsWith(str))
-            {
-                cmd = str;
-                messageType = m_messageTypeMapping.value(str, MessageType::Unknown);
-                break;
-            }
+            const QString line = decodedLine();
+            if (m_printToConsole) { qDebug() << "FSD Recv=>" << line; }
+            emitRawFsdMessage(line, false);
         }
 
+        int pduLength = 0;
+        const MessageType messageType = messageTypeFromRawLine(data + begin, end - begin, pduLength);
+
         // statistics
         if (m_statistics)
         {
             increaseStatisticsValue(QStringLiteral("parseMessage"), this->messageTypeToString(messageType));
         }
 
-        if (messageType != MessageType::Unknown)
+        if (messageType == MessageType::Unknown)
         {
-            // Cutoff the cmd from the beginning
-            const QString payload = line.mid(cmd.size()).trimmed();
+            handleUnknownPacket(decodedLine());
+            return;
+        }
 
-            // We expected a payload, but there is nothing
-            if (payload.length() == 0) { return; }
+        // Cutoff the cmd from the beginning
+        begin += pduLength;
+        while (begin < end && isAsciiWhitespace(data[begin])) { ++begin; }
 
-            const QStringList tokens = payload.split(':');
-            switch (messageType)
-            {
-            // ignored ones
-            case MessageType::AddAtc:
-            case MessageType::AddPilot:
-            case MessageType::ServerHeartbeat:
-            case MessageType::ProController:
-            case MessageType::ClientIdentification:
-            case MessageType::RegistrationInfo:
-            case MessageType::RevBPilotDescription:
-
-                break;
-
-            // handled ones
-            case MessageType::AtcDataUpdate: handleAtcDataUpdate(tokens); break;
+        // We expected a payload, but there is nothing
+        if (begin >= end) { return; }
+
+        // tokens are views on the encoded line, handlers of frequent packets decode only the fields they need
+        const MessageTokens tokens(lineEncoded, begin, end, m_fsdTextCodec);
+        switch (messageType)
+        {
+        // ignored ones
+        case MessageType::AddAtc:
+        case MessageType::AddPilot:
+        case MessageType::ServerHeartbeat:
+        case MessageType::ProController:
+        case MessageType::ClientIdentification:
+        case MessageType::RegistrationInfo:
+        case MessageType::RevBPilotDescription:
+
+            break;
+
+        // handled ones
+        case MessageType::AtcDataUpdate: handleAtcDataUpdate(tokens.toStringList()); break;
 #ifdef SWIFT_VATSIM_SUPPORT
-            case MessageType::AuthChallenge: handleAuthChallenge(tokens); break;
-            case MessageType::AuthResponse: handleAuthResponse(tokens); break;
+        case MessageType::AuthChallenge: handleAuthChallenge(tokens.toStringList()); break;
+        case MessageType::AuthResponse: handleAuthResponse(tokens.toStringList()); break;
 #endif
-            case MessageType::ClientQuery: handleClientQuery(tokens); break;
-            case MessageType::ClientResponse: handleClientResponse(tokens); break;
-            case MessageType::DeleteATC: handleDeleteATC(tokens); break;
-            case MessageType::DeletePilot: handleDeletePilot(tokens); break;
-            case MessageType::FlightPlan: handleFlightPlan(tokens); break;
+        case MessageType::ClientQuery: handleClientQuery(tokens.toStringList()); break;
+        case MessageType::ClientResponse: handleClientResponse(tokens.toStringList()); break;
+        case MessageType::DeleteATC: handleDeleteATC(tokens.toStringList()); break;
+        case MessageType::DeletePilot: handleDeletePilot(tokens.toStringList()); break;
+        case MessageType::FlightPlan: handleFlightPlan(tokens.toStringList()); break;
 #ifdef SWIFT_VATSIM_SUPPORT
-            case MessageType::FsdIdentification: handleFsdIdentification(tokens); break;
+        case MessageType::FsdIdentification: handleFsdIdentification(tokens.toStringList()); break;
 #endif
-            case MessageType::KillRequest: handleKillRequest(tokens); break;
-            case MessageType::PilotDataUpdate: handlePilotDataUpdate(tokens); break;
-            case MessageType::Ping: handlePing(tokens); break;
-            case MessageType::Pong: handlePong(tokens); break;
-            case MessageType::ServerError: handleServerError(tokens); break;
-            case MessageType::TextMessage: handleTextMessage(tokens); break;
-            case MessageType::PilotClientCom: handleCustomPilotPacket(tokens); break;
-            case MessageType::RevBClientParts: handleRevBClientPartsPacket(tokens); break;
-            case MessageType::VisualPilotDataUpdate:
-            case MessageType::VisualPilotDataPeriodic:
-            case MessageType::VisualPilotDataStopped: handleVisualPilotDataUpdate(tokens, messageType); break;
-            case MessageType::VisualPilotDataToggle: handleVisualPilotDataToggle(tokens); break;
-            case MessageType::EuroscopeSimData: handleEuroscopeSimData(tokens); break;
-            case MessageType::Rehost: handleRehost(tokens); break;
-            case MessageType::Mute: handleMute(tokens); break;
-
-            // normally we should not get here
-            default:
-            case MessageType::Unknown:
-                handleUnknownPacket(tokens);
-                break;
-            }
-        }
-        else
-        {
-            handleUnknownPacket(line);
+        case MessageType::KillRequest: handleKillRequest(tokens.toStringList()); break;
+        case MessageType::PilotDataUpdate: handlePilotDataUpdate(tokens); break;
+        case MessageType::Ping: handlePing(tokens.toStringList()); break;
+        case MessageType::Pong: handlePong(tokens.toStringList()); break;
+        case MessageType::ServerError: handleServerError(tokens.toStringList()); break;
+        case MessageType::TextMessage: handleTextMessage(tokens.toStringList()); break;
+        case MessageType::PilotClientCom: handleCustomPilotPacket(tokens.toStringList()); break;
+        case MessageType::RevBClientParts: handleRevBClientPartsPacket(tokens.toStringList()); break;
+        case MessageType::VisualPilotDataUpdate:
+        case MessageType::VisualPilotDataPeriodic:
+        case MessageType::VisualPilotDataStopped: handleVisualPilotDataUpdate(tokens, messageType); break;
+        case MessageType::VisualPilotDataToggle: handleVisualPilotDataToggle(tokens.toStringList()); break;
+        case MessageType::EuroscopeSimData: handleEuroscopeSimData(tokens.toStringList()); break;
+        case MessageType::Rehost: handleRehost(tokens.toStringList()); break;
+        case MessageType::Mute: handleMute(tokens.toStringList()); break;
+
+        // normally we should not get here
+        default:
+        case MessageType::Unknown:
+            handleUnknownPacket(tokens.toStringList());
+            break;
         }
     }
 
@@ -10,6 +10,8 @@
 #include "blackcore/vatsim/vatsimsettings.h"
 #include "blackcore/fsd/enums.h"
 #include "blackcore/fsd/messagebase.h"
+#include "blackcore/fsd/messagetokens.h"
+#include "blackcore/fsd/messagewriter.h"
 
 #include "blackmisc/simulation/ownaircraftprovider.h"
 #include "blackmisc/simulation/remoteaircraftprovider.h"
@@ -44,6 +46,8 @@
 #include <QTextCodec>
 #include <QReadWriteLock>
 #include <QQueue>
+#include <QVector>
+#include <QByteArray>
 
 #include <atomic>
 
@@ -260,6 +264,13 @@ namespace BlackCore::Fsd
         bool isStatisticsEnabled() const { return m_statistics; }
         //! @}
 
+        //! @{
+        //! Time budget for processing received lines per event loop turn
+        //! \remark remaining lines are processed in the next turn
+        void setReadTimeBudgetMs(int budgetMs) { m_readTimeBudgetMs = qMax(1, budgetMs); }
+        int getReadTimeBudgetMs() const { return m_readTimeBudgetMs; }
+        //! @}
+
         //! Clear the statistics
         void clearStatistics();
 
@@ -343,7 +354,7 @@ namespace BlackCore::Fsd
         void sendPlaneInformationFsinn(const BlackMisc::Aviation::CCallsign &callsign);
         void sendAircraftConfiguration(const QString &receiver, const QString &aircraftConfigJson);
         //
-        void sendMessageString(const QString &message);
+        void sendEncodedMessage(const QByteArray &message);
         void sendQueuedMessage();
         //! @}
 
@@ -353,6 +364,12 @@ namespace BlackCore::Fsd
         int increaseStatisticsValue(const QString &identifier, int value);
         //! @}
 
+        //! Add value to the statistics counter for given identifier
+        int addToStatisticsValue(const QString &identifier, int value);
+
+        //! Set statistics value (gauge) for given identifier
+        void setStatisticsValue(const QString &identifier, int value);
+
         //! Message send to FSD
         template <class T>
         void sendQueuedMessage(const T &message)
@@ -363,7 +380,7 @@ namespace BlackCore::Fsd
                 this->sendDirectMessage(message);
                 return;
             }
-            m_queuedFsdMessages.enqueue(messageToFSDString(message));
+            m_queuedFsdMessages.enqueue(messageToFSDBytes(message, m_messageWriter));
         }
 
         //! Message send to FSD
@@ -371,7 +388,7 @@ namespace BlackCore::Fsd
         void sendDirectMessage(const T &message)
         {
             if (!message.isValid()) { return; }
-            this->sendMessageString(messageToFSDString(message));
+            this->sendEncodedMessage(messageToFSDBytes(message, m_messageWriter));
         }
 
         //! @{
@@ -415,9 +432,21 @@ namespace BlackCore::Fsd
 #endif
         void sendIncrementalAircraftConfig();
 
-        void readDataFromSocket() { this->readDataFromSocketMaxLines(); }
-        void readDataFromSocketMaxLines(int maxLines = -1);
-        void parseMessage(const QString &lineRaw);
+        //! Drain the socket into the read buffer and process the complete lines
+        void readDataFromSocket();
+
+        //! Process complete lines of the read buffer within the time budget
+        //! \return true if complete lines are left for the next turn
+        bool processReadBuffer();
+
+        //! Clear the read buffer
+        //! \remark while the buffer is processed, the clear is deferred until parsing stops
+        void clearReadBuffer();
+
+        //! Callsign of a position packet (raw data, not copied), empty for other packets
+        static QByteArray positionCallsignFromRawLine(const char *line, int size);
+
+        void parseMessage(const QByteArray &lineEncoded);
 
         QString socketErrorString(QAbstractSocket::SocketError error) const;
         static QString socketErrorToQString(QAbstractSocket::SocketError error);
@@ -438,8 +467,8 @@ namespace BlackCore::Fsd
         void handleDeleteATC(const QStringList &tokens);
         void handleDeletePilot(const QStringList &tokens);
         void handleTextMessage(const QStringList &tokens);
-        void handlePilotDataUpdate(const QStringList &tokens);
-        void handleVisualPilotDataUpdate(const QStringList &tokens, MessageType messageType);
+        void handlePilotDataUpdate(const MessageTokens &tokens);
+        void handleVisualPilotDataUpdate(const MessageTokens &tokens, MessageType messageType);
         void handleVisualPilotDataToggle(const QStringList &tokens);
         void handleEuroscopeSimData(const QStringList &tokens);
         void handlePing(const QStringList &tokens);
@@ -648,7 +677,16 @@ namespace BlackCore::Fsd
             return m_ownCallsign.asString();
         }
 
-        QQueue<QString> m_queuedFsdMessages;
+        QQueue<QByteArray> m_queuedFsdMessages; //!< already encoded messages
+        MessageWriter m_messageWriter; //!< reused buffer for outgoing messages, only used in the sending thread
+
+        // read buffer, data are consumed up to m_readBufferOffset
+        QByteArray m_readBuffer; //!< reused, keeps its capacity
+        int m_readBufferOffset = 0; //!< begin of unprocessed data
+        QVector<QPair<int, int>> m_readBufferLines; //!< complete lines of the current batch (begin, end)
+        bool m_readingFromSocket = false; //!< guard against re-entrant reads
+        bool m_readBufferClearPending = false; //!< cleared while processing, stop parsing and clear afterwards
+        std::atomic_int m_readTimeBudgetMs { 2 }; //!< processing time per event loop turn
 
         //! An illegal FSD state has been detected
         void handleIllegalFsdState(const QString &message);
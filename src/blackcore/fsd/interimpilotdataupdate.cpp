@@ -45,6 +45,16 @@ namespace BlackCore::Fsd
         return tokens;
     }
 
+    void InterimPilotDataUpdate::writeTo(MessageWriter &writer) const
+    {
+        std::uint32_t pbh;
+        packPBH(m_pitch, m_bank, m_heading, m_onGround, pbh);
+
+        writer.add(m_sender).add(m_receiver).add(QLatin1String("VI")); // VI = vatlib interim, see toTokens
+        writer.addFixed(m_latitude, 5).addFixed(m_longitude, 5);
+        writer.add(m_altitudeTrue).add(m_groundSpeed).add(pbh);
+    }
+
     InterimPilotDataUpdate InterimPilotDataUpdate::fromTokens(const QStringList &tokens)
     {
         if (tokens.size() < 8)
@@ -7,6 +7,7 @@
 #define BLACKCORE_FSD_INTERIMPILOTDATAUPDATE_H
 
 #include "blackcore/fsd/messagebase.h"
+#include "blackcore/fsd/messagewriter.h"
 
 namespace BlackCore::Fsd
 {
@@ -22,6 +23,9 @@ namespace BlackCore::Fsd
         //! Message converted to tokens
         QStringList toTokens() const;
 
+        //! Message written directly to the encoded buffer, same result as toTokens
+        void writeTo(MessageWriter &writer) const;
+
         //! Construct from tokens
         static InterimPilotDataUpdate fromTokens(const QStringList &tokens);
 
@@ -0,0 +1,214 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+#include "blackcore/fsd/messagetokens.h"
+
+#include <QTextCodec>
+#include <cstring>
+#include <limits>
+
+namespace BlackCore::Fsd
+{
+    namespace
+    {
+        bool isAsciiSpace(char c)
+        {
+            return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\v' || c == '\f';
+        }
+
+        //! Parse an integer like QString::toLongLong, i.e. surrounding whitespace and a sign are allowed
+        bool parseInteger(const char *data, int size, qint64 &value)
+        {
+            int begin = 0;
+            int end = size;
+            while (begin < end && isAsciiSpace(data[begin])) { ++begin; }
+            while (end > begin && isAsciiSpace(data[end - 1])) { --end; }
+            if (begin >= end) { return false; }
+
+            bool negative = false;
+            if (data[begin] == '-' || data[begin] == '+')
+            {
+                negative = data[begin] == '-';
+                ++begin;
+            }
+            if (begin >= end || end - begin > 18) { return false; } // 18 digits never overflow qint64
+
+            qint64 v = 0;
+            for (int i = begin; i < end; ++i)
+            {
+                const char c = data[i];
+                if (c < '0' || c > '9') { return false; }
+                v = v * 10 + (c - '0');
+            }
+            value = negative ? -v : v;
+            return true;
+        }
+    }
+
+    MessageType messageTypeFromRawLine(const char *line, int size, int &pduLength)
+    {
+        pduLength = 0;
+        if (!line || size < 1) { return MessageType::Unknown; }
+
+        const char c1 = size > 1 ? line[1] : '\0';
+        const char c2 = size > 2 ? line[2] : '\0';
+        const auto found = [&pduLength](MessageType type, int length) {
+            pduLength = length;
+            return type;
+        };
+
+        // trie over the first bytes, all PDU identifiers are ASCII
+        switch (line[0])
+        {
+        case '@': return found(MessageType::PilotDataUpdate, 1);
+        case '^': return found(MessageType::VisualPilotDataUpdate, 1);
+        case '%': return found(MessageType::AtcDataUpdate, 1);
+        case '#':
+            switch (c1)
+            {
+            case 'A':
+                if (c2 == 'A') { return found(MessageType::AddAtc, 3); }
+                if (c2 == 'P') { return found(MessageType::AddPilot, 3); }
+                break;
+            case 'D':
+                if (c2 == 'A') { return found(MessageType::DeleteATC, 3); }
+                if (c2 == 'P') { return found(MessageType::DeletePilot, 3); }
+                if (c2 == 'L') { return found(MessageType::ServerHeartbeat, 3); }
+                break;
+            case 'P':
+                if (c2 == 'C') { return found(MessageType::ProController, 3); }
+                break;
+            case 'S':
+                if (c2 == 'B') { return found(MessageType::PilotClientCom, 3); }
+                if (c2 == 'L') { return found(MessageType::VisualPilotDataPeriodic, 3); }
+                if (c2 == 'T') { return found(MessageType::VisualPilotDataStopped, 3); }
+                break;
+            case 'T':
+                if (c2 == 'M') { return found(MessageType::TextMessage, 3); }
+                break;
+            case 'M':
+                if (c2 == 'U') { return found(MessageType::Mute, 3); }
+                break;
+            default: break;
+            }
+            break;
+        case '$':
+            switch (c1)
+            {
+            case 'C':
+                if (c2 == 'Q') { return found(MessageType::ClientQuery, 3); }
+                if (c2 == 'R') { return found(MessageType::ClientResponse, 3); }
+                break;
+            case 'Z':
+                if (c2 == 'C') { return found(MessageType::AuthChallenge, 3); }
+                if (c2 == 'R') { return found(MessageType::AuthResponse, 3); }
+                break;
+            case 'P':
+                if (c2 == 'I') { return found(MessageType::Ping, 3); }
+                if (c2 == 'O') { return found(MessageType::Pong, 3); }
+                break;
+            case 'I':
+                if (c2 == 'D') { return found(MessageType::ClientIdentification, 3); }
+                break;
+            case 'D':
+                if (c2 == 'I') { return found(MessageType::FsdIdentification, 3); }
+                break;
+            case 'F':
+                if (c2 == 'P') { return found(MessageType::FlightPlan, 3); }
+                break;
+            case 'S':
+                if (c2 == 'F') { return found(MessageType::VisualPilotDataToggle, 3); }
+                break;
+            case 'E':
+                if (c2 == 'R') { return found(MessageType::ServerError, 3); }
+                break;
+            case 'X':
+                if (c2 == 'X') { return found(MessageType::Rehost, 3); }
+                break;
+            case '!':
+                if (c2 == '!') { return found(MessageType::KillRequest, 3); }
+                break;
+            default: break;
+            }
+            break;
+        case '-':
+            // IVAO only
+            if (c2 == 'D' && c1 == 'M') { return found(MessageType::RevBClientParts, 3); }
+            if (c2 == 'D' && c1 == 'P') { return found(MessageType::RevBPilotDescription, 3); }
+            break;
+        case '!':
+            // IVAO only
+            if (c1 == 'R') { return found(MessageType::RegistrationInfo, 2); }
+            break;
+        case 'S':
+            // Euroscope
+            if (size >= 7 && std::memcmp(line, "SIMDATA", 7) == 0) { return found(MessageType::EuroscopeSimData, 7); }
+            break;
+        default: break;
+        }
+        return MessageType::Unknown;
+    }
+
+    MessageTokens::MessageTokens(const QByteArray &line, int begin, int end, QTextCodec *codec) : m_line(line), m_codec(codec)
+    {
+        Q_ASSERT_X(begin >= 0 && end <= line.size() && begin <= end, Q_FUNC_INFO, "Wrong range");
+
+        // same as QString::split(':'), empty tokens are kept
+        // ':' is ASCII and never part of a multi-byte sequence in the FSD codecs
+        const char *data = m_line.constData();
+        int start = begin;
+        for (int i = begin; i < end; ++i)
+        {
+            if (data[i] != ':') { continue; }
+            m_tokens.append(qMakePair(start, i - start));
+            start = i + 1;
+        }
+        m_tokens.append(qMakePair(start, end - start));
+    }
+
+    QByteArray MessageTokens::raw(int index) const
+    {
+        Q_ASSERT_X(index >= 0 && index < m_tokens.size(), Q_FUNC_INFO, "Index out of range");
+        return QByteArray::fromRawData(this->tokenData(index), this->tokenSize(index));
+    }
+
+    QString MessageTokens::toQString(int index) const
+    {
+        Q_ASSERT_X(index >= 0 && index < m_tokens.size(), Q_FUNC_INFO, "Index out of range");
+        const int size = this->tokenSize(index);
+        if (size < 1) { return {}; }
+        return m_codec ? m_codec->toUnicode(this->tokenData(index), size) : QString::fromUtf8(this->tokenData(index), size);
+    }
+
+    int MessageTokens::toInt(int index) const
+    {
+        Q_ASSERT_X(index >= 0 && index < m_tokens.size(), Q_FUNC_INFO, "Index out of range");
+        qint64 value = 0;
+        if (!parseInteger(this->tokenData(index), this->tokenSize(index), value)) { return 0; }
+        if (value < std::numeric_limits<int>::min() || value > std::numeric_limits<int>::max()) { return 0; }
+        return static_cast<int>(value);
+    }
+
+    uint MessageTokens::toUInt(int index) const
+    {
+        Q_ASSERT_X(index >= 0 && index < m_tokens.size(), Q_FUNC_INFO, "Index out of range");
+        qint64 value = 0;
+        if (!parseInteger(this->tokenData(index), this->tokenSize(index), value)) { return 0; }
+        if (value < 0 || value > std::numeric_limits<uint>::max()) { return 0; }
+        return static_cast<uint>(value);
+    }
+
+    double MessageTokens::toDouble(int index) const
+    {
+        // raw data is not copied, QByteArray::toDouble uses the C locale like QString::toDouble
+        return this->raw(index).toDouble();
+    }
+
+    QStringList MessageTokens::toStringList() const
+    {
+        QStringList tokens;
+        tokens.reserve(m_tokens.size());
+        for (int i = 0; i < m_tokens.size(); ++i) { tokens.push_back(this->toQString(i)); }
+        return tokens;
+    }
+} // ns
@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#ifndef BLACKCORE_FSD_MESSAGETOKENS_H
+#define BLACKCORE_FSD_MESSAGETOKENS_H
+
+#include "blackcore/fsd/messagebase.h"
+#include "blackcore/blackcoreexport.h"
+
+#include <QByteArray>
+#include <QPair>
+#include <QString>
+#include <QStringList>
+#include <QVarLengthArray>
+
+class QTextCodec;
+
+namespace BlackCore::Fsd
+{
+    //! Classify a raw (still encoded) FSD line by its PDU identifier
+    //! \remark table driven on the first 1-3 bytes, no string allocation
+    //! \param line start of the (trimmed) line
+    //! \param size length of the line
+    //! \param pduLength length of the PDU identifier, 0 for unknown messages
+    BLACKCORE_EXPORT MessageType messageTypeFromRawLine(const char *line, int size, int &pduLength);
+
+    //! Zero-copy view on the ':' separated tokens of a raw FSD line
+    //! \remark tokens are only decoded to QString when requested
+    class BLACKCORE_EXPORT MessageTokens
+    {
+    public:
+        //! Default constructor
+        MessageTokens() {}
+
+        //! Split the payload range [begin, end) of the encoded line
+        //! \remark the line is implicitly shared, no copy of the data is made
+        MessageTokens(const QByteArray &line, int begin, int end, QTextCodec *codec);
+
+        //! Number of tokens
+        int size() const { return m_tokens.size(); }
+
+        //! No tokens?
+        bool isEmpty() const { return m_tokens.isEmpty(); }
+
+        //! Raw token, the returned byte array references the line data
+        QByteArray raw(int index) const;
+
+        //! Token decoded with the codec of the line
+        QString toQString(int index) const;
+
+        //! @{
+        //! Token as number, 0 if not a valid number (like QString::toInt etc.)
+        int toInt(int index) const;
+        uint toUInt(int index) const;
+        double toDouble(int index) const;
+        //! @}
+
+        //! All tokens decoded, same as splitting the decoded payload
+        QStringList toStringList() const;
+
+    private:
+        const char *tokenData(int index) const { return m_line.constData() + m_tokens[index].first; }
+        int tokenSize(int index) const { return m_tokens[index].second; }
+
+        QByteArray m_line; //!< shared, not copied
+        QTextCodec *m_codec = nullptr; //!< nullptr means UTF-8
+        QVarLengthArray<QPair<int, int>, 32> m_tokens; //!< offset and length per token
+    };
+} // ns
+
+#endif // guard
@@ -0,0 +1,149 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+#include "blackcore/fsd/messagewriter.h"
+
+#include <QTextCodec>
+#include <cmath>
+
+namespace BlackCore::Fsd
+{
+    MessageWriter::MessageWriter(QTextCodec *codec) : m_codec(codec)
+    {
+        // reserved capacity is kept when the buffer is resized to 0
+        m_buffer.reserve(256);
+    }
+
+    MessageWriter &MessageWriter::begin(const QString &pdu)
+    {
+        m_buffer.resize(0);
+        m_firstToken = true;
+        m_buffer.append(pdu.toLatin1()); // PDU identifiers are ASCII
+        return *this;
+    }
+
+    MessageWriter &MessageWriter::add(const QString &value)
+    {
+        this->separator();
+        const QChar *data = value.constData();
+        const int size = value.size();
+        for (int i = 0; i < size; ++i)
+        {
+            // only non ASCII strings need the codec
+            if (data[i].unicode() >= 0x80)
+            {
+                m_buffer.append(m_codec ? m_codec->fromUnicode(data + i, size - i) : QString(data + i, size - i).toUtf8());
+                return *this;
+            }
+            m_buffer.append(static_cast<char>(data[i].unicode()));
+        }
+        return *this;
+    }
+
+    MessageWriter &MessageWriter::add(QLatin1String value)
+    {
+        this->separator();
+        m_buffer.append(value.data(), value.size());
+        return *this;
+    }
+
+    MessageWriter &MessageWriter::add(qint64 value)
+    {
+        this->separator();
+        char digits[24];
+        int pos = sizeof(digits);
+        const bool negative = value < 0;
+        quint64 v = negative ? 0ULL - static_cast<quint64>(value) : static_cast<quint64>(value);
+        do
+        {
+            digits[--pos] = static_cast<char>('0' + v % 10);
+            v /= 10;
+        }
+        while (v > 0);
+        if (negative) { digits[--pos] = '-'; }
+        m_buffer.append(digits + pos, static_cast<int>(sizeof(digits)) - pos);
+        return *this;
+    }
+
+    MessageWriter &MessageWriter::addFixed(double value, int precision)
+    {
+        static constexpr double Pow10[] = { 1.0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9 };
+        static constexpr double MaxScaled = 1e12; // absolute error of the product stays far below TieTolerance
+        static constexpr double TieTolerance = 1e-3;
+
+        if (precision >= 0 && precision <= 9 && std::isfinite(value))
+        {
+            const double scaled = std::abs(value) * Pow10[precision];
+            if (scaled < MaxScaled)
+            {
+                const double integral = std::floor(scaled);
+                const double fraction = scaled - integral;
+
+                // close to a tie the product is not precise enough to decide the rounding direction
+                if (std::abs(fraction - 0.5) > TieTolerance)
+                {
+                    const qint64 rounded = static_cast<qint64>(integral) + (fraction > 0.5 ? 1 : 0);
+
+                    // QString::number keeps the sign of negative values rounded to 0, use the precise path for those
+                    const bool negative = std::signbit(value);
+                    if (rounded > 0 || !negative)
+                    {
+                        this->separator();
+                        this->appendScaled(rounded, negative, precision);
+                        return *this;
+                    }
+                }
+            }
+        }
+
+        // precise path, same algorithm as QString::number
+        this->separator();
+        m_buffer.append(QByteArray::number(value, 'f', precision));
+        return *this;
+    }
+
+    MessageWriter &MessageWriter::addTokens(const QStringList &tokens)
+    {
+        for (const QString &token : tokens) { this->add(token); }
+        return *this;
+    }
+
+    QByteArray MessageWriter::finish()
+    {
+        m_buffer.append("\r\n", 2);
+
+        // exact size copy, the buffer itself is reused
+        return QByteArray(m_buffer.constData(), m_buffer.size());
+    }
+
+    void MessageWriter::separator()
+    {
+        if (m_firstToken)
+        {
+            m_firstToken = false;
+            return;
+        }
+        m_buffer.append(':');
+    }
+
+    void MessageWriter::appendScaled(qint64 scaled, bool negative, int precision)
+    {
+        char digits[32];
+        int pos = sizeof(digits);
+        quint64 v = static_cast<quint64>(scaled);
+        for (int i = 0; i < precision; ++i)
+        {
+            digits[--pos] = static_cast<char>('0' + v % 10);
+            v /= 10;
+        }
+        if (precision > 0) { digits[--pos] = '.'; }
+        do
+        {
+            digits[--pos] = static_cast<char>('0' + v % 10);
+            v /= 10;
+        }
+        while (v > 0);
+        if (negative) { digits[--pos] = '-'; }
+        m_buffer.append(digits + pos, static_cast<int>(sizeof(digits)) - pos);
+    }
+} // ns
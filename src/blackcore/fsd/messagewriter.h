@@ -0,0 +1,92 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#ifndef BLACKCORE_FSD_MESSAGEWRITER_H
+#define BLACKCORE_FSD_MESSAGEWRITER_H
+
+#include "blackcore/blackcoreexport.h"
+
+#include <QByteArray>
+#include <QLatin1String>
+#include <QString>
+#include <QStringList>
+#include <type_traits>
+#include <utility>
+
+class QTextCodec;
+
+namespace BlackCore::Fsd
+{
+    //! Writes FSD messages directly into a reusable, encoded byte buffer
+    //! \remark avoids the QStringList/QString round trip of toTokens for frequently sent messages
+    class BLACKCORE_EXPORT MessageWriter
+    {
+    public:
+        //! Constructor
+        explicit MessageWriter(QTextCodec *codec = nullptr);
+
+        //! Codec used for strings, nullptr means UTF-8
+        void setCodec(QTextCodec *codec) { m_codec = codec; }
+
+        //! Start a new message with its PDU identifier
+        MessageWriter &begin(const QString &pdu);
+
+        //! @{
+        //! Append a token, tokens are separated by ':'
+        MessageWriter &add(const QString &value);
+        MessageWriter &add(QLatin1String value);
+        MessageWriter &add(qint64 value);
+        MessageWriter &add(int value) { return this->add(static_cast<qint64>(value)); }
+        MessageWriter &add(quint32 value) { return this->add(static_cast<qint64>(value)); }
+        //! @}
+
+        //! Append a double with fixed precision, same result as QString::number(value, 'f', precision)
+        MessageWriter &addFixed(double value, int precision);
+
+        //! Append all tokens
+        MessageWriter &addTokens(const QStringList &tokens);
+
+        //! Terminate the message with CR/LF and return it
+        //! \remark the internal buffer keeps its capacity for the next message
+        QByteArray finish();
+
+    private:
+        //! Separator if not the first token
+        void separator();
+
+        //! Append fixed point number from an already scaled (rounded) integer
+        void appendScaled(qint64 scaled, bool negative, int precision);
+
+        QByteArray m_buffer;
+        QTextCodec *m_codec = nullptr;
+        bool m_firstToken = true;
+    };
+
+    /*!
+     * Trait to detect whether a FSD message class has a direct serializer writeTo(MessageWriter &).
+     */
+    template <typename T, typename = std::void_t<>>
+    struct THasWriteTo : public std::false_type
+    {};
+    //! \cond
+    template <typename T>
+    struct THasWriteTo<T, std::void_t<decltype(std::declval<const T &>().writeTo(std::declval<MessageWriter &>()))>> : public std::true_type
+    {};
+    //! \endcond
+
+    //! Encoded message which will be send
+    //! \remark uses the direct serializer if available, otherwise the tokens
+    template <class T>
+    QByteArray messageToFSDBytes(const T &message, MessageWriter &writer)
+    {
+        if (!message.isValid()) { return {}; }
+        writer.begin(T::pdu());
+        if constexpr (THasWriteTo<T>::value) { message.writeTo(writer); }
+        else { writer.addTokens(message.toTokens()); }
+        return writer.finish();
+    }
+} // ns
+
+#endif // guard
@@ -7,6 +7,8 @@
 #define BLACKCORE_FSD_PILOTDATAUPDATE_H
 
 #include "blackcore/fsd/messagebase.h"
+#include "blackcore/fsd/messagewriter.h"
+#include "blackcore/fsd/messagetokens.h"
 #include "blackcore/fsd/enums.h"
 #include "blackmisc/aviation/transponder.h"
 
@@ -24,9 +26,16 @@ namespace BlackCore::Fsd
         //! Message converted to tokens
         QStringList toTokens() const;
 
+        //! Message written directly to the encoded buffer, same result as toTokens
+        void writeTo(MessageWriter &writer) const;
+
         //! Construct from tokens
         static PilotDataUpdate fromTokens(const QStringList &tokens);
 
+        //! Construct from raw tokens
+        //! \remark numeric fields are parsed without decoding them to strings
+        static PilotDataUpdate fromTokens(const MessageTokens &tokens);
+
         //! PDU identifier
         static QString pdu() { return "@"; }
 
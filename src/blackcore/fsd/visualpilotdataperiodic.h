@@ -7,6 +7,7 @@
 #define BLACKCORE_FSD_VISUALPILOTDATAPERIODIC_H
 
 #include "messagebase.h"
+#include "messagewriter.h"
 #include "enums.h"
 
 namespace BlackCore::Fsd
@@ -25,6 +26,9 @@ namespace BlackCore::Fsd
         //! Message converted to tokens
         QStringList toTokens() const;
 
+        //! Message written directly to the encoded buffer, same result as toTokens
+        void writeTo(MessageWriter &writer) const;
+
         //! Construct from tokens
         static VisualPilotDataPeriodic fromTokens(const QStringList &tokens);
 
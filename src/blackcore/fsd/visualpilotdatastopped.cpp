@@ -45,6 +45,15 @@ namespace BlackCore::Fsd
         return tokens;
     }
 
+    void VisualPilotDataStopped::writeTo(MessageWriter &writer) const
+    {
+        std::uint32_t pbh;
+        packPBH(m_pitch, m_bank, m_heading, false, pbh);
+
+        writer.add(m_sender).addFixed(m_latitude, 7).addFixed(m_longitude, 7).addFixed(m_altitudeTrue, 2).addFixed(m_heightAgl, 2).add(pbh);
+        writer.addFixed(m_noseGearAngle, 2);
+    }
+
     VisualPilotDataStopped VisualPilotDataStopped::fromTokens(const QStringList &tokens)
     {
         if (tokens.size() < 6)
@@ -59,6 +59,17 @@ namespace BlackCore::Fsd
         return tokens;
     }
 
+    void VisualPilotDataUpdate::writeTo(MessageWriter &writer) const
+    {
+        std::uint32_t pbh;
+        packPBH(m_pitch, m_bank, m_heading, false, pbh);
+
+        writer.add(m_sender).addFixed(m_latitude, 7).addFixed(m_longitude, 7).addFixed(m_altitudeTrue, 2).addFixed(m_heightAgl, 2).add(pbh);
+        writer.addFixed(m_xVelocity, 4).addFixed(m_yVelocity, 4).addFixed(m_zVelocity, 4);
+        writer.addFixed(m_pitchRadPerSec, 4).addFixed(m_headingRadPerSec, 4).addFixed(m_bankRadPerSec, 4);
+        writer.addFixed(m_noseGearAngle, 2);
+    }
+
     VisualPilotDataUpdate VisualPilotDataUpdate::fromTokens(const QStringList &tokens)
     {
         if (tokens.size() < 12)
@@ -744,14 +744,30 @@ namespace BlackCore
         Q_ASSERT_X(CThreadUtils::isInThisThread(this), Q_FUNC_INFO, "Needs to run in object thread");
         Q_ASSERT_X(snapshot.generatingThreadName() != QThread::currentThread()->objectName(), Q_FUNC_INFO, "Expect snapshot from background thread");
 
+        // same restrictions as before: only the diff to the previous snapshot is relevant,
+        // from time to time all enabled aircraft are reconciled with the simulator state
+        // to fix failed adds, aircraft removed by the simulator and skipped snapshots
+        const qint64 now = QDateTime::currentMSecsSinceEpoch();
+        const bool fullReconcile = !snapshot.hasDiff() || snapshot.isRestrictionChanged() || m_lastSnapshotFullReconcileMs < 0 || (now - m_lastSnapshotFullReconcileMs) > SnapshotFullReconcileMs;
+        if (!fullReconcile && !snapshot.hasChanges()) { return; }
+        if (fullReconcile) { m_lastSnapshotFullReconcileMs = now; }
+
         // restricted snapshot values?
         bool changed = false;
         if (snapshot.isRenderingEnabled())
         {
             // make sure not to add aircraft again which are no longer in range
             const CCallsignSet callsignsInRange = this->getAircraftInRangeCallsigns();
-            const CCallsignSet callsignsEnabledAndStillInRange = snapshot.getEnabledAircraftCallsignsByDistance().intersection(callsignsInRange);
-            const CCallsignSet callsignsInSimulator(this->physicallyRenderedAircraft()); // state in simulator
+            CCallsignSet callsignsEnabledAndStillInRange = snapshot.getEnabledAircraftCallsignsByDistance().intersection(callsignsInRange);
+            CCallsignSet callsignsInSimulator(this->physicallyRenderedAircraft()); // state in simulator
+            if (!fullReconcile)
+            {
+                CCallsignSet callsignsChanged(snapshot.getChangedCallsigns());
+                callsignsChanged.push_back(snapshot.getAddedCallsigns());
+                callsignsChanged.push_back(snapshot.getRemovedCallsigns());
+                callsignsEnabledAndStillInRange = callsignsEnabledAndStillInRange.intersection(callsignsChanged);
+                callsignsInSimulator = callsignsInSimulator.intersection(callsignsChanged);
+            }
             const CCallsignSet callsignsToBeRemoved(callsignsInSimulator.difference(callsignsEnabledAndStillInRange));
             const CCallsignSet callsignsToBeAdded(callsignsEnabledAndStillInRange.difference(callsignsInSimulator));
             if (!callsignsToBeRemoved.isEmpty())
@@ -951,8 +967,18 @@ namespace BlackCore
 
         const CAirportList airports = sApp->getWebDataServices()->getAirports();
         if (airports.isEmpty()) { return airports; }
+
+        // the spatial index is only rebuilt when the airports have been read again
+        const QDateTime airportsTs = sApp->getWebDataServices()->getCacheTimestamp(CEntityFlags::AirportEntity);
+        const qint64 airportsTsMs = airportsTs.isValid() ? airportsTs.toMSecsSinceEpoch() : -1;
+        if (airportsTsMs != m_airportsIndexedTimestamp || airports.size() != m_airportsIndexed.size())
+        {
+            m_airportsIndexed.setList(airports);
+            m_airportsIndexedTimestamp = airportsTsMs;
+        }
+
         const CCoordinateGeodetic ownPosition = this->getOwnAircraftPosition();
-        CAirportList airportsInRange = airports.findClosest(maxAirportsInRange(), ownPosition);
+        CAirportList airportsInRange = m_airportsIndexed.findClosest(maxAirportsInRange(), ownPosition);
         if (recalculateDistance) { airportsInRange.calculcateAndUpdateRelativeDistanceAndBearing(this->getOwnAircraftPosition()); }
         return airportsInRange;
     }
@@ -25,6 +25,7 @@
 #include "blackmisc/network/clientprovider.h"
 #include "blackmisc/weather/weathergridprovider.h"
 #include "blackmisc/geo/elevationplane.h"
+#include "blackmisc/geo/geoobjectlist.h"
 #include "blackmisc/pq/length.h"
 #include "blackmisc/pq/time.h"
 #include "blackmisc/statusmessage.h"
@@ -572,6 +573,8 @@ namespace BlackCore
         qint64 m_lastRecordedGndElevationMs = 0; //!< when gnd.elevation was last modified
         qint64 m_statsLastUpdateAircraftRequestedMs = 0; //!< when was the last aircraft update requested
         qint64 m_statsUpdateAircraftRequestedDeltaMs = 0; //!< delta time between 2 aircraft updates
+        qint64 m_lastSnapshotFullReconcileMs = -1; //!< when all enabled aircraft of a snapshot were last reconciled with the simulator
+        static constexpr qint64 SnapshotFullReconcileMs = 10 * 1000; //!< interval of the full snapshot reconcile, in between only the diff is handled
 
         BlackMisc::Aviation::CAltitude m_pseudoElevation { BlackMisc::Aviation::CAltitude::null() }; //!< pseudo elevation for testing purposes
         BlackMisc::Simulation::CSimulatorInternals m_simulatorInternals; //!< setup read from the sim
@@ -619,6 +622,10 @@ namespace BlackCore
         bool m_test = false; //!< test mode?
         BlackMisc::Aviation::CCallsignSet m_callsignsToBeRendered; //!< callsigns which will be rendered
         BlackMisc::CConnectionGuard m_remoteAircraftProviderConnections; //!< connected signal/slots
+
+        // airports
+        mutable BlackMisc::Geo::CGeoIndexedList<BlackMisc::Aviation::CAirportList> m_airportsIndexed; //!< airports of the web data services with spatial index
+        mutable qint64 m_airportsIndexedTimestamp = -1; //!< cache timestamp of the indexed airports
     };
 
     //! \brief Interface to a simulator listener.
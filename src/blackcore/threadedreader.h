@@ -110,6 +110,10 @@ namespace BlackCore
         //! \threadsafe
         bool didContentChange(const QString &content, int startPosition = -1);
 
+        //! Stores new content hash of raw data and returns if content changed
+        //! \threadsafe
+        bool didContentChange(const QByteArray &content, int startPosition = -1);
+
         //! Set initial and periodic times
         void setInitialAndPeriodicTime(int initialTime, int periodicTime);
 
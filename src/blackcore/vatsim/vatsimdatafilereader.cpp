@@ -7,6 +7,7 @@
 #include "blackmisc/aviation/altitude.h"
 #include "blackmisc/aviation/atcstation.h"
 #include "blackmisc/geo/coordinategeodetic.h"
+#include "blackmisc/jsonstreamreader.h"
 #include "blackmisc/network/entityflags.h"
 #include "blackmisc/network/server.h"
 #include "blackmisc/network/url.h"
@@ -194,7 +195,7 @@ namespace BlackCore::Vatsim
 
         if (nwReply->error() == QNetworkReply::NoError)
         {
-            const QString dataFileData = nwReply->readAll();
+            const QByteArray dataFileData = nwReply->readAll();
             nwReply->close(); // close asap
 
             if (dataFileData.isEmpty()) { return; }
@@ -203,50 +204,59 @@ namespace BlackCore::Vatsim
                 CLogMessage(this).info(u"VATSIM file '%1' has same content, skipped") << urlString;
                 return;
             }
-            auto jsonDoc = QJsonDocument::fromJson(dataFileData.toUtf8());
-            if (jsonDoc.isEmpty()) { return; }
 
             // build on local vars for thread safety
             CServerList fsdServers;
             CAtcStationList atcStations;
             CSimulatedAircraftList aircraft;
             QMap<CCallsign, CFlightPlanRemarks> flightPlanRemarksMap;
-            auto updateTimestampFromFile = QDateTime::fromString(jsonDoc["general"]["update_timestamp"].toString(), Qt::ISODateWithMs);
-
-            const bool alreadyRead = (updateTimestampFromFile == this->getUpdateTimestamp());
-            if (alreadyRead)
+            QDateTime updateTimestampFromFile;
+            bool terminated = false;
+            bool alreadyRead = false;
+
+            // streamed, pilots and controllers are parsed one by one without DOM of the whole file
+            const auto workCheck = [&] {
+                terminated = !this->doWorkCheck();
+                return !terminated;
+            };
+            CJsonStreamReader reader;
+            reader.onValue("general", [&](const QJsonValue &general) {
+                updateTimestampFromFile = QDateTime::fromString(general["update_timestamp"].toString(), Qt::ISODateWithMs);
+                alreadyRead = (updateTimestampFromFile == this->getUpdateTimestamp());
+                return !alreadyRead;
+            });
+            reader.onArrayObject("pilots", [&](const QJsonObject &pilot) {
+                if (!workCheck()) { return false; }
+                aircraft.push_back(parsePilot(pilot, illegalEquipmentCodes));
+                flightPlanRemarksMap.insert(aircraft.back().getCallsign(), parseFlightPlanRemarks(pilot));
+                return true;
+            });
+            reader.onArrayObject("controllers", [&](const QJsonObject &controller) {
+                if (!workCheck()) { return false; }
+                atcStations.push_back(parseController(controller));
+                return true;
+            });
+            reader.onArrayObject("atis", [&](const QJsonObject &atis) {
+                if (!workCheck()) { return false; }
+                atcStations.push_back(parseController(atis));
+                return true;
+            });
+
+            const bool parsed = reader.parse(dataFileData);
+            if (terminated)
             {
-                CLogMessage(this).info(u"VATSIM file has same timestamp, skipped");
+                CLogMessage(this).info(u"Terminated VATSIM file parsing process");
                 return;
             }
-
-            for (QJsonValueRef pilot : jsonDoc["pilots"].toArray())
-            {
-                if (!this->doWorkCheck())
-                {
-                    CLogMessage(this).info(u"Terminated VATSIM file parsing process");
-                    return;
-                }
-                aircraft.push_back(parsePilot(pilot.toObject(), illegalEquipmentCodes));
-                flightPlanRemarksMap.insert(aircraft.back().getCallsign(), parseFlightPlanRemarks(pilot.toObject()));
-            }
-            for (QJsonValueRef controller : jsonDoc["controllers"].toArray())
+            if (!parsed && !reader.isStopped())
             {
-                if (!this->doWorkCheck())
-                {
-                    CLogMessage(this).info(u"Terminated VATSIM file parsing process");
-                    return;
-                }
-                atcStations.push_back(parseController(controller.toObject()));
+                CLogMessage(this).warning(u"Parsing VATSIM file '%1' failed: %2") << urlString << reader.getLastError();
+                return;
             }
-            for (QJsonValueRef atis : jsonDoc["atis"].toArray())
+            if (alreadyRead || updateTimestampFromFile == this->getUpdateTimestamp())
             {
-                if (!this->doWorkCheck())
-                {
-                    CLogMessage(this).info(u"Terminated VATSIM file parsing process");
-                    return;
-                }
-                atcStations.push_back(parseController(atis.toObject()));
+                CLogMessage(this).info(u"VATSIM file has same timestamp, skipped");
+                return;
             }
 
             // Setup for VATSIM servers and sorting for comparison
@@ -5,10 +5,12 @@
 #include "ui_copymodelsfromotherswiftversionscomponent.h"
 #include "blackgui/models/aircraftmodellistmodel.h"
 #include "blackcore/application.h"
+#include "blackmisc/cachesettingsutils.h"
 #include "blackmisc/stringutils.h"
 #include "blackmisc/fileutils.h"
 #include "blackmisc/swiftdirectories.h"
 #include "blackmisc/directoryutils.h"
+#include "blackmisc/valuecache.h"
 
 #include <QSet>
 #include <QPointer>
@@ -125,7 +127,13 @@ namespace BlackGui::Components
         if (relativeModelFile.length() < 2) { return false; }
         relativeModelFile = relativeModelFile.mid(relativeModelFile.indexOf('/', 1));
 
-        const QString otherModelFile = CFileUtils::appendFilePathsAndFixUnc(otherVersion.getApplicationDataDirectory(), relativeModelFile);
+        QString otherModelFile = CFileUtils::appendFilePathsAndFixUnc(otherVersion.getApplicationDataDirectory(), relativeModelFile);
+        if (!QFileInfo::exists(otherModelFile))
+        {
+            // other version saves in JSON, this version in binary format or vice versa
+            const QString otherFormatFile = CCacheSettingsUtils::otherFormatCacheFileName(otherModelFile);
+            if (!otherFormatFile.isEmpty() && QFileInfo::exists(otherFormatFile)) { otherModelFile = otherFormatFile; }
+        }
         const QFileInfo fiOtherModelFile(otherModelFile);
         if (!fiOtherModelFile.exists())
         {
@@ -133,6 +141,22 @@ namespace BlackGui::Components
             return false;
         }
 
+        // read other binary file
+        if (fiOtherModelFile.suffix() == QLatin1String("bin"))
+        {
+            CVariantMap values;
+            const CStatusMessage msg = CValueCache::readBinaryFile(fiOtherModelFile.absoluteFilePath(), values);
+            if (msg.isFailure() || values.isEmpty())
+            {
+                if (msg.isFailure()) { this->showOverlayMessage(msg); }
+                return false;
+            }
+            models = values.cbegin()->to<CAircraftModelList>();
+            ui->tvp_AircraftModels->updateContainerAsync(models);
+            ui->le_Status->setText(QStringLiteral("Imported %1 models '%2' for %3").arg(models.size()).arg(fiOtherModelFile.fileName(), sim.toQString()));
+            return true;
+        }
+
         // read other file
         const QString jsonString = CFileUtils::readFileToString(fiOtherModelFile.absoluteFilePath());
         if (jsonString.isEmpty()) { return false; }
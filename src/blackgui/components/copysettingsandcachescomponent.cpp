@@ -9,6 +9,8 @@
 #include "blackmisc/json.h"
 #include "blackmisc/fileutils.h"
 #include "blackmisc/icons.h"
+#include "blackmisc/valuecache.h"
+#include "blackmisc/variantmap.h"
 
 #include <QRegularExpression>
 #include <QFileInfo>
@@ -56,8 +58,8 @@ namespace BlackGui::Components
         readOnlyCheckbox(ui->cb_SettingsAudioOutputDevice, !CCacheSettingsUtils::hasOtherVersionSettingsFile(info, m_settingsAudioOutputDevice.getFilename()));
 
         readOnlyCheckbox(ui->cb_SettingsNetworkTrafficServers, !CCacheSettingsUtils::hasOtherVersionSettingsFile(info, m_settingsNetworkServers.getFilename()));
-        readOnlyCheckbox(ui->cb_CacheLastNetworkServer, !CCacheSettingsUtils::hasOtherVersionCacheFile(info, m_cacheLastNetworkServer.getFilename()));
-        readOnlyCheckbox(ui->cb_CacheLastVatsimServer, !CCacheSettingsUtils::hasOtherVersionCacheFile(info, m_cacheLastVatsimServer.getFilename()));
+        readOnlyCheckbox(ui->cb_CacheLastNetworkServer, !CCacheSettingsUtils::hasOtherVersionCacheFileAnyFormat(info, m_cacheLastNetworkServer.getFilename()));
+        readOnlyCheckbox(ui->cb_CacheLastVatsimServer, !CCacheSettingsUtils::hasOtherVersionCacheFileAnyFormat(info, m_cacheLastVatsimServer.getFilename()));
 
         readOnlyCheckbox(ui->cb_SettingsGuiGeneral, !CCacheSettingsUtils::hasOtherVersionSettingsFile(info, m_settingsGuiGeneral.getFilename()));
         readOnlyCheckbox(ui->cb_SettingsDockWidget, !CCacheSettingsUtils::hasOtherVersionSettingsFile(info, m_settingsDockWidget.getFilename()));
@@ -206,29 +208,21 @@ namespace BlackGui::Components
 
         if (ui->cb_CacheLastNetworkServer->isChecked())
         {
-            const QString joStr = CCacheSettingsUtils::otherVersionCacheFileContent(otherVersionInfo, m_cacheLastNetworkServer.getFilename());
-            if (!joStr.isEmpty())
+            CServer server;
+            if (this->readOtherVersionServerCache(otherVersionInfo, m_cacheLastNetworkServer.getFilename(), m_cacheLastNetworkServer.getKey(), server))
             {
-                const CServer server = CServer::fromJsonNoThrow(joStr, true, success, errMsg);
-                if (this->parsingMessage(success, errMsg, m_cacheLastNetworkServer.getKey()))
-                {
-                    this->displayStatusMessage(m_cacheLastNetworkServer.set(server), server.toQString(true));
-                    copied++;
-                }
+                this->displayStatusMessage(m_cacheLastNetworkServer.set(server), server.toQString(true));
+                copied++;
             }
         }
 
         if (ui->cb_CacheLastVatsimServer->isChecked())
         {
-            const QString joStr = CCacheSettingsUtils::otherVersionCacheFileContent(otherVersionInfo, m_cacheLastVatsimServer.getFilename());
-            if (!joStr.isEmpty())
+            CServer server;
+            if (this->readOtherVersionServerCache(otherVersionInfo, m_cacheLastVatsimServer.getFilename(), m_cacheLastVatsimServer.getKey(), server))
             {
-                const CServer server = CServer::fromJsonNoThrow(joStr, true, success, errMsg);
-                if (this->parsingMessage(success, errMsg, m_cacheLastVatsimServer.getKey()))
-                {
-                    this->displayStatusMessage(m_cacheLastVatsimServer.set(server), server.toQString(true));
-                    copied++;
-                }
+                this->displayStatusMessage(m_cacheLastVatsimServer.set(server), server.toQString(true));
+                copied++;
             }
         }
 
@@ -412,6 +406,34 @@ namespace BlackGui::Components
         return false;
     }
 
+    bool CCopySettingsAndCachesComponent::readOtherVersionServerCache(const CApplicationInfo &otherVersionInfo, const QString &myCacheFile, const QString &key, CServer &server)
+    {
+        const QString file = CCacheSettingsUtils::otherVersionCacheFileNameAnyFormat(otherVersionInfo, myCacheFile);
+        if (file.isEmpty()) { return false; }
+
+        // the other version can store its caches in the other format, see --binarycache
+        if (QFileInfo(file).suffix() == QLatin1String("bin"))
+        {
+            CVariantMap values;
+            const CStatusMessage msg = CValueCache::readBinaryFile(file, values);
+            if (msg.isFailure())
+            {
+                this->displayStatusMessage(msg, key);
+                return false;
+            }
+            if (values.isEmpty()) { return false; }
+            server = values.cbegin()->to<CServer>();
+            return true;
+        }
+
+        const QString joStr = CFileUtils::readFileToString(file);
+        if (joStr.isEmpty()) { return false; }
+        bool success = false;
+        QString errMsg;
+        server = CServer::fromJsonNoThrow(joStr, true, success, errMsg);
+        return this->parsingMessage(success, errMsg, key);
+    }
+
     void CCopySettingsAndCachesComponent::displayStatusMessage(const CStatusMessage &msg, const QString &value)
     {
         if (msg.isEmpty()) { return; }
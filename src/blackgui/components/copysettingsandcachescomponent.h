@@ -98,6 +98,9 @@ namespace BlackGui::Components
         //! Display status message
         void displayStatusMessage(const BlackMisc::CStatusMessage &msg, const QString &value);
 
+        //! Read a server from the other version's cache file, which can be in JSON or binary format
+        bool readOtherVersionServerCache(const BlackMisc::CApplicationInfo &otherVersionInfo, const QString &myCacheFile, const QString &key, BlackMisc::Network::CServer &server);
+
         //! All check boxes read only
         void allCheckBoxesReadOnly();
 
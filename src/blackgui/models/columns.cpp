@@ -98,6 +98,7 @@ namespace BlackGui::Models
         CColumn copy(column);
         copy.setTranslationContext(m_translationContext);
         m_columns.push_back(copy);
+        m_revision++;
     }
 
     void CColumns::addColumnIncognito(const CColumn &column)
@@ -274,7 +275,6 @@ namespace BlackGui::Models
     const CDefaultFormatter *CColumns::getFormatter(const QModelIndex &index) const
     {
         if (!this->isValidColumn(index)) { return nullptr; }
-        const CColumn c = m_columns.at(index.column());
-        return c.getFormatter();
+        return m_columns.at(index.column()).getFormatter();
     }
 } // namespace
@@ -213,14 +213,26 @@ namespace BlackGui::Models
         const CColumn &at(int columnNumber) const { return m_columns.at(columnNumber); }
 
         //! Clear
-        void clear() { m_columns.clear(); }
+        void clear()
+        {
+            m_columns.clear();
+            m_revision++;
+        }
 
         //! @{
         //! Set columns
-        void setColumns(const QList<CColumn> &columns) { m_columns = columns; }
-        void setColumns(const CColumns &columns) { m_columns = columns.m_columns; }
+        void setColumns(const QList<CColumn> &columns)
+        {
+            m_columns = columns;
+            m_revision++;
+        }
+        void setColumns(const CColumns &columns) { this->setColumns(columns.m_columns); }
         //! @}
 
+        //! Revision, changes whenever columns are added or replaced
+        //! \remark allows to detect values formatted with other columns
+        int getRevision() const { return m_revision; }
+
         //! Columns
         const QList<CColumn> &columns() const { return m_columns; }
 
@@ -242,6 +254,7 @@ namespace BlackGui::Models
     private:
         QList<CColumn> m_columns; //!< all columns
         QString m_translationContext; //!< for future usage
+        int m_revision = 0; //!< changed columns
     };
 } // ns
 
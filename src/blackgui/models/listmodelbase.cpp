@@ -7,6 +7,7 @@
 #include "blackgui/models/listmodelbase.h"
 #include "blackgui/models/allmodelcontainers.h"
 #include "blackgui/guiutility.h"
+#include "blackmisc/sortkey.h"
 #include "blackmisc/variant.h"
 #include "blackmisc/worker.h"
 
@@ -14,6 +15,10 @@
 #include <QJsonDocument>
 #include <QList>
 #include <QMimeData>
+#include <QPair>
+#include <algorithm>
+#include <iterator>
+#include <numeric>
 
 using namespace BlackMisc;
 using namespace BlackMisc::Aviation;
@@ -23,7 +28,22 @@ namespace BlackGui::Models
     template <typename T, bool UseCompare>
     CListModelBase<T, UseCompare>::CListModelBase(const QString &translationContext, QObject *parent)
         : CListModelBaseNonTemplate(translationContext, parent)
-    {}
+    {
+        if constexpr (THasDbKey<ObjectType>::value || THasGetCallsign<ObjectType>::value)
+        {
+            m_keyFunction = &Private::keyForModelUpdate<ObjectType>;
+        }
+
+        // rows changed, cached display values no longer match
+        const auto invalidate = [this] {
+            if (!m_maintainDisplayCache) { this->invalidateDisplayCache(); }
+        };
+        connect(this, &QAbstractItemModel::modelReset, this, invalidate);
+        connect(this, &QAbstractItemModel::layoutChanged, this, invalidate);
+        connect(this, &QAbstractItemModel::rowsInserted, this, invalidate);
+        connect(this, &QAbstractItemModel::rowsRemoved, this, invalidate);
+        connect(this, &QAbstractItemModel::rowsMoved, this, invalidate);
+    }
 
     template <typename T, bool UseCompare>
     int CListModelBase<T, UseCompare>::rowCount(const QModelIndex &parentIndex) const
@@ -105,11 +125,46 @@ namespace BlackGui::Models
         default: break; // continue here
         }
 
-        // Formatted data
-        const ObjectType obj = this->containerOrFilteredContainer()[row];
+        // Formatted data, display values are cached (incognito can change any time)
+        if (role == Qt::DisplayRole && !m_columns.at(col).isIncognito())
+        {
+            return this->cachedDisplayData(row, col, propertyIndex, formatter);
+        }
+        const ObjectType &obj = this->containerOrFilteredContainer()[row];
         return formatter->data(role, obj.propertyByIndex(propertyIndex)).getQVariant();
     }
 
+    template <typename T, bool UseCompare>
+    QVariant CListModelBase<T, UseCompare>::cachedDisplayData(int row, int column, const CPropertyIndex &propertyIndex, const CDefaultFormatter *formatter) const
+    {
+        const ContainerType &rows = this->containerOrFilteredContainer();
+        if (m_displayCacheRevision != m_columns.getRevision() || m_displayCache.size() != rows.size())
+        {
+            // columns changed, or rows changed without signal
+            m_displayCache.clear();
+            m_displayCache.resize(rows.size());
+            m_displayCacheRevision = m_columns.getRevision();
+        }
+
+        QVector<std::optional<QVariant>> &cachedRow = m_displayCache[row];
+        if (cachedRow.isEmpty()) { cachedRow.resize(this->columnCount()); }
+        std::optional<QVariant> &value = cachedRow[column];
+        if (!value) { value = formatter->data(Qt::DisplayRole, rows[row].propertyByIndex(propertyIndex)).getQVariant(); }
+        return *value;
+    }
+
+    template <typename T, bool UseCompare>
+    void CListModelBase<T, UseCompare>::invalidateDisplayCache()
+    {
+        m_displayCache.clear();
+    }
+
+    template <typename T, bool UseCompare>
+    void CListModelBase<T, UseCompare>::invalidateDisplayCache(int firstRow, int lastRow)
+    {
+        for (int r = qMax(firstRow, 0); r <= lastRow && r < m_displayCache.size(); ++r) { m_displayCache[r].clear(); }
+    }
+
     template <typename T, bool UseCompare>
     bool CListModelBase<T, UseCompare>::setData(const QModelIndex &index, const QVariant &value, int role)
     {
@@ -149,6 +204,8 @@ namespace BlackGui::Models
         const int row = index.row();
         if (row < 0 || row >= this->container().size()) { return false; }
         m_container[row] = obj;
+        if (this->hasFilter()) { this->invalidateDisplayCache(); }
+        else { this->invalidateDisplayCache(row, row); }
         return true;
     }
 
@@ -159,17 +216,26 @@ namespace BlackGui::Models
 
         // Keep sorting out of begin/end reset model
         ContainerType sortedContainer;
-        ContainerType selection;
-        if (m_selectionModel)
-        {
-            selection = m_selectionModel->selectedObjects();
-        }
         const int oldSize = m_container.size();
         const bool performSort = sort && container.size() > 1 && this->hasValidSortColumn();
         if (performSort)
         {
             const int sortColumn = this->getSortColumn();
-            sortedContainer = this->sortContainerByColumn(container, sortColumn, m_sortOrder);
+            sortedContainer = this->sortContainerByColumnMerged(container, m_container, sortColumn, m_sortOrder);
+        }
+
+        // only signal what has changed, the views keep selection and scroll position
+        bool changed = false;
+        if (this->updateByKey(performSort ? sortedContainer : container, changed))
+        {
+            if (changed) { this->emitModelDataChanged(); }
+            return m_container.size();
+        }
+
+        ContainerType selection;
+        if (m_selectionModel)
+        {
+            selection = m_selectionModel->selectedObjects();
         }
 
         this->beginResetModel();
@@ -216,8 +282,9 @@ namespace BlackGui::Models
         if (m_modelDestroyed) { return nullptr; }
         const auto sortColumn = this->getSortColumn();
         const auto sortOrder = this->getSortOrder();
-        CWorker *worker = CWorker::fromTask(this, "ModelSort", [this, container, sortColumn, sortOrder]() {
-            return this->sortContainerByColumn(container, sortColumn, sortOrder);
+        const ContainerType previous = m_container;
+        CWorker *worker = CWorker::fromTask(this, "ModelSort", CThreadPool::Interactive, [this, container, previous, sortColumn, sortOrder]() {
+            return this->sortContainerByColumnMerged(container, previous, sortColumn, sortOrder);
         });
         worker->thenWithResult<ContainerType>(this, [this](const ContainerType &sortedContainer) {
             if (m_modelDestroyed) { return; }
@@ -454,6 +521,141 @@ namespace BlackGui::Models
         }
     }
 
+    template <typename T, bool UseCompare>
+    bool CListModelBase<T, UseCompare>::updateByKey(const ContainerType &container, bool &changed)
+    {
+        changed = false;
+        if (!m_keyFunction) { return false; }
+
+        // the view shows the filtered rows, so these are diffed
+        const bool filtered = this->hasFilter();
+        const ContainerType newRows = filtered ? m_filter->filter(container) : container;
+        const ContainerType oldRows = this->containerOrFilteredContainer();
+        QVector<QString> newKeys;
+        QVector<QString> keys;
+        QHash<QString, int> newPositions;
+        QHash<QString, int> oldPositions;
+        if (!this->keysOf(newRows, newKeys, newPositions) || !this->keysOf(oldRows, keys, oldPositions)) { return false; }
+
+        ContainerType &rows = filtered ? m_containerFiltered : m_container;
+
+        // cached display values move with their rows
+        if (m_displayCache.size() != rows.size()) { m_displayCache.clear(); }
+        const bool moveCache = !m_displayCache.isEmpty();
+        m_maintainDisplayCache = true;
+
+        // removed rows, bottom up so the row numbers stay valid
+        for (int last = keys.size() - 1; last >= 0; --last)
+        {
+            if (newPositions.contains(keys[last])) { continue; }
+            int first = last;
+            while (first > 0 && !newPositions.contains(keys[first - 1])) { --first; }
+            this->beginRemoveRows(QModelIndex(), first, last);
+            rows.erase(rows.begin() + first, rows.begin() + last + 1);
+            keys.erase(keys.begin() + first, keys.begin() + last + 1);
+            if (moveCache) { m_displayCache.erase(m_displayCache.begin() + first, m_displayCache.begin() + last + 1); }
+            this->endRemoveRows();
+            changed = true;
+            last = first;
+        }
+
+        // remaining rows in new order, moved by a layout change
+        QVector<QString> orderedKeys;
+        orderedKeys.reserve(keys.size());
+        for (const QString &key : std::as_const(newKeys))
+        {
+            if (oldPositions.contains(key)) { orderedKeys.push_back(key); }
+        }
+        if (orderedKeys != keys)
+        {
+            QHash<QString, int> currentRows;
+            currentRows.reserve(keys.size());
+            for (int r = 0; r < keys.size(); ++r) { currentRows.insert(keys[r], r); }
+
+            emit this->layoutAboutToBeChanged({}, QAbstractItemModel::VerticalSortHint);
+            ContainerType ordered;
+            ordered.reserve(rows.size());
+            QVector<int> toRows(keys.size());
+            for (int r = 0; r < orderedKeys.size(); ++r)
+            {
+                const int from = currentRows.value(orderedKeys[r]);
+                ordered.push_back(rows[from]);
+                toRows[from] = r;
+            }
+            const QModelIndexList fromIndexes = this->persistentIndexList();
+            QModelIndexList toIndexes;
+            toIndexes.reserve(fromIndexes.size());
+            for (const QModelIndex &index : fromIndexes)
+            {
+                toIndexes.push_back(this->index(toRows.value(index.row()), index.column()));
+            }
+            if (moveCache)
+            {
+                QVector<QVector<std::optional<QVariant>>> orderedCache(m_displayCache.size());
+                for (int from = 0; from < toRows.size(); ++from) { orderedCache[toRows[from]] = std::move(m_displayCache[from]); }
+                m_displayCache = std::move(orderedCache);
+            }
+            rows = ordered;
+            keys = orderedKeys;
+            this->changePersistentIndexList(fromIndexes, toIndexes);
+            emit this->layoutChanged({}, QAbstractItemModel::VerticalSortHint);
+            changed = true;
+        }
+
+        // inserted rows, top down so the remaining rows are already at their new position
+        for (int first = 0; first < newKeys.size(); ++first)
+        {
+            if (oldPositions.contains(newKeys[first])) { continue; }
+            int last = first;
+            while (last + 1 < newKeys.size() && !oldPositions.contains(newKeys[last + 1])) { ++last; }
+            this->beginInsertRows(QModelIndex(), first, last);
+            for (int r = first; r <= last; ++r) { rows.insert(rows.begin() + r, newRows[r]); }
+            if (moveCache) { m_displayCache.insert(first, last - first + 1, {}); }
+            this->endInsertRows();
+            changed = true;
+            first = last;
+        }
+        Q_ASSERT_X(rows.size() == newRows.size(), Q_FUNC_INFO, "mismatching rows");
+        m_maintainDisplayCache = false;
+
+        // changed values of the remaining rows
+        rows = newRows;
+        if (filtered) { m_container = container; }
+        // modelDataChanged is emitted once by the caller, not per changed range
+        const int lastColumn = this->columnCount() - 1;
+        m_updatingByKey = true;
+        for (int first = 0; first < newKeys.size(); ++first)
+        {
+            const auto isChanged = [&](int r) {
+                const int old = oldPositions.value(newKeys[r], -1);
+                return old >= 0 && !(oldRows[old] == newRows[r]);
+            };
+            if (!isChanged(first)) { continue; }
+            int last = first;
+            while (last + 1 < newKeys.size() && isChanged(last + 1)) { ++last; }
+            emit this->dataChanged(this->index(first, 0), this->index(last, lastColumn));
+            changed = true;
+            first = last;
+        }
+        m_updatingByKey = false;
+        return true;
+    }
+
+    template <typename T, bool UseCompare>
+    bool CListModelBase<T, UseCompare>::keysOf(const ContainerType &container, QVector<QString> &keys, QHash<QString, int> &positions) const
+    {
+        keys.reserve(container.size());
+        positions.reserve(container.size());
+        for (const ObjectType &object : container)
+        {
+            const QString key = m_keyFunction(object);
+            if (key.isEmpty() || positions.contains(key)) { return false; }
+            positions.insert(key, keys.size());
+            keys.push_back(key);
+        }
+        return true;
+    }
+
     template <typename T, bool UseCompare>
     void CListModelBase<T, UseCompare>::emitModelDataChanged()
     {
@@ -466,10 +668,10 @@ namespace BlackGui::Models
     void CListModelBase<T, UseCompare>::onDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight, const QVector<int> &roles)
     {
         // underlying base class changed
-        Q_UNUSED(topLeft)
-        Q_UNUSED(bottomRight)
         Q_UNUSED(roles)
-        this->emitModelDataChanged();
+        if (topLeft.isValid() && bottomRight.isValid()) { this->invalidateDisplayCache(topLeft.row(), bottomRight.row()); }
+        else { this->invalidateDisplayCache(); }
+        if (!m_updatingByKey) { this->emitModelDataChanged(); }
     }
 
     template <typename T, bool UseCompare>
@@ -548,14 +750,151 @@ namespace BlackGui::Models
             return container; // at release build do nothing
         }
 
-        // sort the values
-        const auto tieBreakersCopy = m_sortTieBreakers; //! \todo workaround T579 still not thread-safe, but less likely to crash
-        const std::integral_constant<bool, UseCompare> marker {};
-        const auto p = [=](const ObjectType &a, const ObjectType &b) -> bool {
-            return Private::compareForModelSort<ObjectType>(a, b, order, propertyIndex, tieBreakersCopy, marker);
-        };
+        // sort positions, large objects are not swapped around
+        const int size = container.size();
+        QVector<int> positions(size);
+        std::iota(positions.begin(), positions.end(), 0);
+        if constexpr (UseCompare)
+        {
+            // sort keys are fetched once, properties without key are compared per comparison
+            const QVector<CPropertyIndex> indexes = this->sortIndexes(propertyIndex);
+            const int keysPerObject = indexes.size();
+            QVector<bool> keyed(keysPerObject, false);
+            QVector<CSortKey> keys;
+            if constexpr (THasSortKeyByIndex<ObjectType>::value)
+            {
+                // whether a property has a key depends on the index only
+                bool anyKey = false;
+                for (int i = 0; i < keysPerObject; ++i)
+                {
+                    keyed[i] = container.front().sortKeyByIndex(indexes[i]).isValid();
+                    anyKey = anyKey || keyed[i];
+                }
+                if (anyKey)
+                {
+                    keys.reserve(size * keysPerObject);
+                    for (const ObjectType &object : container)
+                    {
+                        for (int i = 0; i < keysPerObject; ++i) { keys.push_back(keyed[i] ? object.sortKeyByIndex(indexes[i]) : CSortKey()); }
+                    }
+                }
+            }
+            std::sort(positions.begin(), positions.end(), [&](int a, int b) {
+                for (int i = 0; i < keysPerObject; ++i)
+                {
+                    const int c = keyed[i] ?
+                                      keys[a * keysPerObject + i].compare(keys[b * keysPerObject + i]) :
+                                      container[a].comparePropertyByIndex(indexes[i], container[b]);
+                    if (c != 0) { return (order == Qt::AscendingOrder) ? (c < 0) : (c > 0); }
+                }
+                return false;
+            });
+        }
+        else
+        {
+            // values are fetched once, same order as Private::compareForModelSort without compare function
+            const auto tieBreakersCopy = m_sortTieBreakers; //! \todo workaround T579 still not thread-safe, but less likely to crash
+            const int valuesPerObject = 1 + tieBreakersCopy.size();
+            QVector<CVariant> values;
+            values.reserve(size * valuesPerObject);
+            for (const ObjectType &object : container)
+            {
+                values.push_back(object.propertyByIndex(propertyIndex));
+                for (const CPropertyIndex &tieBreaker : tieBreakersCopy) { values.push_back(object.propertyByIndex(tieBreaker)); }
+            }
+            std::sort(positions.begin(), positions.end(), [&](int a, int b) {
+                const CVariant *aValues = values.constData() + a * valuesPerObject;
+                const CVariant *bValues = values.constData() + b * valuesPerObject;
+                int i = 0;
+                while (i + 1 < valuesPerObject && aValues[i] == bValues[i]) { ++i; }
+                return (order == Qt::AscendingOrder) ? (aValues[i] < bValues[i]) : (bValues[i] < aValues[i]);
+            });
+        }
+
+        ContainerType sorted;
+        sorted.reserve(size);
+        for (int position : std::as_const(positions)) { sorted.push_back(container[position]); }
+        return sorted;
+    }
+
+    template <typename T, bool UseCompare>
+    typename CListModelBase<T, UseCompare>::ContainerType CListModelBase<T, UseCompare>::sortContainerByColumnMerged(const ContainerType &container, const ContainerType &previous, int column, Qt::SortOrder order) const
+    {
+        if (m_modelDestroyed) { return container; }
+        if (container.size() < 2 || !m_columns.isSortable(column))
+        {
+            return container; // nothing to do
+        }
+
+        const auto p = this->sortPredicate(column, order);
+        if (!p) { return container; }
+        if (previous.isEmpty() || !m_keyFunction) { return container.sorted(p); }
+
+        QVector<QString> previousKeys;
+        QHash<QString, int> previousPositions;
+        if (!this->keysOf(previous, previousKeys, previousPositions)) { return container.sorted(p); }
+
+        // objects with the same sort values as before keep their previous order
+        QVector<QPair<int, int>> kept; // previous position, position
+        ContainerType resorted;
+        for (int i = 0; i < container.size(); ++i)
+        {
+            const ObjectType &object = container[i];
+            const int pos = previousPositions.value(m_keyFunction(object), -1);
+            if (pos >= 0 && !p(object, previous[pos]) && !p(previous[pos], object)) { kept.push_back({ pos, i }); }
+            else { resorted.push_back(object); }
+        }
+        std::sort(kept.begin(), kept.end());
+        ContainerType keptObjects;
+        keptObjects.reserve(kept.size());
+        for (const auto &k : std::as_const(kept)) { keptObjects.push_back(container[k.second]); }
+
+        // previous container was not sorted by this column
+        if (!std::is_sorted(keptObjects.cbegin(), keptObjects.cend(), p)) { return container.sorted(p); }
+
+        resorted = this->sortContainerByColumn(resorted, column, order);
+        ContainerType merged;
+        merged.reserve(container.size());
+        std::merge(keptObjects.cbegin(), keptObjects.cend(), resorted.cbegin(), resorted.cend(), std::back_inserter(merged), p);
+        return merged;
+    }
+
+    template <typename T, bool UseCompare>
+    std::function<bool(const typename CListModelBase<T, UseCompare>::ObjectType &, const typename CListModelBase<T, UseCompare>::ObjectType &)> CListModelBase<T, UseCompare>::sortPredicate(int column, Qt::SortOrder order) const
+    {
+        // this is the only part not really thread safe, but columns do not change so far
+        const CPropertyIndex propertyIndex = m_columns.columnToSortPropertyIndex(column);
+        Q_ASSERT(!propertyIndex.isEmpty());
+        if (propertyIndex.isEmpty())
+        {
+            return {}; // at release build do nothing
+        }
 
-        return container.sorted(p);
+        if constexpr (UseCompare)
+        {
+            const QVector<CPropertyIndex> indexes = this->sortIndexes(propertyIndex);
+            return [=](const ObjectType &a, const ObjectType &b) -> bool {
+                return Private::compareForModelSort<ObjectType>(a, b, order, indexes);
+            };
+        }
+        else
+        {
+            const auto tieBreakersCopy = m_sortTieBreakers; //! \todo workaround T579 still not thread-safe, but less likely to crash
+            return [=](const ObjectType &a, const ObjectType &b) -> bool {
+                return Private::compareForModelSort<ObjectType>(a, b, order, propertyIndex, tieBreakersCopy, std::false_type());
+            };
+        }
+    }
+
+    template <typename T, bool UseCompare>
+    QVector<CPropertyIndex> CListModelBase<T, UseCompare>::sortIndexes(const CPropertyIndex &propertyIndex) const
+    {
+        const auto tieBreakersCopy = m_sortTieBreakers; //! \todo workaround T579 still not thread-safe, but less likely to crash
+        QVector<CPropertyIndex> indexes;
+        indexes.reserve(1 + tieBreakersCopy.size());
+        indexes.push_back(propertyIndex);
+        for (const CPropertyIndex &tieBreaker : tieBreakersCopy) { indexes.push_back(tieBreaker); }
+        return indexes;
     }
 
     template <typename T, bool UseCompare>
@@ -9,15 +9,19 @@
 #include "blackgui/models/listmodelbasenontemplate.h"
 #include "blackgui/models/modelfilter.h"
 #include "blackgui/models/selectionmodel.h"
+#include "blackmisc/typetraits.h"
 
 #include <QJsonDocument>
+#include <QHash>
 #include <QJsonObject>
 #include <QModelIndex>
 #include <QModelIndexList>
 #include <QString>
 #include <QVariant>
 #include <QVector>
+#include <functional>
 #include <memory>
+#include <optional>
 
 class QMimeData;
 class QModelIndex;
@@ -39,6 +43,9 @@ namespace BlackGui::Models
         //! Container element type
         using ObjectType = typename T::value_type;
 
+        //! Key identifying an object across updates, empty if the object has no key
+        using KeyFunction = std::function<QString(const ObjectType &)>;
+
         //! Destructor
         virtual ~CListModelBase() override {}
 
@@ -94,11 +101,14 @@ namespace BlackGui::Models
 
         //! Simple set of data in container, using class is responsible for firing signals etc.
         //! \sa sendDataChanged
+        //! \remark invalidates the cached display values of the row
         bool setInContainer(const QModelIndex &index, const ObjectType &obj);
 
         //! Update by new container
         //! \return int size after update
         //! \remarks a sorting is performed only if a valid sort column is set
+        //! \remarks if all objects have unique keys, only the changed rows are signalled instead of resetting the model
+        //! \sa setKeyFunction
         virtual int update(const ContainerType &container, bool sort = true);
 
         //! Asynchronous update
@@ -132,12 +142,32 @@ namespace BlackGui::Models
 
         //! Sort container by given column / order. This is used by sort() but als
         //! for asynchronous updates in the views
+        //! \remark the sort values are fetched once per object (not per comparison) if no compare function is used,
+        //!         positions are sorted and the objects copied once
+        //! \remark with compare function the sort keys of objects providing sortKeyByIndex are fetched once per object,
+        //!         properties without sort key are compared by comparePropertyByIndex
         //! \param container used list
         //! \param column    column inder
         //! \param order     sort order (ascending / descending)
         //! \threadsafe under normal conditions thread safe as long as the column metadata are not changed
         ContainerType sortContainerByColumn(const ContainerType &container, int column, Qt::SortOrder order) const;
 
+        //! Sort container by given column / order, keeping the order of the previous container for objects whose sort values did not change
+        //! \remark objects are matched by key, changed and new objects are sorted and merged in, the result equals sortContainerByColumn
+        //! \param container used list
+        //! \param previous  previous (sorted) list, normally a copy of container()
+        //! \param column    column index
+        //! \param order     sort order (ascending / descending)
+        //! \threadsafe as sortContainerByColumn
+        ContainerType sortContainerByColumnMerged(const ContainerType &container, const ContainerType &previous, int column, Qt::SortOrder order) const;
+
+        //! Set the key function used to match objects on updates
+        //! \remark by default the DB key or callsign if the object has one, an empty function always resets the model on updates
+        void setKeyFunction(const KeyFunction &keyFunction) { m_keyFunction = keyFunction; }
+
+        //! Key function set?
+        bool hasKeyFunction() const { return static_cast<bool>(m_keyFunction); }
+
         //! Similar to ContainerType::push_back
         virtual void push_back(const ObjectType &object);
 
@@ -159,6 +189,7 @@ namespace BlackGui::Models
         {
             int c = m_container.removeIf(BlackMisc::Predicates::MemberEqual(k0, v0, keysValues...));
             this->updateFilteredContainer();
+            this->invalidateDisplayCache();
             if (c > 0) { this->emitModelDataChanged(); }
             return c;
         }
@@ -201,28 +232,77 @@ namespace BlackGui::Models
         //! Model changed
         void emitModelDataChanged();
 
+        //! Invalidate the cached display values of all rows
+        void invalidateDisplayCache();
+
+        //! Invalidate the cached display values of the rows
+        void invalidateDisplayCache(int firstRow, int lastRow);
+
+        //! Update the visible rows by key, signalling only removed, moved, inserted and changed rows
+        //! \param container new (sorted) container
+        //! \param changed   set to true if any row was changed
+        //! \return false if the objects cannot be matched by key, the model was not changed then
+        bool updateByKey(const ContainerType &container, bool &changed);
+
         ContainerType m_container; //!< used container
         ContainerType m_containerFiltered; //!< cache for filtered container data
         std::unique_ptr<IModelFilter<ContainerType>> m_filter; //!< used filter
         ISelectionModel<ContainerType> *m_selectionModel = nullptr; //!< selection model
+        KeyFunction m_keyFunction; //!< key matching objects on updates
+
+    private:
+        //! Display value of a visible row, formatted once and cached until the row changes
+        QVariant cachedDisplayData(int row, int column, const BlackMisc::CPropertyIndex &propertyIndex, const CDefaultFormatter *formatter) const;
+
+        //! Predicate for sorting by column, empty if the column cannot be sorted
+        //! \threadsafe as sortContainerByColumn
+        std::function<bool(const ObjectType &, const ObjectType &)> sortPredicate(int column, Qt::SortOrder order) const;
+
+        //! Sort index followed by the tie breakers
+        QVector<BlackMisc::CPropertyIndex> sortIndexes(const BlackMisc::CPropertyIndex &propertyIndex) const;
+
+        //! Keys of the objects
+        //! \return false if any key is empty or redundant
+        bool keysOf(const ContainerType &container, QVector<QString> &keys, QHash<QString, int> &positions) const;
+
+        mutable QVector<QVector<std::optional<QVariant>>> m_displayCache; //!< formatted display values per visible row and column, empty if the row is not cached
+        mutable int m_displayCacheRevision = -1; //!< columns revision of the cached values
+        bool m_maintainDisplayCache = false; //!< cache is maintained by the keyed update, row signals do not invalidate it
+        bool m_updatingByKey = false; //!< keyed update signals the changed rows, modelDataChanged is emitted once afterwards
     };
 
     namespace Private
     {
-        //! Sort with compare function
+        //! Default key of an object for the keyed model updates, the DB key or the callsign
+        template <class ObjectType>
+        QString keyForModelUpdate(const ObjectType &object)
+        {
+            if constexpr (BlackMisc::THasDbKey<ObjectType>::value)
+            {
+                return object.hasValidDbKey() ? object.getDbKeyAsString() : QString();
+            }
+            else if constexpr (BlackMisc::THasGetCallsign<ObjectType>::value)
+            {
+                return object.getCallsign().asString();
+            }
+            else
+            {
+                Q_UNUSED(object)
+                return {};
+            }
+        }
+
+        //! Sort with compare function, the sort index followed by the tie breakers
+        //! \remark no list of the remaining tie breakers is copied per comparison
         template <class ObjectType>
-        bool compareForModelSort(const ObjectType &a, const ObjectType &b, Qt::SortOrder order, const BlackMisc::CPropertyIndex &index, const BlackMisc::CPropertyIndexList &tieBreakers, std::true_type)
+        bool compareForModelSort(const ObjectType &a, const ObjectType &b, Qt::SortOrder order, const QVector<BlackMisc::CPropertyIndex> &indexes)
         {
-            const int c = a.comparePropertyByIndex(index, b);
-            if (c == 0)
+            for (const BlackMisc::CPropertyIndex &index : indexes)
             {
-                if (!tieBreakers.isEmpty())
-                {
-                    return compareForModelSort<ObjectType>(a, b, order, tieBreakers.front(), tieBreakers.copyFrontRemoved(), std::true_type());
-                }
-                return false;
+                const int c = a.comparePropertyByIndex(index, b);
+                if (c != 0) { return (order == Qt::AscendingOrder) ? (c < 0) : (c > 0); }
             }
-            return (order == Qt::AscendingOrder) ? (c < 0) : (c > 0);
+            return false;
         }
 
         //! Sort without compare function
@@ -102,9 +102,10 @@ namespace BlackGui::Views
         ModelClass *model = this->derivedModel();
         const auto sortColumn = model->getSortColumn();
         const auto sortOrder = model->getSortOrder();
+        const ContainerType previous = model->container();
         this->showLoadIndicator(container.size());
-        CWorker *worker = CWorker::fromTask(this, "ViewSort", [model, container, sortColumn, sortOrder]() {
-            return model->sortContainerByColumn(container, sortColumn, sortOrder);
+        CWorker *worker = CWorker::fromTask(this, "ViewSort", CThreadPool::Interactive, [model, container, previous, sortColumn, sortOrder]() {
+            return model->sortContainerByColumnMerged(container, previous, sortColumn, sortOrder);
         });
         worker->thenWithResult<ContainerType>(this, [this, resize](const ContainerType &sortedContainer) {
             this->updateContainer(sortedContainer, false, resize);
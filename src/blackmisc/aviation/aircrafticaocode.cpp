@@ -3,6 +3,7 @@
 
 #include "blackmisc/aviation/aircrafticaocode.h"
 #include "blackmisc/db/datastoreutility.h"
+#include "blackmisc/db/jsonkeys.h"
 #include "blackmisc/comparefunctions.h"
 #include "blackmisc/logcategories.h"
 #include "blackmisc/propertyindexref.h"
@@ -755,6 +756,32 @@ namespace BlackMisc::Aviation
         return 0;
     }
 
+    CSortKey CAircraftIcaoCode::sortKeyByIndex(CPropertyIndexRef index) const
+    {
+        if (index.isMyself()) { return CSortKey(m_designator, Qt::CaseInsensitive); }
+        if (IDatastoreObjectWithIntegerKey::canHandleIndex(index)) { return IDatastoreObjectWithIntegerKey::sortKeyByIndex(index); }
+        const ColumnIndex i = index.frontCasted<ColumnIndex>();
+        switch (i)
+        {
+        case IndexAircraftDesignator: return CSortKey(m_designator, Qt::CaseInsensitive);
+        case IndexIataCode: return CSortKey(m_iataCode, Qt::CaseInsensitive);
+        case IndexFamily: return CSortKey(m_family, Qt::CaseInsensitive);
+        case IndexCombinedAircraftType: return CSortKey(m_combinedType, Qt::CaseInsensitive);
+        case IndexModelDescription: return CSortKey(m_modelDescription, Qt::CaseInsensitive);
+        case IndexModelIataDescription: return CSortKey(m_modelIataDescription, Qt::CaseInsensitive);
+        case IndexModelSwiftDescription: return CSortKey(m_modelSwiftDescription, Qt::CaseInsensitive);
+        case IndexManufacturer: return CSortKey(m_manufacturer, Qt::CaseInsensitive);
+        case IndexIsLegacy: return CSortKey(m_legacy);
+        case IndexIsMilitary: return CSortKey(m_military);
+        case IndexIsVtol: return CSortKey(this->isVtol());
+        case IndexIsRealworld: return CSortKey(m_realWorld);
+        case IndexRank: return CSortKey(m_rank);
+        case IndexDesignatorManufacturer: return CSortKey(this->getDesignatorManufacturer(), Qt::CaseInsensitive);
+        default: break; // category, combined description and WTC are compared by comparePropertyByIndex
+        }
+        return {};
+    }
+
     bool CAircraftIcaoCode::isValidDesignator(const QString &designator)
     {
         if (designator.length() < DesignatorMinLength || designator.length() > DesignatorMaxLength) { return false; }
@@ -862,6 +889,37 @@ namespace BlackMisc::Aviation
         log->push_back(logMessage(icao, message, extraCategories, s));
     }
 
+    namespace
+    {
+        //! JSON keys of CAircraftIcaoCode::fromDatabaseJson
+        struct AircraftIcaoJsonKeys
+        {
+            //! Keys with prefix
+            AircraftIcaoJsonKeys(const QString &prefix) : engineCount(prefix % u"enginecount"), categoryId(prefix % u"idcategory"), designator(prefix % u"designator"), iata(prefix % u"iata"),
+                                                          family(prefix % u"family"), manufacturer(prefix % u"manufacturer"), model(prefix % u"model"), modelIata(prefix % u"modeliata"),
+                                                          modelSwift(prefix % u"modelswift"), type(prefix % u"type"), engine(prefix % u"engine"), wtc(prefix % u"wtc"),
+                                                          realWorld(prefix % u"realworld"), legacy(prefix % u"legacy"), military(prefix % u"military"), rank(prefix % u"rank")
+            {}
+
+            QString engineCount; //!< number of engines
+            QString categoryId; //!< category key
+            QString designator; //!< designator
+            QString iata; //!< IATA code
+            QString family; //!< family
+            QString manufacturer; //!< manufacturer
+            QString model; //!< model
+            QString modelIata; //!< IATA model
+            QString modelSwift; //!< swift model
+            QString type; //!< aircraft type
+            QString engine; //!< engine type
+            QString wtc; //!< wake turbulence category
+            QString realWorld; //!< real world flag
+            QString legacy; //!< legacy flag
+            QString military; //!< military flag
+            QString rank; //!< rank
+        };
+    }
+
     CAircraftIcaoCode CAircraftIcaoCode::fromDatabaseJson(const QJsonObject &json, const QString &prefix)
     {
         if (!existsKey(json, prefix))
@@ -870,20 +928,21 @@ namespace BlackMisc::Aviation
             return CAircraftIcaoCode();
         }
 
-        const int engineCount(json.value(prefix % u"enginecount").toInt(-1));
-        const int categoryId(json.value(prefix % u"idcategory").toInt(-1));
-        const QString designator(json.value(prefix % u"designator").toString());
-        const QString iata(json.value(prefix % u"iata").toString());
-        const QString family(json.value(prefix % u"family").toString());
-        const QString manufacturer(json.value(prefix % u"manufacturer").toString());
-        const QString model(json.value(prefix % u"model").toString());
-        const QString modelIata(json.value(prefix % u"modeliata").toString());
-        const QString modelSwift(json.value(prefix % u"modelswift").toString());
-        const QString type(json.value(prefix % u"type").toString());
-        const QString engine(json.value(prefix % u"engine").toString());
+        const AircraftIcaoJsonKeys &keys = Db::jsonKeys<AircraftIcaoJsonKeys>(prefix);
+        const int engineCount(json.value(keys.engineCount).toInt(-1));
+        const int categoryId(json.value(keys.categoryId).toInt(-1));
+        const QString designator(json.value(keys.designator).toString());
+        const QString iata(json.value(keys.iata).toString());
+        const QString family(json.value(keys.family).toString());
+        const QString manufacturer(json.value(keys.manufacturer).toString());
+        const QString model(json.value(keys.model).toString());
+        const QString modelIata(json.value(keys.modelIata).toString());
+        const QString modelSwift(json.value(keys.modelSwift).toString());
+        const QString type(json.value(keys.type).toString());
+        const QString engine(json.value(keys.engine).toString());
         const QString combined(createdCombinedString(type, engineCount, engine));
 
-        QString wtcString(json.value(prefix % u"wtc").toString());
+        QString wtcString(json.value(keys.wtc).toString());
         if (wtcString.length() > 1 && wtcString.contains("/"))
         {
             // "L/M" -> "M"
@@ -892,10 +951,10 @@ namespace BlackMisc::Aviation
         Q_ASSERT_X(wtcString.length() < 2, Q_FUNC_INFO, "WTC too long");
         const CWakeTurbulenceCategory wtc = wtcString.isEmpty() ? CWakeTurbulenceCategory() : CWakeTurbulenceCategory(wtcString.at(0));
 
-        const bool real = CDatastoreUtility::dbBoolStringToBool(json.value(prefix % u"realworld").toString());
-        const bool legacy = CDatastoreUtility::dbBoolStringToBool(json.value(prefix % u"legacy").toString());
-        const bool military = CDatastoreUtility::dbBoolStringToBool(json.value(prefix % u"military").toString());
-        const int rank(json.value(prefix % u"rank").toInt(10));
+        const bool real = CDatastoreUtility::dbBoolStringToBool(json.value(keys.realWorld).toString());
+        const bool legacy = CDatastoreUtility::dbBoolStringToBool(json.value(keys.legacy).toString());
+        const bool military = CDatastoreUtility::dbBoolStringToBool(json.value(keys.military).toString());
+        const int rank(json.value(keys.rank).toInt(10));
 
         CAircraftIcaoCode code(
             designator, iata, family, combined, manufacturer,
@@ -13,6 +13,7 @@
 #include "blackmisc/blackmiscexport.h"
 #include "blackmisc/metaclass.h"
 #include "blackmisc/propertyindexref.h"
+#include "blackmisc/sortkey.h"
 #include "blackmisc/statusmessagelist.h"
 #include "blackmisc/valueobject.h"
 
@@ -296,6 +297,9 @@ namespace BlackMisc::Aviation
         //! \copydoc BlackMisc::Mixin::Index::comparePropertyByIndex
         int comparePropertyByIndex(CPropertyIndexRef index, const CAircraftIcaoCode &compareValue) const;
 
+        //! Sort key, orders like comparePropertyByIndex, invalid for properties without key
+        CSortKey sortKeyByIndex(CPropertyIndexRef index) const;
+
         //! \copydoc BlackMisc::Mixin::String::toQString
         QString convertToQString(bool i18n = false) const;
 
@@ -522,6 +522,11 @@ namespace BlackMisc::Aviation
     }
 
     void CAircraftSituation::setOnGroundFactor(double groundFactor)
+    {
+        m_onGroundFactor = fixedOnGroundFactor(groundFactor);
+    }
+
+    double CAircraftSituation::fixedOnGroundFactor(double groundFactor)
     {
         double gf = groundFactor;
         do
@@ -543,7 +548,7 @@ namespace BlackMisc::Aviation
             }
         }
         while (false);
-        m_onGroundFactor = gf;
+        return gf;
     }
 
     bool CAircraftSituation::shouldGuessOnGround() const
@@ -239,6 +239,9 @@ namespace BlackMisc
             //! Set on ground factor 0..1 (on ground), -1 not set
             void setOnGroundFactor(double groundFactor);
 
+            //! On ground factor snapped to -1 (not set), 0 and 1
+            static double fixedOnGroundFactor(double groundFactor);
+
             //! Should we guess on ground?
             bool shouldGuessOnGround() const;
 
@@ -4,6 +4,7 @@
 #include "blackmisc/aviation/airlineicaocode.h"
 #include "blackmisc/aviation/callsign.h"
 #include "blackmisc/db/datastoreutility.h"
+#include "blackmisc/db/jsonkeys.h"
 #include "blackmisc/comparefunctions.h"
 #include "blackmisc/icons.h"
 #include "blackmisc/logcategories.h"
@@ -286,6 +287,30 @@ namespace BlackMisc::Aviation
         return 0;
     }
 
+    CSortKey CAirlineIcaoCode::sortKeyByIndex(CPropertyIndexRef index) const
+    {
+        if (index.isMyself()) { return CSortKey(m_designator, Qt::CaseInsensitive); }
+        if (IDatastoreObjectWithIntegerKey::canHandleIndex(index)) { return IDatastoreObjectWithIntegerKey::sortKeyByIndex(index); }
+        const ColumnIndex i = index.frontCasted<ColumnIndex>();
+        switch (i)
+        {
+        case IndexAirlineIconHTML:
+        case IndexAirlineDesignator: return CSortKey(m_designator);
+        case IndexIataCode: return CSortKey(m_iataCode);
+        case IndexDesignatorNameCountry: return CSortKey(m_country.getName(), Qt::CaseInsensitive);
+        case IndexAirlineName: return CSortKey(m_name, Qt::CaseInsensitive);
+        case IndexTelephonyDesignator: return CSortKey(m_telephonyDesignator, Qt::CaseInsensitive);
+        case IndexIsVirtualAirline: return CSortKey(this->isVirtualAirline());
+        case IndexIsOperating: return CSortKey(this->isOperating());
+        case IndexIsMilitary: return CSortKey(this->isMilitary());
+        case IndexGroupDesignator: return CSortKey(m_groupDesignator, Qt::CaseInsensitive);
+        case IndexGroupName: return CSortKey(m_groupName, Qt::CaseInsensitive);
+        case IndexGroupId: return CSortKey(m_groupId);
+        default: break;
+        }
+        return {};
+    }
+
     CStatusMessageList CAirlineIcaoCode::validate() const
     {
         static const CLogCategoryList cats(CLogCategoryList(this).withValidation());
@@ -457,6 +482,33 @@ namespace BlackMisc::Aviation
         return null;
     }
 
+    namespace
+    {
+        //! JSON keys of CAirlineIcaoCode::fromDatabaseJson
+        struct AirlineIcaoJsonKeys
+        {
+            //! Keys with prefix
+            AirlineIcaoJsonKeys(const QString &prefix) : designator(prefix % u"designator"), iata(prefix % u"iata"), telephony(prefix % u"callsign"), name(prefix % u"name"),
+                                                         countryIso(prefix % u"country"), countryName(prefix % u"countryname"), groupName(prefix % u"groupname"),
+                                                         groupDesignator(prefix % u"groupdesignator"), groupId(prefix % u"groupid"), va(prefix % u"va"),
+                                                         operating(prefix % u"operating"), military(prefix % u"military")
+            {}
+
+            QString designator; //!< designator
+            QString iata; //!< IATA code
+            QString telephony; //!< telephony designator
+            QString name; //!< name
+            QString countryIso; //!< country ISO code
+            QString countryName; //!< country name
+            QString groupName; //!< group name
+            QString groupDesignator; //!< group designator
+            QString groupId; //!< group id
+            QString va; //!< virtual airline flag
+            QString operating; //!< operating flag
+            QString military; //!< military flag
+        };
+    }
+
     CAirlineIcaoCode CAirlineIcaoCode::fromDatabaseJson(const QJsonObject &json, const QString &prefix)
     {
         if (!existsKey(json, prefix))
@@ -465,23 +517,24 @@ namespace BlackMisc::Aviation
             return CAirlineIcaoCode();
         }
 
-        QString designator(json.value(prefix % u"designator").toString());
+        const AirlineIcaoJsonKeys &keys = Db::jsonKeys<AirlineIcaoJsonKeys>(prefix);
+        QString designator(json.value(keys.designator).toString());
         if (!CAirlineIcaoCode::isValidAirlineDesignator(designator))
         {
             designator = CAirlineIcaoCode::normalizeDesignator(designator);
         }
 
-        const QString iata(json.value(prefix % u"iata").toString());
-        const QString telephony(json.value(prefix % u"callsign").toString());
-        const QString name(json.value(prefix % u"name").toString());
-        const QString countryIso(json.value(prefix % u"country").toString());
-        const QString countryName(json.value(prefix % u"countryname").toString());
-        const QString groupName(json.value(prefix % u"groupname").toString());
-        const QString groupDesignator(json.value(prefix % u"groupdesignator").toString());
-        const int groupId(json.value(prefix % u"groupid").toInt(-1));
-        const bool va = CDatastoreUtility::dbBoolStringToBool(json.value(prefix % u"va").toString());
-        const bool operating = CDatastoreUtility::dbBoolStringToBool(json.value(prefix % u"operating").toString());
-        const bool military = CDatastoreUtility::dbBoolStringToBool(json.value(prefix % u"military").toString());
+        const QString iata(json.value(keys.iata).toString());
+        const QString telephony(json.value(keys.telephony).toString());
+        const QString name(json.value(keys.name).toString());
+        const QString countryIso(json.value(keys.countryIso).toString());
+        const QString countryName(json.value(keys.countryName).toString());
+        const QString groupName(json.value(keys.groupName).toString());
+        const QString groupDesignator(json.value(keys.groupDesignator).toString());
+        const int groupId(json.value(keys.groupId).toInt(-1));
+        const bool va = CDatastoreUtility::dbBoolStringToBool(json.value(keys.va).toString());
+        const bool operating = CDatastoreUtility::dbBoolStringToBool(json.value(keys.operating).toString());
+        const bool military = CDatastoreUtility::dbBoolStringToBool(json.value(keys.military).toString());
 
         CAirlineIcaoCode code(
             designator, name,
@@ -11,6 +11,7 @@
 #include "blackmisc/db/datastore.h"
 #include "blackmisc/metaclass.h"
 #include "blackmisc/propertyindexref.h"
+#include "blackmisc/sortkey.h"
 #include "blackmisc/statusmessagelist.h"
 #include "blackmisc/valueobject.h"
 
@@ -216,6 +217,9 @@ namespace BlackMisc::Aviation
         //! \copydoc Mixin::Index::comparePropertyByIndex
         int comparePropertyByIndex(CPropertyIndexRef index, const CAirlineIcaoCode &compareValue) const;
 
+        //! Sort key, orders like comparePropertyByIndex, invalid for properties without key
+        CSortKey sortKeyByIndex(CPropertyIndexRef index) const;
+
         //! Get icon resource path
         QString getIconResourcePath() const;
 
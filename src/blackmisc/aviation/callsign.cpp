@@ -371,6 +371,21 @@ namespace BlackMisc::Aviation
         return 0;
     }
 
+    CSortKey CCallsign::sortKeyByIndex(CPropertyIndexRef index) const
+    {
+        if (index.isMyself()) { return CSortKey(m_callsign, Qt::CaseInsensitive); }
+        const ColumnIndex i = index.frontCasted<ColumnIndex>();
+        switch (i)
+        {
+        case IndexCallsignString: return CSortKey(m_callsign, Qt::CaseInsensitive);
+        case IndexCallsignStringAsSet: return CSortKey(m_callsignAsSet, Qt::CaseInsensitive);
+        case IndexTelephonyDesignator: return CSortKey(m_telephonyDesignator, Qt::CaseInsensitive);
+        case IndexSuffix: return CSortKey(this->getSuffix(), Qt::CaseInsensitive);
+        default: break;
+        }
+        return {};
+    }
+
     bool CCallsign::isValid() const
     {
         switch (m_typeHint)
@@ -9,6 +9,7 @@
 #include "blackmisc/blackmiscexport.h"
 #include "blackmisc/metaclass.h"
 #include "blackmisc/propertyindexref.h"
+#include "blackmisc/sortkey.h"
 #include "blackmisc/valueobject.h"
 #include "blackmisc/statusmessage.h"
 #include <QMetaType>
@@ -165,6 +166,9 @@ namespace BlackMisc
             //! \copydoc BlackMisc::Mixin::Index::comparePropertyByIndex
             int comparePropertyByIndex(CPropertyIndexRef index, const CCallsign &compareValue) const;
 
+            //! Sort key, orders like comparePropertyByIndex, invalid for properties without key
+            CSortKey sortKeyByIndex(CPropertyIndexRef index) const;
+
             //! \copydoc BlackMisc::Mixin::String::toQString()
             QString convertToQString(bool i18n = false) const;
 
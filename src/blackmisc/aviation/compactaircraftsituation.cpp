@@ -0,0 +1,131 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+#include "blackmisc/aviation/compactaircraftsituation.h"
+#include "blackmisc/aviation/aircraftvelocity.h"
+#include "blackmisc/aviation/callsign.h"
+#include "blackmisc/geo/elevationplane.h"
+#include "blackmisc/pq/units.h"
+
+using namespace BlackMisc::Geo;
+using namespace BlackMisc::PhysicalQuantities;
+
+namespace BlackMisc::Aviation
+{
+    namespace
+    {
+        //! Value in unit, NaN for null quantities
+        template <class PQ, class MU>
+        double valueOrNull(const PQ &quantity, const MU &unit)
+        {
+            return quantity.isNull() ? CompactAircraftSituation::NullValue : quantity.value(unit);
+        }
+    }
+
+    bool CompactAircraftSituation::setOnGroundFromGroundFactorFromInterpolation(double threshold)
+    {
+        onGroundDetails = CAircraftSituation::OnGroundByInterpolation;
+        if (onGroundFactor < 0.0)
+        {
+            this->setOnGround(false); // same as CAircraftSituation
+            return false;
+        }
+
+        // set on ground but leave factor untouched
+        onGround = onGroundFactor > threshold ? CAircraftSituation::OnGround : CAircraftSituation::NotOnGround;
+        return true;
+    }
+
+    CompactAircraftSituation CompactAircraftSituation::fromSituation(const CAircraftSituation &situation)
+    {
+        CompactAircraftSituation c;
+        c.normalVector = situation.getPosition().normalVectorDouble();
+        c.altitudeM = valueOrNull(situation.getAltitude(), CLengthUnit::m());
+        c.altitudeDatum = static_cast<quint8>(situation.getAltitude().getReferenceDatum());
+        c.altitudeType = static_cast<quint8>(situation.getAltitude().getAltitudeType());
+        c.pressureAltitudeM = valueOrNull(situation.getPressureAltitude(), CLengthUnit::m());
+        c.pressureAltitudeDatum = static_cast<quint8>(situation.getPressureAltitude().getReferenceDatum());
+        c.headingRad = valueOrNull(situation.getHeading(), CAngleUnit::rad());
+        c.setFlag(MagneticHeading, situation.getHeading().isMagneticHeading());
+        c.pitchRad = valueOrNull(situation.getPitch(), CAngleUnit::rad());
+        c.bankRad = valueOrNull(situation.getBank(), CAngleUnit::rad());
+        c.groundSpeedMps = valueOrNull(situation.getGroundSpeed(), CSpeedUnit::m_s());
+        c.cgM = valueOrNull(situation.getCG(), CLengthUnit::m());
+        c.sceneryOffsetM = valueOrNull(situation.getSceneryOffset(), CLengthUnit::m());
+
+        const CElevationPlane &plane = situation.getGroundElevationPlane();
+        c.elevationNormalVector = plane.normalVectorDouble();
+        c.elevationM = valueOrNull(plane.getAltitude(), CLengthUnit::m());
+        c.elevationDatum = static_cast<quint8>(plane.getAltitude().getReferenceDatum());
+        c.elevationRadiusM = valueOrNull(plane.getRadius(), CLengthUnit::m());
+        c.elevationInfo = static_cast<quint8>(situation.getGroundElevationInfo());
+        c.setFlag(ElvInfoTransferred, situation.isGroundElevationInfoTransferred());
+
+        if (situation.hasVelocity())
+        {
+            const CAircraftVelocity &v = situation.getVelocity();
+            c.velocityMps = { { v.getVelocityX(CSpeedUnit::m_s()), v.getVelocityY(CSpeedUnit::m_s()), v.getVelocityZ(CSpeedUnit::m_s()) } };
+            c.angularVelocityRadps = { { v.getPitchVelocity(CAngleUnit::rad(), CTimeUnit::s()), v.getRollVelocity(CAngleUnit::rad(), CTimeUnit::s()), v.getHeadingVelocity(CAngleUnit::rad(), CTimeUnit::s()) } };
+            c.setFlag(HasVelocity, true);
+        }
+
+        c.onGround = static_cast<quint8>(situation.getOnGround());
+        c.onGroundDetails = static_cast<quint8>(situation.getOnGroundDetails());
+        c.onGroundFactor = situation.getOnGroundFactor();
+        c.setFlag(Interim, situation.isInterim());
+        c.msecsSinceEpoch = situation.getMSecsSinceEpoch();
+        c.timeOffsetMs = situation.getTimeOffsetMs();
+        return c;
+    }
+
+    CAircraftSituation CompactAircraftSituation::toSituation(const CCallsign &callsign) const
+    {
+        static const CLengthUnit altUnit = CAltitude::defaultUnit();
+
+        CAircraftSituation situation(callsign);
+        CCoordinateGeodetic position(normalVector);
+        if (!isNull(altitudeM))
+        {
+            const CAltitude altitude(altitudeM, static_cast<CAltitude::ReferenceDatum>(altitudeDatum), static_cast<CAltitude::AltitudeType>(altitudeType), CLengthUnit::m());
+            position.setGeodeticHeight(altitude.switchedUnit(altUnit));
+        }
+        situation.setPosition(position);
+
+        if (!isNull(pressureAltitudeM))
+        {
+            const CAltitude pressureAltitude(pressureAltitudeM, static_cast<CAltitude::ReferenceDatum>(pressureAltitudeDatum), CAltitude::PressureAltitude, CLengthUnit::m());
+            situation.setPressureAltitude(pressureAltitude.switchedUnit(altUnit));
+        }
+        if (!isNull(headingRad))
+        {
+            const CAngle heading = CAngle(headingRad, CAngleUnit::rad()).switchedUnit(CAngleUnit::deg());
+            situation.setHeading(CHeading(heading, hasFlag(MagneticHeading) ? CHeading::Magnetic : CHeading::True));
+        }
+        if (!isNull(pitchRad)) { situation.setPitch(CAngle(pitchRad, CAngleUnit::rad()).switchedUnit(CAngleUnit::deg())); }
+        if (!isNull(bankRad)) { situation.setBank(CAngle(bankRad, CAngleUnit::rad()).switchedUnit(CAngleUnit::deg())); }
+        if (!isNull(groundSpeedMps)) { situation.setGroundSpeed(CSpeed(groundSpeedMps, CSpeedUnit::m_s()).switchedUnit(CSpeedUnit::kts())); }
+        if (!isNull(cgM)) { situation.setCG(CLength(cgM, CLengthUnit::m())); }
+        if (!isNull(sceneryOffsetM)) { situation.setSceneryOffset(CLength(sceneryOffsetM, CLengthUnit::m())); }
+
+        if (!isNull(elevationM))
+        {
+            CCoordinateGeodetic elevationPosition(elevationNormalVector);
+            elevationPosition.setGeodeticHeight(CAltitude(elevationM, static_cast<CAltitude::ReferenceDatum>(elevationDatum), CLengthUnit::m()));
+            const CLength radius = isNull(elevationRadiusM) ? CLength::null() : CLength(elevationRadiusM, CLengthUnit::m());
+            situation.setGroundElevation(CElevationPlane(elevationPosition, radius), static_cast<CAircraftSituation::GndElevationInfo>(elevationInfo), hasFlag(ElvInfoTransferred));
+        }
+
+        if (hasFlag(HasVelocity))
+        {
+            situation.setVelocity(CAircraftVelocity(velocityMps[0], velocityMps[1], velocityMps[2], CSpeedUnit::m_s(),
+                                                    angularVelocityRadps[0], angularVelocityRadps[1], angularVelocityRadps[2], CAngleUnit::rad(), CTimeUnit::s()));
+        }
+
+        situation.setOnGround(static_cast<CAircraftSituation::IsOnGround>(onGround), static_cast<CAircraftSituation::OnGroundDetails>(onGroundDetails));
+        situation.setOnGroundFactor(onGroundFactor);
+        situation.setInterimFlag(hasFlag(Interim));
+        situation.setMSecsSinceEpoch(msecsSinceEpoch);
+        situation.setTimeOffsetMs(timeOffsetMs);
+        return situation;
+    }
+} // ns
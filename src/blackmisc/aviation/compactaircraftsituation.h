@@ -0,0 +1,116 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#ifndef BLACKMISC_AVIATION_COMPACTAIRCRAFTSITUATION_H
+#define BLACKMISC_AVIATION_COMPACTAIRCRAFTSITUATION_H
+
+#include "blackmisc/aviation/aircraftsituation.h"
+#include "blackmisc/blackmiscexport.h"
+
+#include <QtGlobal>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+namespace BlackMisc::Aviation
+{
+    class CCallsign;
+
+    /*!
+     * Plain old data representation of CAircraftSituation for the interpolation hot path.
+     *
+     * All values are SI normalized (m, rad, m/s, rad/s, ms), null quantities are NaN.
+     * Conversion to and from CAircraftSituation keeps all values, only the units are normalized
+     * (altitudes and lengths in ft, angles in deg, ground speed in kts as used by CAircraftSituation).
+     * The callsign is not part of the struct, it is passed when converting back.
+     */
+    struct BLACKMISC_EXPORT CompactAircraftSituation
+    {
+        //! Flags
+        enum Flag : quint16
+        {
+            NoFlags = 0,
+            HasVelocity = 1 << 0, //!< velocity is set
+            Interim = 1 << 1, //!< interim situation
+            ElvInfoTransferred = 1 << 2, //!< ground elevation has been transferred
+            MagneticHeading = 1 << 3, //!< heading relative to magnetic north
+        };
+
+        //! Null value
+        static constexpr double NullValue = std::numeric_limits<double>::quiet_NaN();
+
+        std::array<double, 3> normalVector { { 0, 0, 0 } }; //!< position normal vector, (0, 0, 0) is a null position
+        double altitudeM = NullValue; //!< altitude (geodetic height)
+        double pressureAltitudeM = NullValue; //!< pressure altitude
+        double headingRad = NullValue; //!< heading
+        double pitchRad = NullValue; //!< pitch
+        double bankRad = NullValue; //!< bank
+        double groundSpeedMps = NullValue; //!< ground speed
+        double cgM = NullValue; //!< center of gravity
+        double sceneryOffsetM = NullValue; //!< scenery offset
+        std::array<double, 3> elevationNormalVector { { 0, 0, 0 } }; //!< ground elevation position normal vector
+        double elevationM = NullValue; //!< ground elevation
+        double elevationRadiusM = NullValue; //!< ground elevation radius
+        std::array<double, 3> velocityMps { { 0, 0, 0 } }; //!< linear velocity x, y, z
+        std::array<double, 3> angularVelocityRadps { { 0, 0, 0 } }; //!< angular velocity pitch, roll, heading
+        double onGroundFactor = -1; //!< 1..on ground, 0..not on ground, -1 no info
+        qint64 msecsSinceEpoch = -1; //!< timestamp
+        qint64 timeOffsetMs = 0; //!< time offset
+        quint16 flags = NoFlags; //!< \sa Flag
+        quint8 onGround = CAircraftSituation::OnGroundSituationUnknown; //!< \sa CAircraftSituation::IsOnGround
+        quint8 onGroundDetails = CAircraftSituation::NotSetGroundDetails; //!< \sa CAircraftSituation::OnGroundDetails
+        quint8 elevationInfo = CAircraftSituation::NoElevationInfo; //!< \sa CAircraftSituation::GndElevationInfo
+        quint8 altitudeDatum = CAltitude::MeanSeaLevel; //!< \sa CAltitude::ReferenceDatum
+        quint8 altitudeType = CAltitude::TrueAltitude; //!< \sa CAltitude::AltitudeType
+        quint8 pressureAltitudeDatum = CAltitude::MeanSeaLevel; //!< \sa CAltitude::ReferenceDatum
+        quint8 elevationDatum = CAltitude::MeanSeaLevel; //!< \sa CAltitude::ReferenceDatum
+
+        //! Null value?
+        static bool isNull(double value) { return std::isnan(value); }
+
+        //! Flag set?
+        bool hasFlag(Flag flag) const { return (flags & flag) != 0; }
+
+        //! Set or clear flag
+        void setFlag(Flag flag, bool set) { flags = static_cast<quint16>(set ? (flags | flag) : (flags & ~flag)); }
+
+        //! Timestamp plus offset
+        qint64 getAdjustedMSecsSinceEpoch() const { return msecsSinceEpoch + timeOffsetMs; }
+
+        //! Null position?
+        bool isPositionNull() const { return normalVector[0] == 0 && normalVector[1] == 0 && normalVector[2] == 0; }
+
+        //! Ground elevation available?
+        bool hasGroundElevation() const { return !isNull(elevationM); }
+
+        //! On ground?
+        bool isOnGround() const { return onGround == CAircraftSituation::OnGround; }
+
+        //! \copydoc CAircraftSituation::setOnGround(bool)
+        void setOnGround(bool og)
+        {
+            onGround = og ? CAircraftSituation::OnGround : CAircraftSituation::NotOnGround;
+            onGroundFactor = og ? 1.0 : 0.0;
+        }
+
+        //! \copydoc CAircraftSituation::setOnGroundFactor
+        void setOnGroundFactor(double groundFactor) { onGroundFactor = CAircraftSituation::fixedOnGroundFactor(groundFactor); }
+
+        //! \copydoc CAircraftSituation::setOnGroundFromGroundFactorFromInterpolation
+        bool setOnGroundFromGroundFactorFromInterpolation(double threshold = 0.5);
+
+        //! From situation
+        static CompactAircraftSituation fromSituation(const CAircraftSituation &situation);
+
+        //! To situation
+        CAircraftSituation toSituation(const CCallsign &callsign) const;
+    };
+
+    static_assert(std::is_trivially_copyable_v<CompactAircraftSituation>, "Must be copyable as plain memory");
+    static_assert(std::is_standard_layout_v<CompactAircraftSituation>, "Must be plain old data");
+} // ns
+
+#endif // guard
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
 
 #include "blackmisc/db/datastoreutility.h"
+#include "blackmisc/db/jsonkeys.h"
 #include "blackmisc/aviation/livery.h"
 #include "blackmisc/mixin/mixincompare.h"
 #include "blackmisc/comparefunctions.h"
@@ -218,6 +219,24 @@ namespace BlackMisc::Aviation
         }
     }
 
+    namespace
+    {
+        //! JSON keys of CLivery::fromDatabaseJson
+        struct LiveryJsonKeys
+        {
+            //! Keys with prefix
+            LiveryJsonKeys(const QString &prefix) : combinedCode(prefix % u"combinedcode"), description(prefix % u"description"), colorFuselage(prefix % u"colorfuselage"),
+                                                    colorTail(prefix % u"colortail"), military(prefix % u"military")
+            {}
+
+            QString combinedCode; //!< combined code
+            QString description; //!< description
+            QString colorFuselage; //!< fuselage color
+            QString colorTail; //!< tail color
+            QString military; //!< military flag
+        };
+    }
+
     CLivery CLivery::fromDatabaseJson(const QJsonObject &json, const QString &prefix)
     {
         if (!existsKey(json, prefix))
@@ -226,7 +245,8 @@ namespace BlackMisc::Aviation
             return CLivery();
         }
 
-        const QString combinedCode(json.value(prefix % u"combinedcode").toString());
+        const LiveryJsonKeys &keys = Db::jsonKeys<LiveryJsonKeys>(prefix);
+        const QString combinedCode(json.value(keys.combinedCode).toString());
         if (combinedCode.isEmpty())
         {
             CLivery liveryStub; // only consists of id, maybe key and timestamp
@@ -235,12 +255,13 @@ namespace BlackMisc::Aviation
         }
 
         const bool isColorLivery = combinedCode.startsWith(colorLiveryMarker());
-        const QString description(json.value(prefix % u"description").toString());
-        const CRgbColor colorFuselage(json.value(prefix % u"colorfuselage").toString());
-        const CRgbColor colorTail(json.value(prefix % u"colortail").toString());
-        const bool military = CDatastoreUtility::dbBoolStringToBool(json.value(prefix % u"military").toString());
+        const QString description(json.value(keys.description).toString());
+        const CRgbColor colorFuselage(json.value(keys.colorFuselage).toString());
+        const CRgbColor colorTail(json.value(keys.colorTail).toString());
+        const bool military = CDatastoreUtility::dbBoolStringToBool(json.value(keys.military).toString());
         CAirlineIcaoCode airline;
-        if (!isColorLivery) { airline = CAirlineIcaoCode::fromDatabaseJson(json, "al_"); }
+        static const QString prefixAirline("al_");
+        if (!isColorLivery) { airline = CAirlineIcaoCode::fromDatabaseJson(json, prefixAirline); }
         CLivery livery(combinedCode, airline, description, colorFuselage, colorTail, military);
         livery.setKeyVersionTimestampFromDatabaseJson(json, prefix);
 
@@ -258,7 +279,8 @@ namespace BlackMisc::Aviation
             return CLivery();
         }
 
-        const QString combinedCode(json.value(prefix % u"combinedcode").toString());
+        const LiveryJsonKeys &keys = Db::jsonKeys<LiveryJsonKeys>(prefix);
+        const QString combinedCode(json.value(keys.combinedCode).toString());
         if (combinedCode.isEmpty())
         {
             CLivery liveryStub; // only consists of id, maybe key and timestamp
@@ -267,16 +289,17 @@ namespace BlackMisc::Aviation
         }
 
         const bool isColorLivery = combinedCode.startsWith(colorLiveryMarker());
-        const QString description(json.value(prefix % u"description").toString());
-        const CRgbColor colorFuselage(json.value(prefix % u"colorfuselage").toString());
-        const CRgbColor colorTail(json.value(prefix % u"colortail").toString());
-        const bool military = CDatastoreUtility::dbBoolStringToBool(json.value(prefix % u"military").toString());
+        const QString description(json.value(keys.description).toString());
+        const CRgbColor colorFuselage(json.value(keys.colorFuselage).toString());
+        const CRgbColor colorTail(json.value(keys.colorTail).toString());
+        const bool military = CDatastoreUtility::dbBoolStringToBool(json.value(keys.military).toString());
 
         CAirlineIcaoCode airline;
         if (!isColorLivery)
         {
             static const QString prefixAirline("al_");
-            const int idAirlineIcao = json.value(prefixAirline % u"id").toInt(-1);
+            static const QString keyAirlineId(prefixAirline % u"id");
+            const int idAirlineIcao = json.value(keyAirlineId).toInt(-1);
             const bool cachedAirlineIcao = idAirlineIcao >= 0 && airlineIcaos.contains(idAirlineIcao);
 
             airline = cachedAirlineIcao ?
@@ -411,6 +434,22 @@ namespace BlackMisc::Aviation
         return 0;
     }
 
+    CSortKey CLivery::sortKeyByIndex(CPropertyIndexRef index) const
+    {
+        if (index.isMyself()) { return CSortKey(this->getCombinedCode()); }
+        if (IDatastoreObjectWithIntegerKey::canHandleIndex(index)) { return IDatastoreObjectWithIntegerKey::sortKeyByIndex(index); }
+        const ColumnIndex i = index.frontCasted<ColumnIndex>();
+        switch (i)
+        {
+        case IndexDescription: return CSortKey(m_description, Qt::CaseInsensitive);
+        case IndexAirlineIcaoCode: return m_airline.sortKeyByIndex(index.copyFrontRemoved());
+        case IndexCombinedCode: return CSortKey(this->getCombinedCode());
+        case IndexIsMilitary: return CSortKey(this->isMilitary());
+        default: break;
+        }
+        return {};
+    }
+
     void CLivery::updateMissingParts(const CLivery &otherLivery)
     {
         if (!this->hasValidDbKey() && otherLivery.hasValidDbKey())
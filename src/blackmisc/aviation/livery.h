@@ -11,6 +11,7 @@
 #include "blackmisc/db/datastore.h"
 #include "blackmisc/metaclass.h"
 #include "blackmisc/propertyindexref.h"
+#include "blackmisc/sortkey.h"
 #include "blackmisc/rgbcolor.h"
 #include "blackmisc/statusmessagelist.h"
 #include "blackmisc/valueobject.h"
@@ -140,6 +141,9 @@ namespace BlackMisc::Aviation
         //! Compare for index
         int comparePropertyByIndex(CPropertyIndexRef index, const CLivery &compareValue) const;
 
+        //! Sort key, orders like comparePropertyByIndex, invalid for properties without key
+        CSortKey sortKeyByIndex(CPropertyIndexRef index) const;
+
         //! \copydoc Mixin::String::toQString
         QString convertToQString(bool i18n = false) const;
 
@@ -197,12 +197,14 @@ namespace BlackMisc::Aviation
 
     CLiveryList CLiveryList::fromDatabaseJsonCaching(const QJsonArray &array, const CAirlineIcaoCodeList &relatedAirlines)
     {
+        static const QString prefix("liv_");
         AirlineIcaoIdMap airlineIcaos = relatedAirlines.toIdMap();
 
         CLiveryList models;
+        models.reserve(array.size());
         for (const QJsonValue &value : array)
         {
-            models.push_back(CLivery::fromDatabaseJsonCaching(value.toObject(), airlineIcaos));
+            models.push_back(CLivery::fromDatabaseJsonCaching(value.toObject(), airlineIcaos, prefix));
         }
         return models;
     }
@@ -60,6 +60,13 @@ namespace BlackMisc
         return otherVersionFileName(info, relativeMyCache);
     }
 
+    QString CCacheSettingsUtils::otherFormatCacheFileName(const QString &cacheFile)
+    {
+        if (cacheFile.endsWith(".json")) { return cacheFile.left(cacheFile.length() - 5) + ".bin"; }
+        if (cacheFile.endsWith(".bin")) { return cacheFile.left(cacheFile.length() - 4) + ".json"; }
+        return {};
+    }
+
     bool CCacheSettingsUtils::hasOtherVersionSettingsFile(const CApplicationInfo &info, const QString &mySettingFile)
     {
         return !otherVersionSettingsFileName(info, mySettingFile).isEmpty();
@@ -70,6 +77,18 @@ namespace BlackMisc
         return !otherVersionCacheFileName(info, myCacheFile).isEmpty();
     }
 
+    bool CCacheSettingsUtils::hasOtherVersionCacheFileAnyFormat(const CApplicationInfo &info, const QString &myCacheFile)
+    {
+        return !otherVersionCacheFileNameAnyFormat(info, myCacheFile).isEmpty();
+    }
+
+    QString CCacheSettingsUtils::otherVersionCacheFileNameAnyFormat(const CApplicationInfo &info, const QString &myCacheFile)
+    {
+        const QString file = otherVersionCacheFileName(info, myCacheFile);
+        if (!file.isEmpty()) { return file; }
+        return otherVersionCacheFileName(info, otherFormatCacheFileName(myCacheFile));
+    }
+
     QString CCacheSettingsUtils::otherVersionFileName(const CApplicationInfo &info, const QString &relativeFileName)
     {
         thread_local const QRegularExpression re("bin$");
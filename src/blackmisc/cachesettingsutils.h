@@ -43,12 +43,21 @@ namespace BlackMisc
         //! Create other version's cache file from "my cache file"
         static QString otherVersionCacheFileName(const BlackMisc::CApplicationInfo &info, const QString &myCacheFile);
 
+        //! The cache file in the other format, i.e. binary instead of JSON and vice versa
+        static QString otherFormatCacheFileName(const QString &cacheFile);
+
         //! Has the settings file for the given other version?
         static bool hasOtherVersionSettingsFile(const BlackMisc::CApplicationInfo &info, const QString &mySettingFile);
 
         //! Has the cache file for the given other version?
         static bool hasOtherVersionCacheFile(const BlackMisc::CApplicationInfo &info, const QString &myCacheFile);
 
+        //! Has the cache file for the given other version, in JSON or binary format?
+        static bool hasOtherVersionCacheFileAnyFormat(const BlackMisc::CApplicationInfo &info, const QString &myCacheFile);
+
+        //! Other version's cache file in the format of "my cache file", otherwise in the other format
+        static QString otherVersionCacheFileNameAnyFormat(const BlackMisc::CApplicationInfo &info, const QString &myCacheFile);
+
         //! Setting JSON object as string
         static QString otherVersionSettingsFileContent(const BlackMisc::CApplicationInfo &info, const QString &mySettingFile);
 
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
 
 #include "blackmisc/country.h"
+#include "blackmisc/db/jsonkeys.h"
 #include "blackmisc/icons.h"
 #include "blackmisc/stringutils.h"
 #include <QJsonValue>
@@ -177,6 +178,23 @@ namespace BlackMisc
         return CValueObject::comparePropertyByIndex(index, compareValue);
     }
 
+    namespace
+    {
+        //! JSON keys of CCountry::fromDatabaseJson
+        struct CountryJsonKeys
+        {
+            //! Keys with prefix
+            CountryJsonKeys(const QString &prefix) : iso(prefix % u"id"), name(prefix % u"country"), alias1(prefix % u"alias1"), alias2(prefix % u"alias2"), iso3(prefix % u"iso3"), historic(prefix % u"historic") {}
+
+            QString iso; //!< ISO code
+            QString name; //!< name
+            QString alias1; //!< alias 1
+            QString alias2; //!< alias 2
+            QString iso3; //!< ISO 3 letter code
+            QString historic; //!< historic flag
+        };
+    }
+
     CCountry CCountry::fromDatabaseJson(const QJsonObject &json, const QString &prefix)
     {
         if (!existsKey(json, prefix))
@@ -184,12 +202,13 @@ namespace BlackMisc
             // when using relationship, this can be null
             return CCountry();
         }
-        const QString iso(json.value(prefix % u"id").toString());
-        const QString name(json.value(prefix % u"country").toString());
-        const QString alias1(json.value(prefix % u"alias1").toString());
-        const QString alias2(json.value(prefix % u"alias2").toString());
-        const QString iso3(json.value(prefix % u"iso3").toString());
-        const QString historic(json.value(prefix % u"historic").toString());
+        const CountryJsonKeys &keys = Db::jsonKeys<CountryJsonKeys>(prefix);
+        const QString iso(json.value(keys.iso).toString());
+        const QString name(json.value(keys.name).toString());
+        const QString alias1(json.value(keys.alias1).toString());
+        const QString alias2(json.value(keys.alias2).toString());
+        const QString iso3(json.value(keys.iso3).toString());
+        const QString historic(json.value(keys.historic).toString());
         CCountry country(iso, name);
         country.setLoadedFromDb(true);
         country.setAlias1(alias1);
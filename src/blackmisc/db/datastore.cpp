@@ -4,6 +4,7 @@
 #include "blackmisc/db/datastore.h"
 #include "blackmisc/comparefunctions.h"
 #include "blackmisc/db/datastoreutility.h"
+#include "blackmisc/db/jsonkeys.h"
 #include "blackmisc/icon.h"
 
 #include <QDateTime>
@@ -12,6 +13,21 @@
 
 namespace BlackMisc::Db
 {
+    namespace
+    {
+        //! JSON keys common to all DB objects
+        struct DatastoreJsonKeys
+        {
+            //! Keys with prefix
+            DatastoreJsonKeys(const QString &prefix) : id(prefix % u"id"), lastUpdated(prefix % u"lastupdated"), tsLastUpdated(prefix % u"tsLastUpdated"), version(prefix % u"version") {}
+
+            QString id; //!< key
+            QString lastUpdated; //!< timestamp, DB format
+            QString tsLastUpdated; //!< timestamp, backend object format
+            QString version; //!< version
+        };
+    }
+
     QVersionNumber IDatastoreObject::getQVersion() const
     {
         return QVersionNumber::fromString(this->getVersion());
@@ -20,13 +36,14 @@ namespace BlackMisc::Db
     void IDatastoreObject::setTimestampVersionFromDatabaseJson(const QJsonObject &json, const QString &prefix)
     {
         // we check 2 formats, the DB format and the backend object format
-        QString timestampString(json.value(prefix % u"lastupdated").toString());
-        if (timestampString.isEmpty()) { timestampString = json.value(prefix % u"tsLastUpdated").toString(); }
+        const DatastoreJsonKeys &keys = jsonKeys<DatastoreJsonKeys>(prefix);
+        QString timestampString(json.value(keys.lastUpdated).toString());
+        if (timestampString.isEmpty()) { timestampString = json.value(keys.tsLastUpdated).toString(); }
         const QDateTime ts(CDatastoreUtility::parseTimestamp(timestampString));
         this->setUtcTimestamp(ts);
 
         // version
-        this->setVersion(json.value(prefix % u"version").toString());
+        this->setVersion(json.value(keys.version).toString());
     }
 
     QString IDatastoreObjectWithIntegerKey::getDbKeyAsString() const
@@ -84,14 +101,14 @@ namespace BlackMisc::Db
     void IDatastoreObjectWithIntegerKey::setKeyVersionTimestampFromDatabaseJson(const QJsonObject &json, const QString &prefix)
     {
         // this function is performance sensitive, as it is called for all DB data
-        const int dbKey = json.value(prefix % u"id").toInt(-1);
+        const int dbKey = json.value(jsonKeys<DatastoreJsonKeys>(prefix).id).toInt(-1);
         this->setDbKey(dbKey);
         IDatastoreObject::setTimestampVersionFromDatabaseJson(json, prefix);
     }
 
     bool IDatastoreObjectWithIntegerKey::existsKey(const QJsonObject &json, const QString &prefix)
     {
-        const QJsonValue jv(json.value(prefix % u"id"));
+        const QJsonValue jv(json.value(jsonKeys<DatastoreJsonKeys>(prefix).id));
         return !(jv.isNull() || jv.isUndefined());
     }
 
@@ -144,6 +161,20 @@ namespace BlackMisc::Db
         return 0;
     }
 
+    CSortKey IDatastoreObjectWithIntegerKey::sortKeyByIndex(CPropertyIndexRef index) const
+    {
+        if (ITimestampBased::canHandleIndex(index)) { return ITimestampBased::sortKeyByIndex(index); }
+        const ColumnIndex i = index.frontCasted<ColumnIndex>();
+        switch (i)
+        {
+        case IndexDbKeyAsString: // fall thru
+        case IndexDbIntegerKey: return CSortKey(m_dbKey);
+        case IndexDatabaseIcon: return CSortKey(this->hasValidDbKey());
+        default: break;
+        }
+        return {};
+    }
+
     bool IDatastoreObjectWithIntegerKey::canHandleIndex(BlackMisc::CPropertyIndexRef index)
     {
         if (ITimestampBased::canHandleIndex(index)) { return true; }
@@ -179,14 +210,14 @@ namespace BlackMisc::Db
 
     void IDatastoreObjectWithStringKey::setKeyVersionTimestampFromDatabaseJson(const QJsonObject &json, const QString &prefix)
     {
-        QString dbKey = json.value(prefix % u"id").toString();
+        QString dbKey = json.value(jsonKeys<DatastoreJsonKeys>(prefix).id).toString();
         this->setDbKey(dbKey);
         IDatastoreObject::setTimestampVersionFromDatabaseJson(json, prefix);
     }
 
     bool IDatastoreObjectWithStringKey::existsKey(const QJsonObject &json, const QString &prefix)
     {
-        const QJsonValue jv(json.value(prefix % u"id"));
+        const QJsonValue jv(json.value(jsonKeys<DatastoreJsonKeys>(prefix).id));
         return !(jv.isNull() || jv.isUndefined());
     }
 
@@ -243,6 +274,20 @@ namespace BlackMisc::Db
         return 0;
     }
 
+    CSortKey IDatastoreObjectWithStringKey::sortKeyByIndex(CPropertyIndexRef index) const
+    {
+        if (ITimestampBased::canHandleIndex(index)) { return ITimestampBased::sortKeyByIndex(index); }
+        const ColumnIndex i = index.frontCasted<ColumnIndex>();
+        switch (i)
+        {
+        case IndexDbKeyAsString: // fall thru
+        case IndexDbStringKey: return CSortKey(m_dbKey);
+        case IndexDatabaseIcon: return CSortKey(this->hasValidDbKey());
+        default: break;
+        }
+        return {};
+    }
+
     bool IDatastoreObjectWithStringKey::canHandleIndex(CPropertyIndexRef index)
     {
         if (index.isEmpty()) { return false; }
@@ -149,6 +149,9 @@ namespace BlackMisc
             //! \copydoc BlackMisc::Mixin::Index::comparePropertyByIndex
             int comparePropertyByIndex(CPropertyIndexRef index, const IDatastoreObjectWithIntegerKey &compareValue) const;
 
+            //! Sort key, orders like comparePropertyByIndex, invalid for the version
+            CSortKey sortKeyByIndex(CPropertyIndexRef index) const;
+
             //! Can given index be handled?
             static bool canHandleIndex(BlackMisc::CPropertyIndexRef index);
 
@@ -237,6 +240,9 @@ namespace BlackMisc
             //! \copydoc BlackMisc::Mixin::Index::comparePropertyByIndex
             int comparePropertyByIndex(BlackMisc::CPropertyIndexRef index, const IDatastoreObjectWithStringKey &compareValue) const;
 
+            //! Sort key, orders like comparePropertyByIndex, invalid for the version
+            BlackMisc::CSortKey sortKeyByIndex(BlackMisc::CPropertyIndexRef index) const;
+
             //! Can given index be handled
             static bool canHandleIndex(BlackMisc::CPropertyIndexRef index);
 
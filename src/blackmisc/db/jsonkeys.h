@@ -0,0 +1,31 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#ifndef BLACKMISC_DB_JSONKEYS_H
+#define BLACKMISC_DB_JSONKEYS_H
+
+#include <QString>
+#include <map>
+
+namespace BlackMisc::Db
+{
+    /*!
+     * Keys of a DB JSON object, prefix and field names concatenated once per prefix.
+     *
+     * KEYS is a struct of QString keys with a constructor taking the prefix. The fromDatabaseJson functions
+     * look up their keys once per object, instead of concatenating prefix and field name for every field of every row.
+     * \remark the keys are cached per thread, so rows can be decoded in parallel without locking
+     */
+    template <class KEYS>
+    const KEYS &jsonKeys(const QString &prefix)
+    {
+        thread_local std::map<QString, KEYS> keysPerPrefix; // a few prefixes only, references stay valid
+        auto it = keysPerPrefix.find(prefix);
+        if (it == keysPerPrefix.end()) { it = keysPerPrefix.emplace(prefix, KEYS(prefix)).first; }
+        return it->second;
+    }
+} // ns
+
+#endif // guard
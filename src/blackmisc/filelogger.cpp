@@ -3,6 +3,8 @@
 
 #include "blackmisc/filelogger.h"
 #include "blackmisc/swiftdirectories.h"
+#include "blackmisc/threadutils.h"
+#include "blackmisc/worker.h"
 #include "blackconfig/buildconfig.h"
 
 #include <QCoreApplication>
@@ -12,8 +14,16 @@
 #include <QIODevice>
 #include <QString>
 #include <QStringBuilder>
+#include <QTimer>
 #include <QtGlobal>
 
+#if defined(Q_OS_WIN)
+#    include <io.h>
+#    include <windows.h>
+#else
+#    include <unistd.h>
+#endif
+
 using namespace BlackConfig;
 
 namespace BlackMisc
@@ -37,6 +47,12 @@ namespace BlackMisc
         return fileName;
     }
 
+    //! Interval of the batch writes
+    constexpr int WriteIntervalMs = 100;
+
+    //! Interval of flushing the file to disk
+    constexpr qint64 SyncIntervalMs = 2000;
+
     CFileLogger::CFileLogger(QObject *parent) : QObject(parent),
                                                 m_logFile(this)
     {
@@ -60,6 +76,11 @@ namespace BlackMisc
         if (m_logFile.isOpen())
         {
             disconnect(this); // disconnect from log handler
+            if (this->isAsynchronous())
+            {
+                this->stopWriter();
+                writeContentToFile(u"Asynchronous writing, " % getStatistics().toQString());
+            }
             writeContentToFile(QStringLiteral("Logging stops."));
             m_logFile.close();
         }
@@ -86,6 +107,128 @@ namespace BlackMisc
         writeContentToFile(finalContent);
     }
 
+    void CFileLogger::setAsynchronous(bool async, int bufferRecords)
+    {
+        Q_ASSERT_X(CThreadUtils::isInThisThread(this), Q_FUNC_INFO, "Needs to be called in the owner thread");
+        if (async == this->isAsynchronous()) { return; }
+        if (!async)
+        {
+            this->stopWriter();
+            return;
+        }
+        if (!m_logFile.isOpen()) { return; }
+
+        m_stream.flush();
+        m_records.assign(static_cast<size_t>(qMax(bufferRecords, 2)), QByteArray());
+        m_recordsWritePosition = 0;
+        m_recordsReadPosition = 0;
+        m_writtenRecords = 0;
+        m_writtenBytes = 0;
+        m_writtenBatches = 0;
+        m_droppedRecords = 0;
+        m_lastSyncMs = 0;
+        m_asyncTime.start();
+
+        // the timer lives in the writer thread, so the records are written there
+        m_writerThread = new CRegularThread(this);
+        m_writerThread->setObjectName(QStringLiteral("CFileLogger: writer"));
+        m_writerTimer = new QTimer();
+        m_writerTimer->setInterval(WriteIntervalMs);
+        m_writerTimer->moveToThread(m_writerThread);
+        connect(m_writerThread, &QThread::started, m_writerTimer, qOverload<>(&QTimer::start));
+        connect(m_writerThread, &QThread::finished, m_writerTimer, &QTimer::stop);
+        connect(m_writerTimer, &QTimer::timeout, m_writerTimer, [this] { this->writeRecords(); });
+        m_writerThread->start(QThread::LowPriority);
+    }
+
+    CFileLogger::Statistics CFileLogger::getStatistics() const
+    {
+        Statistics statistics;
+        statistics.records = m_writtenRecords;
+        statistics.bytes = m_writtenBytes;
+        statistics.batches = m_writtenBatches;
+        statistics.dropped = m_droppedRecords;
+        statistics.elapsedMs = m_asyncTime.isValid() ? m_asyncTime.elapsed() : 0;
+        return statistics;
+    }
+
+    QString CFileLogger::Statistics::toQString() const
+    {
+        return QStringLiteral("records: %1 bytes: %2 batches: %3 dropped: %4 throughput: %5KB/s").arg(records).arg(bytes).arg(batches).arg(dropped).arg(bytesPerSecond() / 1024.0, 0, 'f', 1);
+    }
+
+    bool CFileLogger::pushRecord(QByteArray &&record)
+    {
+        const quint64 write = m_recordsWritePosition.load(std::memory_order_relaxed);
+        const quint64 read = m_recordsReadPosition.load(std::memory_order_acquire);
+        if (write - read >= m_records.size())
+        {
+            ++m_droppedRecords;
+            return false;
+        }
+        m_records[static_cast<size_t>(write % m_records.size())] = std::move(record);
+        m_recordsWritePosition.store(write + 1, std::memory_order_release);
+        return true;
+    }
+
+    void CFileLogger::writeRecords()
+    {
+        const quint64 read = m_recordsReadPosition.load(std::memory_order_relaxed);
+        const quint64 write = m_recordsWritePosition.load(std::memory_order_acquire);
+        if (read != write)
+        {
+            m_batch.truncate(0);
+            for (quint64 position = read; position < write; ++position)
+            {
+                QByteArray &record = m_records[static_cast<size_t>(position % m_records.size())];
+                m_batch += record;
+                record.clear();
+            }
+            m_recordsReadPosition.store(write, std::memory_order_release);
+
+            m_logFile.write(m_batch);
+            m_logFile.flush();
+            m_writtenRecords += static_cast<qint64>(write - read);
+            m_writtenBytes += m_batch.size();
+            ++m_writtenBatches;
+        }
+
+        const qint64 nowMs = m_asyncTime.elapsed();
+        if (nowMs - m_lastSyncMs >= SyncIntervalMs)
+        {
+            m_lastSyncMs = nowMs;
+            this->syncFile();
+        }
+    }
+
+    void CFileLogger::syncFile()
+    {
+        if (!m_logFile.isOpen()) { return; }
+        m_logFile.flush();
+#if defined(Q_OS_WIN)
+        FlushFileBuffers(reinterpret_cast<HANDLE>(_get_osfhandle(m_logFile.handle())));
+#else
+        ::fsync(m_logFile.handle());
+#endif
+    }
+
+    void CFileLogger::stopWriter()
+    {
+        if (!m_writerThread) { return; }
+        m_writerThread->quit();
+        m_writerThread->wait();
+        delete m_writerTimer;
+        delete m_writerThread;
+        m_writerTimer = nullptr;
+        m_writerThread = nullptr;
+
+        // writer thread has finished, remaining records are written here
+        this->writeRecords();
+        this->syncFile();
+        m_records.clear();
+        m_batch.clear();
+    }
+
     QString CFileLogger::getLogFilePath()
     {
         QString filePath = CSwiftDirectories::logDirectory() % '/' % logFileName();
@@ -127,6 +270,12 @@ namespace BlackMisc
 
     void CFileLogger::writeContentToFile(const QString &content)
     {
+        if (this->isAsynchronous())
+        {
+            // a dropped category line has to be repeated
+            if (!this->pushRecord(QString(content % u'\n').toUtf8())) { m_previousCategories.clear(); }
+            return;
+        }
         m_stream << content << Qt::endl;
     }
 }
@@ -10,10 +10,17 @@
 #include "blackmisc/logpattern.h"
 #include "blackmisc/statusmessage.h"
 
+#include <QByteArray>
+#include <QElapsedTimer>
 #include <QFile>
 #include <QObject>
 #include <QString>
 #include <QTextStream>
+#include <atomic>
+#include <vector>
+
+class QThread;
+class QTimer;
 
 namespace BlackMisc
 {
@@ -23,6 +30,22 @@ namespace BlackMisc
         Q_OBJECT
 
     public:
+        //! Statistics of the asynchronous writing
+        struct Statistics
+        {
+            qint64 records = 0; //!< written records
+            qint64 bytes = 0; //!< written bytes
+            qint64 batches = 0; //!< file writes
+            qint64 dropped = 0; //!< records dropped because the buffer was full
+            qint64 elapsedMs = 0; //!< time since asynchronous writing was enabled
+
+            //! Written bytes per second
+            double bytesPerSecond() const { return elapsedMs > 0 ? 1000.0 * bytes / elapsedMs : 0.0; }
+
+            //! Info string
+            QString toQString() const;
+        };
+
         //! Constructor.
         //! Filename defaults to QCoreApplication::applicationName() and path to "."
         CFileLogger(QObject *parent = nullptr);
@@ -33,9 +56,24 @@ namespace BlackMisc
         //! Change the log pattern. Default is to log all messages.
         void changeLogPattern(const CLogPattern &pattern) { m_logPattern = pattern; }
 
+        //! The log pattern
+        const CLogPattern &getLogPattern() const { return m_logPattern; }
+
         //! Close file
         void close();
 
+        //! Write the file in a background thread.
+        //! Messages are formatted and put into a buffer of the given number of records, which is written in batches.
+        //! \remark if the buffer is full, messages are dropped and counted, the caller is never blocked
+        void setAsynchronous(bool async, int bufferRecords = 8192);
+
+        //! Writing in a background thread?
+        bool isAsynchronous() const { return m_writerThread != nullptr; }
+
+        //! Statistics of the asynchronous writing
+        //! \threadsafe
+        Statistics getStatistics() const;
+
         //! Get the log file name
         static QString getLogFileName();
 
@@ -51,11 +89,37 @@ namespace BlackMisc
         void writeHeaderToFile();
         void writeContentToFile(const QString &content);
 
+        //! Put a record into the buffer, consumed by writeRecords
+        bool pushRecord(QByteArray &&record);
+
+        //! Write all buffered records with one file write, called in the writer thread
+        void writeRecords();
+
+        //! Flush the file to disk
+        void syncFile();
+
+        //! Stop the writer thread and write the remaining records
+        void stopWriter();
+
         CLogPattern m_logPattern;
         QFile m_logFile;
         QString m_fileName;
         QTextStream m_stream;
         QString m_previousCategories;
+
+        // asynchronous writing, single producer (owner thread), single consumer (writer thread)
+        QThread *m_writerThread = nullptr;
+        QTimer *m_writerTimer = nullptr;
+        std::vector<QByteArray> m_records; //!< ring buffer
+        std::atomic<quint64> m_recordsWritePosition { 0 };
+        std::atomic<quint64> m_recordsReadPosition { 0 };
+        QByteArray m_batch; //!< reused by the writer thread
+        QElapsedTimer m_asyncTime;
+        qint64 m_lastSyncMs = 0;
+        std::atomic<qint64> m_writtenRecords { 0 };
+        std::atomic<qint64> m_writtenBytes { 0 };
+        std::atomic<qint64> m_writtenBatches { 0 };
+        std::atomic<qint64> m_droppedRecords { 0 };
     };
 }
 
@@ -0,0 +1,393 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+#include "blackmisc/geo/elevationtilecache.h"
+#include "blackmisc/geo/latitude.h"
+#include "blackmisc/geo/longitude.h"
+#include "blackmisc/aviation/altitude.h"
+#include "blackmisc/pq/units.h"
+
+#include <QPair>
+#include <QSet>
+#include <QtMath>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <utility>
+
+using namespace BlackMisc::Aviation;
+using namespace BlackMisc::PhysicalQuantities;
+
+namespace BlackMisc::Geo
+{
+    namespace
+    {
+        //! Longitude difference in [-180, 180]
+        double normalizedLngDiff(double diffDeg)
+        {
+            while (diffDeg > 180.0) { diffDeg -= 360.0; }
+            while (diffDeg < -180.0) { diffDeg += 360.0; }
+            return diffDeg;
+        }
+
+        //! Linear interpolation
+        double lerp(double a, double b, double fraction)
+        {
+            return a + (b - a) * fraction;
+        }
+    }
+
+    QString CElevationTileCache::Statistics::toQString() const
+    {
+        static const QString info("hits %1, interpolated %2, missed %3, evicted %4");
+        return info.arg(hits).arg(interpolated).arg(misses).arg(evictions);
+    }
+
+    CElevationTileCache::Statistics CElevationTileCache::getStatistics() const
+    {
+        Statistics statistics;
+        statistics.hits = m_hits;
+        statistics.interpolated = m_interpolated;
+        statistics.misses = m_misses;
+        statistics.evictions = m_evictions;
+        return statistics;
+    }
+
+    void CElevationTileCache::resetStatistics()
+    {
+        m_hits = 0;
+        m_interpolated = 0;
+        m_misses = 0;
+        m_evictions = 0;
+    }
+
+    CElevationTileCache::CElevationTileCache(int maxElevations, int maxElevationsGnd, double cellSizeDeg) : m_cellSizeDeg(qBound(0.001, cellSizeDeg, 10.0))
+    {
+        m_latCells = qCeil(180.0 / m_cellSizeDeg);
+        m_lngCells = qCeil(360.0 / m_cellSizeDeg);
+        this->setMaxElevations(maxElevations, maxElevationsGnd);
+    }
+
+    void CElevationTileCache::setMaxElevations(int maxElevations, int maxElevationsGnd)
+    {
+        m_maxElevations = qMax(0, maxElevations);
+        m_maxElevationsGnd = qMax(0, maxElevationsGnd);
+        this->evictIfRequired(false);
+        this->evictIfRequired(true);
+    }
+
+    int CElevationTileCache::size(ElevationSelection selection) const
+    {
+        switch (selection)
+        {
+        case OnGroundElevations: return m_sizeGnd;
+        case OtherElevations: return m_size;
+        default: break;
+        }
+        return m_size + m_sizeGnd;
+    }
+
+    bool CElevationTileCache::insert(const ICoordinateGeodetic &elevation, bool onGround)
+    {
+        if (elevation.isNull() || !elevation.hasMSLGeodeticHeight()) { return false; }
+
+        Sample sample;
+        sample.coordinate = CCoordinateGeodetic(elevation);
+        sample.latDeg = elevation.latitude().value(CAngleUnit::deg());
+        sample.lngDeg = elevation.longitude().value(CAngleUnit::deg());
+        sample.queuedTick = ++m_tick;
+        sample.lastUsed = sample.queuedTick;
+        sample.onGround = onGround;
+
+        const quint64 key = this->cellKey(sample.latDeg, sample.lngDeg);
+        m_cells[key].samples.push_back(sample);
+        this->lruQueue(onGround).insert(sample.queuedTick, key);
+        if (onGround) { m_sizeGnd++; }
+        else { m_size++; }
+
+        this->evictIfRequired(onGround);
+        return true;
+    }
+
+    CCoordinateGeodetic CElevationTileCache::findClosestWithinRange(const ICoordinateGeodetic &reference, const CLength &range, ElevationSelection selection) const
+    {
+        const QVector<Candidate> candidates = this->findCandidates(reference, range, selection);
+        if (candidates.isEmpty()) { return {}; }
+        const auto closest = std::min_element(candidates.cbegin(), candidates.cend(), [](const Candidate &a, const Candidate &b) { return a.distanceM < b.distanceM; });
+        this->touch(*closest);
+        return closest->sample->coordinate;
+    }
+
+    CElevationPlane CElevationTileCache::findElevationPlane(const ICoordinateGeodetic &reference, const CLength &range) const
+    {
+        const QVector<Candidate> candidates = this->findCandidates(reference, range, AllElevations);
+        if (candidates.isEmpty())
+        {
+            m_misses++;
+            return CElevationPlane::null();
+        }
+
+        const auto closest = std::min_element(candidates.cbegin(), candidates.cend(), [](const Candidate &a, const Candidate &b) { return a.distanceM < b.distanceM; });
+        const CLength closestDistance(closest->distanceM, CLengthUnit::m());
+        if (closestDistance <= CElevationPlane::singlePointRadius())
+        {
+            this->touch(*closest);
+            m_hits++;
+            return CElevationPlane(closest->sample->coordinate, reference);
+        }
+
+        // closest elevation per quadrant: NE, NW, SE, SW
+        const double refLatDeg = reference.latitude().value(CAngleUnit::deg());
+        const double refLngDeg = reference.longitude().value(CAngleUnit::deg());
+        std::array<const Candidate *, 4> quadrants { { nullptr, nullptr, nullptr, nullptr } };
+        for (const Candidate &candidate : candidates)
+        {
+            const Sample &s = *candidate.sample;
+            const int q = (s.latDeg >= refLatDeg ? 0 : 2) + (normalizedLngDiff(s.lngDeg - refLngDeg) >= 0 ? 0 : 1);
+            if (!quadrants[q] || quadrants[q]->distanceM > candidate.distanceM) { quadrants[q] = &candidate; }
+        }
+
+        if (std::any_of(quadrants.cbegin(), quadrants.cend(), [](const Candidate *c) { return c == nullptr; }))
+        {
+            this->touch(*closest);
+            m_hits++;
+            return CElevationPlane(closest->sample->coordinate, reference);
+        }
+
+        // bilinear: along the longitude on the northern and southern edge, then along the latitude
+        const auto interpolateEdge = [&](const Candidate *west, const Candidate *east, double &latDeg, double &heightFt) {
+            const Sample &w = *west->sample;
+            const Sample &e = *east->sample;
+            const double dw = normalizedLngDiff(w.lngDeg - refLngDeg);
+            const double de = normalizedLngDiff(e.lngDeg - refLngDeg);
+            const double fraction = (de - dw) > 0 ? -dw / (de - dw) : 0.5;
+            latDeg = lerp(w.latDeg, e.latDeg, fraction);
+            heightFt = lerp(w.coordinate.geodeticHeight().value(CLengthUnit::ft()), e.coordinate.geodeticHeight().value(CLengthUnit::ft()), fraction);
+        };
+
+        double northLatDeg, northFt, southLatDeg, southFt;
+        interpolateEdge(quadrants[1], quadrants[0], northLatDeg, northFt);
+        interpolateEdge(quadrants[3], quadrants[2], southLatDeg, southFt);
+        const double fraction = (northLatDeg - southLatDeg) > 0 ? qBound(0.0, (refLatDeg - southLatDeg) / (northLatDeg - southLatDeg), 1.0) : 0.5;
+        const double heightFt = lerp(southFt, northFt, fraction);
+
+        for (const Candidate *c : quadrants) { this->touch(*c); }
+        m_interpolated++;
+
+        CCoordinateGeodetic position(reference);
+        position.setGeodeticHeight(CAltitude(heightFt, CAltitude::MeanSeaLevel, CLengthUnit::ft()));
+        return CElevationPlane(position, closestDistance);
+    }
+
+    int CElevationTileCache::removeInsideRange(const ICoordinateGeodetic &reference, const CLength &range, ElevationSelection selection)
+    {
+        return this->removeIf(selection, [&](const Sample &sample) {
+            return calculateGreatCircleDistance(sample.coordinate, reference) <= range;
+        });
+    }
+
+    int CElevationTileCache::removeOutsideRange(const ICoordinateGeodetic &reference, const CLength &range, ElevationSelection selection)
+    {
+        return this->removeIf(selection, [&](const Sample &sample) {
+            return calculateGreatCircleDistance(sample.coordinate, reference) > range;
+        });
+    }
+
+    int CElevationTileCache::keepClosest(const ICoordinateGeodetic &reference, int maxNumber, ElevationSelection selection)
+    {
+        if (maxNumber < 0 || this->size(selection) <= maxNumber) { return 0; }
+
+        // partial ordering is enough, only the ones beyond maxNumber are removed
+        QVector<QPair<double, const Sample *>> distances;
+        distances.reserve(this->size(selection));
+        for (const Cell &cell : std::as_const(m_cells))
+        {
+            for (const Sample &sample : cell.samples)
+            {
+                if (isSelected(sample, selection)) { distances.push_back({ calculateEuclideanDistanceSquared(sample.coordinate, reference), &sample }); }
+            }
+        }
+        std::nth_element(distances.begin(), distances.begin() + maxNumber, distances.end(), [](const auto &a, const auto &b) { return a.first < b.first; });
+
+        QSet<const Sample *> removed;
+        for (auto it = distances.cbegin() + maxNumber; it != distances.cend(); ++it) { removed.insert(it->second); }
+        return this->removeIf(selection, [&](const Sample &sample) { return removed.contains(&sample); });
+    }
+
+    CCoordinateGeodeticList CElevationTileCache::getElevations(ElevationSelection selection) const
+    {
+        QVector<const Sample *> samples;
+        samples.reserve(this->size(selection));
+        for (const Cell &cell : m_cells)
+        {
+            for (const Sample &sample : cell.samples)
+            {
+                if (isSelected(sample, selection)) { samples.push_back(&sample); }
+            }
+        }
+        std::sort(samples.begin(), samples.end(), [](const Sample *a, const Sample *b) { return a->lastUsed.load() > b->lastUsed.load(); });
+
+        CCoordinateGeodeticList elevations;
+        elevations.reserve(samples.size());
+        for (const Sample *sample : std::as_const(samples)) { elevations.push_back(sample->coordinate); }
+        return elevations;
+    }
+
+    void CElevationTileCache::clear()
+    {
+        m_cells.clear();
+        m_lruQueue.clear();
+        m_lruQueueGnd.clear();
+        m_size = 0;
+        m_sizeGnd = 0;
+    }
+
+    quint64 CElevationTileCache::cellKey(double latDeg, double lngDeg) const
+    {
+        const int latIndex = qBound(0, static_cast<int>(std::floor((latDeg + 90.0) / m_cellSizeDeg)), m_latCells - 1);
+        const int lngIndex = static_cast<int>(std::floor((lngDeg + 180.0) / m_cellSizeDeg));
+        return cellKey(latIndex, ((lngIndex % m_lngCells) + m_lngCells) % m_lngCells);
+    }
+
+    quint64 CElevationTileCache::cellKey(int latIndex, int lngIndex)
+    {
+        return (static_cast<quint64>(static_cast<quint32>(latIndex)) << 32) | static_cast<quint32>(lngIndex);
+    }
+
+    QVector<CElevationTileCache::Candidate> CElevationTileCache::findCandidates(const ICoordinateGeodetic &reference, const CLength &range, ElevationSelection selection) const
+    {
+        QVector<Candidate> candidates;
+        if (reference.isNull() || range.isNull() || m_cells.isEmpty()) { return candidates; }
+
+        const double rangeM = range.value(CLengthUnit::m());
+        this->forEachCellInRange(reference, range, [&](const Cell &cell) {
+            for (const Sample &sample : cell.samples)
+            {
+                if (!isSelected(sample, selection)) { continue; }
+                const CLength distance = calculateGreatCircleDistance(sample.coordinate, reference);
+                if (distance.isNull()) { continue; }
+                const double distanceM = distance.value(CLengthUnit::m());
+                if (distanceM <= rangeM) { candidates.push_back({ &sample, distanceM }); }
+            }
+        });
+        return candidates;
+    }
+
+    void CElevationTileCache::forEachCellInRange(const ICoordinateGeodetic &reference, const CLength &range, const std::function<void(const Cell &)> &visitor) const
+    {
+        static constexpr double EarthRadiusMeters = 6371000.8; // as in calculateGreatCircleDistance
+
+        // slightly enlarged, float rounding of the distance calculation must not drop elevations at the boundary
+        const double angleRad = range.value(CLengthUnit::m()) / EarthRadiusMeters * 1.001 + 1e-6;
+        const double latDeg = reference.latitude().value(CAngleUnit::deg());
+        const double lngDeg = reference.longitude().value(CAngleUnit::deg());
+        const double latSpanDeg = qRadiansToDegrees(angleRad);
+
+        const int latMin = qBound(0, static_cast<int>(std::floor((latDeg - latSpanDeg + 90.0) / m_cellSizeDeg)), m_latCells - 1);
+        const int latMax = qBound(0, static_cast<int>(std::floor((latDeg + latSpanDeg + 90.0) / m_cellSizeDeg)), m_latCells - 1);
+
+        // max. longitude difference of a spherical cap, all longitudes if it contains a pole
+        bool allLng = angleRad >= M_PI_2 || latDeg + latSpanDeg >= 90.0 || latDeg - latSpanDeg <= -90.0;
+        double lngSpanDeg = 180.0;
+        if (!allLng)
+        {
+            const double x = std::sin(angleRad) / std::cos(qDegreesToRadians(latDeg));
+            if (x >= 1.0) { allLng = true; }
+            else { lngSpanDeg = qRadiansToDegrees(std::asin(x)); }
+        }
+
+        const int lngMin = allLng ? 0 : static_cast<int>(std::floor((lngDeg - lngSpanDeg + 180.0) / m_cellSizeDeg));
+        const int lngMax = allLng ? m_lngCells - 1 : static_cast<int>(std::floor((lngDeg + lngSpanDeg + 180.0) / m_cellSizeDeg));
+        const int lngCount = qMin(lngMax - lngMin + 1, m_lngCells);
+
+        // more cells to probe than existing ones
+        if (static_cast<qint64>(latMax - latMin + 1) * lngCount >= m_cells.size())
+        {
+            for (const Cell &cell : m_cells) { visitor(cell); }
+            return;
+        }
+
+        for (int latIndex = latMin; latIndex <= latMax; ++latIndex)
+        {
+            for (int i = 0; i < lngCount; ++i)
+            {
+                const int lngIndex = (((lngMin + i) % m_lngCells) + m_lngCells) % m_lngCells;
+                const auto it = m_cells.constFind(cellKey(latIndex, lngIndex));
+                if (it != m_cells.cend()) { visitor(*it); }
+            }
+        }
+    }
+
+    int CElevationTileCache::removeIf(ElevationSelection selection, const std::function<bool(const Sample &)> &predicate)
+    {
+        int removed = 0;
+        for (auto it = m_cells.begin(); it != m_cells.end();)
+        {
+            QVector<Sample> &samples = it->samples;
+            for (int i = samples.size() - 1; i >= 0; --i)
+            {
+                const Sample &sample = samples[i];
+                if (!isSelected(sample, selection) || !predicate(sample)) { continue; }
+                if (sample.onGround) { m_sizeGnd--; }
+                else { m_size--; }
+                this->lruQueue(sample.onGround).remove(sample.queuedTick);
+                samples.remove(i);
+                removed++;
+            }
+            it = samples.isEmpty() ? m_cells.erase(it) : it + 1;
+        }
+        return removed;
+    }
+
+    void CElevationTileCache::evictIfRequired(bool onGround)
+    {
+        const ElevationSelection selection = onGround ? OnGroundElevations : OtherElevations;
+        const int max = onGround ? m_maxElevationsGnd : m_maxElevations;
+        QMap<quint64, quint64> &queue = this->lruQueue(onGround);
+        while (this->size(selection) > max && !queue.isEmpty())
+        {
+            // oldest queued sample, evicted if not used since it was queued
+            const auto oldest = queue.begin();
+            const quint64 queuedTick = oldest.key();
+            const auto cell = m_cells.find(oldest.value());
+            queue.erase(oldest);
+            Q_ASSERT_X(cell != m_cells.end(), Q_FUNC_INFO, "Queued elevation, but no cell");
+            if (cell == m_cells.end()) { continue; }
+
+            QVector<Sample> &samples = cell->samples;
+            const auto sample = std::find_if(samples.begin(), samples.end(), [&](const Sample &s) { return s.queuedTick == queuedTick; });
+            Q_ASSERT_X(sample != samples.end(), Q_FUNC_INFO, "Queued elevation, but not in cell");
+            if (sample == samples.end()) { continue; }
+
+            const quint64 lastUsed = sample->lastUsed.load();
+            if (lastUsed != queuedTick)
+            {
+                sample->queuedTick = lastUsed;
+                queue.insert(lastUsed, cell.key());
+                continue;
+            }
+
+            samples.erase(sample);
+            if (onGround) { m_sizeGnd--; }
+            else { m_size--; }
+            m_evictions++;
+            if (samples.isEmpty()) { m_cells.erase(cell); }
+        }
+    }
+
+    void CElevationTileCache::touch(const Candidate &candidate) const
+    {
+        candidate.sample->lastUsed.value.store(++m_tick, std::memory_order_relaxed);
+    }
+
+    bool CElevationTileCache::isSelected(const Sample &sample, ElevationSelection selection)
+    {
+        switch (selection)
+        {
+        case OnGroundElevations: return sample.onGround;
+        case OtherElevations: return !sample.onGround;
+        default: break;
+        }
+        return true;
+    }
+} // ns
@@ -0,0 +1,205 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#ifndef BLACKMISC_GEO_ELEVATIONTILECACHE_H
+#define BLACKMISC_GEO_ELEVATIONTILECACHE_H
+
+#include "blackmisc/geo/coordinategeodeticlist.h"
+#include "blackmisc/geo/elevationplane.h"
+#include "blackmisc/pq/length.h"
+#include "blackmisc/blackmiscexport.h"
+
+#include <QHash>
+#include <QMap>
+#include <QString>
+#include <QVector>
+#include <QtGlobal>
+#include <atomic>
+#include <functional>
+
+namespace BlackMisc::Geo
+{
+    /*!
+     * Ground elevation cache organized in cells of quantized latitude/longitude.
+     *
+     * Lookups only check the cells overlapping the range, so they do not depend on the number of cached elevations.
+     * Elevations "on ground" (likely taxiways and runways) and other elevations are capped separately,
+     * if a max. number is exceeded the least recently used elevation is evicted.
+     * \remark lookups are const and can run concurrently (the owner's read lock), they only update atomic LRU ticks and statistics,
+     *         all other modifications need exclusive access (the owner's write lock)
+     */
+    class BLACKMISC_EXPORT CElevationTileCache
+    {
+    public:
+        //! Which elevations
+        enum ElevationSelection
+        {
+            AllElevations,
+            OnGroundElevations,
+            OtherElevations
+        };
+
+        //! Lookup statistics
+        struct Statistics
+        {
+            int hits = 0; //!< cached elevation found
+            int interpolated = 0; //!< elevation interpolated from the surrounding elevations
+            int misses = 0; //!< nothing within range
+            int evictions = 0; //!< elevations dropped because the max. number was exceeded
+
+            //! Hits and interpolated values
+            int found() const { return hits + interpolated; }
+
+            //! Info string
+            QString toQString() const;
+        };
+
+        //! Constructor
+        CElevationTileCache(int maxElevations = 100, int maxElevationsGnd = 400, double cellSizeDeg = 0.01);
+
+        //! Max. number of elevations kept
+        void setMaxElevations(int maxElevations, int maxElevationsGnd);
+
+        //! Max. number of other elevations
+        int getMaxElevations() const { return m_maxElevations; }
+
+        //! Max. number of on ground elevations
+        int getMaxElevationsGnd() const { return m_maxElevationsGnd; }
+
+        //! Number of elevations
+        int size(ElevationSelection selection = AllElevations) const;
+
+        //! Empty?
+        bool isEmpty() const { return m_cells.isEmpty(); }
+
+        //! Add an elevation (coordinate with MSL height), evicts elevations if the max. number is exceeded
+        //! \remark no check for existing elevations in range, \sa findClosestWithinRange
+        bool insert(const ICoordinateGeodetic &elevation, bool onGround);
+
+        //! Closest elevation within range or NULL
+        //! \remark marks the elevation as recently used, does not count as lookup in the statistics
+        CCoordinateGeodetic findClosestWithinRange(const ICoordinateGeodetic &reference, const PhysicalQuantities::CLength &range, ElevationSelection selection = AllElevations) const;
+
+        //! Elevation plane for the reference position, NULL if nothing is within range
+        //! \remark an elevation within the single point radius is used directly,
+        //!         otherwise the height is interpolated (bilinear) if there are elevations in all 4 quadrants around the reference,
+        //!         otherwise the closest elevation within range is used
+        CElevationPlane findElevationPlane(const ICoordinateGeodetic &reference, const PhysicalQuantities::CLength &range) const;
+
+        //! Remove elevations inside range
+        int removeInsideRange(const ICoordinateGeodetic &reference, const PhysicalQuantities::CLength &range, ElevationSelection selection = AllElevations);
+
+        //! Remove elevations outside range
+        int removeOutsideRange(const ICoordinateGeodetic &reference, const PhysicalQuantities::CLength &range, ElevationSelection selection = AllElevations);
+
+        //! Keep the closest elevations only
+        int keepClosest(const ICoordinateGeodetic &reference, int maxNumber, ElevationSelection selection = AllElevations);
+
+        //! All elevations, most recently used first
+        CCoordinateGeodeticList getElevations(ElevationSelection selection = AllElevations) const;
+
+        //! Remove all elevations, statistics are kept
+        void clear();
+
+        //! Statistics
+        Statistics getStatistics() const;
+
+        //! Reset statistics
+        void resetStatistics();
+
+    private:
+        //! LRU tick, set by concurrent lookups
+        struct Tick
+        {
+            //! Constructor
+            Tick(quint64 tick = 0) : value(tick) {}
+
+            //! Copy constructor
+            Tick(const Tick &other) : value(other.load()) {}
+
+            //! Copy assignment
+            Tick &operator=(const Tick &other)
+            {
+                value.store(other.load(), std::memory_order_relaxed);
+                return *this;
+            }
+
+            //! Current tick
+            quint64 load() const { return value.load(std::memory_order_relaxed); }
+
+            mutable std::atomic<quint64> value; //!< tick
+        };
+
+        //! Cached elevation
+        struct Sample
+        {
+            CCoordinateGeodetic coordinate; //!< elevation
+            double latDeg = 0; //!< latitude, avoids recalculation
+            double lngDeg = 0; //!< longitude, avoids recalculation
+            Tick lastUsed; //!< LRU tick, updated by lookups
+            quint64 queuedTick = 0; //!< key in the LRU queue, unique
+            bool onGround = false; //!< on ground elevation
+        };
+
+        //! Cell
+        struct Cell
+        {
+            QVector<Sample> samples; //!< elevations in the cell
+        };
+
+        //! Sample found by a lookup
+        struct Candidate
+        {
+            const Sample *sample = nullptr; //!< the sample
+            double distanceM = -1; //!< distance to reference
+        };
+
+        //! Key of the cell containing the position
+        quint64 cellKey(double latDeg, double lngDeg) const;
+
+        //! Key by indexes
+        static quint64 cellKey(int latIndex, int lngIndex);
+
+        //! All samples within range
+        QVector<Candidate> findCandidates(const ICoordinateGeodetic &reference, const PhysicalQuantities::CLength &range, ElevationSelection selection) const;
+
+        //! Call functor for the cells overlapping the range
+        void forEachCellInRange(const ICoordinateGeodetic &reference, const PhysicalQuantities::CLength &range, const std::function<void(const Cell &)> &visitor) const;
+
+        //! Remove samples matching the predicate
+        int removeIf(ElevationSelection selection, const std::function<bool(const Sample &)> &predicate);
+
+        //! Evict least recently used samples if the max. number is exceeded
+        //! \remark samples used since they were queued are queued again with their last use
+        void evictIfRequired(bool onGround);
+
+        //! Mark sample as used
+        void touch(const Candidate &candidate) const;
+
+        //! LRU queue of on ground or other elevations
+        QMap<quint64, quint64> &lruQueue(bool onGround) { return onGround ? m_lruQueueGnd : m_lruQueue; }
+
+        //! Sample selected?
+        static bool isSelected(const Sample &sample, ElevationSelection selection);
+
+        QHash<quint64, Cell> m_cells; //!< cells by key
+        double m_cellSizeDeg = 0.01; //!< cell size
+        int m_latCells = 18000; //!< number of latitude cells
+        int m_lngCells = 36000; //!< number of longitude cells
+        int m_maxElevations = 100; //!< max. other elevations
+        int m_maxElevationsGnd = 400; //!< max. on ground elevations
+        int m_size = 0; //!< number of other elevations
+        int m_sizeGnd = 0; //!< number of on ground elevations
+        QMap<quint64, quint64> m_lruQueue; //!< other elevations, cell key by queued tick
+        QMap<quint64, quint64> m_lruQueueGnd; //!< on ground elevations, cell key by queued tick
+        mutable std::atomic<quint64> m_tick { 0 }; //!< LRU clock
+        mutable std::atomic_int m_hits { 0 }; //!< lookup statistics
+        mutable std::atomic_int m_interpolated { 0 }; //!< lookup statistics
+        mutable std::atomic_int m_misses { 0 }; //!< lookup statistics
+        int m_evictions = 0; //!< eviction statistics
+    };
+} // ns
+
+#endif // guard
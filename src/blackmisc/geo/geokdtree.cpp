@@ -0,0 +1,129 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+#include "blackmisc/geo/geokdtree.h"
+#include "blackmisc/pq/units.h"
+
+#include <QtMath>
+#include <algorithm>
+#include <cmath>
+
+using namespace BlackMisc::PhysicalQuantities;
+
+namespace BlackMisc::Geo
+{
+    CGeoKdTree::CGeoKdTree(const QVector<std::array<double, 3>> &normalVectors) : m_listSize(normalVectors.size())
+    {
+        m_nodes.reserve(normalVectors.size());
+        for (int i = 0; i < normalVectors.size(); ++i)
+        {
+            const std::array<double, 3> &v = normalVectors[i];
+            if (v[0] == 0 && v[1] == 0 && v[2] == 0) { continue; } // NULL position
+            m_nodes.push_back({ v, i });
+        }
+        this->build(0, m_nodes.size(), 0);
+    }
+
+    QVector<int> CGeoKdTree::findWithinChord(const std::array<double, 3> &normalVector, double chord) const
+    {
+        QVector<int> result;
+        if (chord < 0 || m_nodes.isEmpty()) { return result; }
+        this->search(0, m_nodes.size(), 0, normalVector, chord, chord * chord, result);
+        std::sort(result.begin(), result.end()); // same order as the list
+        return result;
+    }
+
+    QVector<int> CGeoKdTree::findNearest(const std::array<double, 3> &normalVector, int number) const
+    {
+        QVector<int> result;
+        if (number < 1 || m_nodes.isEmpty()) { return result; }
+        std::vector<std::pair<double, int>> heap;
+        heap.reserve(static_cast<size_t>(qMin(number, m_nodes.size())));
+        this->searchNearest(0, m_nodes.size(), 0, normalVector, number, heap);
+        std::sort_heap(heap.begin(), heap.end()); // closest first
+        result.reserve(static_cast<int>(heap.size()));
+        for (const std::pair<double, int> &node : heap) { result.push_back(node.second); }
+        return result;
+    }
+
+    QVector<int> CGeoKdTree::findCandidatesWithinRange(const ICoordinateGeodetic &coordinate, const CLength &range) const
+    {
+        if (coordinate.isNull() || range.isNull()) { return {}; }
+        return this->findWithinChord(coordinate.normalVectorDouble(), chordForRange(range));
+    }
+
+    double CGeoKdTree::chordForRange(const CLength &range)
+    {
+        static constexpr double EarthRadiusMeters = 6371000.8; // as in calculateGreatCircleDistance
+        static constexpr double RelativeMargin = 1e-3;
+        static constexpr double AbsoluteMarginRad = 1e-5; // about 60m
+
+        if (range.isNull() || range.isNegativeWithEpsilonConsidered()) { return -1.0; }
+        const double angle = range.value(CLengthUnit::m()) / EarthRadiusMeters * (1.0 + RelativeMargin) + AbsoluteMarginRad;
+        if (angle >= M_PI) { return 2.1; } // whole sphere, above the max.chord of 2
+        return 2.0 * std::sin(angle / 2.0);
+    }
+
+    void CGeoKdTree::build(int begin, int end, int axis)
+    {
+        if (end - begin < 2) { return; }
+        const int mid = begin + (end - begin) / 2;
+        std::nth_element(m_nodes.begin() + begin, m_nodes.begin() + mid, m_nodes.begin() + end, [axis](const Node &a, const Node &b) {
+            return a.vector[axis] < b.vector[axis];
+        });
+        const int next = (axis + 1) % 3;
+        this->build(begin, mid, next);
+        this->build(mid + 1, end, next);
+    }
+
+    void CGeoKdTree::search(int begin, int end, int axis, const std::array<double, 3> &vector, double chord, double chord2, QVector<int> &result) const
+    {
+        if (begin >= end) { return; }
+        const int mid = begin + (end - begin) / 2;
+        const Node &node = m_nodes[mid];
+
+        const double dx = node.vector[0] - vector[0];
+        const double dy = node.vector[1] - vector[1];
+        const double dz = node.vector[2] - vector[2];
+        if (dx * dx + dy * dy + dz * dz <= chord2) { result.push_back(node.index); }
+
+        // left side values <= median, right side values >= median
+        const double d = vector[axis] - node.vector[axis];
+        const int next = (axis + 1) % 3;
+        if (d - chord <= 0) { this->search(begin, mid, next, vector, chord, chord2, result); }
+        if (d + chord >= 0) { this->search(mid + 1, end, next, vector, chord, chord2, result); }
+    }
+
+    void CGeoKdTree::searchNearest(int begin, int end, int axis, const std::array<double, 3> &vector, int number, std::vector<std::pair<double, int>> &heap) const
+    {
+        if (begin >= end) { return; }
+        const int mid = begin + (end - begin) / 2;
+        const Node &node = m_nodes[mid];
+
+        const double dx = node.vector[0] - vector[0];
+        const double dy = node.vector[1] - vector[1];
+        const double dz = node.vector[2] - vector[2];
+        const std::pair<double, int> candidate(dx * dx + dy * dy + dz * dz, node.index);
+        if (heap.size() < static_cast<size_t>(number))
+        {
+            heap.push_back(candidate);
+            std::push_heap(heap.begin(), heap.end());
+        }
+        else if (candidate < heap.front())
+        {
+            std::pop_heap(heap.begin(), heap.end());
+            heap.back() = candidate;
+            std::push_heap(heap.begin(), heap.end());
+        }
+
+        // the side of the query first, the other side only if it can contain closer nodes
+        const double d = vector[axis] - node.vector[axis];
+        const int next = (axis + 1) % 3;
+        const bool leftFirst = d <= 0;
+        this->searchNearest(leftFirst ? begin : mid + 1, leftFirst ? mid : end, next, vector, number, heap);
+        if (heap.size() < static_cast<size_t>(number) || d * d <= heap.front().first)
+        {
+            this->searchNearest(leftFirst ? mid + 1 : begin, leftFirst ? end : mid, next, vector, number, heap);
+        }
+    }
+} // ns
@@ -0,0 +1,98 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#ifndef BLACKMISC_GEO_GEOKDTREE_H
+#define BLACKMISC_GEO_GEOKDTREE_H
+
+#include "blackmisc/geo/coordinategeodetic.h"
+#include "blackmisc/pq/length.h"
+#include "blackmisc/blackmiscexport.h"
+
+#include <QVector>
+#include <array>
+#include <utility>
+#include <vector>
+
+namespace BlackMisc::Geo
+{
+    /*!
+     * Static k-d tree over the normal vectors (earth centered, unit sphere) of a geo object list.
+     *
+     * The tree is built once for a given list, the returned indexes refer to the positions in that list.
+     * Range queries return candidates, a superset of the objects within the great circle distance,
+     * the exact check is left to the caller (\sa IGeoObjectList).
+     * Objects with NULL position are not indexed.
+     * \remark the tree does not follow changes of the list, build a new one after modifying the list
+     */
+    class BLACKMISC_EXPORT CGeoKdTree
+    {
+    public:
+        //! Empty tree
+        CGeoKdTree() = default;
+
+        //! Tree for the given normal vectors, index i corresponds to element i of the list
+        //! \remark (0, 0, 0) is a NULL position and will not be indexed
+        explicit CGeoKdTree(const QVector<std::array<double, 3>> &normalVectors);
+
+        //! Tree for any container of geo objects
+        template <class CONTAINER>
+        static CGeoKdTree fromList(const CONTAINER &container)
+        {
+            QVector<std::array<double, 3>> normalVectors;
+            normalVectors.reserve(container.size());
+            for (const ICoordinateGeodetic &geoObj : container)
+            {
+                normalVectors.push_back(geoObj.isNull() ? std::array<double, 3> { { 0, 0, 0 } } : geoObj.normalVectorDouble());
+            }
+            return CGeoKdTree(normalVectors);
+        }
+
+        //! Number of indexed objects
+        int size() const { return m_nodes.size(); }
+
+        //! No indexed objects?
+        bool isEmpty() const { return m_nodes.isEmpty(); }
+
+        //! Size of the list the tree has been built for
+        int listSize() const { return m_listSize; }
+
+        //! Indexes (ascending) of all objects within the given straight line (chord) distance on the unit sphere
+        QVector<int> findWithinChord(const std::array<double, 3> &normalVector, double chord) const;
+
+        //! Indexes (ascending) of all objects which can be within the great circle distance
+        //! \remark candidates, superset of the objects within range, empty for a NULL coordinate or NULL range
+        QVector<int> findCandidatesWithinRange(const ICoordinateGeodetic &coordinate, const PhysicalQuantities::CLength &range) const;
+
+        //! Indexes of the closest objects, closest first
+        //! \remark distances as straight line (chord) on the unit sphere, like calculateEuclideanDistanceSquared
+        QVector<int> findNearest(const std::array<double, 3> &normalVector, int number) const;
+
+        //! Chord on the unit sphere for a great circle distance
+        //! \remark slightly enlarged, so float rounding of calculateGreatCircleDistance can not drop objects at the boundary
+        static double chordForRange(const PhysicalQuantities::CLength &range);
+
+    private:
+        //! Tree node
+        struct Node
+        {
+            std::array<double, 3> vector; //!< normal vector
+            int index; //!< index in the list
+        };
+
+        //! Arrange nodes [begin, end) as implicit balanced tree, the median is stored in the middle
+        void build(int begin, int end, int axis);
+
+        //! Search nodes [begin, end)
+        void search(int begin, int end, int axis, const std::array<double, 3> &vector, double chord, double chord2, QVector<int> &result) const;
+
+        //! Search the closest nodes in [begin, end), heap of (squared distance, index) with the farthest on top
+        void searchNearest(int begin, int end, int axis, const std::array<double, 3> &vector, int number, std::vector<std::pair<double, int>> &heap) const;
+
+        QVector<Node> m_nodes; //!< implicit tree
+        int m_listSize = 0; //!< size of the indexed list
+    };
+} // ns
+
+#endif // guard
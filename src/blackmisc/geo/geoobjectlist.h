@@ -11,8 +11,10 @@
 #include "blackmisc/blackmiscexport.h"
 #include "blackmisc/sequence.h"
 #include "blackmisc/geo/coordinategeodetic.h"
+#include "blackmisc/geo/geokdtree.h"
 
 #include <QList>
+#include <memory>
 #include <tuple>
 
 namespace BlackMisc::Geo
@@ -53,6 +55,59 @@ namespace BlackMisc::Geo
             });
         }
 
+        //! @{
+        //! Same results as the linear search, but only the candidates of the spatial index are checked
+        //! \remark the index has to be built for this very list, \sa createSpatialIndex
+        CONTAINER findWithinRange(const ICoordinateGeodetic &coordinate, const PhysicalQuantities::CLength &range, const CGeoKdTree &index) const
+        {
+            if (!this->canUseSpatialIndex(index, range)) { return this->findWithinRange(coordinate, range); }
+            CONTAINER result;
+            for (int i : index.findCandidatesWithinRange(coordinate, range))
+            {
+                const OBJ &geoObj = this->container()[i];
+                if (calculateGreatCircleDistance(geoObj, coordinate) <= range) { result.push_back(geoObj); }
+            }
+            return result;
+        }
+
+        OBJ findFirstWithinRangeOrDefault(const ICoordinateGeodetic &coordinate, const PhysicalQuantities::CLength &range, const CGeoKdTree &index) const
+        {
+            if (!this->canUseSpatialIndex(index, range)) { return this->findFirstWithinRangeOrDefault(coordinate, range); }
+            for (int i : index.findCandidatesWithinRange(coordinate, range))
+            {
+                const OBJ &geoObj = this->container()[i];
+                if (calculateGreatCircleDistance(geoObj, coordinate) <= range) { return geoObj; }
+            }
+            return OBJ();
+        }
+
+        OBJ findClosestWithinRange(const ICoordinateGeodetic &coordinate, const PhysicalQuantities::CLength &range, const CGeoKdTree &index) const
+        {
+            if (!this->canUseSpatialIndex(index, range)) { return this->findClosestWithinRange(coordinate, range); }
+            OBJ closest;
+            PhysicalQuantities::CLength distance = PhysicalQuantities::CLength::null();
+            for (int i : index.findCandidatesWithinRange(coordinate, range))
+            {
+                const OBJ &obj = this->container()[i];
+                const PhysicalQuantities::CLength d = coordinate.calculateGreatCircleDistance(obj);
+                if (d > range) { continue; }
+                if (distance.isNull() || distance > d)
+                {
+                    distance = d;
+                    closest = obj;
+                }
+            }
+            return closest;
+        }
+        //! @}
+
+        //! Spatial index for the current elements
+        //! \remark has to be rebuilt whenever the list is modified, \sa CGeoIndexedList
+        CGeoKdTree createSpatialIndex() const
+        {
+            return CGeoKdTree::fromList(this->container());
+        }
+
         //! Elements with geodetic height (only MSL)
         CONTAINER findWithGeodeticMSLHeight() const
         {
@@ -175,6 +230,17 @@ namespace BlackMisc::Geo
             return closest;
         }
 
+        //! Find 0..n objects closest to the given coordinate, using the spatial index
+        //! \remark the index has to be built for this very list, \sa createSpatialIndex
+        //! \remark unlike the linear search, objects with NULL position are never returned
+        CONTAINER findClosest(int number, const ICoordinateGeodetic &coordinate, const CGeoKdTree &index) const
+        {
+            if (coordinate.isNull() || index.listSize() != this->container().size()) { return this->findClosest(number, coordinate); }
+            CONTAINER closest;
+            for (int i : index.findNearest(coordinate.normalVectorDouble(), number)) { closest.push_back(this->container()[i]); }
+            return closest;
+        }
+
         //! Find 0..n objects farthest to the given coordinate.
         CONTAINER findFarthest(int number, const ICoordinateGeodetic &coordinate) const
         {
@@ -235,6 +301,16 @@ namespace BlackMisc::Geo
         {
             return static_cast<CONTAINER &>(*this);
         }
+
+    private:
+        //! Index built for this list and a range the index can handle?
+        bool canUseSpatialIndex(const CGeoKdTree &index, const PhysicalQuantities::CLength &range) const
+        {
+            // a NULL range is handled by the linear search only
+            if (range.isNull()) { return false; }
+            Q_ASSERT_X(index.listSize() == this->container().size(), Q_FUNC_INFO, "Index not built for this list");
+            return index.listSize() == this->container().size();
+        }
     };
 
     //! List of objects with geo coordinates.
@@ -300,6 +376,105 @@ namespace BlackMisc::Geo
         IGeoObjectWithRelativePositionList()
         {}
     };
+
+    /*!
+     * Geo object list with a lazily built spatial index.
+     *
+     * The index is built with the first range query and dropped whenever the list is modified,
+     * so modifications are only possible via setList, modify and clear.
+     * \remark const queries can run concurrently, modifications need exclusive access like any container
+     */
+    template <class CONTAINER>
+    class CGeoIndexedList
+    {
+    public:
+        //! Object type
+        using OBJ = typename CONTAINER::value_type;
+
+        //! Default constructor
+        CGeoIndexedList() = default;
+
+        //! Constructor
+        explicit CGeoIndexedList(const CONTAINER &list) : m_list(list) {}
+
+        //! The list
+        const CONTAINER &getList() const { return m_list; }
+
+        //! Set the list, invalidates the index
+        void setList(const CONTAINER &list)
+        {
+            m_list = list;
+            this->invalidateIndex();
+        }
+
+        //! Modify the list by a functor taking the list by reference, invalidates the index
+        template <class F>
+        void modify(F &&modifier)
+        {
+            modifier(m_list);
+            this->invalidateIndex();
+        }
+
+        //! Clear the list
+        void clear()
+        {
+            m_list.clear();
+            this->invalidateIndex();
+        }
+
+        //! Number of objects
+        int size() const { return m_list.size(); }
+
+        //! Empty?
+        bool isEmpty() const { return m_list.isEmpty(); }
+
+        //! \copydoc IGeoObjectList::findWithinRange
+        CONTAINER findWithinRange(const ICoordinateGeodetic &coordinate, const PhysicalQuantities::CLength &range) const
+        {
+            return m_list.findWithinRange(coordinate, range, *this->getIndex());
+        }
+
+        //! \copydoc IGeoObjectList::findFirstWithinRangeOrDefault
+        OBJ findFirstWithinRangeOrDefault(const ICoordinateGeodetic &coordinate, const PhysicalQuantities::CLength &range) const
+        {
+            return m_list.findFirstWithinRangeOrDefault(coordinate, range, *this->getIndex());
+        }
+
+        //! \copydoc IGeoObjectList::findClosestWithinRange
+        OBJ findClosestWithinRange(const ICoordinateGeodetic &coordinate, const PhysicalQuantities::CLength &range) const
+        {
+            return m_list.findClosestWithinRange(coordinate, range, *this->getIndex());
+        }
+
+        //! \copydoc IGeoObjectList::findClosest(int, const ICoordinateGeodetic &, const CGeoKdTree &) const
+        CONTAINER findClosest(int number, const ICoordinateGeodetic &coordinate) const
+        {
+            return m_list.findClosest(number, coordinate, *this->getIndex());
+        }
+
+        //! The index, built if not yet available
+        std::shared_ptr<const CGeoKdTree> getIndex() const
+        {
+            std::shared_ptr<const CGeoKdTree> index = std::atomic_load(&m_index);
+            if (!index)
+            {
+                // concurrent readers might build it twice, both results are the same
+                index = std::make_shared<const CGeoKdTree>(m_list.createSpatialIndex());
+                std::atomic_store(&m_index, index);
+            }
+            return index;
+        }
+
+        //! Index built?
+        bool hasIndex() const { return static_cast<bool>(std::atomic_load(&m_index)); }
+
+    private:
+        //! Drop the index
+        void invalidateIndex() { std::atomic_store(&m_index, std::shared_ptr<const CGeoKdTree>()); }
+
+        CONTAINER m_list;
+        mutable std::shared_ptr<const CGeoKdTree> m_index; //!< lazily built, shared by copies of the same list
+    };
 } // namespace
 
 #endif // guard
@@ -0,0 +1,218 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+#include "blackmisc/jsonstreamreader.h"
+
+#include "rapidjson/error/en.h"
+#include "rapidjson/reader.h"
+
+#include <QJsonArray>
+#include <vector>
+
+namespace BlackMisc
+{
+    //! SAX handler for rapidjson, builds the values handled by CJsonStreamReader
+    class CJsonStreamReaderHandler
+    {
+    public:
+        //! Constructor
+        CJsonStreamReaderHandler(CJsonStreamReader &reader) : m_reader(reader) {}
+
+        //! rapidjson handler API
+        //! @{
+        bool Null() { return this->value(QJsonValue::Null); }
+        bool Bool(bool b) { return this->value(b); }
+        bool Int(int i) { return this->value(i); }
+        bool Uint(unsigned u) { return this->value(static_cast<qint64>(u)); }
+        bool Int64(int64_t i) { return this->value(static_cast<qint64>(i)); }
+        bool Uint64(uint64_t u) { return this->value(static_cast<double>(u)); }
+        bool Double(double d) { return this->value(d); }
+        bool RawNumber(const char *str, rapidjson::SizeType length, bool) { return this->value(QString::fromUtf8(str, static_cast<int>(length)).toDouble()); }
+        bool String(const char *str, rapidjson::SizeType length, bool) { return (this->isBuilding() || m_depth == 1) ? this->value(QString::fromUtf8(str, static_cast<int>(length))) : true; }
+        bool StartObject() { return this->startContainer(true); }
+        bool Key(const char *str, rapidjson::SizeType length, bool);
+        bool EndObject(rapidjson::SizeType) { return this->endContainer(); }
+        bool StartArray() { return this->startContainer(false); }
+        bool EndArray(rapidjson::SizeType) { return this->endContainer(); }
+        //! @}
+
+    private:
+        //! Object or array being built
+        struct Frame
+        {
+            bool isObject = true;
+            QJsonObject object;
+            QJsonArray array;
+            QString key;
+        };
+
+        bool isBuilding() const { return !m_frames.empty(); }
+        bool value(const QJsonValue &value);
+        bool startContainer(bool object);
+        bool endContainer();
+        void addToFrame(const QJsonValue &value);
+
+        CJsonStreamReader &m_reader;
+        std::vector<Frame> m_frames; //!< stack of the values being built
+        const CJsonStreamReader::ObjectHandler *m_arrayHandler = nullptr; //!< streamed array
+        const CJsonStreamReader::ValueHandler *m_valueHandler = nullptr; //!< captured top level value
+        QString m_topLevelKey; //!< current key of the document object
+        int m_depth = 0; //!< open objects and arrays
+        int m_arrayDepth = -1; //!< depth of the streamed array
+    };
+
+    bool CJsonStreamReaderHandler::Key(const char *str, rapidjson::SizeType length, bool)
+    {
+        if (this->isBuilding())
+        {
+            m_frames.back().key = QString::fromUtf8(str, static_cast<int>(length));
+        }
+        else if (m_depth == 1 && !m_reader.m_arrayDocument)
+        {
+            m_topLevelKey = QString::fromUtf8(str, static_cast<int>(length));
+        }
+        return true;
+    }
+
+    bool CJsonStreamReaderHandler::value(const QJsonValue &value)
+    {
+        if (m_depth == 1) { m_reader.m_documentElements++; }
+        if (this->isBuilding())
+        {
+            this->addToFrame(value);
+            return true;
+        }
+
+        // scalar top level value, elements of a streamed array which are no objects are ignored
+        if (m_depth != 1 || m_reader.m_arrayDocument) { return true; }
+        const auto it = m_reader.m_valueHandlers.constFind(m_topLevelKey);
+        if (it == m_reader.m_valueHandlers.constEnd()) { return true; }
+        if ((*it)(value)) { return true; }
+        m_reader.m_stopped = true;
+        return false;
+    }
+
+    bool CJsonStreamReaderHandler::startContainer(bool object)
+    {
+        m_depth++;
+        if (m_depth == 1) { m_reader.m_documentElements = 0; }
+        else if (m_depth == 2) { m_reader.m_documentElements++; }
+        if (this->isBuilding())
+        {
+            m_frames.push_back({ object, {}, {}, {} });
+            return true;
+        }
+
+        if (m_depth == 1)
+        {
+            // the document itself
+            m_reader.m_arrayDocument = !object;
+            if (object) { return true; }
+            const auto it = m_reader.m_arrayHandlers.constFind(QString());
+            if (it != m_reader.m_arrayHandlers.constEnd())
+            {
+                m_arrayHandler = &(*it);
+                m_arrayDepth = m_depth;
+            }
+            return true;
+        }
+
+        if (m_depth == 2 && !m_reader.m_arrayDocument)
+        {
+            // value of a top level key
+            if (!object)
+            {
+                const auto it = m_reader.m_arrayHandlers.constFind(m_topLevelKey);
+                if (it != m_reader.m_arrayHandlers.constEnd())
+                {
+                    m_arrayHandler = &(*it);
+                    m_arrayDepth = m_depth;
+                    return true;
+                }
+            }
+            const auto it = m_reader.m_valueHandlers.constFind(m_topLevelKey);
+            if (it != m_reader.m_valueHandlers.constEnd())
+            {
+                m_valueHandler = &(*it);
+                m_frames.push_back({ object, {}, {}, {} });
+            }
+            return true;
+        }
+
+        if (m_arrayHandler && object && m_depth == m_arrayDepth + 1)
+        {
+            // element of the streamed array
+            m_frames.push_back({ true, {}, {}, {} });
+        }
+        return true;
+    }
+
+    bool CJsonStreamReaderHandler::endContainer()
+    {
+        if (!this->isBuilding())
+        {
+            if (m_arrayHandler && m_depth == m_arrayDepth)
+            {
+                m_arrayHandler = nullptr;
+                m_arrayDepth = -1;
+            }
+            m_depth--;
+            return true;
+        }
+
+        Frame frame = std::move(m_frames.back());
+        m_frames.pop_back();
+        m_depth--;
+        if (this->isBuilding())
+        {
+            this->addToFrame(frame.isObject ? QJsonValue(frame.object) : QJsonValue(frame.array));
+            return true;
+        }
+
+        // value completed
+        bool goOn = true;
+        if (m_arrayHandler && m_depth == m_arrayDepth)
+        {
+            goOn = (*m_arrayHandler)(frame.object);
+        }
+        else if (m_valueHandler)
+        {
+            goOn = (*m_valueHandler)(frame.isObject ? QJsonValue(frame.object) : QJsonValue(frame.array));
+            m_valueHandler = nullptr;
+        }
+        if (!goOn) { m_reader.m_stopped = true; }
+        return goOn;
+    }
+
+    void CJsonStreamReaderHandler::addToFrame(const QJsonValue &value)
+    {
+        Frame &frame = m_frames.back();
+        if (frame.isObject) { frame.object.insert(frame.key, value); }
+        else { frame.array.append(value); }
+    }
+
+    bool CJsonStreamReader::parse(const QByteArray &utf8)
+    {
+        m_lastError.clear();
+        m_stopped = false;
+        m_arrayDocument = false;
+        m_documentElements = -1;
+        if (utf8.isEmpty())
+        {
+            m_lastError = QStringLiteral("Empty JSON data");
+            return false;
+        }
+
+        // QByteArray data is always null terminated
+        CJsonStreamReaderHandler handler(*this);
+        rapidjson::StringStream stream(utf8.constData());
+        rapidjson::Reader reader;
+        const rapidjson::ParseResult result = reader.Parse<rapidjson::kParseStopWhenDoneFlag>(stream, handler);
+        if (result) { return true; }
+        if (m_stopped) { return false; }
+
+        static const QString errorMsg("JSON parse error at offset %1: %2");
+        m_lastError = errorMsg.arg(result.Offset()).arg(QString::fromUtf8(rapidjson::GetParseError_En(result.Code())));
+        return false;
+    }
+} // ns
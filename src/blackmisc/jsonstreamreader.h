@@ -0,0 +1,81 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#ifndef BLACKMISC_JSONSTREAMREADER_H
+#define BLACKMISC_JSONSTREAMREADER_H
+
+#include "blackmisc/blackmiscexport.h"
+
+#include <QByteArray>
+#include <QHash>
+#include <QJsonObject>
+#include <QJsonValue>
+#include <QString>
+#include <functional>
+
+namespace BlackMisc
+{
+    /*!
+     * Streaming (SAX style) reader for large JSON documents like the VATSIM data file or the swift DB data.
+     *
+     * Works directly on the UTF-8 bytes, no QString conversion and no DOM of the whole document.
+     * The objects of the top level arrays are built one by one and passed to a handler,
+     * so only a single element is kept in memory at a time.
+     * \code
+     * CJsonStreamReader reader;
+     * reader.onArrayObject("pilots", [&](const QJsonObject &pilot) { aircraft.push_back(parsePilot(pilot)); return true; });
+     * reader.onValue("general", [&](const QJsonValue &general) { ts = general["update_timestamp"].toString(); return true; });
+     * const bool ok = reader.parse(data);
+     * \endcode
+     * \remark values of keys without handler are skipped
+     */
+    class BLACKMISC_EXPORT CJsonStreamReader
+    {
+    public:
+        //! Handler for an object of an array, return false to stop parsing
+        using ObjectHandler = std::function<bool(const QJsonObject &)>;
+
+        //! Handler for a top level value, return false to stop parsing
+        using ValueHandler = std::function<bool(const QJsonValue &)>;
+
+        //! Objects of the array with the given top level key
+        //! \remark an empty key is used for a document being an array
+        void onArrayObject(const QString &key, const ObjectHandler &handler) { m_arrayHandlers.insert(key, handler); }
+
+        //! Top level value with the given key, value is built completely
+        void onValue(const QString &key, const ValueHandler &handler) { m_valueHandlers.insert(key, handler); }
+
+        //! Parse UTF-8 JSON data
+        //! \return true if the whole document was parsed, false on errors or if a handler stopped parsing
+        bool parse(const QByteArray &utf8);
+
+        //! Stopped by a handler?
+        bool isStopped() const { return m_stopped; }
+
+        //! Document is an array (and not an object)?
+        bool isArrayDocument() const { return m_arrayDocument; }
+
+        //! Document is an empty object or array, or no object or array at all?
+        bool isEmptyDocument() const { return m_documentElements <= 0; }
+
+        //! Error of last parse, empty if none
+        const QString &getLastError() const { return m_lastError; }
+
+        //! Has error?
+        bool hasError() const { return !m_lastError.isEmpty(); }
+
+    private:
+        friend class CJsonStreamReaderHandler;
+
+        QHash<QString, ObjectHandler> m_arrayHandlers;
+        QHash<QString, ValueHandler> m_valueHandlers;
+        QString m_lastError;
+        bool m_stopped = false;
+        bool m_arrayDocument = false;
+        int m_documentElements = -1; //!< keys of the document object or elements of the document array, -1 if none of them
+    };
+} // ns
+
+#endif // guard
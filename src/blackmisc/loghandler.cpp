@@ -22,6 +22,7 @@
 #include <Qt>
 #include <QtDebug>
 #include <algorithm>
+#include <array>
 
 #ifdef Q_OS_WIN
 #    include <windows.h>
@@ -31,6 +32,18 @@ namespace BlackMisc
 {
     Q_GLOBAL_STATIC(CLogHandler, g_handler)
 
+    namespace
+    {
+        //! Bit set if messages of all categories are consumed
+        constexpr quint64 AnyCategoryBit = Q_UINT64_C(1) << 63;
+
+        //! Bit set if messages of the category are consumed, several categories share a bit
+        quint64 categoryBit(const QString &category) { return Q_UINT64_C(1) << (qHash(category) % 63); }
+
+        //! Consumed messages per severity, everything as long as nothing is known about the consumers
+        std::array<std::atomic<quint64>, 4> g_enabledMessages { { { ~Q_UINT64_C(0) }, { ~Q_UINT64_C(0) }, { ~Q_UINT64_C(0) }, { ~Q_UINT64_C(0) } } };
+    }
+
     CLogHandler *CLogHandler::instance()
     {
         Q_ASSERT(!g_handler.isDestroyed());
@@ -80,6 +93,7 @@ namespace BlackMisc
         if (skipIfAlreadyInstalled && m_oldHandler) { return; }
         Q_ASSERT_X(!m_oldHandler, Q_FUNC_INFO, "Re-installing the log handler should be avoided");
         m_oldHandler = qInstallMessageHandler(messageHandler);
+        updateEnabledMessages();
     }
 
     CLogHandler::CLogHandler()
@@ -91,6 +105,7 @@ namespace BlackMisc
     CLogHandler::~CLogHandler()
     {
         qInstallMessageHandler(m_oldHandler);
+        for (auto &mask : g_enabledMessages) { mask = ~Q_UINT64_C(0); }
     }
 
     CLogPatternHandler *CLogHandler::handlerForPattern(const CLogPattern &pattern)
@@ -197,6 +212,58 @@ namespace BlackMisc
         Q_ASSERT_X(m_oldHandler, Q_FUNC_INFO, "Install the log handler before using it");
         Q_ASSERT_X(thread() == QThread::currentThread(), Q_FUNC_INFO, "Wrong thread");
         m_enableFallThrough = enable;
+        updateEnabledMessages();
+    }
+
+    void CLogHandler::setLocalListenerPatterns(const QList<CLogPattern> &patterns)
+    {
+        Q_ASSERT_X(thread() == QThread::currentThread(), Q_FUNC_INFO, "Wrong thread");
+        m_localListenerPatterns = patterns;
+        updateEnabledMessages();
+    }
+
+    bool CLogHandler::isEnabled(StatusSeverity severity, const CLogCategoryList &categories)
+    {
+        Q_ASSERT_X(severity >= SeverityDebug && severity <= SeverityError, Q_FUNC_INFO, "Wrong severity");
+        const quint64 mask = g_enabledMessages[static_cast<size_t>(severity)].load(std::memory_order_relaxed);
+        if (mask & AnyCategoryBit) { return true; }
+        if (!mask) { return false; }
+        return categories.containsBy([mask](const CLogCategory &category) { return (mask & categoryBit(category.toQString())) != 0; });
+    }
+
+    void CLogHandler::updateEnabledMessages()
+    {
+        Q_ASSERT_X(thread() == QThread::currentThread(), Q_FUNC_INFO, "Wrong thread");
+
+        std::array<quint64, 4> masks {};
+        const auto enable = [&masks](const CLogPattern &pattern) {
+            quint64 bits = 0;
+            if (pattern.isLimitedToCategoryStrings())
+            {
+                for (const QString &category : pattern.getCategoryStrings()) { bits |= categoryBit(category); }
+            }
+            else { bits = AnyCategoryBit; }
+            for (const CStatusMessage::StatusSeverity severity : pattern.getSeverities()) { masks[static_cast<size_t>(severity)] |= bits; }
+        };
+
+        if (!m_oldHandler || m_enableFallThrough)
+        {
+            // everything goes to the console, unless overridden by a handler
+            enable(CLogPattern());
+        }
+        else
+        {
+            for (const CLogPattern &pattern : std::as_const(m_localListenerPatterns)) { enable(pattern); }
+            for (const auto &pair : m_patternHandlers)
+            {
+                const CLogPatternHandler *handler = pair.second;
+                const bool isConsumer = handler->m_subscriptionNeedsUpdate || handler->m_isSubscribed ||
+                                        (!handler->m_inheritFallThrough && handler->m_enableFallThrough);
+                if (isConsumer) { enable(pair.first); }
+            }
+        }
+
+        for (size_t i = 0; i < masks.size(); ++i) { g_enabledMessages[i].store(masks[i], std::memory_order_relaxed); }
     }
 
     void CLogHandler::logMessage(const CStatusMessage &statusMessage)
@@ -228,6 +295,7 @@ namespace BlackMisc
         {
             it->second->deleteLater();
             m_patternHandlers.erase(it);
+            updateEnabledMessages();
         }
     }
 
@@ -274,6 +342,10 @@ namespace BlackMisc
             {
                 m_parent->removePatternHandler(this);
             }
+            else
+            {
+                m_parent->updateEnabledMessages();
+            }
         }
     }
 
@@ -68,6 +68,19 @@ namespace BlackMisc
         //! Returns all log patterns for which there are currently subscribed log pattern handlers.
         QList<CLogPattern> getAllSubscriptions() const;
 
+        //! Messages needed by the receivers of localMessageLogged, all messages by default.
+        //! \remark messages neither matching one of these patterns, nor a subscription, nor the console output are dropped by CLogMessage
+        //! \warning This must only be called from the main thread.
+        void setLocalListenerPatterns(const QList<CLogPattern> &patterns);
+
+        //! Messages needed by the receivers of localMessageLogged.
+        const QList<CLogPattern> &getLocalListenerPatterns() const { return m_localListenerPatterns; }
+
+        //! Is there any consumer for a message with the given severity and categories?
+        //! \remark fast pre-check used by CLogMessage, can be true for messages nobody consumes, but never false for needed ones
+        //! \threadsafe
+        static bool isEnabled(StatusSeverity severity, const CLogCategoryList &categories);
+
     signals:
         //! Emitted when a message is logged in this process.
         void localMessageLogged(const BlackMisc::CStatusMessage &message);
@@ -96,6 +109,8 @@ namespace BlackMisc
         void logMessage(const BlackMisc::CStatusMessage &message);
         QtMessageHandler m_oldHandler = nullptr;
         bool m_enableFallThrough = true;
+        QList<CLogPattern> m_localListenerPatterns { CLogPattern() };
+        void updateEnabledMessages();
         bool isFallThroughEnabled(const QList<CLogPatternHandler *> &handlers) const;
         using PatternPair = std::pair<CLogPattern, CLogPatternHandler *>;
         QList<PatternPair> m_patternHandlers;
@@ -126,6 +141,7 @@ namespace BlackMisc
             m_inheritFallThrough = false;
             m_enableFallThrough = enable;
             m_subscriptionNeedsUpdate = true;
+            m_parent->updateEnabledMessages();
         }
 
         /*!
@@ -140,6 +156,7 @@ namespace BlackMisc
             Q_ASSERT(thread() == QThread::currentThread());
             m_inheritFallThrough = true;
             m_subscriptionNeedsUpdate = true;
+            m_parent->updateEnabledMessages();
         }
 
     signals:
@@ -179,7 +196,11 @@ namespace BlackMisc
         //! \copydoc QObject::connectNotify
         virtual void connectNotify(const QMetaMethod &signal) override
         {
-            if (signal == QMetaMethod::fromSignal(&CLogPatternHandler::messageLogged)) { m_subscriptionNeedsUpdate = true; }
+            if (signal == QMetaMethod::fromSignal(&CLogPatternHandler::messageLogged))
+            {
+                m_subscriptionNeedsUpdate = true;
+                if (thread() == QThread::currentThread()) { m_parent->updateEnabledMessages(); } // do not miss messages until the subscription is updated
+            }
         }
 
         //! \copydoc QObject::disconnectNotify
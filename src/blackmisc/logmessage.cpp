@@ -4,6 +4,7 @@
 //! \cond PRIVATE
 
 #include "blackmisc/logmessage.h"
+#include "blackmisc/loghandler.h"
 
 namespace BlackMisc
 {
@@ -14,14 +15,22 @@ namespace BlackMisc
 
     CLogMessage::operator CStatusMessage()
     {
+        Q_ASSERT_X(m_suppressed <= 0 || m_severity != SeverityDebug, Q_FUNC_INFO, "Streamed values have been skipped, use CStatusMessage");
         return { m_categories, m_severity, message() };
     }
 
     CLogMessage::~CLogMessage()
     {
+        if (isSuppressed()) { return; }
         ostream(qtCategory()).noquote() << message();
     }
 
+    bool CLogMessage::isSuppressed() const
+    {
+        if (m_suppressed < 0 || m_severity != SeverityDebug) { m_suppressed = CLogHandler::isEnabled(m_severity, m_categories) ? 0 : 1; }
+        return m_suppressed > 0;
+    }
+
     QByteArray CLogMessage::qtCategory() const
     {
         return m_categories.toQString().toLatin1();
@@ -42,6 +42,7 @@ namespace BlackMisc
         ~CLogMessage();
 
         //! Convert to CStatusMessage for returning the message directly from the function which generated it.
+        //! \remark not for debug messages, their streamed values are skipped if nobody consumes them
         operator CStatusMessage();
 
         //! Sends a verbatim, preformatted message to the log.
@@ -51,7 +52,16 @@ namespace BlackMisc
         static void preformatted(const CStatusMessageList &statusMessages);
 
     private:
+        friend class CMessageBase<CLogMessage>;
+
         QMessageLogger m_logger;
+        mutable int m_suppressed = -1; //!< cached isSuppressed(), -1 if not yet known
+
+        //! Nobody consumes this message, \sa CLogHandler::isEnabled
+        bool isSuppressed() const;
+
+        //! Debug messages nobody consumes do not format their streamed values
+        bool skipsArguments() const { return m_severity == SeverityDebug && (m_suppressed < 0 ? isSuppressed() : m_suppressed > 0); }
 
         QByteArray qtCategory() const;
         QDebug ostream(const QByteArray &category) const;
@@ -102,6 +102,12 @@ namespace BlackMisc
         //! Technical category names matched by this pattern.
         QSet<QString> getCategoryStrings() const { return m_strings; }
 
+        //! Severities matched by this pattern.
+        QSet<CStatusMessage::StatusSeverity> getSeverities() const { return m_severities; }
+
+        //! True if this pattern only matches messages which contain at least one of the category names returned by getCategoryStrings().
+        bool isLimitedToCategoryStrings() const { return (m_strategy == ExactMatch || m_strategy == AnyOf || m_strategy == AllOf) && !m_strings.isEmpty(); }
+
         //! Returns true if this pattern is a proper subset of the other pattern.
         //! \see     https://en.wikipedia.org/wiki/Proper_subset
         //! \details Pattern A is a proper subset of pattern B iff pattern B would match every category which pattern A matches,
@@ -6,13 +6,18 @@
 #ifndef BLACKMISC_MEMOTABLE_H
 #define BLACKMISC_MEMOTABLE_H
 
-#include "blackmisc/dictionary.h"
 #include "blackmisc/sequence.h"
+#include "blackmisc/typetraits.h"
+
+#include <QHash>
 
 namespace BlackMisc
 {
     /*!
      * A data memoization pattern useful for compressing JSON representations of containers.
+     *
+     * Values are indexed by the hash of their DB key if they have a valid one, otherwise by the hash of the value.
+     * Only values with the same hash are compared, so inserting is O(1) instead of O(log n) comparisons of heavy value objects.
      */
     template <typename T>
     class CMemoTable
@@ -21,13 +26,15 @@ namespace BlackMisc
         //! Return the index of a value, inserting it if it is not already in the table.
         int getIndex(const T &value)
         {
-            int &index = m_dict[value];
-            if (!index)
+            const uint hash = hashOf(value);
+            for (auto it = m_index.constFind(hash); it != m_index.cend() && it.key() == hash; ++it)
             {
-                m_list.push_back(value);
-                index = m_list.size();
+                if (m_list[*it] == value) { return *it; }
             }
-            return index - 1;
+            const int index = m_list.size();
+            m_list.push_back(value);
+            m_index.insert(hash, index);
+            return index;
         }
 
         //! Return the values in the table as a flat list.
@@ -37,8 +44,18 @@ namespace BlackMisc
         }
 
     private:
+        //! Hash of the DB key if any, otherwise hash of the value
+        static uint hashOf(const T &value)
+        {
+            if constexpr (THasDbKey<T>::value)
+            {
+                if (value.hasValidDbKey()) { return ::qHash(value.getDbKey()); }
+            }
+            return qHash(value);
+        }
+
         CSequence<T> m_list;
-        CDictionary<T, int, QMap> m_dict;
+        QMultiHash<uint, int> m_index; //!< hash to indexes in m_list
     };
 
     /*!
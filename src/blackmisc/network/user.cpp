@@ -306,6 +306,23 @@ namespace BlackMisc::Network
         return 0;
     }
 
+    CSortKey CUser::sortKeyByIndex(CPropertyIndexRef index) const
+    {
+        if (index.isMyself()) { return CSortKey(this->getRealName(), Qt::CaseInsensitive); }
+        const ColumnIndex i = index.frontCasted<ColumnIndex>();
+        switch (i)
+        {
+        case IndexEmail: return CSortKey(m_email, Qt::CaseInsensitive);
+        case IndexId: return CSortKey(m_id, Qt::CaseInsensitive);
+        case IndexId7Digit: return CSortKey(this->get7DigitId(), Qt::CaseInsensitive);
+        case IndexIdInteger: return CSortKey(this->getIntegerId());
+        case IndexRealName: return CSortKey(m_realname, Qt::CaseInsensitive);
+        case IndexCallsign: return m_callsign.sortKeyByIndex(index.copyFrontRemoved());
+        default: break;
+        }
+        return {};
+    }
+
     void CUser::setPassword(const QString &pw)
     {
         m_password = CObfuscation::decode(pw);
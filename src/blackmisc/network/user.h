@@ -10,6 +10,7 @@
 #include "blackmisc/aviation/callsign.h"
 #include "blackmisc/metaclass.h"
 #include "blackmisc/propertyindexref.h"
+#include "blackmisc/sortkey.h"
 #include "blackmisc/statusmessagelist.h"
 #include "blackmisc/valueobject.h"
 #include "blackmisc/blackmiscexport.h"
@@ -154,6 +155,9 @@ namespace BlackMisc::Network
         //! \copydoc BlackMisc::Mixin::Index::comparePropertyByIndex
         int comparePropertyByIndex(CPropertyIndexRef index, const CUser &compareValue) const;
 
+        //! Sort key, orders like comparePropertyByIndex, invalid for properties without key
+        CSortKey sortKeyByIndex(CPropertyIndexRef index) const;
+
         //! This and another user exchange missing data, This user has priority and overrides first.
         void synchronizeData(CUser &otherUser);
 
@@ -81,4 +81,10 @@ namespace BlackMisc
         const int o2 = compareValue.hasValidOrder() ? compareValue.getOrder() : max;
         return Compare::compare(o1, o2);
     }
+
+    CSortKey IOrderable::sortKeyByIndex(CPropertyIndexRef index) const
+    {
+        Q_UNUSED(index)
+        return CSortKey(this->hasValidOrder() ? this->getOrder() : std::numeric_limits<int>::max());
+    }
 } // namespace
@@ -8,6 +8,7 @@
 
 #include "blackmisc/blackmiscexport.h"
 #include "blackmisc/propertyindexref.h"
+#include "blackmisc/sortkey.h"
 
 #include <QVariant>
 #include <QString>
@@ -59,6 +60,9 @@ namespace BlackMisc
         //! \copydoc BlackMisc::Mixin::Index::comparePropertyByIndex
         int comparePropertyByIndex(CPropertyIndexRef index, const IOrderable &compareValue) const;
 
+        //! Sort key, orders like comparePropertyByIndex
+        CSortKey sortKeyByIndex(CPropertyIndexRef index) const;
+
         int m_order = -1; //!< order number
     };
 } // namespace
@@ -12,6 +12,7 @@
 #include "blackmisc/geo/registermetadatageo.h"
 #include "blackmisc/pq/registermetadatapq.h"
 
+#include "blackmisc/sharedstate/deltaevent.h"
 #include "blackmisc/sharedstate/passiveobserver.h"
 #include "blackmisc/applicationinfolist.h"
 #include "blackmisc/countrylist.h"
@@ -95,6 +96,7 @@ namespace BlackMisc
         Weather::registerMetadata();
 
         SharedState::CAnyMatch::registerMetadata();
+        SharedState::CDeltaEvent::registerMetadata();
 
         // needed by xswiftbus proxy class
         qDBusRegisterMetaType<CSequence<double>>();
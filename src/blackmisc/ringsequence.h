@@ -0,0 +1,270 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#ifndef BLACKMISC_RINGSEQUENCE_H
+#define BLACKMISC_RINGSEQUENCE_H
+
+#include "blackmisc/sequence.h"
+
+#include <QVector>
+#include <QtGlobal>
+#include <iterator>
+#include <utility>
+
+namespace BlackMisc
+{
+    /*!
+     * Sequence with a fixed capacity, latest element first.
+     *
+     * Elements are kept in a ring buffer allocated once with the capacity. push_front is O(1) and,
+     * when the ring is full, overwrites the last (oldest) element instead of shifting all elements.
+     * Copies are implicitly shared like CSequence.
+     * \tparam T the type of elements contained, must be default constructible
+     */
+    template <class T>
+    class CRingSequence
+    {
+    public:
+        //! STL compatibility
+        typedef T value_type;
+
+        //! STL compatibility
+        typedef T &reference;
+
+        //! STL compatibility
+        typedef const T &const_reference;
+
+        //! STL compatibility
+        typedef int size_type;
+
+        //! STL compatibility
+        typedef ptrdiff_t difference_type;
+
+        //! Random access iterator in latest first order
+        template <class Ring, class Ref>
+        class Iterator
+        {
+        public:
+            //! @{
+            //! STL compatibility
+            typedef std::random_access_iterator_tag iterator_category;
+            typedef T value_type;
+            typedef ptrdiff_t difference_type;
+            typedef std::remove_reference_t<Ref> *pointer;
+            typedef Ref reference;
+            //! @}
+
+            //! Default constructor
+            Iterator() = default;
+
+            //! Constructor
+            Iterator(Ring *ring, int index) : m_ring(ring), m_index(index) {}
+
+            //! @{
+            //! Access
+            Ref operator*() const { return (*m_ring)[m_index]; }
+            pointer operator->() const { return &(*m_ring)[m_index]; }
+            Ref operator[](difference_type n) const { return (*m_ring)[m_index + static_cast<int>(n)]; }
+            //! @}
+
+            //! @{
+            //! Advance
+            Iterator &operator++() { ++m_index; return *this; }
+            Iterator operator++(int) { Iterator copy(*this); ++m_index; return copy; }
+            Iterator &operator--() { --m_index; return *this; }
+            Iterator operator--(int) { Iterator copy(*this); --m_index; return copy; }
+            Iterator &operator+=(difference_type n) { m_index += static_cast<int>(n); return *this; }
+            Iterator &operator-=(difference_type n) { m_index -= static_cast<int>(n); return *this; }
+            friend Iterator operator+(Iterator it, difference_type n) { return it += n; }
+            friend Iterator operator+(difference_type n, Iterator it) { return it += n; }
+            friend Iterator operator-(Iterator it, difference_type n) { return it -= n; }
+            friend difference_type operator-(const Iterator &a, const Iterator &b) { return a.m_index - b.m_index; }
+            //! @}
+
+            //! @{
+            //! Compare
+            friend bool operator==(const Iterator &a, const Iterator &b) { return a.m_index == b.m_index; }
+            friend bool operator!=(const Iterator &a, const Iterator &b) { return a.m_index != b.m_index; }
+            friend bool operator<(const Iterator &a, const Iterator &b) { return a.m_index < b.m_index; }
+            friend bool operator>(const Iterator &a, const Iterator &b) { return a.m_index > b.m_index; }
+            friend bool operator<=(const Iterator &a, const Iterator &b) { return a.m_index <= b.m_index; }
+            friend bool operator>=(const Iterator &a, const Iterator &b) { return a.m_index >= b.m_index; }
+            //! @}
+
+        private:
+            Ring *m_ring = nullptr;
+            int m_index = 0;
+        };
+
+        //! STL compatibility
+        typedef Iterator<const CRingSequence, const T &> const_iterator;
+
+        //! STL compatibility
+        typedef Iterator<CRingSequence, T &> iterator;
+
+        //! Default constructor, capacity 0
+        CRingSequence() = default;
+
+        //! Constructor with capacity, the storage is allocated upfront
+        explicit CRingSequence(int capacity) : m_data(qMax(0, capacity)) {}
+
+        //! Constructor from a latest first sequence, elements beyond the capacity are ignored
+        CRingSequence(const CSequence<T> &latestFirst, int capacity) : m_data(qMax(0, capacity))
+        {
+            for (const T &value : latestFirst)
+            {
+                if (m_size >= this->capacity()) { break; }
+                m_data[m_size++] = value;
+            }
+        }
+
+        //! Max.number of elements
+        int capacity() const { return m_data.size(); }
+
+        //! Number of elements
+        int size() const { return m_size; }
+
+        //! Empty?
+        bool isEmpty() const { return m_size < 1; }
+
+        //! Capacity reached?
+        bool isFull() const { return m_size >= this->capacity(); }
+
+        //! Remove all elements, the storage is kept
+        void clear()
+        {
+            m_head = 0;
+            m_size = 0;
+        }
+
+        //! @{
+        //! Element by index, 0 is the latest element
+        const T &operator[](int index) const
+        {
+            Q_ASSERT_X(index >= 0 && index < m_size, Q_FUNC_INFO, "Index out of range");
+            return m_data[this->physicalIndex(index)];
+        }
+        T &operator[](int index)
+        {
+            Q_ASSERT_X(index >= 0 && index < m_size, Q_FUNC_INFO, "Index out of range");
+            return m_data[this->physicalIndex(index)];
+        }
+        //! @}
+
+        //! @{
+        //! Latest element
+        const T &front() const { return (*this)[0]; }
+        T &front() { return (*this)[0]; }
+        //! @}
+
+        //! @{
+        //! Oldest element
+        const T &back() const { return (*this)[m_size - 1]; }
+        T &back() { return (*this)[m_size - 1]; }
+        //! @}
+
+        //! @{
+        //! Iterators in latest first order
+        const_iterator begin() const { return { this, 0 }; }
+        const_iterator end() const { return { this, m_size }; }
+        const_iterator cbegin() const { return this->begin(); }
+        const_iterator cend() const { return this->end(); }
+        iterator begin() { return { this, 0 }; }
+        iterator end() { return { this, m_size }; }
+        //! @}
+
+        //! Insert as latest element, drops the oldest element if full
+        //! \remark O(1), no allocation
+        void push_front(const T &value)
+        {
+            if (!this->prepareFront()) { return; }
+            m_data[m_head] = value;
+        }
+
+        //! Move-insert as latest element, drops the oldest element if full
+        void push_front(T &&value)
+        {
+            if (!this->prepareFront()) { return; }
+            m_data[m_head] = std::move(value);
+        }
+
+        //! Insert at index (0 is latest), drops the oldest element if full
+        //! \remark O(n) for the elements behind index, meant for the rare out of order values
+        void insert(int index, const T &value)
+        {
+            Q_ASSERT_X(index >= 0 && index <= m_size, Q_FUNC_INFO, "Index out of range");
+            if (index == 0)
+            {
+                this->push_front(value);
+                return;
+            }
+            if (index >= this->capacity()) { return; } // would be dropped right away
+            if (!this->isFull()) { m_size++; }
+            for (int i = m_size - 1; i > index; --i) { (*this)[i] = std::move((*this)[i - 1]); }
+            (*this)[index] = value;
+        }
+
+        //! Remove the oldest element
+        void pop_back()
+        {
+            if (m_size > 0) { m_size--; }
+        }
+
+        //! Keep at most maxSize elements, the oldest elements are removed
+        void truncate(int maxSize)
+        {
+            if (maxSize >= 0 && m_size > maxSize) { m_size = maxSize; }
+        }
+
+        //! Copy into a sequence (latest first)
+        template <class C = CSequence<T>>
+        C toSequence() const
+        {
+            C sequence;
+            sequence.reserve(m_size);
+            for (int i = 0; i < m_size; ++i) { sequence.push_back((*this)[i]); }
+            return sequence;
+        }
+
+        //! Equal elements in the same order
+        friend bool operator==(const CRingSequence &a, const CRingSequence &b)
+        {
+            if (a.size() != b.size()) { return false; }
+            for (int i = 0; i < a.size(); ++i)
+            {
+                if (!(a[i] == b[i])) { return false; }
+            }
+            return true;
+        }
+
+        //! Not equal
+        friend bool operator!=(const CRingSequence &a, const CRingSequence &b) { return !(a == b); }
+
+    private:
+        //! Ring position of the logical index
+        int physicalIndex(int index) const
+        {
+            const int i = m_head + index;
+            const int c = this->capacity();
+            return i >= c ? i - c : i;
+        }
+
+        //! Move head to the free (or oldest) slot, false if there is no capacity
+        bool prepareFront()
+        {
+            const int c = this->capacity();
+            if (c < 1) { return false; }
+            m_head = m_head > 0 ? m_head - 1 : c - 1;
+            if (m_size < c) { m_size++; }
+            return true;
+        }
+
+        QVector<T> m_data; //!< storage, size is the capacity
+        int m_head = 0; //!< storage index of the latest element
+        int m_size = 0; //!< number of valid elements
+    };
+} // ns
+
+#endif // guard
@@ -288,6 +288,9 @@ namespace BlackMisc
         //! Removes all elements in the sequence.
         void clear() { m_impl.clear(); }
 
+        //! Reserve storage for size elements.
+        void reserve(size_type size) { m_impl.reserve(size); }
+
         //! Changes the size of the sequence, if it is bigger than the given size.
         void truncate(size_type maxSize)
         {
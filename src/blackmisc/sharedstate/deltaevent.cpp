@@ -0,0 +1,17 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#include "blackmisc/sharedstate/deltaevent.h"
+#include <QStringBuilder>
+
+BLACK_DEFINE_VALUEOBJECT_MIXINS(BlackMisc::SharedState, CDeltaEvent)
+
+namespace BlackMisc::SharedState
+{
+    QString CDeltaEvent::convertToQString(bool i18n) const
+    {
+        return (m_snapshot ? QStringLiteral("snapshot ") : QStringLiteral("delta ")) % QString::number(m_sequence) % u' ' % m_value.toQString(i18n);
+    }
+}
@@ -0,0 +1,59 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#ifndef BLACKMISC_SHAREDSTATE_DELTAEVENT_H
+#define BLACKMISC_SHAREDSTATE_DELTAEVENT_H
+
+#include "blackmisc/variant.h"
+#include "blackmisc/valueobject.h"
+#include "blackmisc/metaclass.h"
+#include "blackmisc/blackmiscexport.h"
+#include <QString>
+
+BLACK_DECLARE_VALUEOBJECT_MIXINS(BlackMisc::SharedState, CDeltaEvent)
+
+namespace BlackMisc::SharedState
+{
+    /*!
+     * Sequenced event emitted by CDeltaJournal, either a full snapshot or a delta to the previous sequence.
+     * \ingroup SharedState
+     */
+    class BLACKMISC_EXPORT CDeltaEvent : public CValueObject<CDeltaEvent>
+    {
+    public:
+        //! Default constructor.
+        CDeltaEvent() = default;
+
+        //! Constructor.
+        CDeltaEvent(qint64 sequence, bool snapshot, const CVariant &value) : m_sequence(sequence), m_snapshot(snapshot), m_value(value) {}
+
+        //! Sequence number, a delta follows the previous sequence number without gap.
+        qint64 getSequence() const { return m_sequence; }
+
+        //! Full snapshot (reply to a request) or delta (event)?
+        bool isSnapshot() const { return m_snapshot; }
+
+        //! Snapshot or delta value.
+        const CVariant &getValue() const { return m_value; }
+
+        //! To string.
+        QString convertToQString(bool i18n = false) const;
+
+    private:
+        qint64 m_sequence = 0;
+        bool m_snapshot = false;
+        CVariant m_value;
+
+        BLACK_METACLASS(
+            CDeltaEvent,
+            BLACK_METAMEMBER(sequence),
+            BLACK_METAMEMBER(snapshot),
+            BLACK_METAMEMBER(value));
+    };
+}
+
+Q_DECLARE_METATYPE(BlackMisc::SharedState::CDeltaEvent)
+
+#endif
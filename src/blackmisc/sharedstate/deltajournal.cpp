@@ -0,0 +1,27 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#include "blackmisc/sharedstate/deltajournal.h"
+#include "blackmisc/sharedstate/datalink.h"
+
+namespace BlackMisc::SharedState
+{
+    void CGenericDeltaJournal::initialize(IDataLink *dataLink)
+    {
+        dataLink->publish(m_mutator.data());
+    }
+
+    void CGenericDeltaJournal::postGenericDelta(const CVariant &delta)
+    {
+        m_mutator->postEvent(CVariant::from(CDeltaEvent(++m_sequence, false, delta)));
+    }
+
+    CVariant CGenericDeltaJournal::handleRequest(const CVariant &param)
+    {
+        Q_UNUSED(param)
+        m_hasObservers = true;
+        return CVariant::from(CDeltaEvent(m_sequence, true, genericSnapshot()));
+    }
+}
@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#ifndef BLACKMISC_SHAREDSTATE_DELTAJOURNAL_H
+#define BLACKMISC_SHAREDSTATE_DELTAJOURNAL_H
+
+#include "blackmisc/sharedstate/activemutator.h"
+#include "blackmisc/sharedstate/deltaevent.h"
+#include "blackmisc/variant.h"
+#include "blackmisc/blackmiscexport.h"
+#include <QObject>
+#include <atomic>
+
+namespace BlackMisc::SharedState
+{
+    class IDataLink;
+
+    /*!
+     * Non-template base class for CDeltaJournal.
+     * \ingroup SharedState
+     */
+    class BLACKMISC_EXPORT CGenericDeltaJournal : public QObject
+    {
+        Q_OBJECT
+
+    public:
+        //! Publish using the given transport mechanism.
+        void initialize(IDataLink *);
+
+        //! Sequence number of the last posted delta.
+        qint64 getSequence() const { return m_sequence; }
+
+        //! Has any observer requested a snapshot?
+        //! \remark observers request a snapshot when connecting, so no deltas are needed before the first request
+        //! \threadsafe
+        bool hasObservers() const { return m_hasObservers; }
+
+    protected:
+        //! Constructor.
+        CGenericDeltaJournal(QObject *parent) : QObject(parent) {}
+
+        //! Post a delta as variant, with the next sequence number.
+        void postGenericDelta(const CVariant &delta);
+
+    private:
+        CVariant handleRequest(const CVariant &param);
+        virtual CVariant genericSnapshot() const = 0;
+
+        QSharedPointer<CActiveMutator> m_mutator = CActiveMutator::create(this, &CGenericDeltaJournal::handleRequest);
+        std::atomic<qint64> m_sequence { 0 };
+        std::atomic_bool m_hasObservers { false };
+    };
+
+    /*!
+     * Base class for an object that shares state with corresponding CDeltaObserver subclass objects,
+     * by sending a snapshot on request and then only deltas.
+     *
+     * Every delta carries a sequence number, so an observer that missed a delta can request a new snapshot.
+     * \tparam T Datatype encapsulating the state to be shared.
+     * \tparam D Datatype encapsulating a change of the state.
+     * \ingroup SharedState
+     */
+    template <typename T, typename D>
+    class CDeltaJournal : public CGenericDeltaJournal
+    {
+    protected:
+        //! Constructor.
+        CDeltaJournal(QObject *parent) : CGenericDeltaJournal(parent) {}
+
+        //! Post a delta, the snapshot needs to be updated accordingly before.
+        void postDelta(const D &delta) { postGenericDelta(CVariant::from(delta)); }
+
+        //! Current state, sent to an observer requesting a snapshot.
+        virtual T snapshot() const = 0;
+
+    private:
+        virtual CVariant genericSnapshot() const override final { return CVariant::from(snapshot()); }
+    };
+}
+
+#endif
@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#include "blackmisc/sharedstate/deltaobserver.h"
+#include "blackmisc/sharedstate/datalink.h"
+
+#include <QDateTime>
+
+namespace BlackMisc::SharedState
+{
+    void CGenericDeltaObserver::initialize(IDataLink *dataLink)
+    {
+        dataLink->subscribe(m_observer.data());
+        m_observer->setEventSubscription(CVariant::from(CAnyMatch()));
+        connect(dataLink->watcher(), &CDataLinkConnectionWatcher::connected, this, &CGenericDeltaObserver::reconstruct);
+        connect(dataLink->watcher(), &CDataLinkConnectionWatcher::disconnected, this, &CGenericDeltaObserver::desynchronize);
+        if (dataLink->watcher()->isConnected()) { reconstruct(); }
+    }
+
+    void CGenericDeltaObserver::reconstruct()
+    {
+        // (re)connected, a pending request of the previous connection is not waited for
+        m_snapshotRequestedMs = -1;
+        requestSnapshot();
+    }
+
+    void CGenericDeltaObserver::requestSnapshot()
+    {
+        m_synchronized = false;
+
+        // one request at a time, all deltas until the reply are contained in the snapshot
+        const qint64 now = QDateTime::currentMSecsSinceEpoch();
+        const qint64 requestedMs = m_snapshotRequestedMs;
+        if (requestedMs >= 0 && now - requestedMs < SnapshotRequestTimeoutMs) { return; }
+        m_snapshotRequestedMs = now;
+        m_observer->requestAsync({}, [this](const CVariant &reply) { handleSnapshot(reply); });
+    }
+
+    void CGenericDeltaObserver::desynchronize()
+    {
+        m_synchronized = false;
+        m_snapshotRequestedMs = -1;
+    }
+
+    void CGenericDeltaObserver::handleSnapshot(const CVariant &param)
+    {
+        m_snapshotRequestedMs = -1;
+        if (!param.canConvert<CDeltaEvent>()) { return; } // no journal (yet), next delta will retry
+        const CDeltaEvent snapshot = param.to<CDeltaEvent>();
+        Q_ASSERT_X(snapshot.isSnapshot(), Q_FUNC_INFO, "expected a snapshot");
+        if (m_synchronized && snapshot.getSequence() < m_sequence) { return; } // reply to an older request
+        m_sequence = snapshot.getSequence();
+        onGenericSnapshot(snapshot.getValue());
+        m_synchronized = true;
+    }
+
+    void CGenericDeltaObserver::handleEvent(const CVariant &param)
+    {
+        const CDeltaEvent delta = param.to<CDeltaEvent>();
+        if (!m_synchronized)
+        {
+            // the requested snapshot will contain this delta, request again only if no request is pending,
+            // e.g. the journal was not available when connecting (deltas are rate limited by the journal)
+            requestSnapshot();
+            return;
+        }
+        if (delta.getSequence() <= m_sequence) { return; } // already contained in the snapshot
+        if (delta.getSequence() != m_sequence + 1)
+        {
+            // missed a delta
+            ++m_resyncCount;
+            requestSnapshot();
+            return;
+        }
+        m_sequence = delta.getSequence();
+        onGenericDelta(delta.getValue());
+    }
+}
@@ -0,0 +1,91 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#ifndef BLACKMISC_SHAREDSTATE_DELTAOBSERVER_H
+#define BLACKMISC_SHAREDSTATE_DELTAOBSERVER_H
+
+#include "blackmisc/sharedstate/activeobserver.h"
+#include "blackmisc/sharedstate/deltaevent.h"
+#include "blackmisc/variant.h"
+#include "blackmisc/blackmiscexport.h"
+#include <QObject>
+#include <atomic>
+
+namespace BlackMisc::SharedState
+{
+    class IDataLink;
+
+    /*!
+     * Non-template base class for CDeltaObserver.
+     * \ingroup SharedState
+     */
+    class BLACKMISC_EXPORT CGenericDeltaObserver : public QObject
+    {
+        Q_OBJECT
+
+    public:
+        //! Subscribe using the given transport mechanism.
+        void initialize(IDataLink *);
+
+        //! Snapshot received and no delta missed since?
+        //! \threadsafe
+        bool isSynchronized() const { return m_synchronized; }
+
+        //! Sequence number of the last applied snapshot or delta.
+        qint64 getSequence() const { return m_sequence; }
+
+        //! Number of snapshots requested because of a missed delta.
+        int getResyncCount() const { return m_resyncCount; }
+
+    protected:
+        //! Constructor.
+        CGenericDeltaObserver(QObject *parent) : QObject(parent) {}
+
+    private:
+        void reconstruct();
+        void requestSnapshot();
+        void desynchronize();
+        void handleEvent(const CVariant &param);
+        void handleSnapshot(const CVariant &param);
+        virtual void onGenericSnapshot(const CVariant &snapshot) = 0;
+        virtual void onGenericDelta(const CVariant &delta) = 0;
+
+        QSharedPointer<CActiveObserver> m_observer = CActiveObserver::create(this, &CGenericDeltaObserver::handleEvent);
+        std::atomic_bool m_synchronized { false };
+        std::atomic<qint64> m_sequence { 0 };
+        std::atomic_int m_resyncCount { 0 };
+        std::atomic<qint64> m_snapshotRequestedMs { -1 }; //!< pending snapshot request, -1 if none
+        static constexpr qint64 SnapshotRequestTimeoutMs = 5000; //!< a pending request without reply is repeated after this time
+    };
+
+    /*!
+     * Base class for an object that shares state with a corresponding CDeltaJournal subclass object.
+     *
+     * A snapshot is requested when connected, afterwards only deltas are received.
+     * If a delta is missed (gap in the sequence numbers) a new snapshot is requested.
+     * \tparam T Datatype encapsulating the state to be shared.
+     * \tparam D Datatype encapsulating a change of the state.
+     * \ingroup SharedState
+     */
+    template <typename T, typename D>
+    class CDeltaObserver : public CGenericDeltaObserver
+    {
+    protected:
+        //! Constructor.
+        CDeltaObserver(QObject *parent) : CGenericDeltaObserver(parent) {}
+
+    private:
+        //! Called when a snapshot replaces the state.
+        virtual void onSnapshot(const T &snapshot) = 0;
+
+        //! Called when a delta is to be applied to the state.
+        virtual void onDelta(const D &delta) = 0;
+
+        virtual void onGenericSnapshot(const CVariant &snapshot) override final { onSnapshot(snapshot.to<T>()); }
+        virtual void onGenericDelta(const CVariant &delta) override final { onDelta(delta.to<D>()); }
+    };
+}
+
+#endif
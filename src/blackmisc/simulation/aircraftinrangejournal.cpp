@@ -0,0 +1,47 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+#include "blackmisc/simulation/aircraftinrangejournal.h"
+
+namespace BlackMisc::Simulation
+{
+    CAircraftInRangeJournal::CAircraftInRangeJournal(QObject *parent) : CDeltaJournal(parent)
+    {}
+
+    bool CAircraftInRangeJournal::update(const CSimulatedAircraftList &aircraft)
+    {
+        if (!this->hasObservers())
+        {
+            // nobody to send deltas to, only keep the snapshot current (implicitly shared, no diff)
+            m_aircraft = aircraft;
+            return false;
+        }
+
+        const CSimulatedAircraftListDelta delta = CSimulatedAircraftListDelta::fromDiff(m_aircraft, aircraft);
+        if (delta.isEmpty()) { return false; }
+        m_aircraft = aircraft;
+        this->postDelta(delta);
+        return true;
+    }
+
+    CAircraftInRangeReplica::CAircraftInRangeReplica(QObject *parent) : CDeltaObserver(parent)
+    {}
+
+    CSimulatedAircraftList CAircraftInRangeReplica::getAircraftInRange() const
+    {
+        QMutexLocker lock(&m_aircraftMutex);
+        return m_aircraft;
+    }
+
+    void CAircraftInRangeReplica::onSnapshot(const CSimulatedAircraftList &aircraft)
+    {
+        QMutexLocker lock(&m_aircraftMutex);
+        m_aircraft = aircraft;
+    }
+
+    void CAircraftInRangeReplica::onDelta(const CSimulatedAircraftListDelta &delta)
+    {
+        QMutexLocker lock(&m_aircraftMutex);
+        delta.applyTo(m_aircraft);
+    }
+} // namespace
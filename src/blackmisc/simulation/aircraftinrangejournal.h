@@ -0,0 +1,72 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#ifndef BLACKMISC_SIMULATION_AIRCRAFTINRANGEJOURNAL_H
+#define BLACKMISC_SIMULATION_AIRCRAFTINRANGEJOURNAL_H
+
+#include "blackmisc/sharedstate/datalink.h"
+#include "blackmisc/sharedstate/deltajournal.h"
+#include "blackmisc/sharedstate/deltaobserver.h"
+#include "blackmisc/simulation/simulatedaircraftlist.h"
+#include "blackmisc/simulation/simulatedaircraftlistdelta.h"
+#include "blackmisc/blackmiscexport.h"
+#include <QObject>
+#include <QMutex>
+
+namespace BlackMisc::Simulation
+{
+    /*!
+     * Publishes the aircraft in range, as snapshot on request and as deltas afterwards.
+     */
+    class BLACKMISC_EXPORT CAircraftInRangeJournal : public SharedState::CDeltaJournal<CSimulatedAircraftList, CSimulatedAircraftListDelta>
+    {
+        Q_OBJECT
+        BLACK_SHARED_STATE_CHANNEL("swift.aircraft.inrange")
+
+    public:
+        //! Constructor.
+        CAircraftInRangeJournal(QObject *parent = nullptr);
+
+        //! Publish the changes to the previously published aircraft, if any.
+        //! \remark the caller controls the update rate
+        //! \remark without observers the aircraft are only kept for the snapshot, no diff is calculated
+        //! \return delta published
+        bool update(const CSimulatedAircraftList &aircraft);
+
+        //! Last published aircraft.
+        const CSimulatedAircraftList &getAircraft() const { return m_aircraft; }
+
+    private:
+        virtual CSimulatedAircraftList snapshot() const override final { return m_aircraft; }
+
+        CSimulatedAircraftList m_aircraft;
+    };
+
+    /*!
+     * Allows distributed access to the aircraft in range of a central CAircraftInRangeJournal.
+     */
+    class BLACKMISC_EXPORT CAircraftInRangeReplica : public SharedState::CDeltaObserver<CSimulatedAircraftList, CSimulatedAircraftListDelta>
+    {
+        Q_OBJECT
+        BLACK_SHARED_STATE_CHANNEL("swift.aircraft.inrange")
+
+    public:
+        //! Constructor.
+        CAircraftInRangeReplica(QObject *parent = nullptr);
+
+        //! Aircraft in range, as of the last received snapshot or delta.
+        //! \threadsafe
+        CSimulatedAircraftList getAircraftInRange() const;
+
+    private:
+        virtual void onSnapshot(const CSimulatedAircraftList &aircraft) override final;
+        virtual void onDelta(const CSimulatedAircraftListDelta &delta) override final;
+
+        mutable QMutex m_aircraftMutex;
+        CSimulatedAircraftList m_aircraft;
+    };
+} // namespace
+
+#endif // guard
@@ -4,6 +4,7 @@
 #include "blackmisc/simulation/matchingutils.h"
 #include "blackmisc/simulation/aircraftmodel.h"
 #include "blackmisc/db/datastoreutility.h"
+#include "blackmisc/db/jsonkeys.h"
 #include "blackmisc/comparefunctions.h"
 #include "blackmisc/fileutils.h"
 #include "blackmisc/logcategories.h"
@@ -369,6 +370,40 @@ namespace BlackMisc::Simulation
         return 0;
     }
 
+    CSortKey CAircraftModel::sortKeyByIndex(CPropertyIndexRef index) const
+    {
+        if (IDatastoreObjectWithIntegerKey::canHandleIndex(index)) { return IDatastoreObjectWithIntegerKey::sortKeyByIndex(index); }
+        if (IOrderable::canHandleIndex(index)) { return IOrderable::sortKeyByIndex(index); }
+        if (index.isMyself()) { return CSortKey(m_modelString, Qt::CaseInsensitive); }
+        const ColumnIndex i = index.frontCasted<ColumnIndex>();
+        switch (i)
+        {
+        case IndexModelString: return CSortKey(m_modelString, Qt::CaseInsensitive);
+        case IndexModelStringAlias: return CSortKey(m_modelStringAlias, Qt::CaseInsensitive);
+        case IndexAllModelStrings: return CSortKey(this->getAllModelStringsAndAliases(), Qt::CaseInsensitive);
+        case IndexHasQueriedModelString: return CSortKey(this->hasQueriedModelString());
+        case IndexAircraftIcaoCode: return m_aircraftIcao.sortKeyByIndex(index.copyFrontRemoved());
+        case IndexLivery: return m_livery.sortKeyByIndex(index.copyFrontRemoved());
+        case IndexDistributor: return m_distributor.sortKeyByIndex(index.copyFrontRemoved());
+        case IndexDescription: return CSortKey(m_description, Qt::CaseInsensitive);
+        case IndexName: return CSortKey(m_name, Qt::CaseInsensitive);
+        case IndexCallsign: return m_callsign.sortKeyByIndex(index.copyFrontRemoved());
+        case IndexFileName: return CSortKey(m_fileName, Qt::CaseInsensitive);
+        case IndexIconPath: return CSortKey(m_iconFile, Qt::CaseInsensitive);
+        case IndexSupportedParts: return CSortKey(m_supportedParts);
+        case IndexModelTypeAsString:
+        case IndexModelType: return CSortKey(m_modelType);
+        case IndexFileTimestamp:
+        case IndexFileTimestampFormattedYmdhms: return CSortKey(m_fileTimestamp);
+        case IndexModelMode:
+        case IndexModelModeAsString:
+        case IndexModelModeAsIcon: return CSortKey(m_modelMode);
+        case IndexMembersDbStatus: return CSortKey(this->getMembersDbStatus());
+        default: break; // CG and simulator are compared by comparePropertyByIndex
+        }
+        return {};
+    }
+
     bool CAircraftModel::setAircraftIcaoCode(const CAircraftIcaoCode &aircraftIcaoCode)
     {
         if (m_aircraftIcao == aircraftIcaoCode) { return false; }
@@ -984,17 +1019,38 @@ namespace BlackMisc::Simulation
         return i; // default
     }
 
+    namespace
+    {
+        //! JSON keys of CAircraftModel::fromDatabaseJson
+        struct AircraftModelJsonKeys
+        {
+            //! Keys with prefix
+            AircraftModelJsonKeys(const QString &prefix) : modelString(prefix % u"modelstring"), modelStringAlias(prefix % u"modelstringalias"), description(prefix % u"description"),
+                                                           name(prefix % u"name"), mode(prefix % u"mode"), parts(prefix % u"parts"), cg(prefix % u"cgft")
+            {}
+
+            QString modelString; //!< model string
+            QString modelStringAlias; //!< model string alias
+            QString description; //!< description
+            QString name; //!< name
+            QString mode; //!< mode
+            QString parts; //!< supported parts
+            QString cg; //!< CG in ft
+        };
+    }
+
     CAircraftModel CAircraftModel::fromDatabaseJsonBaseImpl(const QJsonObject &json, const QString &prefix, const CAircraftIcaoCode &aircraftIcao, const CLivery &livery, const CDistributor &distributor)
     {
-        const QString modelString(json.value(prefix % u"modelstring").toString());
-        const QString modelStringAlias(json.value(prefix % u"modelstringalias").toString());
-        const QString modelDescription(json.value(prefix % u"description").toString());
-        const QString modelName(json.value(prefix % u"name").toString());
-        const QString modelMode(json.value(prefix % u"mode").toString());
-        const QString parts(json.value(prefix % u"parts").toString());
+        const AircraftModelJsonKeys &keys = Db::jsonKeys<AircraftModelJsonKeys>(prefix);
+        const QString modelString(json.value(keys.modelString).toString());
+        const QString modelStringAlias(json.value(keys.modelStringAlias).toString());
+        const QString modelDescription(json.value(keys.description).toString());
+        const QString modelName(json.value(keys.name).toString());
+        const QString modelMode(json.value(keys.mode).toString());
+        const QString parts(json.value(keys.parts).toString());
 
         // check for undefined to rule out 0ft values
-        const QJsonValue cgjv = json.value(prefix % u"cgft");
+        const QJsonValue cgjv = json.value(keys.cg);
         const CLength cg = (cgjv.isNull() || cgjv.isUndefined()) ? CLength::null() : CLength(cgjv.toDouble(), CLengthUnit::ft());
 
         const CSimulatorInfo simInfo = CSimulatorInfo::fromDatabaseJson(json, prefix);
@@ -1015,9 +1071,12 @@ namespace BlackMisc::Simulation
         static const QString prefixAircraftIcao("ac_");
         static const QString prefixLivery("liv_");
         static const QString prefixDistributor("dist_");
-        const QString idDistributor = json.value(prefixDistributor % u"id").toString();
-        const int idAircraftIcao = json.value(prefixAircraftIcao % u"id").toInt(-1);
-        const int idLivery = json.value(prefixLivery % u"id").toInt(-1);
+        static const QString keyIdDistributor(prefixDistributor % u"id");
+        static const QString keyIdAircraftIcao(prefixAircraftIcao % u"id");
+        static const QString keyIdLivery(prefixLivery % u"id");
+        const QString idDistributor = json.value(keyIdDistributor).toString();
+        const int idAircraftIcao = json.value(keyIdAircraftIcao).toInt(-1);
+        const int idLivery = json.value(keyIdLivery).toInt(-1);
 
         CDistributor distributor(CDistributor::fromDatabaseJson(json, prefixDistributor));
         CAircraftIcaoCode aircraftIcao(CAircraftIcaoCode::fromDatabaseJson(json, prefixAircraftIcao));
@@ -1039,9 +1098,12 @@ namespace BlackMisc::Simulation
         static const QString prefixAircraftIcao("ac_");
         static const QString prefixLivery("liv_");
         static const QString prefixDistributor("dist_");
-        const QString idDistributor = json.value(prefixDistributor % u"id").toString();
-        const int idAircraftIcao = json.value(prefixAircraftIcao % u"id").toInt(-1);
-        const int idLivery = json.value(prefixLivery % u"id").toInt(-1);
+        static const QString keyIdDistributor(prefixDistributor % u"id");
+        static const QString keyIdAircraftIcao(prefixAircraftIcao % u"id");
+        static const QString keyIdLivery(prefixLivery % u"id");
+        const QString idDistributor = json.value(keyIdDistributor).toString();
+        const int idAircraftIcao = json.value(keyIdAircraftIcao).toInt(-1);
+        const int idLivery = json.value(keyIdLivery).toInt(-1);
 
         const bool cachedAircraftIcao = (idAircraftIcao >= 0) && aircraftIcaos.contains(idAircraftIcao);
         const bool cachedLivery = (idLivery >= 0) && liveries.contains(idLivery);
@@ -23,6 +23,7 @@
 #include "blackmisc/orderable.h"
 #include "blackmisc/pixmap.h"
 #include "blackmisc/propertyindexref.h"
+#include "blackmisc/sortkey.h"
 #include "blackmisc/blackmiscexport.h"
 
 #include <QFlags>
@@ -160,6 +161,9 @@ namespace BlackMisc
             //! \copydoc BlackMisc::Mixin::Index::comparePropertyByIndex
             int comparePropertyByIndex(CPropertyIndexRef index, const CAircraftModel &compareValue) const;
 
+            //! Sort key, orders like comparePropertyByIndex, invalid for properties without key
+            CSortKey sortKeyByIndex(CPropertyIndexRef index) const;
+
             //! \copydoc BlackMisc::Mixin::String::toQString
             QString convertToQString(bool i18n = false) const;
 
@@ -22,7 +22,10 @@
 #include <QMultiMap>
 #include <QFileInfo>
 #include <QDir>
+#include <QThread>
+#include <future>
 #include <tuple>
+#include <vector>
 
 using namespace BlackConfig;
 using namespace BlackMisc::Network;
@@ -1623,7 +1626,7 @@ namespace BlackMisc::Simulation
         clear();
         QJsonValue value = json.value("containerbase");
         if (value.isUndefined()) { throw CJsonException("Missing 'containerbase'"); }
-        QJsonArray array = value.toArray();
+        const QJsonArray array = value.toArray();
 
         CAircraftModel::MemoHelper::CUnmemoizer helper;
         const QJsonValue aircraftIcaos = json.value("aircraftIcaos");
@@ -1664,14 +1667,16 @@ namespace BlackMisc::Simulation
             helper.getTable<CDistributor>().convertFromJson(distributors.toObject());
         }
 
+        // const iterators, a non-const QJsonArray would detach and be copied as a whole
+        this->reserve(array.size());
         int index = 0;
-        for (auto i = array.begin(); i != array.end(); ++i)
+        for (auto i = array.cbegin(); i != array.cend(); ++i)
         {
             CJsonScope scope("containerbase", index++);
             Q_UNUSED(scope)
-            CAircraftModel value;
-            value.convertFromMemoizedJson(i->toObject(), helper);
-            this->push_back(value);
+            CAircraftModel model;
+            model.convertFromMemoizedJson(i->toObject(), helper);
+            this->push_back(std::move(model));
         }
     }
 
@@ -1799,16 +1804,42 @@ namespace BlackMisc::Simulation
         const CLiveryList &liveries,
         const CDistributorList &distributors)
     {
-        AircraftIcaoIdMap aircraftIcaosMap = icaos.toDbKeyValueMap();
-        LiveryIdMap liveriesMap = liveries.toDbKeyValueMap();
-        DistributorIdMap distributorsMap = distributors.toDbKeyValueMap();
+        const AircraftIcaoIdMap aircraftIcaosMap = icaos.toDbKeyValueMap();
+        const LiveryIdMap liveriesMap = liveries.toDbKeyValueMap();
+        const DistributorIdMap distributorsMap = distributors.toDbKeyValueMap();
         const AircraftCategoryIdMap categoriesMap = categories.toDbKeyValueMap();
 
-        CAircraftModelList models;
-        for (const QJsonValue &value : array)
+        // rows of a range are decoded with their own caches, so ranges can be decoded in parallel
+        const auto decodeRows = [&](int begin, int end) {
+            static const QString prefix("mod_");
+            AircraftIcaoIdMap aircraftIcaosCache = aircraftIcaosMap;
+            LiveryIdMap liveriesCache = liveriesMap;
+            DistributorIdMap distributorsCache = distributorsMap;
+            CAircraftModelList models;
+            models.reserve(end - begin);
+            for (int i = begin; i < end; ++i)
+            {
+                models.push_back(CAircraftModel::fromDatabaseJsonCaching(array.at(i).toObject(), aircraftIcaosCache, categoriesMap, liveriesCache, distributorsCache, prefix));
+            }
+            return models;
+        };
+
+        // small arrays are not worth the threads
+        constexpr int MinRowsPerThread = 2500;
+        const int rows = array.size();
+        const int threads = qBound(1, qMin(QThread::idealThreadCount(), rows / MinRowsPerThread), 8);
+        if (threads < 2) { return decodeRows(0, rows); }
+
+        const int rowsPerThread = (rows + threads - 1) / threads;
+        std::vector<std::future<CAircraftModelList>> ranges;
+        for (int begin = 0; begin < rows; begin += rowsPerThread)
         {
-            models.push_back(CAircraftModel::fromDatabaseJsonCaching(value.toObject(), aircraftIcaosMap, categoriesMap, liveriesMap, distributorsMap));
+            ranges.push_back(std::async(std::launch::async, decodeRows, begin, qMin(begin + rowsPerThread, rows)));
         }
+
+        CAircraftModelList models;
+        models.reserve(rows);
+        for (std::future<CAircraftModelList> &range : ranges) { models.push_back(range.get()); }
         return models;
     }
 
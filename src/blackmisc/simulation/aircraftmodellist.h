@@ -556,6 +556,7 @@ namespace BlackMisc
             //! @}
 
             //! Newer version
+            //! \remark large arrays are decoded in parallel
             static CAircraftModelList fromDatabaseJsonCaching(const QJsonArray &array,
                                                               const Aviation::CAircraftIcaoCodeList &aircraftIcaos = {},
                                                               const Aviation::CAircraftCategoryList &aircraftCategories = {},
@@ -0,0 +1,204 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+#include "blackmisc/simulation/aircraftmodelsetindex.h"
+#include "blackmisc/aviation/livery.h"
+
+#include <iterator>
+#include <numeric>
+
+using namespace BlackMisc::Aviation;
+
+namespace BlackMisc::Simulation
+{
+    CAircraftModelSetIndex::CAircraftModelSetIndex(const CAircraftModelList &modelSet) : m_modelSet(modelSet)
+    {
+        const auto addKey = [](Index &index, const QString &key, int id) {
+            if (!key.isEmpty()) { index[key].push_back(id); }
+        };
+        const auto addFirst = [](QHash<QString, int> &index, const QString &key, int id) {
+            if (!key.isEmpty() && !index.contains(key)) { index.insert(key, id); }
+        };
+
+        const int size = m_modelSet.sizeInt();
+        m_byModelString.reserve(size);
+        m_byModelStringOrAlias.reserve(size);
+        for (int id = 0; id < size; ++id)
+        {
+            // ids are added in ascending order, so all id vectors of the indexes are sorted
+            const CAircraftModel &model = m_modelSet[id];
+            const CAircraftIcaoCode &icao = model.getAircraftIcaoCode();
+            const QString modelString = model.getModelString().toUpper();
+            addFirst(m_byModelString, modelString, id);
+            addFirst(m_byModelStringOrAlias, modelString, id);
+            addFirst(m_byModelStringOrAlias, model.getModelStringAlias().toUpper(), id);
+
+            addKey(m_byAircraftDesignator, icao.getDesignator(), id);
+            addKey(m_byAirlineDesignator, model.getAirlineIcaoCodeDesignator(), id);
+            addKey(m_byFamily, icao.getFamily(), id);
+            addKey(m_byLiveryCombinedCode, model.getLivery().getCombinedCode(), id);
+            addKey(m_byCombinedType, icao.getCombinedType(), id);
+            addKey(m_byManufacturer, icao.getManufacturer(), id);
+        }
+    }
+
+    CAircraftModelSetIndex::ModelIds CAircraftModelSetIndex::allIds() const
+    {
+        ModelIds ids(this->size());
+        std::iota(ids.begin(), ids.end(), 0);
+        return ids;
+    }
+
+    CAircraftModelList CAircraftModelSetIndex::models(const ModelIds &view) const
+    {
+        // ids are unique, so a sorted view with all ids is the whole set
+        if (view.size() == this->size() && std::is_sorted(view.cbegin(), view.cend())) { return m_modelSet; }
+
+        CAircraftModelList models;
+        models.reserve(view.size());
+        for (int id : view) { models.push_back(this->model(id)); }
+        return models;
+    }
+
+    CAircraftModelSetIndex::ModelIds CAircraftModelSetIndex::idsOf(const CAircraftModelList &models) const
+    {
+        ModelIds ids;
+        ids.reserve(models.sizeInt());
+        for (const CAircraftModel &model : models)
+        {
+            const int id = m_byModelString.value(model.getModelString().toUpper(), -1);
+            if (id >= 0) { ids.push_back(id); }
+        }
+        return ids;
+    }
+
+    int CAircraftModelSetIndex::findFirstByModelStringOrAlias(const QString &modelString) const
+    {
+        if (modelString.isEmpty()) { return -1; }
+        return m_byModelStringOrAlias.value(modelString.toUpper(), -1);
+    }
+
+    CAircraftModelSetIndex::ModelIds CAircraftModelSetIndex::findByAircraftDesignator(const ModelIds &view, const QString &designator) const
+    {
+        if (designator.isEmpty())
+        {
+            return this->findBy(view, [](const CAircraftModel &model) { return model.getAircraftIcaoCodeDesignator().isEmpty(); });
+        }
+        return intersection(view, lookup(m_byAircraftDesignator, designator));
+    }
+
+    CAircraftModelSetIndex::ModelIds CAircraftModelSetIndex::findByAirlineDesignator(const ModelIds &view, const QString &designator) const
+    {
+        if (designator.isEmpty())
+        {
+            return this->findBy(view, [](const CAircraftModel &model) { return model.getAirlineIcaoCodeDesignator().isEmpty(); });
+        }
+        return intersection(view, lookup(m_byAirlineDesignator, designator));
+    }
+
+    CAircraftModelSetIndex::ModelIds CAircraftModelSetIndex::findByAirlineGroup(const ModelIds &view, const CAirlineIcaoCode &airline) const
+    {
+        const int groupId = airline.getGroupId();
+        if (groupId < 0) { return {}; }
+        return this->findBy(view, [&](const CAircraftModel &model) { return model.getAirlineIcaoCode().getGroupId() == groupId; });
+    }
+
+    CAircraftModelSetIndex::ModelIds CAircraftModelSetIndex::findByAircraftDesignatorAndLiveryCombinedCode(const ModelIds &view, const QString &aircraftDesignator, const QString &combinedCode) const
+    {
+        if (aircraftDesignator.isEmpty()) { return {}; }
+        const ModelIds &byAircraft = lookup(m_byAircraftDesignator, aircraftDesignator.trimmed().toUpper());
+        const ModelIds &byLivery = lookup(m_byLiveryCombinedCode, combinedCode.trimmed().toUpper());
+        return intersection(view, intersection(byAircraft, byLivery));
+    }
+
+    CAircraftModelSetIndex::ModelIds CAircraftModelSetIndex::findByFamily(const ModelIds &view, const QString &family) const
+    {
+        if (family.isEmpty()) { return {}; }
+        return intersection(view, lookup(m_byFamily, family.toUpper().trimmed()));
+    }
+
+    CAircraftModelSetIndex::ModelIds CAircraftModelSetIndex::findByManufacturer(const ModelIds &view, const QString &manufacturer) const
+    {
+        if (manufacturer.isEmpty()) { return {}; }
+        return intersection(view, lookup(m_byManufacturer, manufacturer.toUpper().trimmed()));
+    }
+
+    CAircraftModelSetIndex::ModelIds CAircraftModelSetIndex::findByCombinedType(const ModelIds &view, const QString &combinedType) const
+    {
+        if (combinedType.length() != 3) { return {}; }
+        const QString cc(combinedType.trimmed().toUpper());
+        const QString ccWildcards = QString(cc).replace(' ', '*').replace('-', '*');
+        if (ccWildcards.contains('*'))
+        {
+            return this->findBy(view, [&](const CAircraftModel &model) { return model.getAircraftIcaoCode().matchesCombinedType(cc); });
+        }
+        return intersection(view, lookup(m_byCombinedType, cc));
+    }
+
+    CAircraftModelSetIndex::ModelIds CAircraftModelSetIndex::findByCombinedAndManufacturer(const ModelIds &view, const CAircraftIcaoCode &icao) const
+    {
+        const QString &combinedType = icao.getCombinedType();
+        const QString &manufacturer = icao.getManufacturer();
+        if (manufacturer.isEmpty()) { return this->findByCombinedType(view, combinedType); }
+        if (combinedType.isEmpty()) { return this->findByManufacturer(view, manufacturer); }
+        return this->findBy(this->findByCombinedType(view, combinedType), [&](const CAircraftModel &model) {
+            return model.getAircraftIcaoCode().matchesManufacturer(manufacturer);
+        });
+    }
+
+    CAircraftModelSetIndex::ModelIds CAircraftModelSetIndex::findByMilitaryFlag(const ModelIds &view, bool military) const
+    {
+        return this->findBy(view, [=](const CAircraftModel &model) { return model.isMilitary() == military; });
+    }
+
+    CAircraftModelSetIndex::ModelIds CAircraftModelSetIndex::findByVtolFlag(const ModelIds &view, bool vtol) const
+    {
+        return this->findBy(view, [=](const CAircraftModel &model) { return model.isVtol() == vtol; });
+    }
+
+    bool CAircraftModelSetIndex::containsVtol(const ModelIds &view) const
+    {
+        return this->containsBy(view, [](const CAircraftModel &model) { return model.isVtol(); });
+    }
+
+    CAircraftModelSetIndex::ModelIds CAircraftModelSetIndex::intersection(const ModelIds &view, const ModelIds &sortedIds)
+    {
+        ModelIds ids;
+        if (view.isEmpty() || sortedIds.isEmpty()) { return ids; }
+        Q_ASSERT_X(std::is_sorted(sortedIds.cbegin(), sortedIds.cend()), Q_FUNC_INFO, "ids need to be sorted");
+        if (std::is_sorted(view.cbegin(), view.cend()))
+        {
+            std::set_intersection(view.cbegin(), view.cend(), sortedIds.cbegin(), sortedIds.cend(), std::back_inserter(ids));
+            return ids;
+        }
+
+        // unsorted view (e.g. appended family results), keep its order
+        for (int id : view)
+        {
+            if (std::binary_search(sortedIds.cbegin(), sortedIds.cend(), id)) { ids.push_back(id); }
+        }
+        return ids;
+    }
+
+    CAircraftModelSetIndex::ModelIds CAircraftModelSetIndex::difference(const ModelIds &view, const ModelIds &ids)
+    {
+        if (ids.isEmpty()) { return view; }
+        ModelIds sortedIds(ids);
+        std::sort(sortedIds.begin(), sortedIds.end());
+        ModelIds result;
+        result.reserve(view.size());
+        for (int id : view)
+        {
+            if (!std::binary_search(sortedIds.cbegin(), sortedIds.cend(), id)) { result.push_back(id); }
+        }
+        return result;
+    }
+
+    const CAircraftModelSetIndex::ModelIds &CAircraftModelSetIndex::lookup(const Index &index, const QString &key)
+    {
+        static const ModelIds empty;
+        if (key.isEmpty()) { return empty; }
+        const auto it = index.constFind(key);
+        return it == index.constEnd() ? empty : *it;
+    }
+} // namespace
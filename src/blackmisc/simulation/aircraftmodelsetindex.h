@@ -0,0 +1,145 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#ifndef BLACKMISC_SIMULATION_AIRCRAFTMODELSETINDEX_H
+#define BLACKMISC_SIMULATION_AIRCRAFTMODELSETINDEX_H
+
+#include "blackmisc/simulation/aircraftmodellist.h"
+#include "blackmisc/aviation/aircrafticaocode.h"
+#include "blackmisc/aviation/airlineicaocode.h"
+#include "blackmisc/blackmiscexport.h"
+
+#include <QHash>
+#include <QString>
+#include <QVector>
+#include <algorithm>
+
+namespace BlackMisc::Simulation
+{
+    /*!
+     * Secondary indexes of a model set, as used by the model matching.
+     *
+     * Models are referred to by their position in the set (id), a reduced set is a view (ids of the models).
+     * The finders behave like the CAircraftModelList finders with the same name, but use the indexes
+     * (aircraft and airline designator, family, livery combined code, combined type, manufacturer) instead
+     * of iterating and copying models. Views keep their order.
+     * \remark immutable after construction, so it can be shared by threads matching in parallel
+     */
+    class BLACKMISC_EXPORT CAircraftModelSetIndex
+    {
+    public:
+        //! Ids (positions) of models in the set
+        using ModelIds = QVector<int>;
+
+        //! Default constructor, empty set
+        CAircraftModelSetIndex() = default;
+
+        //! Constructor, builds the indexes
+        explicit CAircraftModelSetIndex(const CAircraftModelList &modelSet);
+
+        //! The indexed model set
+        const CAircraftModelList &getModelSet() const { return m_modelSet; }
+
+        //! Number of models
+        int size() const { return m_modelSet.sizeInt(); }
+
+        //! Empty set?
+        bool isEmpty() const { return m_modelSet.isEmpty(); }
+
+        //! Model by id
+        const CAircraftModel &model(int id) const { return m_modelSet[id]; }
+
+        //! All ids in set order
+        ModelIds allIds() const;
+
+        //! Models of the view, in view order
+        //! \remark the view of all models returns the (implicitly shared) set without copying
+        CAircraftModelList models(const ModelIds &view) const;
+
+        //! Ids of the given models, found by model string, unknown models are skipped
+        ModelIds idsOf(const CAircraftModelList &models) const;
+
+        //! Id of the first model matching model string or alias (case insensitive), -1 if not found
+        //! \sa CAircraftModelList::findFirstByModelStringAliasOrDefault
+        int findFirstByModelStringOrAlias(const QString &modelString) const;
+
+        //! Aircraft designator (exact), as CAircraftModelList::findByIcaoDesignators without airline
+        ModelIds findByAircraftDesignator(const ModelIds &view, const QString &designator) const;
+
+        //! Airline designator (exact), as CAircraftModelList::findByIcaoDesignators without aircraft
+        ModelIds findByAirlineDesignator(const ModelIds &view, const QString &designator) const;
+
+        //! \copydoc CAircraftModelList::findByAirlineGroup
+        ModelIds findByAirlineGroup(const ModelIds &view, const Aviation::CAirlineIcaoCode &airline) const;
+
+        //! \copydoc CAircraftModelList::findByAircraftDesignatorAndLiveryCombinedCode
+        ModelIds findByAircraftDesignatorAndLiveryCombinedCode(const ModelIds &view, const QString &aircraftDesignator, const QString &combinedCode) const;
+
+        //! \copydoc CAircraftModelList::findByFamily
+        ModelIds findByFamily(const ModelIds &view, const QString &family) const;
+
+        //! \copydoc CAircraftModelList::findByManufacturer
+        ModelIds findByManufacturer(const ModelIds &view, const QString &manufacturer) const;
+
+        //! \copydoc CAircraftModelList::findByCombinedType
+        //! \remark combined types with wildcards are not indexed and searched in the view
+        ModelIds findByCombinedType(const ModelIds &view, const QString &combinedType) const;
+
+        //! \copydoc CAircraftModelList::findByCombinedAndManufacturer(const Aviation::CAircraftIcaoCode &) const
+        ModelIds findByCombinedAndManufacturer(const ModelIds &view, const Aviation::CAircraftIcaoCode &icao) const;
+
+        //! \copydoc CAircraftModelList::findByMilitaryFlag
+        ModelIds findByMilitaryFlag(const ModelIds &view, bool military) const;
+
+        //! \copydoc CAircraftModelList::findByVtolFlag
+        ModelIds findByVtolFlag(const ModelIds &view, bool vtol) const;
+
+        //! \copydoc CAircraftModelList::containsVtol
+        bool containsVtol(const ModelIds &view) const;
+
+        //! Ids of the view with models matching the predicate, view order is kept
+        template <class Predicate>
+        ModelIds findBy(const ModelIds &view, Predicate p) const
+        {
+            ModelIds ids;
+            for (int id : view)
+            {
+                if (p(this->model(id))) { ids.push_back(id); }
+            }
+            return ids;
+        }
+
+        //! Any model of the view matching the predicate?
+        template <class Predicate>
+        bool containsBy(const ModelIds &view, Predicate p) const
+        {
+            return std::any_of(view.cbegin(), view.cend(), [&](int id) { return p(this->model(id)); });
+        }
+
+        //! Ids of the view which are also in the (ascending) ids, view order is kept
+        static ModelIds intersection(const ModelIds &view, const ModelIds &sortedIds);
+
+        //! Ids of the view without the given ids, view order is kept
+        static ModelIds difference(const ModelIds &view, const ModelIds &ids);
+
+    private:
+        using Index = QHash<QString, ModelIds>;
+
+        //! Ids for key (ascending), empty if not found
+        static const ModelIds &lookup(const Index &index, const QString &key);
+
+        CAircraftModelList m_modelSet;
+        QHash<QString, int> m_byModelString; //!< upper case model string, first id
+        QHash<QString, int> m_byModelStringOrAlias; //!< upper case model string or alias, first id
+        Index m_byAircraftDesignator; //!< aircraft ICAO designator
+        Index m_byAirlineDesignator; //!< airline ICAO designator
+        Index m_byFamily; //!< aircraft family
+        Index m_byLiveryCombinedCode; //!< livery combined code
+        Index m_byCombinedType; //!< combined type such as "L2J"
+        Index m_byManufacturer; //!< manufacturer
+    };
+} // namespace
+
+#endif // guard
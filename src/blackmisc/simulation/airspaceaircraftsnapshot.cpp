@@ -4,9 +4,7 @@
 #include "blackmisc/aviation/callsign.h"
 #include "blackmisc/pq/physicalquantity.h"
 #include "blackmisc/simulation/airspaceaircraftsnapshot.h"
-#include "blackmisc/simulation/simulatedaircraft.h"
-
-#include <QThread>
+#include "blackmisc/simulation/airspaceaircraftsnapshotbuilder.h"
 
 using namespace BlackMisc::Aviation;
 using namespace BlackMisc::PhysicalQuantities;
@@ -21,67 +19,16 @@ namespace BlackMisc::Simulation
     CAirspaceAircraftSnapshot::CAirspaceAircraftSnapshot(
         const CSimulatedAircraftList &allAircraft,
         bool restricted, bool renderingEnabled, int maxAircraft,
-        const CLength &maxRenderedDistance) : m_timestampMsSinceEpoch(QDateTime::currentMSecsSinceEpoch()),
-                                              m_restricted(restricted),
-                                              m_renderingEnabled(renderingEnabled),
-                                              m_threadName(QThread::currentThread()->objectName())
+        const CLength &maxRenderedDistance)
     {
-        if (allAircraft.isEmpty()) { return; }
-
-        CSimulatedAircraftList aircraft(allAircraft);
-        aircraft.sortByDistanceToReferencePositionRenderedCallsign();
-        const int numberAll = aircraft.size();
-        Q_ASSERT_X(numberAll == allAircraft.size(), Q_FUNC_INFO, "aircraft got lost");
-        const CSimulatedAircraftList vtolAircraft(aircraft.findByVtol(true));
-        const int numberVtol = vtolAircraft.size();
-        m_aircraftCallsignsByDistance = aircraft.getCallsigns();
-        Q_ASSERT_X(m_aircraftCallsignsByDistance.size() == allAircraft.size(), Q_FUNC_INFO, "redundant or missing callsigns");
-        m_vtolAircraftCallsignsByDistance = vtolAircraft.getCallsigns();
-        Q_ASSERT_X(m_vtolAircraftCallsignsByDistance.size() == numberVtol, Q_FUNC_INFO, "redundant or missing callsigns");
-
-        // no restrictions, just find by attributes
-        if (!restricted)
-        {
-            m_enabledAircraftCallsignsByDistance = aircraft.findByEnabled(true).getCallsigns();
-            m_disabledAircraftCallsignsByDistance = aircraft.findByEnabled(false).getCallsigns();
-            int numberEnabled = m_enabledAircraftCallsignsByDistance.size();
-            int numberDisabled = m_disabledAircraftCallsignsByDistance.size();
-            Q_ASSERT_X(numberEnabled + numberDisabled == numberAll, Q_FUNC_INFO, "Mismatch in enabled/disabled/all");
-            m_enabledVtolAircraftCallsignsByDistance = vtolAircraft.findByEnabled(true).getCallsigns();
-            return;
-        }
-
-        // no rendering, this means all aircraft are disabled
-        if (!m_renderingEnabled)
-        {
-            m_disabledAircraftCallsignsByDistance = aircraft.getCallsigns();
-            return;
-        }
+        // a single snapshot, so no diff
+        CAirspaceAircraftSnapshotBuilder builder;
+        *this = builder.buildSnapshot(allAircraft, restricted, renderingEnabled, maxAircraft, maxRenderedDistance);
+    }
 
-        // restricted
-        int count = 0; // when max. aircraft reached?
-        for (const CSimulatedAircraft &currentAircraft : aircraft)
-        {
-            const CCallsign cs(currentAircraft.getCallsign());
-            if (currentAircraft.isEnabled())
-            {
-                CLength distance(currentAircraft.getRelativeDistance());
-                if (count >= maxAircraft || (!maxRenderedDistance.isNull() && distance >= maxRenderedDistance))
-                {
-                    m_disabledAircraftCallsignsByDistance.push_back(cs);
-                }
-                else
-                {
-                    count++;
-                    m_enabledAircraftCallsignsByDistance.push_back(cs);
-                    if (currentAircraft.isVtol()) { m_enabledVtolAircraftCallsignsByDistance.push_back(cs); }
-                }
-            }
-            else
-            {
-                m_disabledAircraftCallsignsByDistance.push_back(cs);
-            }
-        }
+    bool CAirspaceAircraftSnapshot::hasChanges() const
+    {
+        return !m_addedCallsigns.isEmpty() || !m_removedCallsigns.isEmpty() || !m_changedCallsigns.isEmpty();
     }
 
     bool CAirspaceAircraftSnapshot::isValidSnapshot() const
@@ -56,6 +56,22 @@ namespace BlackMisc::Simulation
         //! VTOL aircraft callsigns by distance, only enabled aircraft
         const BlackMisc::Aviation::CCallsignSet &getEnabledVtolAircraftCallsignsByDistance() const { return m_enabledVtolAircraftCallsignsByDistance; }
 
+        //! Callsigns which came into range since the previous snapshot
+        const BlackMisc::Aviation::CCallsignSet &getAddedCallsigns() const { return m_addedCallsigns; }
+
+        //! Callsigns which are no longer in range since the previous snapshot
+        const BlackMisc::Aviation::CCallsignSet &getRemovedCallsigns() const { return m_removedCallsigns; }
+
+        //! Callsigns still in range, but enabled/disabled in this snapshot
+        const BlackMisc::Aviation::CCallsignSet &getChangedCallsigns() const { return m_changedCallsigns; }
+
+        //! Added, removed and changed callsigns are relative to a previous snapshot?
+        //! \remark only snapshots from CAirspaceAircraftSnapshotBuilder have a diff
+        bool hasDiff() const { return m_hasDiff; }
+
+        //! Any added, removed or changed callsigns?
+        bool hasChanges() const;
+
         //! Valid snapshot?
         bool isValidSnapshot() const;
 
@@ -87,10 +103,13 @@ namespace BlackMisc::Simulation
         const QString &generatingThreadName() const { return m_threadName; }
 
     private:
+        friend class CAirspaceAircraftSnapshotBuilder;
+
         qint64 m_timestampMsSinceEpoch = -1;
         bool m_restricted = false;
         bool m_renderingEnabled = true;
         bool m_restrictionChanged = false;
+        bool m_hasDiff = false;
         QString m_threadName; //!< generating thread name for debugging purposes
 
         // remark closest aircraft always first
@@ -102,6 +121,11 @@ namespace BlackMisc::Simulation
         BlackMisc::Aviation::CCallsignSet m_vtolAircraftCallsignsByDistance;
         BlackMisc::Aviation::CCallsignSet m_enabledVtolAircraftCallsignsByDistance;
 
+        // diff to previous snapshot
+        BlackMisc::Aviation::CCallsignSet m_addedCallsigns;
+        BlackMisc::Aviation::CCallsignSet m_removedCallsigns;
+        BlackMisc::Aviation::CCallsignSet m_changedCallsigns;
+
         BLACK_METACLASS(
             CAirspaceAircraftSnapshot,
             BLACK_METAMEMBER(timestampMsSinceEpoch),
@@ -109,7 +133,10 @@ namespace BlackMisc::Simulation
             BLACK_METAMEMBER(enabledAircraftCallsignsByDistance, 0, DisabledForComparison),
             BLACK_METAMEMBER(disabledAircraftCallsignsByDistance, 0, DisabledForComparison),
             BLACK_METAMEMBER(vtolAircraftCallsignsByDistance, 0, DisabledForComparison),
-            BLACK_METAMEMBER(enabledVtolAircraftCallsignsByDistance, 0, DisabledForComparison)
+            BLACK_METAMEMBER(enabledVtolAircraftCallsignsByDistance, 0, DisabledForComparison),
+            BLACK_METAMEMBER(addedCallsigns, 0, DisabledForComparison),
+            BLACK_METAMEMBER(removedCallsigns, 0, DisabledForComparison),
+            BLACK_METAMEMBER(changedCallsigns, 0, DisabledForComparison)
         );
     };
 } // namespace
@@ -0,0 +1,132 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+#include "blackmisc/pq/units.h"
+#include "blackmisc/simulation/airspaceaircraftsnapshotbuilder.h"
+#include "blackmisc/simulation/simulatedaircraft.h"
+
+#include <QDateTime>
+#include <QThread>
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+using namespace BlackMisc::Aviation;
+using namespace BlackMisc::PhysicalQuantities;
+
+namespace BlackMisc::Simulation
+{
+    CAirspaceAircraftSnapshot CAirspaceAircraftSnapshotBuilder::buildSnapshot(
+        const CSimulatedAircraftList &aircraftInRange,
+        bool restricted, bool renderingEnabled, int maxAircraft,
+        const CLength &maxRenderedDistance)
+    {
+        CAirspaceAircraftSnapshot snapshot;
+        snapshot.m_timestampMsSinceEpoch = QDateTime::currentMSecsSinceEpoch();
+        snapshot.m_restricted = restricted;
+        snapshot.m_renderingEnabled = renderingEnabled;
+        snapshot.m_threadName = QThread::currentThread()->objectName();
+        snapshot.m_hasDiff = m_hasPreviousSnapshot;
+
+        // update the records, remember the added ones
+        m_records.reserve(aircraftInRange.size());
+        for (const CSimulatedAircraft &aircraft : aircraftInRange)
+        {
+            if (this->updateRecord(aircraft)) { snapshot.m_addedCallsigns.push_back(aircraft.getCallsign()); }
+        }
+
+        // records not updated are out of range
+        for (auto it = m_records.begin(); it != m_records.end();)
+        {
+            if (it->updated)
+            {
+                ++it;
+                continue;
+            }
+            snapshot.m_removedCallsigns.push_back(it.key());
+            it = m_records.erase(it);
+        }
+
+        // only records enabled in the restricted snapshot are selected by distance
+        std::vector<AircraftRecord *> candidates;
+        if (restricted && renderingEnabled)
+        {
+            const double maxDistanceM = maxRenderedDistance.isNull() ? std::numeric_limits<double>::max() : maxRenderedDistance.value(CLengthUnit::m());
+            candidates.reserve(static_cast<size_t>(m_records.size()));
+            for (AircraftRecord &record : m_records)
+            {
+                if (record.enabled && record.distanceM < maxDistanceM) { candidates.push_back(&record); }
+            }
+            const size_t maxCandidates = static_cast<size_t>(std::max(0, maxAircraft));
+            if (candidates.size() > maxCandidates)
+            {
+                // the sets are ordered by callsign, so the selected top N do not need to be sorted
+                std::nth_element(candidates.begin(), candidates.begin() + maxCandidates, candidates.end(), &CAirspaceAircraftSnapshotBuilder::isCloser);
+                candidates.resize(maxCandidates);
+            }
+        }
+        for (AircraftRecord *record : candidates) { record->selected = true; }
+
+        for (AircraftRecord &record : m_records)
+        {
+            bool enabledInSnapshot = false;
+            if (!restricted) { enabledInSnapshot = record.enabled; }
+            else if (renderingEnabled) { enabledInSnapshot = record.selected; }
+
+            const CCallsign &cs = record.callsign;
+            snapshot.m_aircraftCallsignsByDistance.push_back(cs);
+            if (record.vtol) { snapshot.m_vtolAircraftCallsignsByDistance.push_back(cs); }
+            if (enabledInSnapshot)
+            {
+                snapshot.m_enabledAircraftCallsignsByDistance.push_back(cs);
+                if (record.vtol) { snapshot.m_enabledVtolAircraftCallsignsByDistance.push_back(cs); }
+            }
+            else
+            {
+                snapshot.m_disabledAircraftCallsignsByDistance.push_back(cs);
+            }
+
+            const bool added = snapshot.m_addedCallsigns.contains(cs);
+            if (!added && record.enabledInSnapshot != enabledInSnapshot) { snapshot.m_changedCallsigns.push_back(cs); }
+            record.enabledInSnapshot = enabledInSnapshot;
+            record.selected = false;
+            record.updated = false;
+        }
+
+        Q_ASSERT_X(snapshot.m_aircraftCallsignsByDistance.size() == m_records.size(), Q_FUNC_INFO, "redundant or missing callsigns");
+        m_hasPreviousSnapshot = true;
+        return snapshot;
+    }
+
+    void CAirspaceAircraftSnapshotBuilder::clear()
+    {
+        m_records.clear();
+        m_hasPreviousSnapshot = false;
+    }
+
+    bool CAirspaceAircraftSnapshotBuilder::isCloser(const AircraftRecord *a, const AircraftRecord *b)
+    {
+        if (a->distanceM != b->distanceM) { return a->distanceM < b->distanceM; }
+        if (a->rendered != b->rendered) { return a->rendered; } // get the rendered first
+        return a->callsign.asString() < b->callsign.asString();
+    }
+
+    bool CAirspaceAircraftSnapshotBuilder::updateRecord(const CSimulatedAircraft &aircraft)
+    {
+        const CCallsign &cs = aircraft.getCallsign();
+        auto it = m_records.find(cs);
+        const bool added = (it == m_records.end());
+        if (added) { it = m_records.insert(cs, AircraftRecord()); }
+
+        AircraftRecord &record = *it;
+        Q_ASSERT_X(!record.updated, Q_FUNC_INFO, "redundant callsign");
+        const CLength &distance = aircraft.getRelativeDistance();
+        record.callsign = cs;
+        record.distanceM = distance.isNull() ? std::numeric_limits<double>::max() : distance.value(CLengthUnit::m());
+        record.enabled = aircraft.isEnabled();
+        record.vtol = aircraft.isVtol();
+        record.rendered = aircraft.isRendered();
+        record.updated = true;
+        return added;
+    }
+} // namespace
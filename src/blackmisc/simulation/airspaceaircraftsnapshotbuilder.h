@@ -0,0 +1,70 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#ifndef BLACKMISC_SIMULATION_AIRSPACEAIRCRAFTSNAPSHOTBUILDER_H
+#define BLACKMISC_SIMULATION_AIRSPACEAIRCRAFTSNAPSHOTBUILDER_H
+
+#include "blackmisc/aviation/callsign.h"
+#include "blackmisc/blackmiscexport.h"
+#include "blackmisc/pq/length.h"
+#include "blackmisc/simulation/airspaceaircraftsnapshot.h"
+#include "blackmisc/simulation/simulatedaircraftlist.h"
+
+#include <QHash>
+
+namespace BlackMisc::Simulation
+{
+    /*!
+     * Builds consecutive airspace snapshots from compact per callsign records.
+     *
+     * The records (distance, enabled, VTOL, rendered) are updated in place on every call,
+     * so only the few attributes needed are extracted from the aircraft and no aircraft list is copied or sorted.
+     * Only for a restricted snapshot the closest enabled aircraft are selected (partial sort of the top N).
+     * Each snapshot carries the diff against the previous one, see CAirspaceAircraftSnapshot::hasDiff
+     * \remark not thread safe, used from the airspace analyzer thread
+     */
+    class BLACKMISC_EXPORT CAirspaceAircraftSnapshotBuilder
+    {
+    public:
+        //! Compact record of an aircraft in range
+        struct AircraftRecord
+        {
+            Aviation::CCallsign callsign; //!< callsign
+            double distanceM = 0.0; //!< relative distance in meters, max. double if unknown
+            bool enabled = false; //!< aircraft enabled
+            bool vtol = false; //!< VTOL aircraft
+            bool rendered = false; //!< rendered in simulator
+            bool enabledInSnapshot = false; //!< enabled in the last snapshot (after restrictions)
+            bool selected = false; //!< selected as one of the closest aircraft in the current build
+            bool updated = false; //!< updated in the current build
+        };
+
+        //! Build the next snapshot from the aircraft in range, including the diff to the previous snapshot
+        CAirspaceAircraftSnapshot buildSnapshot(const CSimulatedAircraftList &aircraftInRange,
+                                                bool restricted = false,
+                                                bool renderingEnabled = true,
+                                                int maxAircraft = 100,
+                                                const PhysicalQuantities::CLength &maxRenderedDistance = { 0, nullptr });
+
+        //! Number of records
+        int getRecordCount() const { return m_records.size(); }
+
+        //! Forget all records, next snapshot has no diff
+        void clear();
+
+        //! Closer to reference position, same order as CSimulatedAircraftList::sortByDistanceToReferencePositionRenderedCallsign
+        static bool isCloser(const AircraftRecord *a, const AircraftRecord *b);
+
+    private:
+        //! Update the record of an aircraft
+        //! \return true if added
+        bool updateRecord(const CSimulatedAircraft &aircraft);
+
+        QHash<Aviation::CCallsign, AircraftRecord> m_records; //!< records by callsign
+        bool m_hasPreviousSnapshot = false; //!< diff possible
+    };
+} // namespace
+
+#endif // guard
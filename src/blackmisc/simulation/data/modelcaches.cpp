@@ -78,7 +78,7 @@ namespace BlackMisc::Simulation::Data
     bool IMultiSimulatorModelCaches::hasOtherVersionFile(const CApplicationInfo &info, const CSimulatorInfo &simulator) const
     {
         const QString fn = this->getFilename(simulator);
-        return CCacheSettingsUtils::hasOtherVersionCacheFile(info, fn);
+        return CCacheSettingsUtils::hasOtherVersionCacheFileAnyFormat(info, fn);
     }
 
     CSimulatorInfo IMultiSimulatorModelCaches::otherVersionSimulatorsWithFile(const CApplicationInfo &info) const
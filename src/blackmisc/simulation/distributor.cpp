@@ -3,6 +3,7 @@
 
 #include "blackmisc/logcategories.h"
 #include "blackmisc/simulation/distributor.h"
+#include "blackmisc/db/jsonkeys.h"
 #include "blackmisc/statusmessage.h"
 #include "blackmisc/stringutils.h"
 
@@ -122,6 +123,22 @@ namespace BlackMisc::Simulation
         return 0;
     }
 
+    CSortKey CDistributor::sortKeyByIndex(CPropertyIndexRef index) const
+    {
+        if (IDatastoreObjectWithStringKey::canHandleIndex(index)) { return IDatastoreObjectWithStringKey::sortKeyByIndex(index); }
+        if (IOrderable::canHandleIndex(index)) { return IOrderable::sortKeyByIndex(index); }
+
+        const ColumnIndex i = index.frontCasted<ColumnIndex>();
+        switch (i)
+        {
+        case IndexAlias1: return CSortKey(m_alias1, Qt::CaseInsensitive);
+        case IndexAlias2: return CSortKey(m_alias2, Qt::CaseInsensitive);
+        case IndexDescription: return CSortKey(m_description, Qt::CaseInsensitive);
+        default: break;
+        }
+        return {};
+    }
+
     QString CDistributor::convertToQString(bool i18n) const
     {
         Q_UNUSED(i18n)
@@ -162,6 +179,20 @@ namespace BlackMisc::Simulation
         if (!this->hasDescription()) { this->setDescription(otherDistributor.getDescription()); }
     }
 
+    namespace
+    {
+        //! JSON keys of CDistributor::fromDatabaseJson
+        struct DistributorJsonKeys
+        {
+            //! Keys with prefix
+            DistributorJsonKeys(const QString &prefix) : description(prefix % u"description"), alias1(prefix % u"alias1"), alias2(prefix % u"alias2") {}
+
+            QString description; //!< description
+            QString alias1; //!< alias 1
+            QString alias2; //!< alias 2
+        };
+    }
+
     CDistributor CDistributor::fromDatabaseJson(const QJsonObject &json, const QString &prefix)
     {
         if (!existsKey(json, prefix))
@@ -170,7 +201,8 @@ namespace BlackMisc::Simulation
             return CDistributor();
         }
 
-        const QString description(json.value(prefix % u"description").toString());
+        const DistributorJsonKeys &keys = Db::jsonKeys<DistributorJsonKeys>(prefix);
+        const QString description(json.value(keys.description).toString());
         if (description.isEmpty())
         {
             // stub, only key, maybe also timestamps
@@ -180,8 +212,8 @@ namespace BlackMisc::Simulation
         }
 
         const CSimulatorInfo simulator = CSimulatorInfo::fromDatabaseJson(json, prefix);
-        const QString alias1(json.value(prefix % u"alias1").toString());
-        const QString alias2(json.value(prefix % u"alias2").toString());
+        const QString alias1(json.value(keys.alias1).toString());
+        const QString alias2(json.value(keys.alias2).toString());
         Q_ASSERT_X(!description.isEmpty(), Q_FUNC_INFO, "Missing description");
         CDistributor distributor("", description, alias1, alias2, simulator);
         distributor.setKeyVersionTimestampFromDatabaseJson(json, prefix);
@@ -11,6 +11,7 @@
 #include "blackmisc/metaclass.h"
 #include "blackmisc/orderable.h"
 #include "blackmisc/propertyindexref.h"
+#include "blackmisc/sortkey.h"
 #include "blackmisc/statusmessagelist.h"
 #include "blackmisc/valueobject.h"
 #include "blackmisc/blackmiscexport.h"
@@ -104,6 +105,9 @@ namespace BlackMisc::Simulation
         //! \copydoc Mixin::Index::comparePropertyByIndex
         int comparePropertyByIndex(CPropertyIndexRef index, const CDistributor &compareValue) const;
 
+        //! Sort key, orders like comparePropertyByIndex, invalid for properties without key
+        CSortKey sortKeyByIndex(CPropertyIndexRef index) const;
+
         //! \copydoc BlackMisc::Mixin::String::toQString
         QString convertToQString(bool i18n = false) const;
 
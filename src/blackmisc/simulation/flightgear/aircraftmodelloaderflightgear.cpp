@@ -126,12 +126,12 @@ namespace BlackMisc::Simulation::Flightgear
             if (m_parserWorker && !m_parserWorker->isFinished()) { return; }
             emit this->diskLoadingStarted(simulator, mode);
 
-            m_parserWorker = CWorker::fromTask(this, "CAircraftModelLoaderFlightgear::performParsing",
-                                               [this, modelDirs, excludedDirectoryPatterns, modelConsolidation]() {
-                                                   auto models = this->performParsing(modelDirs, excludedDirectoryPatterns);
-                                                   if (modelConsolidation) { modelConsolidation(models, true); }
-                                                   return models;
-                                               });
+            m_parserWorker = CWorker::fromLongTask(this, "CAircraftModelLoaderFlightgear::performParsing",
+                                                   [this, modelDirs, excludedDirectoryPatterns, modelConsolidation]() {
+                                                       auto models = this->performParsing(modelDirs, excludedDirectoryPatterns);
+                                                       if (modelConsolidation) { modelConsolidation(models, true); }
+                                                       return models;
+                                                   });
             m_parserWorker->thenWithResult<CAircraftModelList>(this, [=](const auto &models) {
                 this->updateInstalledModels(models);
                 m_loadingMessages.freezeOrder();
@@ -66,18 +66,18 @@ namespace BlackMisc::Simulation::FsCommon
         {
             if (m_parserWorker && !m_parserWorker->isFinished()) { return; }
             emit this->diskLoadingStarted(simulator, mode);
-            m_parserWorker = CWorker::fromTask(this, "CAircraftCfgParser::startLoadingFromDisk",
-                                               [this, modelDirs, excludedDirectoryPatterns, simulator, modelConsolidation]() {
-                                                   CStatusMessageList msgs;
-                                                   const CAircraftCfgEntriesList aircraftCfgEntriesList = this->performParsing(modelDirs, excludedDirectoryPatterns, msgs);
-                                                   CAircraftModelList models;
-                                                   if (msgs.isSuccess())
-                                                   {
-                                                       models = aircraftCfgEntriesList.toAircraftModelList(simulator, true, msgs);
-                                                       if (modelConsolidation) { modelConsolidation(models, true); }
-                                                   }
-                                                   return std::make_tuple(aircraftCfgEntriesList, models, msgs);
-                                               });
+            m_parserWorker = CWorker::fromLongTask(this, "CAircraftCfgParser::startLoadingFromDisk",
+                                                   [this, modelDirs, excludedDirectoryPatterns, simulator, modelConsolidation]() {
+                                                       CStatusMessageList msgs;
+                                                       const CAircraftCfgEntriesList aircraftCfgEntriesList = this->performParsing(modelDirs, excludedDirectoryPatterns, msgs);
+                                                       CAircraftModelList models;
+                                                       if (msgs.isSuccess())
+                                                       {
+                                                           models = aircraftCfgEntriesList.toAircraftModelList(simulator, true, msgs);
+                                                           if (modelConsolidation) { modelConsolidation(models, true); }
+                                                       }
+                                                       return std::make_tuple(aircraftCfgEntriesList, models, msgs);
+                                                   });
             m_parserWorker->thenWithResult<LoaderResponse>(this, [this, simulator](const LoaderResponse &tuple) {
                 m_loadingMessages = std::get<2>(tuple);
                 if (m_loadingMessages.isSuccess())
@@ -173,7 +173,7 @@ namespace BlackMisc::Simulation::FsCommon
             if (m_asyncLoadInProgress || m_shutdown) { return nullptr; }
             m_asyncLoadInProgress = true;
         }
-        BlackMisc::CWorker *worker = BlackMisc::CWorker::fromTask(this, "CVPilotRulesReader", [this, convertToModels]() {
+        BlackMisc::CWorker *worker = BlackMisc::CWorker::fromLongTask(this, "CVPilotRulesReader", [this, convertToModels]() {
             this->read(convertToModels);
         });
         worker->then(this, &CVPilotRulesReader::ps_readInBackgroundFinished);
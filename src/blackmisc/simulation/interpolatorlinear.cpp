@@ -5,6 +5,7 @@
 #include "blackmisc/simulation/interpolatorfunctions.h"
 #include "blackmisc/aviation/aircraftsituationlist.h"
 #include "blackmisc/aviation/altitude.h"
+#include "blackmisc/aviation/compactaircraftsituation.h"
 #include "blackmisc/geo/coordinategeodetic.h"
 #include "blackmisc/pq/length.h"
 #include "blackmisc/pq/physicalquantity.h"
@@ -38,19 +39,58 @@ namespace BlackMisc::Simulation
     {}
 
     CInterpolatorLinear::CInterpolant::CInterpolant(const CAircraftSituation &oldSituation, const CAircraftSituation &newSituation, double timeFraction, qint64 interpolatedTime) : IInterpolant(interpolatedTime, 2),
-                                                                                                                                                                                    m_oldSituation(oldSituation), m_newSituation(newSituation),
-                                                                                                                                                                                    m_simulationTimeFraction(timeFraction)
+                                                                                                                                                                                 m_oldSituation(oldSituation), m_newSituation(newSituation),
+                                                                                                                                                                                 m_simulationTimeFraction(timeFraction)
     {
         m_pbh = CInterpolatorPbh(m_simulationTimeFraction, oldSituation, newSituation);
     }
 
+    const CompactAircraftSituation &CInterpolatorLinear::CInterpolant::getOldCompact() const
+    {
+        this->initCompacts();
+        return m_oldCompact;
+    }
+
+    const CompactAircraftSituation &CInterpolatorLinear::CInterpolant::getNewCompact() const
+    {
+        this->initCompacts();
+        return m_newCompact;
+    }
+
+    void CInterpolatorLinear::CInterpolant::reuseCompacts(const CInterpolant &other)
+    {
+        if (!other.m_hasCompacts || other.m_situationsAvailable != m_situationsAvailable) { return; }
+        m_oldCompact = other.m_oldCompact;
+        m_newCompact = other.m_newCompact;
+        m_hasCompacts = true;
+    }
+
+    void CInterpolatorLinear::CInterpolant::initCompacts() const
+    {
+        if (m_hasCompacts) { return; }
+        m_oldCompact = toCompactWithCorrectedAltitude(m_oldSituation);
+        m_newCompact = m_situationsAvailable < 2 ? m_oldCompact : toCompactWithCorrectedAltitude(m_newSituation);
+        m_hasCompacts = true;
+    }
+
+    CompactAircraftSituation CInterpolatorLinear::CInterpolant::toCompactWithCorrectedAltitude(const CAircraftSituation &situation)
+    {
+        CompactAircraftSituation compact = CompactAircraftSituation::fromSituation(situation);
+        const CAltitude corrected = situation.getCorrectedAltitude();
+        compact.altitudeM = corrected.isNull() ? CompactAircraftSituation::NullValue : corrected.value(CLengthUnit::m());
+        return compact;
+    }
+
     void CInterpolatorLinear::anchor()
     {}
 
     CAircraftSituation CInterpolatorLinear::CInterpolant::interpolatePositionAndAltitude(const CAircraftSituation &situation, bool interpolateGndFactor) const
     {
-        const std::array<double, 3> oldVec(m_oldSituation.getPosition().normalVectorDouble());
-        const std::array<double, 3> newVec(m_newSituation.getPosition().normalVectorDouble());
+        // plain double arithmetic on the compact copies, converted once per situation change
+        const CompactAircraftSituation &oldCompact = this->getOldCompact();
+        const CompactAircraftSituation &newCompact = this->getNewCompact();
+        const std::array<double, 3> &oldVec = oldCompact.normalVector;
+        const std::array<double, 3> &newVec = newCompact.normalVector;
 
         if (CBuildConfig::isLocalDeveloperDebugBuild())
         {
@@ -72,12 +112,14 @@ namespace BlackMisc::Simulation
         }
 
         // Interpolate altitude: Alt = (AltB - AltA) * t + AltA
-        // avoid underflow below ground elevation by using getCorrectedAltitude
-        const CAltitude oldAlt(m_oldSituation.getCorrectedAltitude());
-        const CAltitude newAlt(m_newSituation.getCorrectedAltitude());
-        Q_ASSERT_X(oldAlt.getReferenceDatum() == CAltitude::MeanSeaLevel && oldAlt.getReferenceDatum() == newAlt.getReferenceDatum(), Q_FUNC_INFO, "mismatch in reference"); // otherwise no calculation is possible
-        const CAltitude altitude((newAlt - oldAlt) * tf + oldAlt,
-                                 oldAlt.getReferenceDatum());
+        // avoid underflow below ground elevation by using the corrected altitudes of the compact copies
+        Q_ASSERT_X(oldCompact.altitudeDatum == CAltitude::MeanSeaLevel && oldCompact.altitudeDatum == newCompact.altitudeDatum, Q_FUNC_INFO, "mismatch in reference"); // otherwise no calculation is possible
+        CAltitude altitude;
+        if (!CompactAircraftSituation::isNull(oldCompact.altitudeM) && !CompactAircraftSituation::isNull(newCompact.altitudeM))
+        {
+            const double altitudeM = (newCompact.altitudeM - oldCompact.altitudeM) * tf + oldCompact.altitudeM;
+            altitude = CAltitude(altitudeM, CAltitude::MeanSeaLevel, CLengthUnit::m()).switchedUnit(m_newSituation.getAltitude().getUnit());
+        }
 
         CAircraftSituation newSituation(situation);
         newSituation.setPosition(newPosition);
@@ -86,8 +128,8 @@ namespace BlackMisc::Simulation
 
         if (interpolateGndFactor)
         {
-            const double oldGroundFactor = m_oldSituation.getOnGroundFactor();
-            const double newGroundFactor = m_newSituation.getOnGroundFactor();
+            const double oldGroundFactor = oldCompact.onGroundFactor;
+            const double newGroundFactor = newCompact.onGroundFactor;
             do
             {
                 if (CAircraftSituation::isGfEqualAirborne(oldGroundFactor, newGroundFactor))
@@ -225,7 +267,9 @@ namespace BlackMisc::Simulation
             log.interpolantRecalc = recalculate;
         }
 
-        m_interpolant = { oldSituation, newSituation, simulationTimeFraction, interpolatedTime };
+        CInterpolant interpolant(oldSituation, newSituation, simulationTimeFraction, interpolatedTime);
+        if (!recalculate) { interpolant.reuseCompacts(m_interpolant); } // same situations, compact copies are still valid
+        m_interpolant = interpolant;
         m_interpolant.setRecalculated(recalculate);
 
         return m_interpolant;
@@ -10,6 +10,7 @@
 #include "blackmisc/simulation/interpolationlogger.h"
 #include "blackmisc/simulation/interpolant.h"
 #include "blackmisc/aviation/aircraftsituation.h"
+#include "blackmisc/aviation/compactaircraftsituation.h"
 #include "blackmisc/blackmiscexport.h"
 #include <QString>
 #include <QtGlobal>
@@ -48,6 +49,8 @@ namespace BlackMisc
                 //! @}
 
                 //! Perform the interpolation
+                //! \remark plain double arithmetic on the compact copies of the situations, which are created on first use
+                //!         and taken over by the next interpolant as long as the situations do not change
                 Aviation::CAircraftSituation interpolatePositionAndAltitude(const Aviation::CAircraftSituation &situation, bool interpolateGndFactor) const;
 
                 //! Old situation
@@ -56,9 +59,27 @@ namespace BlackMisc
                 //! New situation
                 const Aviation::CAircraftSituation &getNewSituation() const { return m_newSituation; }
 
+                //! Compact old situation, altitude already corrected
+                const Aviation::CompactAircraftSituation &getOldCompact() const;
+
+                //! Compact new situation, altitude already corrected
+                const Aviation::CompactAircraftSituation &getNewCompact() const;
+
+                //! Take over the compact copies of an interpolant with the same situations
+                void reuseCompacts(const CInterpolant &other);
+
+                //! Compact representation with the corrected altitude as used for interpolation
+                static Aviation::CompactAircraftSituation toCompactWithCorrectedAltitude(const Aviation::CAircraftSituation &situation);
+
             private:
+                //! Create the compact copies if not yet done
+                void initCompacts() const;
+
                 Aviation::CAircraftSituation m_oldSituation;
                 Aviation::CAircraftSituation m_newSituation;
+                mutable Aviation::CompactAircraftSituation m_oldCompact; //!< created on first use
+                mutable Aviation::CompactAircraftSituation m_newCompact; //!< created on first use
+                mutable bool m_hasCompacts = false; //!< compact copies created?
                 double m_simulationTimeFraction = 0.0; //!< 0..1
             };
 
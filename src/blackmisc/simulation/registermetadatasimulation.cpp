@@ -16,6 +16,7 @@
 #include "blackmisc/simulation/reverselookup.h"
 #include "blackmisc/simulation/simulatedaircraft.h"
 #include "blackmisc/simulation/simulatedaircraftlist.h"
+#include "blackmisc/simulation/simulatedaircraftlistdelta.h"
 #include "blackmisc/simulation/simulatorinfolist.h"
 #include "blackmisc/simulation/simulatorinternals.h"
 #include "blackmisc/simulation/simulatorplugininfo.h"
@@ -57,6 +58,7 @@ namespace BlackMisc::Simulation
         CSimConnectUtilities::registerMetadata();
         CSimulatedAircraft::registerMetadata();
         CSimulatedAircraftList::registerMetadata();
+        CSimulatedAircraftListDelta::registerMetadata();
         CSimulatorInfo::registerMetadata();
         CSimulatorInfoList::registerMetadata();
         CSimulatorInternals::registerMetadata();
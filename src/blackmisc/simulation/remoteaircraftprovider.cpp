@@ -17,6 +17,100 @@ using namespace BlackConfig;
 
 namespace BlackMisc::Simulation
 {
+    namespace
+    {
+        //! Latest first list copied from the history
+        template <class LIST, class T>
+        LIST toLatestFirstList(const CRingSequence<T> &history)
+        {
+            LIST list = history.template toSequence<LIST>();
+            list.setAdjustedSortHint(LIST::AdjustedTimestampLatestFirst);
+            return list;
+        }
+
+        //! Insert latest first, a value with the same timestamp as the latest value replaces it
+        //! \remark like ITimestampObjectList::push_frontKeepLatestFirst, but out of order values are inserted at their position
+        template <class T>
+        void pushFrontKeepLatestFirst(CRingSequence<T> &history, const T &value, bool adjustedTimestamp)
+        {
+            if (!history.isEmpty() && history.front().getMSecsSinceEpoch() == value.getMSecsSinceEpoch())
+            {
+                history.front() = value;
+                return;
+            }
+
+            int index = 0;
+            while (index < history.size() && (adjustedTimestamp ? value.isOlderThanAdjusted(history[index]) : value.isOlderThan(history[index]))) { index++; }
+            history.insert(index, value);
+        }
+
+        //! Insert latest first and adjust the offset so the adjusted timestamps are sorted as well
+        //! \remark like ITimestampWithOffsetObjectList::push_frontKeepLatestFirstAdjustOffset
+        template <class T>
+        void pushFrontKeepLatestFirstAdjustOffset(CRingSequence<T> &history, const T &value)
+        {
+            pushFrontKeepLatestFirst(history, value, false);
+            if (history.size() < 2) { return; }
+            T &front = history.front();
+            const T &second = history[1];
+            if (!front.isNewerThanAdjusted(second))
+            {
+                const qint64 minReqOs = second.getAdjustedMSecsSinceEpoch() - front.getMSecsSinceEpoch(); // minimal required
+                const qint64 avgOs = (front.getTimeOffsetMs() + second.getTimeOffsetMs()) / 2;
+                front.setTimeOffsetMs(qMax(minReqOs + 1, avgOs)); // at least +1, as value must be > (greater)
+            }
+        }
+
+        //! Adjusted timestamps sorted latest first?
+        //! \remark like ITimestampWithOffsetObjectList::isSortedAdjustedLatestFirst, without copying the history
+        template <class T>
+        bool isSortedAdjustedLatestFirst(const CRingSequence<T> &history)
+        {
+            for (int i = 0; i < history.size(); ++i)
+            {
+                if (!history[i].hasValidTimestamp()) { return history.size() < 2; }
+                if (i > 0 && history[i].getAdjustedMSecsSinceEpoch() > history[i - 1].getAdjustedMSecsSinceEpoch()) { return false; }
+            }
+            return true;
+        }
+
+        //! Fill the history with the value and older copies of it
+        //! \remark like ITimestampWithOffsetObjectList::prefillLatestAdjustedFirst
+        void prefillLatestAdjustedFirst(CAircraftSituationRing &history, const CAircraftSituation &value)
+        {
+            history.clear();
+            const qint64 os = -1 * qAbs(value.getTimeOffsetMs());
+            for (int i = history.capacity() - 1; i > 0; --i)
+            {
+                CAircraftSituation copy(value);
+                copy.addMsecs(os * i);
+                history.push_front(copy);
+            }
+            history.push_front(value);
+        }
+
+        //! Transfer ground elevations to the newer situations
+        //! \remark like CAircraftSituationList::transferElevationForward
+        int transferElevationForward(CAircraftSituationRing &history)
+        {
+            int c = 0;
+            for (int i = 1; i < history.size(); ++i)
+            {
+                if (history[i].transferGroundElevationFromMe(history[i - 1], CElevationPlane::singlePointRadius())) { c++; }
+            }
+            return c;
+        }
+
+        //! Remove outdated parts, but keep at least one
+        //! \remark like IRemoteAircraftProvider::removeOutdatedParts
+        void removeOutdatedPartsFromHistory(CAircraftPartsRing &history)
+        {
+            if (history.isEmpty()) { return; }
+            const qint64 ts = history.front().getMSecsSinceEpoch() - IRemoteAircraftProvider::MaxPartsAgePerCallsignSecs * 1000;
+            while (history.size() > 1 && history.back().getMSecsSinceEpoch() < ts) { history.pop_back(); }
+        }
+    }
+
     IRemoteAircraftProvider::IRemoteAircraftProvider()
     {}
 
@@ -65,9 +159,14 @@ namespace BlackMisc::Simulation
     CAircraftSituationList CRemoteAircraftProvider::remoteAircraftSituations(const CCallsign &callsign) const
     {
         static const CAircraftSituationList empty;
+        const CAircraftSituationListSnapshot situations = this->remoteAircraftSituationsSnapshot(callsign);
+        return situations ? *situations : empty; // implicitly shared, no deep copy
+    }
+
+    CAircraftSituationListSnapshot CRemoteAircraftProvider::remoteAircraftSituationsSnapshot(const CCallsign &callsign) const
+    {
         QReadLocker l(&m_lockSituations);
-        if (!m_situationsByCallsign.contains(callsign)) { return empty; }
-        return m_situationsByCallsign[callsign];
+        return m_situationsByCallsign.value(callsign);
     }
 
     CAircraftSituation CRemoteAircraftProvider::remoteAircraftSituation(const CCallsign &callsign, int index) const
@@ -101,24 +200,26 @@ namespace BlackMisc::Simulation
 
     int CRemoteAircraftProvider::remoteAircraftSituationsCount(const CCallsign &callsign) const
     {
-        QReadLocker l(&m_lockSituations);
-        if (!m_situationsByCallsign.contains(callsign)) { return -1; }
-        return m_situationsByCallsign[callsign].size();
+        const CAircraftSituationListSnapshot situations = this->remoteAircraftSituationsSnapshot(callsign);
+        return situations ? situations->size() : -1;
     }
 
     CAircraftPartsList CRemoteAircraftProvider::remoteAircraftParts(const CCallsign &callsign) const
     {
         static const CAircraftPartsList empty;
         QReadLocker l(&m_lockParts);
-        if (!m_partsByCallsign.contains(callsign)) { return empty; }
-        return m_partsByCallsign[callsign];
+        const auto history = m_partsByCallsign.constFind(callsign);
+        if (history == m_partsByCallsign.constEnd()) { return empty; }
+
+        // copied under the lock, sharing the ring storage would make the next write detach
+        return toLatestFirstList<CAircraftPartsList>(history.value());
     }
 
     int CRemoteAircraftProvider::remoteAircraftPartsCount(const CCallsign &callsign) const
     {
         QReadLocker l(&m_lockParts);
-        if (!m_partsByCallsign.contains(callsign)) { return -1; }
-        return m_partsByCallsign[callsign].size();
+        const auto history = m_partsByCallsign.constFind(callsign);
+        return history == m_partsByCallsign.constEnd() ? -1 : history->size();
     }
 
     bool CRemoteAircraftProvider::isRemoteAircraftSupportingParts(const CCallsign &callsign) const
@@ -142,13 +243,16 @@ namespace BlackMisc::Simulation
     CAircraftSituationChangeList CRemoteAircraftProvider::remoteAircraftSituationChanges(const CCallsign &callsign) const
     {
         QReadLocker l(&m_lockChanges);
-        return m_changesByCallsign[callsign];
+        const auto history = m_changesByCallsign.constFind(callsign);
+        if (history == m_changesByCallsign.constEnd()) { return {}; }
+        return toLatestFirstList<CAircraftSituationChangeList>(history.value());
     }
 
     int CRemoteAircraftProvider::remoteAircraftSituationChangesCount(const CCallsign &callsign) const
     {
         QReadLocker l(&m_lockChanges);
-        return m_changesByCallsign[callsign].size();
+        const auto history = m_changesByCallsign.constFind(callsign);
+        return history == m_changesByCallsign.constEnd() ? 0 : history->size();
     }
 
     int CRemoteAircraftProvider::getAircraftInRangeCount() const
@@ -172,6 +276,7 @@ namespace BlackMisc::Simulation
         {
             QWriteLocker l(&m_lockSituations);
             m_situationsByCallsign.clear();
+            m_situationHistoryByCallsign.clear();
             m_latestSituationByCallsign.clear();
             m_latestOnGroundProviderElevation.clear();
             m_situationsAdded = 0;
@@ -244,8 +349,9 @@ namespace BlackMisc::Simulation
         Q_ASSERT_X(!callsign.isEmpty(), Q_FUNC_INFO, "Missing callsign");
         {
             QWriteLocker l(&m_lockAircraft);
-            if (!m_aircraftInRange.contains(callsign)) { return false; }
-            CSimulatedAircraft &aircraft = m_aircraftInRange[callsign];
+            const auto it = m_aircraftInRange.find(callsign);
+            if (it == m_aircraftInRange.end()) { return false; }
+            CSimulatedAircraft &aircraft = it.value();
             aircraft.setSituation(situation);
             if (!bearing.isNull()) { aircraft.setRelativeBearing(bearing); }
             if (!distance.isNull()) { aircraft.setRelativeDistance(distance); }
@@ -253,6 +359,30 @@ namespace BlackMisc::Simulation
         return true;
     }
 
+    bool CRemoteAircraftProvider::updateAircraftKinematics(const CCallsign &callsign, const CAircraftSituation &situation, const CTransponder &transponder, const CLength &distance, const CAngle &bearing)
+    {
+        Q_ASSERT_X(!callsign.isEmpty(), Q_FUNC_INFO, "Missing callsign");
+        {
+            QWriteLocker l(&m_lockAircraft);
+            const auto it = m_aircraftInRange.find(callsign);
+            if (it == m_aircraftInRange.end()) { return false; }
+            CSimulatedAircraft &aircraft = it.value();
+            bool changed = false;
+
+            // setSituation keeps the velocity if the new situation has none, compare the situation as it would be stored
+            CAircraftSituation stored(situation);
+            if (stored.getVelocity() == CAircraftVelocity {}) { stored.setVelocity(aircraft.getSituation().getVelocity()); }
+            stored.setCallsign(aircraft.getCallsign());
+            if (aircraft.getSituation() != stored) { aircraft.setSituation(situation); changed = true; }
+            if (aircraft.getTransponder() != transponder) { aircraft.setTransponder(transponder); changed = true; }
+            if (aircraft.getRelativeDistance() != distance) { aircraft.setRelativeDistance(distance); changed = true; }
+            if (aircraft.getRelativeBearing() != bearing) { aircraft.setRelativeBearing(bearing); changed = true; }
+            if (!changed) { return false; }
+        }
+        emit this->changedAircraftInRange();
+        return true;
+    }
+
     CAircraftSituation CRemoteAircraftProvider::storeAircraftSituation(const CAircraftSituation &situation, bool allowTestAltitudeOffset)
     {
         const CCallsign cs = situation.getCallsign();
@@ -278,43 +408,33 @@ namespace BlackMisc::Simulation
         // list from new to old
         CAircraftSituationList updatedSituations; // copy of updated situations
         {
+            // the history is modified in place, readers use the published snapshot and are not blocked meanwhile
             const qint64 now = QDateTime::currentMSecsSinceEpoch();
-            QWriteLocker lock(&m_lockSituations);
-            m_situationsAdded++;
-            m_situationsLastModified[cs] = now;
-            CAircraftSituationList &newSituationsList = m_situationsByCallsign[cs];
-            newSituationsList.setAdjustedSortHint(CAircraftSituationList::AdjustedTimestampLatestFirst);
-            const int situations = newSituationsList.size();
-            if (situations < 1)
+            QMutexLocker writeLock(&this->situationsWriteLock(cs));
+            const std::shared_ptr<CAircraftSituationRing> history = this->situationHistory(cs, true);
+            CAircraftSituationRing &situations = *history;
+            if (situations.isEmpty())
             {
-                newSituationsList.prefillLatestAdjustedFirst(situationCorrected, IRemoteAircraftProvider::MaxSituationsPerCallsign);
+                prefillLatestAdjustedFirst(situations, situationCorrected);
             }
-            else if (!situationCorrected.hasVelocity() && newSituationsList.front().hasVelocity())
+            else if (!situationCorrected.hasVelocity() && situations.front().hasVelocity())
             {
+                QWriteLocker lock(&m_lockSituations);
+                m_situationsAdded++;
+                m_situationsLastModified[cs] = now;
                 return situationCorrected;
             }
             else
             {
-                // newSituationsList.push_frontKeepLatestFirstIgnoreOverlapping(situationCorrected, true, IRemoteAircraftProvider::MaxSituationsPerCallsign);
-                newSituationsList.push_frontKeepLatestFirstAdjustOffset(situationCorrected, true, IRemoteAircraftProvider::MaxSituationsPerCallsign);
-                newSituationsList.setAdjustedSortHint(CAircraftSituationList::AdjustedTimestampLatestFirst);
-                newSituationsList.transferElevationForward(); // transfer elevations, will do nothing if elevations already exist
+                pushFrontKeepLatestFirstAdjustOffset(situations, situationCorrected); // O(1), the oldest situation is overwritten
+                transferElevationForward(situations); // transfer elevations, will do nothing if elevations already exist
 
                 // unify all inbound ground information
                 if (situation.hasInboundGroundDetails())
                 {
-                    newSituationsList.setOnGroundDetails(situation.getOnGroundDetails());
+                    for (CAircraftSituation &s : situations) { s.setOnGroundDetails(situation.getOnGroundDetails()); }
                 }
             }
-            m_latestSituationByCallsign[cs] = situationCorrected;
-
-            // check sort order
-            if (CBuildConfig::isLocalDeveloperDebugBuild())
-            {
-                BLACK_VERIFY_X(newSituationsList.isSortedAdjustedLatestFirstWithoutNullPositions(), Q_FUNC_INFO, "wrong adjusted sort order");
-                BLACK_VERIFY_X(newSituationsList.isSortedLatestFirst(), Q_FUNC_INFO, "wrong sort order");
-                BLACK_VERIFY_X(newSituationsList.size() <= IRemoteAircraftProvider::MaxSituationsPerCallsign, Q_FUNC_INFO, "Wrong size");
-            }
 
             if (!situation.hasInboundGroundDetails())
             {
@@ -322,10 +442,25 @@ namespace BlackMisc::Simulation
                 const CAircraftSituationChange simpleChange(updatedSituations, situationCorrected.getCG(), aircraftModel.isVtol(), true, false);
 
                 // guess GND
-                simpleChange.guessOnGround(newSituationsList.front(), aircraftModel);
+                simpleChange.guessOnGround(situations.front(), aircraftModel);
+            }
+
+            // published as list, readers never access the history
+            CAircraftSituationList newSituationsList = toLatestFirstList<CAircraftSituationList>(situations);
+
+            // check sort order
+            if (CBuildConfig::isLocalDeveloperDebugBuild())
+            {
+                BLACK_VERIFY_X(newSituationsList.isSortedAdjustedLatestFirstWithoutNullPositions(), Q_FUNC_INFO, "wrong adjusted sort order");
+                BLACK_VERIFY_X(newSituationsList.isSortedLatestFirst(), Q_FUNC_INFO, "wrong sort order");
+                BLACK_VERIFY_X(newSituationsList.size() <= IRemoteAircraftProvider::MaxSituationsPerCallsign, Q_FUNC_INFO, "Wrong size");
             }
-            updatedSituations = m_situationsByCallsign[cs];
+            updatedSituations = newSituationsList;
+            this->publishSituations(cs, std::move(newSituationsList), now);
 
+            QWriteLocker lock(&m_lockSituations);
+            m_situationsAdded++;
+            m_latestSituationByCallsign[cs] = situationCorrected;
         } // lock
 
         // calculate change AFTER gnd. was guessed
@@ -338,9 +473,13 @@ namespace BlackMisc::Simulation
             const CLength offset = change.getGuessedSceneryDeviation();
             situationCorrected.setSceneryOffset(offset);
 
+            this->modifySituations(cs, [&offset](CAircraftSituationList &situations) {
+                situations.front().setSceneryOffset(offset);
+                return 1;
+            });
+
             QWriteLocker lock(&m_lockSituations);
             m_latestSituationByCallsign[cs].setSceneryOffset(offset);
-            m_situationsByCallsign[cs].front().setSceneryOffset(offset);
         }
 
         // situation has been added
@@ -357,32 +496,26 @@ namespace BlackMisc::Simulation
 
         // list sorted from new to old
         const qint64 ts = QDateTime::currentMSecsSinceEpoch();
-        CAircraftPartsList correctiveParts;
         {
             QWriteLocker lock(&m_lockParts);
             m_partsAdded++;
             m_partsLastModified[callsign] = ts;
-            CAircraftPartsList &partsList = m_partsByCallsign[callsign];
-            partsList.push_frontKeepLatestFirstAdjustOffset(parts, true, IRemoteAircraftProvider::MaxPartsPerCallsign);
-            partsList.setAdjustedSortHint(CAircraftPartsList::AdjustedTimestampLatestFirst);
+            auto history = m_partsByCallsign.find(callsign);
+            if (history == m_partsByCallsign.end()) { history = m_partsByCallsign.insert(callsign, CAircraftPartsRing(IRemoteAircraftProvider::MaxPartsPerCallsign)); }
+            CAircraftPartsRing &partsHistory = history.value();
+            pushFrontKeepLatestFirstAdjustOffset(partsHistory, parts);
 
             // remove outdated parts (but never remove the most recent one)
-            if (removeOutdated) { IRemoteAircraftProvider::removeOutdatedParts(partsList); }
-            correctiveParts = partsList;
+            if (removeOutdated) { removeOutdatedPartsFromHistory(partsHistory); }
 
             // check sort order
-            Q_ASSERT_X(partsList.isSortedAdjustedLatestFirst(), Q_FUNC_INFO, "wrong sort order");
-            Q_ASSERT_X(partsList.size() <= IRemoteAircraftProvider::MaxPartsPerCallsign, Q_FUNC_INFO, "Wrong size");
+            Q_ASSERT_X(isSortedAdjustedLatestFirst(partsHistory), Q_FUNC_INFO, "wrong sort order");
         } // lock
 
         // adjust gnd.flag from parts
-        if (!correctiveParts.isEmpty())
-        {
-            QWriteLocker lock(&m_lockSituations);
-            CAircraftSituationList &situationList = m_situationsByCallsign[callsign];
-            const int c = situationList.adjustGroundFlag(parts);
-            if (c > 0) { m_situationsLastModified[callsign] = ts; }
-        }
+        this->modifySituations(callsign, [&parts](CAircraftSituationList &situations) {
+            return situations.adjustGroundFlag(parts);
+        }, ts);
 
         // update aircraft
         {
@@ -497,8 +630,9 @@ namespace BlackMisc::Simulation
         // a change with the same timestamp will be replaced
         const CCallsign cs(change.getCallsign());
         QWriteLocker lock(&m_lockChanges);
-        CAircraftSituationChangeList &changeList = m_changesByCallsign[cs];
-        changeList.push_frontKeepLatestAdjustedFirst(change, true, IRemoteAircraftProvider::MaxSituationsPerCallsign);
+        auto history = m_changesByCallsign.find(cs);
+        if (history == m_changesByCallsign.end()) { history = m_changesByCallsign.insert(cs, CAircraftSituationChangeRing(IRemoteAircraftProvider::MaxSituationsPerCallsign)); }
+        pushFrontKeepLatestFirst(history.value(), change, true);
     }
 
     bool CRemoteAircraftProvider::guessOnGroundAndUpdateModelCG(CAircraftSituation &situation, const CAircraftSituationChange &change, const CAircraftModel &aircraftModel)
@@ -586,19 +720,17 @@ namespace BlackMisc::Simulation
         CAircraftSituationChange change;
         bool setForOnGndPosition = false;
 
-        int updated = 0;
+        CAircraftSituation latestSituation;
+        const int updated = this->modifySituations(callsign, [&](CAircraftSituationList &situations) {
+            const int c = setGroundElevationCheckedAndGuessGround(situations, elevation, info, model, &change, &setForOnGndPosition);
+            latestSituation = situations.front();
+            return c;
+        }, now);
+        if (updated < 1) { return 0; }
+        if (info == CAircraftSituation::FromProvider && latestSituation.isOnGround())
         {
             QWriteLocker l(&m_lockSituations);
-            CAircraftSituationList &situations = m_situationsByCallsign[callsign];
-            if (situations.isEmpty()) { return 0; }
-            updated = setGroundElevationCheckedAndGuessGround(situations, elevation, info, model, &change, &setForOnGndPosition);
-            if (updated < 1) { return 0; }
-            m_situationsLastModified[callsign] = now;
-            const CAircraftSituation latestSituation = situations.front();
-            if (info == CAircraftSituation::FromProvider && latestSituation.isOnGround())
-            {
-                m_latestOnGroundProviderElevation[callsign] = latestSituation;
-            }
+            m_latestOnGroundProviderElevation[callsign] = latestSituation;
         }
 
         // update change
@@ -849,6 +981,53 @@ namespace BlackMisc::Simulation
         return m_situationsLastModified.value(callsign, -1);
     }
 
+    void CRemoteAircraftProvider::publishSituations(const CCallsign &callsign, CAircraftSituationList &&situations, qint64 modifiedTs)
+    {
+        // allocate outside the lock
+        const CAircraftSituationListSnapshot snapshot = std::make_shared<const CAircraftSituationList>(std::move(situations));
+        QWriteLocker l(&m_lockSituations);
+        m_situationsByCallsign.insert(callsign, snapshot);
+        if (modifiedTs >= 0) { m_situationsLastModified[callsign] = modifiedTs; }
+    }
+
+    int CRemoteAircraftProvider::modifySituations(const CCallsign &callsign, const std::function<int(CAircraftSituationList &)> &modifier, qint64 modifiedTs)
+    {
+        QMutexLocker writeLock(&this->situationsWriteLock(callsign));
+        const std::shared_ptr<CAircraftSituationRing> history = this->situationHistory(callsign, false);
+        if (!history || history->isEmpty()) { return 0; }
+
+        CAircraftSituationList situations = toLatestFirstList<CAircraftSituationList>(*history);
+        const int changed = modifier(situations);
+        if (changed < 1) { return 0; }
+
+        // modifiers change situations, but not their number or order
+        Q_ASSERT_X(situations.size() == history->size(), Q_FUNC_INFO, "Wrong size");
+        for (int i = 0; i < situations.size(); ++i) { (*history)[i] = situations[i]; }
+        this->publishSituations(callsign, std::move(situations), modifiedTs);
+        return changed;
+    }
+
+    std::shared_ptr<CAircraftSituationRing> CRemoteAircraftProvider::situationHistory(const CCallsign &callsign, bool create)
+    {
+        {
+            QReadLocker l(&m_lockSituations);
+            const auto history = m_situationHistoryByCallsign.constFind(callsign);
+            if (history != m_situationHistoryByCallsign.constEnd()) { return history.value(); }
+        }
+        if (!create) { return {}; }
+
+        // only the writer holding the write lock of the callsign creates its history
+        const auto history = std::make_shared<CAircraftSituationRing>(IRemoteAircraftProvider::MaxSituationsPerCallsign);
+        QWriteLocker l(&m_lockSituations);
+        m_situationHistoryByCallsign.insert(callsign, history);
+        return history;
+    }
+
+    QMutex &CRemoteAircraftProvider::situationsWriteLock(const CCallsign &callsign) const
+    {
+        return m_lockSituationsWrite[qHash(callsign) % SituationsWriteLocks];
+    }
+
     qint64 CRemoteAircraftProvider::partsLastModified(const CCallsign &callsign) const
     {
         QReadLocker l(&m_lockParts);
@@ -928,6 +1107,7 @@ namespace BlackMisc::Simulation
         {
             QWriteLocker l2(&m_lockSituations);
             m_situationsByCallsign.remove(callsign);
+            m_situationHistoryByCallsign.remove(callsign);
             m_latestSituationByCallsign.remove(callsign);
             m_latestOnGroundProviderElevation.remove(callsign);
             m_situationsLastModified.remove(callsign);
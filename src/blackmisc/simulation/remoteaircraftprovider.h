@@ -16,6 +16,7 @@
 #include "blackmisc/aviation/percallsign.h"
 #include "blackmisc/aviation/callsignset.h"
 #include "blackmisc/provider.h"
+#include "blackmisc/ringsequence.h"
 #include "blackmisc/blackmiscexport.h"
 #include "blackmisc/identifiable.h"
 
@@ -26,7 +27,10 @@
 #include <QJsonObject>
 #include <QtGlobal>
 #include <QReadWriteLock>
+#include <QMutex>
+#include <array>
 #include <functional>
+#include <memory>
 
 namespace BlackMisc
 {
@@ -283,6 +287,18 @@ Q_DECLARE_INTERFACE(BlackMisc::Simulation::IRemoteAircraftProvider, "org.swift-p
 
 namespace BlackMisc::Simulation
 {
+    //! Immutable snapshot of the situations of one aircraft, latest first
+    using CAircraftSituationListSnapshot = std::shared_ptr<const Aviation::CAircraftSituationList>;
+
+    //! Situation history of one aircraft, latest adjusted first
+    using CAircraftSituationRing = CRingSequence<Aviation::CAircraftSituation>;
+
+    //! Parts history of one aircraft, latest first
+    using CAircraftPartsRing = CRingSequence<Aviation::CAircraftParts>;
+
+    //! Change history of one aircraft, latest adjusted first
+    using CAircraftSituationChangeRing = CRingSequence<Aviation::CAircraftSituationChange>;
+
     //! Implementaion of the interface, which can also be used for testing
     class BLACKMISC_EXPORT CRemoteAircraftProvider :
         public QObject,
@@ -356,6 +372,11 @@ namespace BlackMisc::Simulation
         virtual ReverseLookupLogging isReverseLookupMessagesEnabled() const override;
         virtual BlackMisc::CStatusMessageList getReverseLookupMessages(const BlackMisc::Aviation::CCallsign &callsign) const override;
 
+        //! Situations of the given aircraft as published snapshot, nullptr if there are none
+        //! \remark the list is not copied, snapshots are never modified once published
+        //! \threadsafe
+        CAircraftSituationListSnapshot remoteAircraftSituationsSnapshot(const Aviation::CCallsign &callsign) const;
+
         //! @{
         //! Reverse lookup messages
         //! \threadsafe
@@ -437,6 +458,12 @@ namespace BlackMisc::Simulation
         //! \remark does NOT emit signals
         bool updateAircraftInRangeDistanceBearing(const Aviation::CCallsign &callsign, const Aviation::CAircraftSituation &situation, const PhysicalQuantities::CLength &distance, const PhysicalQuantities::CAngle &bearing);
 
+        //! Update aircraft situation, transponder, distance and bearing (position packet)
+        //! \remark typed alternative to updateAircraftInRange with a CPropertyIndexVariantMap, emits changedAircraftInRange
+        //! \return true if anything changed, equal values are skipped and nothing is emitted
+        //! \threadsafe
+        bool updateAircraftKinematics(const Aviation::CCallsign &callsign, const Aviation::CAircraftSituation &situation, const Aviation::CTransponder &transponder, const PhysicalQuantities::CLength &distance, const PhysicalQuantities::CAngle &bearing);
+
         //! Store an aircraft situation
         //! \remark latest situations are kept first
         //! \threadsafe
@@ -471,11 +498,31 @@ namespace BlackMisc::Simulation
         //! \threadsafe
         void storeChange(const Aviation::CAircraftSituationChange &change);
 
-        Aviation::CAircraftSituationListPerCallsign m_situationsByCallsign; //!< situations, for performance reasons per callsign, thread safe access required
+        //! Publish the situations of a callsign as new snapshot
+        //! \remark only the snapshot pointer is swapped under m_lockSituations
+        //! \threadsafe
+        void publishSituations(const Aviation::CCallsign &callsign, Aviation::CAircraftSituationList &&situations, qint64 modifiedTs);
+
+        //! Copy, modify and publish the situations of a callsign
+        //! \remark the modifier returns the number of changed situations, nothing is published if 0
+        //! \threadsafe
+        int modifySituations(const Aviation::CCallsign &callsign, const std::function<int(Aviation::CAircraftSituationList &)> &modifier, qint64 modifiedTs = -1);
+
+        //! Situation history of a callsign, nullptr if not existing and not to be created
+        //! \remark the history must only be accessed with the write lock of the callsign held
+        std::shared_ptr<CAircraftSituationRing> situationHistory(const Aviation::CCallsign &callsign, bool create);
+
+        //! Lock serializing the writers of the given callsign
+        QMutex &situationsWriteLock(const Aviation::CCallsign &callsign) const;
+
+        static constexpr int SituationsWriteLocks = 16; //!< number of lock stripes for situation writers
+
+        QHash<Aviation::CCallsign, CAircraftSituationListSnapshot> m_situationsByCallsign; //!< published situations per callsign, thread safe access required
+        QHash<Aviation::CCallsign, std::shared_ptr<CAircraftSituationRing>> m_situationHistoryByCallsign; //!< situation history per callsign, fixed capacity, modified in place by the writers of the callsign
         Aviation::CAircraftSituationPerCallsign m_latestSituationByCallsign; //!< latest situations, for performance reasons per callsign, thread safe access required
         Aviation::CAircraftSituationPerCallsign m_latestOnGroundProviderElevation; //!< situations on ground with elevation from provider
-        Aviation::CAircraftPartsListPerCallsign m_partsByCallsign; //!< parts, for performance reasons per callsign, thread safe access required
-        Aviation::CAircraftSituationChangeListPerCallsign m_changesByCallsign; //!< changes, for performance reasons per callsign, thread safe access required (same timestamps as corresponding situations)
+        QHash<Aviation::CCallsign, CAircraftPartsRing> m_partsByCallsign; //!< parts history per callsign, fixed capacity, thread safe access required
+        QHash<Aviation::CCallsign, CAircraftSituationChangeRing> m_changesByCallsign; //!< change history per callsign, fixed capacity, thread safe access required (same timestamps as corresponding situations)
         Aviation::CCallsignSet m_aircraftWithParts; //!< aircraft supporting parts, thread safe access required
         int m_situationsAdded = 0; //!< total number of situations added, thread safe access required
         int m_partsAdded = 0; //!< total number of parts added, thread safe access required
@@ -493,7 +540,8 @@ namespace BlackMisc::Simulation
         bool m_enableAircraftPartsHistory = true; //!< shall we keep a history of aircraft parts
 
         // locks
-        mutable QReadWriteLock m_lockSituations; //!< lock for situations: m_situationsByCallsign
+        mutable QReadWriteLock m_lockSituations; //!< lock for situations: m_situationsByCallsign, m_situationHistoryByCallsign, only held to swap or copy snapshots
+        mutable std::array<QMutex, SituationsWriteLocks> m_lockSituationsWrite; //!< striped locks, writers of the same callsign read, modify and publish one after another
         mutable QReadWriteLock m_lockParts; //!< lock for parts: m_partsByCallsign, m_aircraftSupportingParts
         mutable QReadWriteLock m_lockChanges; //!< lock for changes: m_changesByCallsign
         mutable QReadWriteLock m_lockAircraft; //!< lock aircraft: m_aircraftInRange, m_dbCGPerCallsign
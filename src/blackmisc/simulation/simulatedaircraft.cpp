@@ -449,6 +449,32 @@ namespace BlackMisc::Simulation
         return 0;
     }
 
+    CSortKey CSimulatedAircraft::sortKeyByIndex(CPropertyIndexRef index) const
+    {
+        if (index.isMyself()) { return m_callsign.sortKeyByIndex(index.copyFrontRemoved()); }
+        const ColumnIndex i = index.frontCasted<ColumnIndex>();
+        switch (i)
+        {
+        case IndexCallsign: return m_callsign.sortKeyByIndex(index.copyFrontRemoved());
+        case IndexPilot: return m_pilot.sortKeyByIndex(index.copyFrontRemoved());
+        case IndexTransponder: return CSortKey(m_transponder.getTransponderCode());
+        case IndexLivery: return this->getLivery().sortKeyByIndex(index.copyFrontRemoved());
+        case IndexModel: return m_models[CurrentModel].sortKeyByIndex(index.copyFrontRemoved());
+        case IndexNetworkModelAircraftIcaoDifference: return CSortKey(this->getNetworkModelAircraftIcaoDifference());
+        case IndexNetworkModelAirlineIcaoDifference: return CSortKey(this->getNetworkModelAirlineIcaoDifference());
+        case IndexNetworkModelLiveryDifference: return CSortKey(this->getNetworkModelLiveryDifference());
+        case IndexEnabled: return CSortKey(this->isEnabled());
+        case IndexRendered: return CSortKey(this->isRendered());
+        case IndexPartsSynchronized: return CSortKey(this->isPartsSynchronized());
+        case IndexFastPositionUpdates: return CSortKey(this->fastPositionUpdates());
+        case IndexSupportsGndFlag: return CSortKey(this->isSupportingGndFlag());
+        case IndexCombinedIcaoLiveryString: return CSortKey(this->getCombinedIcaoLiveryString(false));
+        case IndexCombinedIcaoLiveryStringNetworkModel: return CSortKey(this->getCombinedIcaoLiveryString(true));
+        default: break; // situation, distance, COM systems, parts and network model are compared by comparePropertyByIndex
+        }
+        return {};
+    }
+
     const CAircraftModel &CSimulatedAircraft::getNetworkModelOrModel() const
     {
         Q_ASSERT_X(m_models.size() == 2, Q_FUNC_INFO, "Wrong model size");
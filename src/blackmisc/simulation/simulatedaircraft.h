@@ -26,6 +26,7 @@
 #include "blackmisc/mixin/mixincompare.h"
 #include "blackmisc/metaclass.h"
 #include "blackmisc/propertyindexref.h"
+#include "blackmisc/sortkey.h"
 #include "blackmisc/valueobject.h"
 
 #include <QMetaType>
@@ -351,6 +352,9 @@ namespace BlackMisc
             //! Compare for index
             int comparePropertyByIndex(CPropertyIndexRef index, const CSimulatedAircraft &compareValue) const;
 
+            //! Sort key, orders like comparePropertyByIndex, invalid for properties without key
+            CSortKey sortKeyByIndex(CPropertyIndexRef index) const;
+
             //! Get model (model used for mapping)
             const Simulation::CAircraftModel &getModel() const { return m_models[CurrentModel]; }
 
@@ -0,0 +1,101 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+#include "blackmisc/simulation/simulatedaircraftlistdelta.h"
+#include "blackmisc/geo/coordinategeodetic.h"
+#include "blackmisc/propertyindexvariantmap.h"
+
+#include <QHash>
+#include <QStringBuilder>
+
+using namespace BlackMisc::Aviation;
+using namespace BlackMisc::Geo;
+
+BLACK_DEFINE_VALUEOBJECT_MIXINS(BlackMisc::Simulation, CSimulatedAircraftListDelta)
+
+namespace BlackMisc::Simulation
+{
+    CSimulatedAircraftListDelta CSimulatedAircraftListDelta::fromDiff(const CSimulatedAircraftList &previous, const CSimulatedAircraftList &current)
+    {
+        QHash<CCallsign, const CSimulatedAircraft *> previousByCallsign;
+        previousByCallsign.reserve(previous.sizeInt());
+        for (const CSimulatedAircraft &aircraft : previous) { previousByCallsign.insert(aircraft.getCallsign(), &aircraft); }
+
+        CSimulatedAircraftListDelta delta;
+        for (const CSimulatedAircraft &aircraft : current)
+        {
+            const CSimulatedAircraft *previousAircraft = previousByCallsign.take(aircraft.getCallsign());
+            if (!previousAircraft || previousAircraft->getModel() != aircraft.getModel() || previousAircraft->getNetworkModel() != aircraft.getNetworkModel() || previousAircraft->getSelcal() != aircraft.getSelcal())
+            {
+                delta.m_aircraft.push_back(aircraft);
+                continue;
+            }
+            const CPropertyIndexVariantMap values = changedValues(*previousAircraft, aircraft);
+            if (!values.isEmpty()) { delta.m_changedValues.push_back(CVariant::from(values)); }
+        }
+
+        // not taken, so not in current list
+        for (auto it = previousByCallsign.cbegin(); it != previousByCallsign.cend(); ++it) { delta.m_removedCallsigns.push_back(it.key()); }
+        return delta;
+    }
+
+    void CSimulatedAircraftListDelta::applyTo(CSimulatedAircraftList &aircraft) const
+    {
+        if (this->isEmpty()) { return; }
+        if (!m_removedCallsigns.isEmpty()) { aircraft.removeByCallsigns(m_removedCallsigns); }
+
+        QHash<CCallsign, int> positions;
+        positions.reserve(aircraft.sizeInt());
+        for (int i = 0; i < aircraft.sizeInt(); ++i) { positions.insert(aircraft[i].getCallsign(), i); }
+
+        for (const CSimulatedAircraft &a : m_aircraft)
+        {
+            const int i = positions.value(a.getCallsign(), -1);
+            if (i < 0)
+            {
+                positions.insert(a.getCallsign(), aircraft.sizeInt());
+                aircraft.push_back(a);
+            }
+            else { aircraft[i] = a; }
+        }
+
+        for (const CVariant &v : m_changedValues)
+        {
+            const CPropertyIndexVariantMap values = v.to<CPropertyIndexVariantMap>();
+            const CCallsign callsign = values.value(CSimulatedAircraft::IndexCallsign).to<CCallsign>();
+            const int i = positions.value(callsign, -1);
+            Q_ASSERT_X(i >= 0, Q_FUNC_INFO, "changed aircraft not in list");
+            if (i >= 0) { aircraft[i].apply(values); }
+        }
+    }
+
+    QString CSimulatedAircraftListDelta::convertToQString(bool i18n) const
+    {
+        Q_UNUSED(i18n)
+        return u"full: " % QString::number(m_aircraft.size()) %
+               u" changed: " % QString::number(m_changedValues.size()) %
+               u" removed: " % QString::number(m_removedCallsigns.size());
+    }
+
+    CPropertyIndexVariantMap CSimulatedAircraftListDelta::changedValues(const CSimulatedAircraft &previous, const CSimulatedAircraft &current)
+    {
+        CPropertyIndexVariantMap values;
+        const auto addIfChanged = [&](const CPropertyIndex &index, const auto &previousValue, const auto &currentValue) {
+            if (previousValue != currentValue) { values.addValue(index, currentValue); }
+        };
+        addIfChanged(CSimulatedAircraft::IndexSituation, previous.getSituation(), current.getSituation());
+        addIfChanged(CSimulatedAircraft::IndexParts, previous.getParts(), current.getParts());
+        addIfChanged(CSimulatedAircraft::IndexPilot, previous.getPilot(), current.getPilot());
+        addIfChanged(CSimulatedAircraft::IndexCom1System, previous.getCom1System(), current.getCom1System());
+        addIfChanged(CSimulatedAircraft::IndexCom2System, previous.getCom2System(), current.getCom2System());
+        addIfChanged(CSimulatedAircraft::IndexTransponder, previous.getTransponder(), current.getTransponder());
+        addIfChanged(CSimulatedAircraft::IndexEnabled, previous.isEnabled(), current.isEnabled());
+        addIfChanged(CSimulatedAircraft::IndexRendered, previous.isRendered(), current.isRendered());
+        addIfChanged(CSimulatedAircraft::IndexPartsSynchronized, previous.isPartsSynchronized(), current.isPartsSynchronized());
+        addIfChanged(CSimulatedAircraft::IndexFastPositionUpdates, previous.fastPositionUpdates(), current.fastPositionUpdates());
+        addIfChanged(CSimulatedAircraft::IndexRelativeDistance, previous.getRelativeDistance(), current.getRelativeDistance());
+        addIfChanged(ICoordinateWithRelativePosition::IndexRelativeBearing, previous.getRelativeBearing(), current.getRelativeBearing());
+        if (!values.isEmpty()) { values.addValue(CSimulatedAircraft::IndexCallsign, current.getCallsign()); }
+        return values;
+    }
+} // namespace
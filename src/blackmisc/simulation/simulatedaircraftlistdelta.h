@@ -0,0 +1,78 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#ifndef BLACKMISC_SIMULATION_SIMULATEDAIRCRAFTLISTDELTA_H
+#define BLACKMISC_SIMULATION_SIMULATEDAIRCRAFTLISTDELTA_H
+
+#include "blackmisc/simulation/simulatedaircraftlist.h"
+#include "blackmisc/aviation/callsignset.h"
+#include "blackmisc/blackmiscexport.h"
+#include "blackmisc/metaclass.h"
+#include "blackmisc/propertyindexvariantmap.h"
+#include "blackmisc/valueobject.h"
+#include "blackmisc/variantlist.h"
+
+#include <QMetaType>
+#include <QString>
+
+BLACK_DECLARE_VALUEOBJECT_MIXINS(BlackMisc::Simulation, CSimulatedAircraftListDelta)
+
+namespace BlackMisc::Simulation
+{
+    /*!
+     * Changes between two versions of a list of aircraft, per callsign.
+     *
+     * New aircraft, and aircraft whose model or SELCAL changed, are contained in full.
+     * For all other aircraft only the changed values (situation, parts, COM, transponder, flags, relative position ...)
+     * are contained as CPropertyIndexVariantMap.
+     */
+    class BLACKMISC_EXPORT CSimulatedAircraftListDelta : public CValueObject<CSimulatedAircraftListDelta>
+    {
+    public:
+        //! Default constructor, no changes
+        CSimulatedAircraftListDelta() = default;
+
+        //! Changes from previous to current
+        static CSimulatedAircraftListDelta fromDiff(const CSimulatedAircraftList &previous, const CSimulatedAircraftList &current);
+
+        //! Apply to the previous list, which then equals the current list
+        //! \remark new aircraft are appended, the other aircraft keep their position
+        void applyTo(CSimulatedAircraftList &aircraft) const;
+
+        //! No changes?
+        bool isEmpty() const { return m_aircraft.isEmpty() && m_removedCallsigns.isEmpty() && m_changedValues.isEmpty(); }
+
+        //! Aircraft contained in full (new or with changed model/SELCAL)
+        const CSimulatedAircraftList &getAircraft() const { return m_aircraft; }
+
+        //! Callsigns of removed aircraft
+        const Aviation::CCallsignSet &getRemovedCallsigns() const { return m_removedCallsigns; }
+
+        //! Number of aircraft with changed values only
+        int getChangedCount() const { return m_changedValues.size(); }
+
+        //! \copydoc BlackMisc::Mixin::String::toQString
+        QString convertToQString(bool i18n = false) const;
+
+    private:
+        //! Changed values of an aircraft, including its callsign, empty if unchanged
+        static CPropertyIndexVariantMap changedValues(const CSimulatedAircraft &previous, const CSimulatedAircraft &current);
+
+        CSimulatedAircraftList m_aircraft; //!< new aircraft, or with changed model/SELCAL
+        Aviation::CCallsignSet m_removedCallsigns; //!< removed aircraft
+        CVariantList m_changedValues; //!< CPropertyIndexVariantMap per changed aircraft
+
+        BLACK_METACLASS(
+            CSimulatedAircraftListDelta,
+            BLACK_METAMEMBER(aircraft),
+            BLACK_METAMEMBER(removedCallsigns),
+            BLACK_METAMEMBER(changedValues)
+        );
+    };
+} // namespace
+
+Q_DECLARE_METATYPE(BlackMisc::Simulation::CSimulatedAircraftListDelta)
+
+#endif // guard
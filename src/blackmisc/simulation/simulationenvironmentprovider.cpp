@@ -33,12 +33,13 @@ namespace BlackMisc::Simulation
         CCoordinateGeodetic alreadyInRange;
         CCoordinateGeodetic alreadyInRangeGnd;
         {
+            // lookups only touch the atomic LRU ticks of the cache
             QReadLocker l(&m_lockElvCoordinates);
             if (!m_enableElevation) { return false; }
 
             // check if we have already an elevation within range
-            alreadyInRangeGnd = m_elvCoordinatesGnd.findFirstWithinRangeOrDefault(elevationCoordinate, minRange);
-            alreadyInRange = m_elvCoordinates.findFirstWithinRangeOrDefault(elevationCoordinate, minRange);
+            alreadyInRangeGnd = m_elvCache.findClosestWithinRange(elevationCoordinate, minRange, CElevationTileCache::OnGroundElevations);
+            alreadyInRange = m_elvCache.findClosestWithinRange(elevationCoordinate, minRange, CElevationTileCache::OtherElevations);
         }
 
         constexpr double maxDistFt = 30.0;
@@ -74,20 +75,9 @@ namespace BlackMisc::Simulation
 
         const qint64 now = QDateTime::currentMSecsSinceEpoch();
         {
-            // we keep latest at front
-            // * we assume we find them faster
-            // * and need them more frequently (the recent ones)
+            // the cache evicts the least recently used elevations if full
             QWriteLocker l(&m_lockElvCoordinates);
-            if (likelyOnGroundElevation)
-            {
-                if (m_elvCoordinatesGnd.size() > m_maxElevationsGnd) { m_elvCoordinatesGnd.pop_back(); }
-                m_elvCoordinatesGnd.push_front(elevationCoordinate);
-            }
-            else
-            {
-                if (m_elvCoordinates.size() > m_maxElevations) { m_elvCoordinates.pop_back(); }
-                m_elvCoordinates.push_front(elevationCoordinate);
-            }
+            m_elvCache.insert(elevationCoordinate, likelyOnGroundElevation);
 
             // statistics
             if (m_pendingElevationRequests.contains(requestedForCallsign))
@@ -267,15 +257,15 @@ namespace BlackMisc::Simulation
     CCoordinateGeodeticList ISimulationEnvironmentProvider::getAllElevationCoordinates() const
     {
         QReadLocker l(&m_lockElvCoordinates);
-        CCoordinateGeodeticList cl(m_elvCoordinatesGnd);
-        cl.push_back(m_elvCoordinates);
+        CCoordinateGeodeticList cl(m_elvCache.getElevations(CElevationTileCache::OnGroundElevations));
+        cl.push_back(m_elvCache.getElevations(CElevationTileCache::OtherElevations));
         return cl;
     }
 
     CCoordinateGeodeticList ISimulationEnvironmentProvider::getElevationCoordinatesOnGround() const
     {
         QReadLocker l(&m_lockElvCoordinates);
-        return m_elvCoordinatesGnd;
+        return m_elvCache.getElevations(CElevationTileCache::OnGroundElevations);
     }
 
     CElevationPlane ISimulationEnvironmentProvider::averageElevationOfOnGroundAircraft(const CAircraftSituation &reference, const CLength &range, int minValues, int sufficientValues) const
@@ -294,54 +284,29 @@ namespace BlackMisc::Simulation
     CCoordinateGeodeticList ISimulationEnvironmentProvider::getAllElevationCoordinates(int &maxRemembered) const
     {
         QReadLocker l(&m_lockElvCoordinates);
-        maxRemembered = m_maxElevations;
-        CCoordinateGeodeticList cl(m_elvCoordinatesGnd);
-        cl.push_back(m_elvCoordinates);
+        maxRemembered = m_elvCache.getMaxElevations();
+        CCoordinateGeodeticList cl(m_elvCache.getElevations(CElevationTileCache::OnGroundElevations));
+        cl.push_back(m_elvCache.getElevations(CElevationTileCache::OtherElevations));
         return cl;
     }
 
     int ISimulationEnvironmentProvider::cleanUpElevations(const ICoordinateGeodetic &referenceCoordinate, int maxNumber)
     {
-        int currentMax;
-        CCoordinateGeodeticList coordinates(this->getAllElevationCoordinates(currentMax));
-        if (maxNumber < 0) { maxNumber = currentMax; }
-        const int size = coordinates.size();
-        if (size <= maxNumber) { return 0; }
-        coordinates.sortByEuclideanDistanceSquared(referenceCoordinate);
-        coordinates.truncate(maxNumber);
-        const int delta = size - coordinates.size();
-        {
-            QWriteLocker l(&m_lockElvCoordinates);
-            m_elvCoordinates = coordinates;
-        }
-        return delta;
+        QWriteLocker l(&m_lockElvCoordinates);
+        if (maxNumber < 0) { maxNumber = m_elvCache.getMaxElevations(); }
+        return m_elvCache.keepClosest(referenceCoordinate, maxNumber, CElevationTileCache::OtherElevations);
     }
 
     CElevationPlane ISimulationEnvironmentProvider::findClosestElevationWithinRange(const ICoordinateGeodetic &reference, const CLength &range) const
     {
         if (!this->isElevationProviderEnabled()) { return CElevationPlane::null(); }
 
-        // for single point we use a slightly optimized version
+        // for single point we do not interpolate
         const bool singlePoint = (&range == &CElevationPlane::singlePointRadius() || range.isNull() || range <= CElevationPlane::singlePointRadius());
-        const CCoordinateGeodeticList elevations = this->getAllElevationCoordinates();
-        const CCoordinateGeodetic coordinate = singlePoint ?
-                                                   elevations.findFirstWithinRangeOrDefault(reference, CElevationPlane::singlePointRadius()) :
-                                                   elevations.findClosestWithinRange(reference, range);
-        const bool found = !coordinate.isNull();
 
-        {
-            QWriteLocker l { &m_lockElvCoordinates };
-            if (found)
-            {
-                m_elvFound++;
-                return CElevationPlane(coordinate, reference); // plane with radius = distance to reference
-            }
-            else
-            {
-                m_elvMissed++;
-                return CElevationPlane::null();
-            }
-        }
+        // only the cells around the reference are checked, concurrent lookups are fine
+        QReadLocker l { &m_lockElvCoordinates };
+        return m_elvCache.findElevationPlane(reference, singlePoint ? CElevationPlane::singlePointRadius() : range);
     }
 
     CElevationPlane ISimulationEnvironmentProvider::findClosestElevationWithinRangeOrRequest(const ICoordinateGeodetic &reference, const CLength &range, const CCallsign &callsign)
@@ -367,25 +332,26 @@ namespace BlackMisc::Simulation
     QPair<int, int> ISimulationEnvironmentProvider::getElevationsFoundMissed() const
     {
         QReadLocker l(&m_lockElvCoordinates);
-        return QPair<int, int>(m_elvFound, m_elvMissed);
+        const CElevationTileCache::Statistics &stats = m_elvCache.getStatistics();
+        return QPair<int, int>(stats.found(), stats.misses);
     }
 
     QString ISimulationEnvironmentProvider::getElevationsFoundMissedInfo() const
     {
-        static const QString info("%1/%2 %3% in %4 (all)/%5 (gnd)");
-        const QPair<int, int> foundMissed = this->getElevationsFoundMissed();
-        const int f = foundMissed.first;
-        const int m = foundMissed.second;
-        const double hitRatioPercent = 100.0 * static_cast<double>(f) / static_cast<double>(f + m);
-
+        static const QString info("%1/%2 %3% in %4 (all)/%5 (gnd), %6 interpolated, %7 evicted");
+        CElevationTileCache::Statistics stats;
         int elvGnd;
         int elv;
         {
             QReadLocker l(&m_lockElvCoordinates);
-            elvGnd = m_elvCoordinatesGnd.sizeInt();
-            elv = m_elvCoordinates.sizeInt();
+            stats = m_elvCache.getStatistics();
+            elvGnd = m_elvCache.size(CElevationTileCache::OnGroundElevations);
+            elv = m_elvCache.size(CElevationTileCache::OtherElevations);
         }
-        return info.arg(f).arg(m).arg(QString::number(hitRatioPercent, 'f', 1)).arg(elv).arg(elvGnd);
+        const int f = stats.found();
+        const int m = stats.misses;
+        const double hitRatioPercent = 100.0 * static_cast<double>(f) / static_cast<double>(f + m);
+        return info.arg(f).arg(m).arg(QString::number(hitRatioPercent, 'f', 1)).arg(elv).arg(elvGnd).arg(stats.interpolated).arg(stats.evictions);
     }
 
     QPair<qint64, qint64> ISimulationEnvironmentProvider::getElevationRequestTimes() const
@@ -404,6 +370,12 @@ namespace BlackMisc::Simulation
         return info.arg(times.first).arg(times.second);
     }
 
+    CElevationTileCache::Statistics ISimulationEnvironmentProvider::getElevationCacheStatistics() const
+    {
+        QReadLocker l(&m_lockElvCoordinates);
+        return m_elvCache.getStatistics();
+    }
+
     CSimulatorPluginInfo ISimulationEnvironmentProvider::getSimulatorPluginInfo() const
     {
         QReadLocker l(&m_lockSimInfo);
@@ -527,14 +499,14 @@ namespace BlackMisc::Simulation
     int ISimulationEnvironmentProvider::setMaxElevationsRemembered(int max)
     {
         QWriteLocker l(&m_lockElvCoordinates);
-        m_maxElevations = qMax(max, 50);
-        return m_maxElevations;
+        m_elvCache.setMaxElevations(qMax(max, 50), m_elvCache.getMaxElevationsGnd());
+        return m_elvCache.getMaxElevations();
     }
 
     int ISimulationEnvironmentProvider::getMaxElevationsRemembered() const
     {
         QReadLocker l(&m_lockElvCoordinates);
-        return m_maxElevations;
+        return m_elvCache.getMaxElevations();
     }
 
     void ISimulationEnvironmentProvider::resetSimulationEnvironmentStatistics()
@@ -542,58 +514,30 @@ namespace BlackMisc::Simulation
         QWriteLocker l(&m_lockElvCoordinates);
         m_statsCurrentElevRequestTimeMs = -1;
         m_statsMaxElevRequestTimeMs = -1;
-        m_elvFound = m_elvMissed = 0;
+        m_elvCache.resetStatistics();
     }
 
     int ISimulationEnvironmentProvider::removeElevationValues(const CAircraftSituation &reference, const CLength &removeRange)
     {
         QWriteLocker l(&m_lockElvCoordinates);
-        const int r = m_elvCoordinatesGnd.removeInsideRange(reference, removeRange);
-        return r;
+        return m_elvCache.removeInsideRange(reference, removeRange, CElevationTileCache::OnGroundElevations);
     }
 
     bool ISimulationEnvironmentProvider::cleanElevationValues(const CAircraftSituation &reference, const CLength &keptRange, bool forced)
     {
         if (reference.isNull() || keptRange.isNull()) { return false; }
         const CLength r = minRange(keptRange);
-
-        CCoordinateGeodeticList cleanedKeptElvs;
-        bool maxReached = false;
         bool cleaned = false;
 
+        QWriteLocker l(&m_lockElvCoordinates);
+        if (forced || m_elvCache.size(CElevationTileCache::OtherElevations) >= m_elvCache.getMaxElevations())
         {
-            QReadLocker l(&m_lockElvCoordinates);
-            cleanedKeptElvs = m_elvCoordinates;
-            maxReached = m_elvCoordinates.size() >= m_maxElevations;
-        }
-        if (!cleanedKeptElvs.isEmpty() && (forced || maxReached))
-        {
-            const int removed = cleanedKeptElvs.removeOutsideRange(reference, r);
-            if (removed > 0)
-            {
-                cleaned = true;
-                QWriteLocker l(&m_lockElvCoordinates);
-                m_elvCoordinates = cleanedKeptElvs;
-            }
-        }
-
-        cleanedKeptElvs.clear();
-        {
-            QReadLocker l(&m_lockElvCoordinates);
-            cleanedKeptElvs = m_elvCoordinatesGnd;
-            maxReached = m_elvCoordinatesGnd.size() >= m_maxElevationsGnd;
+            cleaned = m_elvCache.removeOutsideRange(reference, r, CElevationTileCache::OtherElevations) > 0;
         }
-        if (!cleanedKeptElvs.isEmpty() && (forced || maxReached))
+        if (forced || m_elvCache.size(CElevationTileCache::OnGroundElevations) >= m_elvCache.getMaxElevationsGnd())
         {
-            const int removed = cleanedKeptElvs.removeOutsideRange(reference, r);
-            if (removed > 0)
-            {
-                cleaned = true;
-                QWriteLocker l(&m_lockElvCoordinates);
-                m_elvCoordinatesGnd = cleanedKeptElvs;
-            }
+            cleaned = m_elvCache.removeOutsideRange(reference, r, CElevationTileCache::OnGroundElevations) > 0 || cleaned;
         }
-
         return cleaned;
     }
 
@@ -687,12 +631,11 @@ namespace BlackMisc::Simulation
     void ISimulationEnvironmentProvider::clearElevations()
     {
         QWriteLocker l(&m_lockElvCoordinates);
-        m_elvCoordinates.clear();
-        m_elvCoordinatesGnd.clear();
+        m_elvCache.clear();
+        m_elvCache.resetStatistics();
         m_pendingElevationRequests.clear();
         m_statsCurrentElevRequestTimeMs = -1;
         m_statsMaxElevRequestTimeMs = -1;
-        m_elvFound = m_elvMissed = 0;
     }
 
     void ISimulationEnvironmentProvider::clearCGs()
@@ -13,6 +13,7 @@
 #include "blackmisc/aviation/percallsign.h"
 #include "blackmisc/geo/coordinategeodeticlist.h"
 #include "blackmisc/geo/elevationplane.h"
+#include "blackmisc/geo/elevationtilecache.h"
 #include "blackmisc/pq/length.h"
 #include "blackmisc/provider.h"
 
@@ -75,6 +76,10 @@ namespace BlackMisc::Simulation
         //! \threadsafe
         QString getElevationRequestTimesInfo() const;
 
+        //! Elevation cache hits, interpolated values, misses and evictions
+        //! \threadsafe
+        Geo::CElevationTileCache::Statistics getElevationCacheStatistics() const;
+
         //! Get the represented plugin
         //! \threadsafe
         CSimulatorPluginInfo getSimulatorPluginInfo() const;
@@ -217,7 +222,7 @@ namespace BlackMisc::Simulation
         //! \threadsafe
         void clearSimulationEnvironmentData();
 
-        //! Only keep closest ones
+        //! Only keep the closest elevations (not on ground ones)
         //! \threadsafe
         int cleanUpElevations(const Geo::ICoordinateGeodetic &referenceCoordinate, int maxNumber = -1);
 
@@ -283,11 +288,8 @@ namespace BlackMisc::Simulation
         QString m_simulatorVersion; //!< simulator version
         CAircraftModel m_defaultModel; //!< default model
 
-        // idea: the elevations on gnd are likely taxiways and runways, so we keep those
-        int m_maxElevations = 100; //!< How many elevations we keep
-        int m_maxElevationsGnd = 400; //!< How many elevations we keep for elevations on gnd.
-        Geo::CCoordinateGeodeticList m_elvCoordinates; //!< elevation cache
-        Geo::CCoordinateGeodeticList m_elvCoordinatesGnd; //!< elevation cache for on ground situations
+        // idea: the elevations on gnd are likely taxiways and runways, so we keep more of those
+        Geo::CElevationTileCache m_elvCache { 100, 400 }; //!< elevation cache
 
         Aviation::CTimestampPerCallsign m_pendingElevationRequests; //!< pending elevation requests for aircraft callsign
         Aviation::CLengthPerCallsign m_cgsPerCallsign; //!< CGs per callsign
@@ -300,10 +302,7 @@ namespace BlackMisc::Simulation
         bool m_enableElevation = true;
         bool m_enableCG = true;
 
-        mutable int m_elvFound = 0; //!< statistics only
-        mutable int m_elvMissed = 0; //!< statistics only
-
-        mutable QReadWriteLock m_lockElvCoordinates { QReadWriteLock::Recursive }; //!< lock m_coordinates, m_pendingElevationRequests
+        mutable QReadWriteLock m_lockElvCoordinates { QReadWriteLock::Recursive }; //!< lock m_elvCache, m_pendingElevationRequests
         mutable QReadWriteLock m_lockCG { QReadWriteLock::Recursive }; //!< lock CGs
         mutable QReadWriteLock m_lockModel { QReadWriteLock::Recursive }; //!< lock models
         mutable QReadWriteLock m_lockSimInfo { QReadWriteLock::Recursive }; //!< lock plugin info
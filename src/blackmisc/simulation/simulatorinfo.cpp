@@ -6,6 +6,7 @@
 #include "blackmisc/simulation/simulatorinfo.h"
 #include "blackmisc/simulation/xplane/xplaneutil.h"
 #include "blackmisc/db/datastoreutility.h"
+#include "blackmisc/db/jsonkeys.h"
 #include "blackmisc/stringutils.h"
 #include "blackmisc/iconlist.h"
 #include "blackmisc/comparefunctions.h"
@@ -318,13 +319,30 @@ namespace BlackMisc::Simulation
         return sim;
     }
 
+    namespace
+    {
+        //! JSON keys of CSimulatorInfo::fromDatabaseJson
+        struct SimulatorInfoJsonKeys
+        {
+            //! Keys with prefix
+            SimulatorInfoJsonKeys(const QString &prefix) : fsx(prefix % u"simfsx"), fs9(prefix % u"simfs9"), xp(prefix % u"simxplane"), p3d(prefix % u"simp3d"), fg(prefix % u"simfg") {}
+
+            QString fsx; //!< FSX flag
+            QString fs9; //!< FS9 flag
+            QString xp; //!< X-Plane flag
+            QString p3d; //!< P3D flag
+            QString fg; //!< FlightGear flag
+        };
+    }
+
     CSimulatorInfo CSimulatorInfo::fromDatabaseJson(const QJsonObject &json, const QString &prefix)
     {
-        const QJsonValue jfsx = json.value(prefix % u"simfsx");
-        const QJsonValue jfs9 = json.value(prefix % u"simfs9");
-        const QJsonValue jxp = json.value(prefix % u"simxplane");
-        const QJsonValue jp3d = json.value(prefix % u"simp3d");
-        const QJsonValue jfg = json.value(prefix % u"simfg");
+        const SimulatorInfoJsonKeys &keys = Db::jsonKeys<SimulatorInfoJsonKeys>(prefix);
+        const QJsonValue jfsx = json.value(keys.fsx);
+        const QJsonValue jfs9 = json.value(keys.fs9);
+        const QJsonValue jxp = json.value(keys.xp);
+        const QJsonValue jp3d = json.value(keys.p3d);
+        const QJsonValue jfg = json.value(keys.fg);
 
         // we handle bool JSON values and bool as string
         const bool fsx = jfsx.isBool() ? jfsx.toBool() : CDatastoreUtility::dbBoolStringToBool(jfsx.toString());
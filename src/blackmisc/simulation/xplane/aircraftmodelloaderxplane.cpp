@@ -111,12 +111,12 @@ namespace BlackMisc::Simulation::XPlane
             if (m_parserWorker && !m_parserWorker->isFinished()) { return; }
             emit this->diskLoadingStarted(simulator, mode);
 
-            m_parserWorker = CWorker::fromTask(this, "CAircraftModelLoaderXPlane::performParsing",
-                                               [this, modelDirs, excludedDirectoryPatterns, modelConsolidation]() {
-                                                   auto models = this->performParsing(modelDirs, excludedDirectoryPatterns);
-                                                   if (modelConsolidation) { modelConsolidation(models, true); }
-                                                   return models;
-                                               });
+            m_parserWorker = CWorker::fromLongTask(this, "CAircraftModelLoaderXPlane::performParsing",
+                                                   [this, modelDirs, excludedDirectoryPatterns, modelConsolidation]() {
+                                                       auto models = this->performParsing(modelDirs, excludedDirectoryPatterns);
+                                                       if (modelConsolidation) { modelConsolidation(models, true); }
+                                                       return models;
+                                                   });
             m_parserWorker->thenWithResult<CAircraftModelList>(this, [=](const auto &models) {
                 this->updateInstalledModels(models);
                 m_loadingMessages.freezeOrder();
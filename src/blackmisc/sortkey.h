@@ -0,0 +1,72 @@
+// SPDX-FileCopyrightText: Copyright (C) 2026 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#ifndef BLACKMISC_SORTKEY_H
+#define BLACKMISC_SORTKEY_H
+
+#include "blackmisc/comparefunctions.h"
+#include <QString>
+#include <QtGlobal>
+#include <type_traits>
+
+namespace BlackMisc
+{
+    /*!
+     * Sort value of an object property, fetched once per object and compared like comparePropertyByIndex.
+     * Value classes provide it by sortKeyByIndex(index), an invalid key means the property has to be compared
+     * by comparePropertyByIndex. Whether a property has a key depends on the index only, not on the object.
+     * \remark strings are kept as they are (implicitly shared) and compared with the same case sensitivity,
+     *         so the order is the order of comparePropertyByIndex
+     */
+    class CSortKey
+    {
+    public:
+        //! Invalid key, no key for this property
+        CSortKey() = default;
+
+        //! Key of an arithmetic value or enumerator
+        template <typename T, std::enable_if_t<std::is_arithmetic_v<T> || std::is_enum_v<T>, int> = 0>
+        explicit CSortKey(T number) : m_type(Number), m_number(static_cast<qint64>(number))
+        {
+            static_assert(!std::is_floating_point_v<T>, "No floating point keys");
+        }
+
+        //! Key of a string
+        explicit CSortKey(const QString &string, Qt::CaseSensitivity cs = Qt::CaseSensitive) : m_type(cs == Qt::CaseSensitive ? String : StringCaseInsensitive), m_string(string) {}
+
+        //! Valid key?
+        bool isValid() const { return m_type != Invalid; }
+
+        //! Compare with key of the same property
+        int compare(const CSortKey &other) const
+        {
+            Q_ASSERT_X(m_type == other.m_type, Q_FUNC_INFO, "Keys of different properties");
+            switch (m_type)
+            {
+            case Number: return Compare::compare(m_number, other.m_number);
+            case String: return m_string.compare(other.m_string, Qt::CaseSensitive);
+            case StringCaseInsensitive: return m_string.compare(other.m_string, Qt::CaseInsensitive);
+            default: break;
+            }
+            return 0;
+        }
+
+    private:
+        //! Type of the key
+        enum KeyType
+        {
+            Invalid,
+            Number,
+            String,
+            StringCaseInsensitive
+        };
+
+        KeyType m_type = Invalid;
+        qint64 m_number = 0;
+        QString m_string;
+    };
+} // ns
+
+#endif
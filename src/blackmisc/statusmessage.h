@@ -310,6 +310,7 @@ namespace BlackMisc
         template <class T, std::enable_if_t<TParameter<std::decay_t<T>>::passBy == ParameterPassBy::Value, int> = 0>
         Derived &operator<<(T v)
         {
+            if (derived().skipsArguments()) { return derived(); }
             return arg(TString<T>::toQString(v));
         }
 
@@ -320,6 +321,7 @@ namespace BlackMisc
         template <class T, std::enable_if_t<TParameter<std::decay_t<T>>::passBy == ParameterPassBy::ConstRef, int> = 0>
         Derived &operator<<(const T &v)
         {
+            if (derived().skipsArguments()) { return derived(); }
             return arg(TString<T>::toQString(v));
         }
 
@@ -340,6 +342,9 @@ namespace BlackMisc
         Derived &derived() { return static_cast<Derived &>(*this); }
 
     protected:
+        //! Streamed values are not needed and not formatted, can be hidden by the derived class
+        bool skipsArguments() const { return false; }
+
         //! Add category if not already existing
         void addIfNotExisting(const CLogCategory &category)
         {
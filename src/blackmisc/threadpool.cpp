@@ -0,0 +1,224 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+#include "blackmisc/threadpool.h"
+
+#include <QMutexLocker>
+#include <QString>
+#include <algorithm>
+
+namespace BlackMisc
+{
+    namespace
+    {
+        thread_local const CThreadPool *t_pool = nullptr; //!< pool of the current thread, if any
+        thread_local int t_index = -1; //!< index of the current thread in its pool
+    }
+
+    //! A thread of the pool, runs the pool's main loop
+    class CThreadPool::CPoolThread : public QThread
+    {
+    public:
+        //! Constructor
+        CPoolThread(CThreadPool *pool, int index) : m_pool(pool), m_index(index) {}
+
+    protected:
+        //! \copydoc QThread::run
+        virtual void run() override { m_pool->run(m_index); }
+
+    private:
+        CThreadPool *m_pool = nullptr;
+        int m_index = -1;
+    };
+
+    CThreadPool::CThreadPool(int threads)
+    {
+        m_clock.start();
+        const int count = threads > 0 ? threads : qMax(2, QThread::idealThreadCount());
+        m_queues.reserve(static_cast<size_t>(count));
+        for (int i = 0; i < count; ++i) { m_queues.push_back(std::make_unique<ThreadQueues>()); }
+        m_threads.resize(static_cast<size_t>(count));
+
+        QMutexLocker lock(&m_mutex);
+        for (int i = 0; i < count; ++i) { this->startThread(i); }
+    }
+
+    CThreadPool::~CThreadPool()
+    {
+        // no threads are deleted or started while stopping, so the pointers stay valid
+        std::vector<CPoolThread *> threads;
+        {
+            QMutexLocker lock(&m_mutex);
+            m_stopping = true;
+            for (const auto &thread : m_threads)
+            {
+                if (thread) { threads.push_back(thread.get()); }
+            }
+            for (const auto &thread : m_replacedThreads) { threads.push_back(thread.get()); }
+        }
+        m_taskAvailable.wakeAll();
+        for (CPoolThread *thread : threads) { thread->wait(); }
+    }
+
+    CThreadPool &CThreadPool::instance()
+    {
+        static CThreadPool pool;
+        return pool;
+    }
+
+    void CThreadPool::submit(std::function<void()> task, Priority priority)
+    {
+        Q_ASSERT_X(task, Q_FUNC_INFO, "Missing task");
+        Task queued { std::move(task), m_clock.nsecsElapsed() };
+        const size_t p = static_cast<size_t>(priority);
+        ++m_tasksSubmitted;
+
+        // tasks submitted by a pool thread stay with this thread, unless stolen
+        const bool poolThread = this->isPoolThread();
+        if (poolThread)
+        {
+            ThreadQueues &own = *m_queues[static_cast<size_t>(t_index)];
+            QMutexLocker lock(&own.mutex);
+            own.tasks[p].push_back(std::move(queued));
+        }
+
+        QMutexLocker lock(&m_mutex);
+        if (!poolThread) { m_sharedTasks[p].push_back(std::move(queued)); }
+        ++m_pendingTasks;
+        m_taskAvailable.wakeOne();
+    }
+
+    bool CThreadPool::isPoolThread() const
+    {
+        return t_pool == this;
+    }
+
+    CThreadPool::Statistics CThreadPool::getStatistics() const
+    {
+        Statistics statistics;
+        statistics.threadsCreated = m_threadsCreated;
+        statistics.tasksSubmitted = m_tasksSubmitted;
+        statistics.tasksExecuted = m_tasksExecuted;
+        statistics.tasksStolen = m_tasksStolen;
+        statistics.totalLatencyNs = m_totalLatencyNs;
+        statistics.maxLatencyNs = m_maxLatencyNs;
+        return statistics;
+    }
+
+    void CThreadPool::resetStatistics()
+    {
+        m_tasksSubmitted = 0;
+        m_tasksExecuted = 0;
+        m_tasksStolen = 0;
+        m_totalLatencyNs = 0;
+        m_maxLatencyNs = 0;
+    }
+
+    void CThreadPool::run(int index)
+    {
+        t_pool = this;
+        t_index = index;
+        for (;;)
+        {
+            Task task;
+            if (this->takeTask(index, task))
+            {
+                this->runTask(task);
+
+                // the interruption can not be reset, so the thread is replaced
+                if (QThread::currentThread()->isInterruptionRequested())
+                {
+                    this->replaceThread(index);
+                    return;
+                }
+                continue;
+            }
+
+            QMutexLocker lock(&m_mutex);
+            if (m_pendingTasks > 0) { continue; } // submitted meanwhile
+            if (m_stopping) { return; }
+            m_taskAvailable.wait(&m_mutex);
+        }
+    }
+
+    bool CThreadPool::takeTask(int index, Task &task)
+    {
+        const auto takeFront = [&](std::deque<Task> &tasks) {
+            if (tasks.empty()) { return false; }
+            task = std::move(tasks.front());
+            tasks.pop_front();
+            --m_pendingTasks;
+            return true;
+        };
+
+        const int threads = this->getThreadCount();
+        for (size_t p = 0; p < m_sharedTasks.size(); ++p)
+        {
+            {
+                // own tasks, most recent first
+                ThreadQueues &own = *m_queues[static_cast<size_t>(index)];
+                QMutexLocker lock(&own.mutex);
+                std::deque<Task> &tasks = own.tasks[p];
+                if (!tasks.empty())
+                {
+                    task = std::move(tasks.back());
+                    tasks.pop_back();
+                    --m_pendingTasks;
+                    return true;
+                }
+            }
+            {
+                QMutexLocker lock(&m_mutex);
+                if (takeFront(m_sharedTasks[p])) { return true; }
+            }
+            for (int i = 1; i < threads; ++i)
+            {
+                // steal the oldest task of another thread
+                ThreadQueues &other = *m_queues[static_cast<size_t>((index + i) % threads)];
+                QMutexLocker lock(&other.mutex);
+                if (takeFront(other.tasks[p]))
+                {
+                    ++m_tasksStolen;
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    void CThreadPool::runTask(Task &task)
+    {
+        const qint64 latencyNs = m_clock.nsecsElapsed() - task.submittedNs;
+        ++m_tasksExecuted;
+        m_totalLatencyNs += latencyNs;
+        qint64 maxLatencyNs = m_maxLatencyNs;
+        while (latencyNs > maxLatencyNs && !m_maxLatencyNs.compare_exchange_weak(maxLatencyNs, latencyNs)) {}
+
+        task.function();
+    }
+
+    void CThreadPool::replaceThread(int index)
+    {
+        QMutexLocker lock(&m_mutex);
+        if (m_stopping)
+        {
+            // the remaining tasks of this thread are stolen by the others
+            m_replacedThreads.push_back(std::move(m_threads[static_cast<size_t>(index)]));
+            return;
+        }
+
+        // the calling thread finishes after returning, it is deleted with the next replacement
+        m_replacedThreads.erase(std::remove_if(m_replacedThreads.begin(), m_replacedThreads.end(), [](const std::unique_ptr<CPoolThread> &thread) { return thread->isFinished(); }), m_replacedThreads.end());
+        m_replacedThreads.push_back(std::move(m_threads[static_cast<size_t>(index)]));
+        this->startThread(index);
+    }
+
+    void CThreadPool::startThread(int index)
+    {
+        auto thread = std::make_unique<CPoolThread>(this, index);
+        thread->setObjectName(QStringLiteral("CThreadPool:%1").arg(index));
+        thread->start();
+        m_threads[static_cast<size_t>(index)] = std::move(thread);
+        ++m_threadsCreated;
+    }
+} // namespace
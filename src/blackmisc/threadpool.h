@@ -0,0 +1,147 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#ifndef BLACKMISC_THREADPOOL_H
+#define BLACKMISC_THREADPOOL_H
+
+#include "blackmisc/blackmiscexport.h"
+
+#include <QElapsedTimer>
+#include <QMutex>
+#include <QThread>
+#include <QWaitCondition>
+#include <QtGlobal>
+#include <array>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace BlackMisc
+{
+    /*!
+     * Fixed size pool of threads running short lived tasks, used by CWorker.
+     *
+     * Every pool thread has its own deques, tasks submitted by a pool thread go to them.
+     * The owning thread works its deques LIFO, idle threads steal FIFO from the other threads.
+     * Tasks submitted by any other thread go to a shared queue.
+     * Interactive tasks (e.g. sorting of views) are always taken before background tasks.
+     * Long or blocking tasks do not belong here, they are run by CWorker::fromLongTask in threads of their own.
+     * \remark a pool thread whose task requested its interruption (QThread::requestInterruption) is replaced by a new thread,
+     *         so tasks can still check QThread::currentThread()->isInterruptionRequested()
+     */
+    class BLACKMISC_EXPORT CThreadPool
+    {
+    public:
+        //! Task priority
+        enum Priority
+        {
+            Interactive, //!< result is waited for by the UI
+            Background //!< everything else
+        };
+
+        //! Counters of the pool
+        struct Statistics
+        {
+            qint64 threadsCreated = 0; //!< threads created, including replaced threads
+            qint64 tasksSubmitted = 0; //!< submitted tasks
+            qint64 tasksExecuted = 0; //!< started tasks
+            qint64 tasksStolen = 0; //!< tasks taken from the deque of another pool thread
+            qint64 totalLatencyNs = 0; //!< sum of the times from submitting to starting the tasks
+            qint64 maxLatencyNs = 0; //!< max. time from submitting to starting a task
+
+            //! Average time from submitting to starting a task
+            double averageLatencyUs() const { return tasksExecuted > 0 ? totalLatencyNs / 1000.0 / tasksExecuted : 0.0; }
+        };
+
+        //! Constructor
+        //! \param threads number of threads, 0 means one per core (at least 2)
+        explicit CThreadPool(int threads = 0);
+
+        //! Destructor, runs the pending tasks and stops the threads
+        ~CThreadPool();
+
+        //! Not copyable
+        //! @{
+        CThreadPool(const CThreadPool &) = delete;
+        CThreadPool &operator=(const CThreadPool &) = delete;
+        //! @}
+
+        //! The process wide pool
+        static CThreadPool &instance();
+
+        //! Run the task in one of the pool threads
+        //! \threadsafe
+        void submit(std::function<void()> task, Priority priority = Background);
+
+        //! Number of threads
+        int getThreadCount() const { return static_cast<int>(m_queues.size()); }
+
+        //! Is the calling thread one of the threads of this pool?
+        //! \threadsafe
+        bool isPoolThread() const;
+
+        //! Current counters
+        //! \threadsafe
+        Statistics getStatistics() const;
+
+        //! Reset the task counters
+        //! \threadsafe
+        void resetStatistics();
+
+    private:
+        class CPoolThread;
+
+        //! A queued task
+        struct Task
+        {
+            std::function<void()> function; //!< the task
+            qint64 submittedNs = 0; //!< submit time relative to m_clock
+        };
+
+        //! The deques of a pool thread
+        struct ThreadQueues
+        {
+            QMutex mutex; //!< protects the deques
+            std::array<std::deque<Task>, 2> tasks; //!< one per priority
+        };
+
+        //! Main loop of the thread with the given index
+        void run(int index);
+
+        //! Take the next task, own deque first, then shared queue, then stealing
+        bool takeTask(int index, Task &task);
+
+        //! Run a task and update the counters
+        void runTask(Task &task);
+
+        //! Replace the calling (interrupted) thread with a new one
+        void replaceThread(int index);
+
+        //! Start a new thread for the given index
+        //! \remark called with m_mutex locked
+        void startThread(int index);
+
+        std::vector<std::unique_ptr<ThreadQueues>> m_queues; //!< per thread, by index
+        std::vector<std::unique_ptr<CPoolThread>> m_threads; //!< by index
+        std::vector<std::unique_ptr<CPoolThread>> m_replacedThreads; //!< interrupted threads, deleted once finished
+        std::array<std::deque<Task>, 2> m_sharedTasks; //!< tasks submitted by other threads, one per priority
+        mutable QMutex m_mutex; //!< protects threads, shared tasks and stopping
+        QWaitCondition m_taskAvailable; //!< wakes idle threads
+        std::atomic_int m_pendingTasks { 0 }; //!< queued tasks
+        bool m_stopping = false; //!< shutting down
+        QElapsedTimer m_clock; //!< for the latencies
+
+        std::atomic<qint64> m_threadsCreated { 0 };
+        std::atomic<qint64> m_tasksSubmitted { 0 };
+        std::atomic<qint64> m_tasksExecuted { 0 };
+        std::atomic<qint64> m_tasksStolen { 0 };
+        std::atomic<qint64> m_totalLatencyNs { 0 };
+        std::atomic<qint64> m_maxLatencyNs { 0 };
+    };
+} // namespace
+
+#endif // guard
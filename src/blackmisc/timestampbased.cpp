@@ -234,6 +234,12 @@ namespace BlackMisc
         return Compare::compare(m_timestampMSecsSinceEpoch, compareValue.m_timestampMSecsSinceEpoch);
     }
 
+    CSortKey ITimestampBased::sortKeyByIndex(CPropertyIndexRef index) const
+    {
+        Q_UNUSED(index);
+        return CSortKey(m_timestampMSecsSinceEpoch);
+    }
+
     void ITimestampBased::updateMissingParts(const ITimestampBased &other)
     {
         if (m_timestampMSecsSinceEpoch < 0)
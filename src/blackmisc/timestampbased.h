@@ -8,6 +8,7 @@
 
 #include "blackmisc/blackmiscexport.h"
 #include "blackmisc/propertyindexref.h"
+#include "blackmisc/sortkey.h"
 
 #include <QDateTime>
 #include <QString>
@@ -155,6 +156,9 @@ namespace BlackMisc
         //! \copydoc BlackMisc::Mixin::Index::comparePropertyByIndex
         int comparePropertyByIndex(CPropertyIndexRef index, const ITimestampBased &compareValue) const;
 
+        //! Sort key, orders like comparePropertyByIndex
+        CSortKey sortKeyByIndex(CPropertyIndexRef index) const;
+
         //! Update missing parts
         void updateMissingParts(const ITimestampBased &other);
 
@@ -133,6 +133,19 @@ namespace BlackMisc
     {};
     //! \endcond
 
+    /*!
+     * Trait which is true if the expression a.sortKeyByIndex(i) is valid with a is an instance of T and i is an
+     * instance of CPropertyIndexRef.
+     */
+    template <typename T, typename = std::void_t<>>
+    struct THasSortKeyByIndex : public std::false_type
+    {};
+    //! \cond
+    template <typename T>
+    struct THasSortKeyByIndex<T, std::void_t<decltype(std::declval<const T &>().sortKeyByIndex(std::declval<CPropertyIndexRef>()))>> : public std::true_type
+    {};
+    //! \endcond
+
     /*!
      * Trait which is true if the expression a.propertyByIndex(i) is valid with a is an instance of T and i is an
      * instance of CPropertyIndexRef.
@@ -171,6 +184,30 @@ namespace BlackMisc
     {};
     //! \endcond
 
+    /*!
+     * Trait which is true if T has methods hasValidDbKey and getDbKey, i.e. is a datastore object.
+     */
+    template <typename T, typename = std::void_t<>>
+    struct THasDbKey : public std::false_type
+    {};
+    //! \cond
+    template <typename T>
+    struct THasDbKey<T, std::void_t<decltype(std::declval<const T &>().hasValidDbKey(), std::declval<const T &>().getDbKey())>> : public std::true_type
+    {};
+    //! \endcond
+
+    /*!
+     * Trait which is true if T has a method getCallsign, i.e. is an object identified by callsign.
+     */
+    template <typename T, typename = std::void_t<>>
+    struct THasGetCallsign : public std::false_type
+    {};
+    //! \cond
+    template <typename T>
+    struct THasGetCallsign<T, std::void_t<decltype(std::declval<const T &>().getCallsign())>> : public std::true_type
+    {};
+    //! \endcond
+
     /*!
      * Trait that detects if a type is QPrivateSignal.
      */
@@ -13,6 +13,7 @@
 
 #include <QByteArray>
 #include <QCoreApplication>
+#include <QDataStream>
 #include <QDBusMetaType>
 #include <QDir>
 #include <QDirIterator>
@@ -21,15 +22,19 @@
 #include <QIODevice>
 #include <QJsonDocument>
 #include <QList>
+#include <QMap>
 #include <QMetaMethod>
 #include <QMutexLocker>
 #include <QStandardPaths>
 #include <QThread>
+#include <QVector>
 #include <Qt>
 #include <atomic>
 #include <exception>
 #include <functional>
 #include <limits>
+#include <tuple>
+#include <utility>
 
 namespace BlackMisc
 {
@@ -354,6 +359,142 @@ namespace BlackMisc
         return status;
     }
 
+    namespace
+    {
+        //! Magic number at the start of binary cache files, "SWCF"
+        constexpr quint32 BinaryCacheMagic = 0x53574346;
+
+        //! Version of the binary cache file format
+        constexpr quint16 BinaryCacheVersion = 1;
+
+        //! Extension of JSON cache files
+        const QString &jsonFileExtension()
+        {
+            static const QString ext(".json");
+            return ext;
+        }
+
+        //! Extension of binary cache files
+        const QString &binaryFileExtension()
+        {
+            static const QString ext(".bin");
+            return ext;
+        }
+
+        //! Binary file of the namespace exists and is not older than the JSON file
+        bool useBinaryFile(const QString &baseName)
+        {
+            const QFileInfo binaryFile(baseName + binaryFileExtension());
+            if (!binaryFile.exists()) { return false; }
+            const QFileInfo jsonFile(baseName + jsonFileExtension());
+            return !jsonFile.exists() || binaryFile.lastModified() >= jsonFile.lastModified();
+        }
+
+        //! Serialize a value for a binary cache file
+        bool toBinaryValue(const CVariant &value, QByteArray &o_bytes)
+        {
+            o_bytes.clear();
+            QDataStream stream(&o_bytes, QIODevice::WriteOnly);
+            stream.setVersion(QDataStream::Qt_DefaultCompiledVersion);
+            stream << value;
+            return stream.status() == QDataStream::Ok;
+        }
+
+        /*!
+         * Binary cache file, mapped into memory.
+         *
+         * The header is followed by an index of keys with offsets and sizes, then the values serialized with QDataStream.
+         * Only the index is read when the file is opened, values are deserialized when requested.
+         */
+        class CBinaryCacheFile
+        {
+        public:
+            //! Map the file and read the index
+            bool open(const QString &fileName)
+            {
+                m_file.setFileName(fileName);
+                if (!m_file.open(QFile::ReadOnly) || m_file.size() < 1) { return false; }
+                const uchar *data = m_file.map(0, m_file.size());
+                if (!data) { return false; }
+                const QByteArray bytes = QByteArray::fromRawData(reinterpret_cast<const char *>(data), static_cast<int>(m_file.size()));
+
+                QDataStream stream(bytes);
+                quint32 magic = 0;
+                quint16 version = 0;
+                qint32 streamVersion = 0;
+                quint32 count = 0;
+                stream >> magic >> version >> streamVersion >> count;
+                if (stream.status() != QDataStream::Ok || magic != BinaryCacheMagic || version != BinaryCacheVersion) { return false; }
+                if (streamVersion < 1 || streamVersion > QDataStream::Qt_DefaultCompiledVersion) { return false; }
+                m_streamVersion = streamVersion;
+                stream.setVersion(streamVersion);
+
+                QVector<std::tuple<QString, quint64, quint64>> index;
+                for (quint32 i = 0; i < count && stream.status() == QDataStream::Ok; ++i)
+                {
+                    QString key;
+                    quint64 offset = 0;
+                    quint64 size = 0;
+                    stream >> key >> offset >> size;
+                    index.push_back({ key, offset, size });
+                }
+                if (stream.status() != QDataStream::Ok) { return false; }
+
+                const quint64 valuesStart = static_cast<quint64>(stream.device()->pos());
+                for (const auto &[key, offset, size] : std::as_const(index))
+                {
+                    if (valuesStart + offset + size > static_cast<quint64>(bytes.size())) { return false; }
+                    m_values.insert(key, QByteArray::fromRawData(bytes.constData() + valuesStart + offset, static_cast<int>(size)));
+                }
+                return true;
+            }
+
+            //! Keys in the file
+            QStringList keys() const { return m_values.keys(); }
+
+            //! Contains key?
+            bool contains(const QString &key) const { return m_values.contains(key); }
+
+            //! Deserialize the value of a key
+            bool value(const QString &key, CVariant &o_value) const
+            {
+                QDataStream stream(m_values.value(key));
+                stream.setVersion(m_streamVersion);
+                stream >> o_value;
+                return stream.status() == QDataStream::Ok;
+            }
+
+            //! Serialized values, copied so they stay valid when the file is closed
+            QMap<QString, QByteArray> copyRawValues() const
+            {
+                QMap<QString, QByteArray> values;
+                for (auto it = m_values.cbegin(); it != m_values.cend(); ++it) { values.insert(it.key(), QByteArray(it->constData(), it->size())); }
+                return values;
+            }
+
+        private:
+            QFile m_file;
+            QMap<QString, QByteArray> m_values; //!< raw data pointing into the mapped file
+            int m_streamVersion = QDataStream::Qt_DefaultCompiledVersion;
+        };
+
+        //! Write a binary cache file
+        bool writeBinaryFile(QIODevice &device, const QMap<QString, QByteArray> &values)
+        {
+            QDataStream stream(&device);
+            stream.setVersion(QDataStream::Qt_DefaultCompiledVersion);
+            stream << BinaryCacheMagic << BinaryCacheVersion << static_cast<qint32>(stream.version()) << static_cast<quint32>(values.size());
+            quint64 offset = 0;
+            for (auto it = values.cbegin(); it != values.cend(); ++it)
+            {
+                stream << it.key() << offset << static_cast<quint64>(it->size());
+                offset += static_cast<quint64>(it->size());
+            }
+            for (const QByteArray &value : values) { stream.writeRawData(value.constData(), value.size()); }
+            return stream.status() == QDataStream::Ok;
+        }
+    } // ns
+
     CStatusMessage CValueCache::saveToFiles(const QString &dir, const CVariantMap &values, const QString &keysMessage) const
     {
         QMap<QString, CVariantMap> namespaces;
@@ -366,31 +507,135 @@ namespace BlackMisc
         {
             return CStatusMessage(this).error(u"Failed to create directory '%1'") << dir;
         }
+        const bool binary = m_binaryFiles;
         for (auto it = namespaces.cbegin(); it != namespaces.cend(); ++it)
         {
-            CAtomicFile file(dir + "/" + it.key() + ".json");
-            if (!QDir::root().mkpath(QFileInfo(file).path()))
+            const QString baseName = dir + "/" + it.key();
+            if (!QDir::root().mkpath(QFileInfo(baseName).path()))
             {
-                return CStatusMessage(this).error(u"Failed to create directory '%1'") << QFileInfo(file).path();
+                return CStatusMessage(this).error(u"Failed to create directory '%1'") << QFileInfo(baseName).path();
             }
-            if (!file.open(QFile::ReadWrite | QFile::Text))
+            const CStatusMessage status = binary ? this->saveToBinaryFile(baseName, *it) : this->saveToJsonFile(baseName, *it);
+            if (status.isFailure()) { return status; }
+        }
+        return CStatusMessage(this).info(u"Written '%1' to value cache in '%2'") << (keysMessage.isEmpty() ? values.keys().to<QStringList>().join(",") : keysMessage) << dir;
+    }
+
+    CStatusMessage CValueCache::saveToJsonFile(const QString &baseName, const CVariantMap &values) const
+    {
+        CAtomicFile file(baseName + jsonFileExtension());
+        if (!file.open(QFile::ReadWrite | QFile::Text))
+        {
+            return CStatusMessage(this).error(u"Failed to open %1: %2") << file.fileName() << file.errorString();
+        }
+        auto json = QJsonDocument::fromJson(file.readAll());
+        if (json.isArray() || (json.isNull() && !json.isEmpty()))
+        {
+            return CStatusMessage(this).error(u"Invalid JSON format in %1") << file.fileName();
+        }
+        auto object = json.object();
+
+        // values written in binary format before
+        const QString binaryFileName = baseName + binaryFileExtension();
+        if (useBinaryFile(baseName))
+        {
+            CVariantMap binaryValues;
+            const CStatusMessage status = readBinaryFile(binaryFileName, binaryValues);
+            if (status.isFailure()) { return status; }
+            object = binaryValues.toMemoizedJson();
+        }
+        json.setObject(values.mergeToMemoizedJson(object));
+
+        if (!(file.seek(0) && file.resize(0) && file.write(json.toJson()) > 0 && file.checkedClose()))
+        {
+            return CStatusMessage(this).error(u"Failed to write to %1: %2") << file.fileName() << file.errorString();
+        }
+        if (QFile::exists(binaryFileName)) { QFile::remove(binaryFileName); }
+        return {};
+    }
+
+    CStatusMessage CValueCache::saveToBinaryFile(const QString &baseName, const CVariantMap &values) const
+    {
+        // values already in the file are kept as they are, without deserializing them
+        QMap<QString, QByteArray> binaryValues;
+        const QString binaryFileName = baseName + binaryFileExtension();
+        const QString jsonFileName = baseName + jsonFileExtension();
+        if (useBinaryFile(baseName))
+        {
+            CBinaryCacheFile existing;
+            if (!existing.open(binaryFileName))
             {
-                return CStatusMessage(this).error(u"Failed to open %1: %2") << file.fileName() << file.errorString();
+                return CStatusMessage(this).error(u"Invalid binary format in %1") << binaryFileName;
             }
-            auto json = QJsonDocument::fromJson(file.readAll());
+            binaryValues = existing.copyRawValues();
+        }
+        else if (QFile::exists(jsonFileName))
+        {
+            // migration of values written in JSON format before
+            QFile jsonFile(jsonFileName);
+            if (!jsonFile.open(QFile::ReadOnly | QFile::Text))
+            {
+                return CStatusMessage(this).error(u"Failed to open %1: %2") << jsonFileName << jsonFile.errorString();
+            }
+            const QJsonDocument json = QJsonDocument::fromJson(jsonFile.readAll());
             if (json.isArray() || (json.isNull() && !json.isEmpty()))
             {
-                return CStatusMessage(this).error(u"Invalid JSON format in %1") << file.fileName();
+                return CStatusMessage(this).error(u"Invalid JSON format in %1") << jsonFileName;
+            }
+            CVariantMap jsonValues;
+            const CStatusMessageList messages = jsonValues.convertFromMemoizedJsonNoThrow(json.object(), this, QStringLiteral("Migrating %1").arg(jsonFileName));
+            if (!messages.isEmpty())
+            {
+                backupFile(jsonFile);
+                CLogMessage::preformatted(messages);
+            }
+            QByteArray bytes;
+            for (auto it = jsonValues.cbegin(); it != jsonValues.cend(); ++it)
+            {
+                if (toBinaryValue(it.value(), bytes)) { binaryValues.insert(it.key(), bytes); }
             }
-            auto object = json.object();
-            json.setObject(it->mergeToMemoizedJson(object));
+        }
 
-            if (!(file.seek(0) && file.resize(0) && file.write(json.toJson()) > 0 && file.checkedClose()))
+        QByteArray bytes;
+        for (auto it = values.cbegin(); it != values.cend(); ++it)
+        {
+            if (!toBinaryValue(it.value(), bytes))
             {
-                return CStatusMessage(this).error(u"Failed to write to %1: %2") << file.fileName() << file.errorString();
+                return CStatusMessage(this).error(u"Failed to serialize '%1' for %2") << it.key() << binaryFileName;
             }
+            binaryValues.insert(it.key(), bytes);
         }
-        return CStatusMessage(this).info(u"Written '%1' to value cache in '%2'") << (keysMessage.isEmpty() ? values.keys().to<QStringList>().join(",") : keysMessage) << dir;
+
+        CAtomicFile file(binaryFileName);
+        if (!file.open(QFile::WriteOnly))
+        {
+            return CStatusMessage(this).error(u"Failed to open %1: %2") << file.fileName() << file.errorString();
+        }
+        if (!(writeBinaryFile(file, binaryValues) && file.checkedClose()))
+        {
+            return CStatusMessage(this).error(u"Failed to write to %1: %2") << file.fileName() << file.errorString();
+        }
+        if (QFile::exists(jsonFileName)) { QFile::remove(jsonFileName); }
+        return {};
+    }
+
+    CStatusMessage CValueCache::readBinaryFile(const QString &fileName, CVariantMap &o_values)
+    {
+        CBinaryCacheFile file;
+        if (!file.open(fileName))
+        {
+            return CStatusMessage(static_cast<CValueCache *>(nullptr)).error(u"Invalid binary format in %1") << fileName;
+        }
+        for (const QString &key : file.keys())
+        {
+            CVariant value;
+            if (!file.value(key, value))
+            {
+                return CStatusMessage(static_cast<CValueCache *>(nullptr)).error(u"Failed to read '%1' from %2") << key << fileName;
+            }
+            o_values.insert(key, value);
+        }
+        return {};
     }
 
     CStatusMessage CValueCache::loadFromFiles(const QString &dir)
@@ -414,56 +659,98 @@ namespace BlackMisc
             return CStatusMessage(this).error(u"Failed to read from directory '%1'") << dir;
         }
 
+        // relative file names without extension, JSON or binary files
         QMap<QString, QStringList> keysInFiles;
         for (const auto &key : keys)
         {
-            keysInFiles[key.section('/', 0, m_fileSplitDepth - 1) + ".json"].push_back(key);
+            keysInFiles[key.section('/', 0, m_fileSplitDepth - 1)].push_back(key);
         }
         if (keys.isEmpty())
         {
-            QDirIterator iter(dir, { "*.json" }, QDir::Files, QDirIterator::Subdirectories);
+            QDirIterator iter(dir, { "*" + jsonFileExtension(), "*" + binaryFileExtension() }, QDir::Files, QDirIterator::Subdirectories);
             while (iter.hasNext())
             {
-                keysInFiles.insert(QDir(dir).relativeFilePath(iter.next()), {});
+                const QString relativeFileName = QDir(dir).relativeFilePath(iter.next());
+                keysInFiles.insert(relativeFileName.left(relativeFileName.lastIndexOf('.')), {});
             }
         }
         bool ok = true;
         for (auto it = keysInFiles.cbegin(); it != keysInFiles.cend(); ++it)
         {
-            QFile file(QDir(dir).absoluteFilePath(it.key()));
-            if (!file.exists())
-            {
-                continue;
-            }
-            if (!file.open(QFile::ReadOnly | QFile::Text))
-            {
-                return CStatusMessage(this).error(u"Failed to open %1: %2") << file.fileName() << file.errorString();
-            }
-            auto json = QJsonDocument::fromJson(file.readAll());
-            if (json.isArray() || (json.isNull() && !json.isEmpty()))
-            {
-                return CStatusMessage(this).error(u"Invalid JSON format in %1") << file.fileName();
-            }
-
+            const QString baseName = QDir(dir).absoluteFilePath(it.key());
             CVariantMap temp;
-            if (keysOnly)
+            QString fileName;
+            if (useBinaryFile(baseName))
             {
-                for (const auto &key : json.object().keys()) { temp.insert(key, {}); } // clazy:exclude=range-loop
+                fileName = baseName + binaryFileExtension();
+                CBinaryCacheFile file;
+                if (!file.open(fileName))
+                {
+                    return CStatusMessage(this).error(u"Invalid binary format in %1") << fileName;
+                }
+
+                // only the requested values are deserialized
+                const QStringList fileKeys = file.keys();
+                if (keysOnly)
+                {
+                    for (const auto &key : fileKeys) { temp.insert(key, {}); }
+                }
+                else
+                {
+                    QStringList failedKeys;
+                    for (const auto &key : (it.value().isEmpty() ? fileKeys : it.value()))
+                    {
+                        if (!file.contains(key)) { continue; }
+                        CVariant value;
+                        if (file.value(key, value)) { temp.insert(key, value); }
+                        else { failedKeys.push_back(key); }
+                    }
+                    if (!failedKeys.isEmpty())
+                    {
+                        ok = false;
+                        QFile backup(fileName);
+                        backupFile(backup);
+                        CLogMessage(this).error(u"Failed to read '%1' from %2") << failedKeys.join(",") << fileName;
+                    }
+                }
             }
             else
             {
-                const QString messagePrefix = QStringLiteral("Parsing %1").arg(it.key());
-                auto messages = temp.convertFromMemoizedJsonNoThrow(json.object(), it.value(), this, messagePrefix);
-                if (it.value().isEmpty()) { messages.push_back(temp.convertFromMemoizedJsonNoThrow(json.object(), this, messagePrefix)); }
-                if (!messages.isEmpty())
+                QFile file(baseName + jsonFileExtension());
+                if (!file.exists())
+                {
+                    continue;
+                }
+                if (!file.open(QFile::ReadOnly | QFile::Text))
+                {
+                    return CStatusMessage(this).error(u"Failed to open %1: %2") << file.fileName() << file.errorString();
+                }
+                fileName = file.fileName();
+                auto json = QJsonDocument::fromJson(file.readAll());
+                if (json.isArray() || (json.isNull() && !json.isEmpty()))
+                {
+                    return CStatusMessage(this).error(u"Invalid JSON format in %1") << file.fileName();
+                }
+
+                if (keysOnly)
                 {
-                    ok = false;
-                    backupFile(file);
-                    CLogMessage::preformatted(messages);
+                    for (const auto &key : json.object().keys()) { temp.insert(key, {}); } // clazy:exclude=range-loop
+                }
+                else
+                {
+                    const QString messagePrefix = QStringLiteral("Parsing %1").arg(it.key() + jsonFileExtension());
+                    auto messages = temp.convertFromMemoizedJsonNoThrow(json.object(), it.value(), this, messagePrefix);
+                    if (it.value().isEmpty()) { messages.push_back(temp.convertFromMemoizedJsonNoThrow(json.object(), this, messagePrefix)); }
+                    if (!messages.isEmpty())
+                    {
+                        ok = false;
+                        backupFile(file);
+                        CLogMessage::preformatted(messages);
+                    }
                 }
             }
             temp.removeDuplicates(currentValues);
-            o_values.insert(temp, QFileInfo(file).lastModified().toMSecsSinceEpoch());
+            o_values.insert(temp, QFileInfo(fileName).lastModified().toMSecsSinceEpoch());
         }
         return CStatusMessage(this).info(u"Loaded cache values '%1' from '%2' '%3'") << (keysMessage.isEmpty() ? o_values.keys().to<QStringList>().join(",") : keysMessage) << dir << (ok ? "successfully" : "with errors");
     }
@@ -508,7 +795,7 @@ namespace BlackMisc
 
     QString CValueCache::filenameForKey(const QString &key) const
     {
-        return key.section('/', 0, m_fileSplitDepth - 1) + ".json";
+        return key.section('/', 0, m_fileSplitDepth - 1) + (m_binaryFiles ? binaryFileExtension() : jsonFileExtension());
     }
 
     QStringList CValueCache::enumerateFiles(const QString &dir) const
@@ -38,6 +38,7 @@
 #include <QThread>
 #include <QVariant>
 #include <QtGlobal>
+#include <atomic>
 #include <stdexcept>
 #include <cstddef>
 #include <tuple>
@@ -200,20 +201,34 @@ namespace BlackMisc
         //! \threadsafe
         CStatusMessageList loadFromJsonNoThrow(const QJsonObject &json, const CLogCategoryList &categories, const QString &prefix);
 
-        //! Save values to Json files in a given directory.
+        //! Save values to Json (or binary) files in a given directory.
         //! If prefix is provided then only those values whose keys start with that prefix.
         //! \threadsafe
         CStatusMessage saveToFiles(const QString &directory, const QString &keyPrefix = {});
 
-        //! Save values to Json files in a given directory.
+        //! Save values to Json (or binary) files in a given directory.
         //! \threadsafe
         CStatusMessage saveToFiles(const QString &directory, const QStringList &keys);
 
-        //! Load all values from Json files in a given directory.
+        //! Load all values from Json or binary files in a given directory.
         //! Values already in the cache will remain in the cache unless they are overwritten.
         //! \threadsafe
         CStatusMessage loadFromFiles(const QString &directory);
 
+        //! Save to binary instead of Json files.
+        //! \details The binary files contain an index of the keys, so single values can be loaded from the memory mapped file
+        //!          without parsing the others. Files in either format are loaded, the older format is migrated on the next save.
+        //! \threadsafe
+        void setBinaryFiles(bool binary) { m_binaryFiles = binary; }
+
+        //! Saving to binary files?
+        //! \threadsafe
+        bool isBinaryFiles() const { return m_binaryFiles; }
+
+        //! Read all values of a binary cache file.
+        //! \threadsafe
+        static CStatusMessage readBinaryFile(const QString &fileName, CVariantMap &o_values);
+
         //! Return the (relative) filename that may is (or would be) used to save the value with the given key.
         //! The file may or may not exist (because it might not have been saved yet).
         //! \threadsafe
@@ -276,11 +291,11 @@ namespace BlackMisc
         }
         //! @}
 
-        //! Save specific values to Json files in a given directory.
+        //! Save specific values to Json (or binary) files in a given directory.
         //! \threadsafe
         CStatusMessage saveToFiles(const QString &directory, const CVariantMap &values, const QString &keysMessage = {}) const;
 
-        //! Load from Json files in a given directory any values which differ from the current ones, and insert them in o_values.
+        //! Load from Json or binary files in a given directory any values which differ from the current ones, and insert them in o_values.
         //! \threadsafe
         CStatusMessage loadFromFiles(const QString &directory, const QSet<QString> &keys, const CVariantMap &current, CValueCachePacket &o_values, const QString &keysMessage = {}, bool keysOnly = false) const;
 
@@ -316,11 +331,14 @@ namespace BlackMisc
         QMap<QString, ElementPtr> m_elements;
         QMap<QString, QString> m_humanReadable;
         const int m_fileSplitDepth = 1; //!< How many levels of subdirectories to split JSON files
+        std::atomic_bool m_binaryFiles { false }; //!< Save to binary instead of JSON files
 
         Element &getElement(const QString &key);
         Element &getElement(const QString &key, QMap<QString, ElementPtr>::const_iterator pos);
         std::tuple<CVariant, qint64, bool> getValue(const QString &key);
         void backupFile(QFile &file) const;
+        CStatusMessage saveToJsonFile(const QString &baseName, const CVariantMap &values) const;
+        CStatusMessage saveToBinaryFile(const QString &baseName, const CVariantMap &values) const;
 
         virtual void connectPage(Private::CValuePage *page);
 
@@ -6,6 +6,7 @@
 #include "blackmisc/verify.h"
 #include "blackmisc/logmessage.h"
 
+#include <chrono>
 #include <future>
 #include <QTimer>
 #include <QPointer>
@@ -17,6 +18,17 @@
 namespace BlackMisc
 {
     QSet<CWorkerBase *> CWorkerBase::s_allWorkers;
+    std::atomic<qint64> CRegularThread::s_threadsCreated { 0 };
+
+    CRegularThread::CRegularThread(QObject *parent) : QThread(parent)
+    {
+        ++s_threadsCreated;
+    }
+
+    qint64 CRegularThread::getThreadsCreatedCount()
+    {
+        return s_threadsCreated;
+    }
 
     void CRegularThread::run()
     {
@@ -61,53 +73,91 @@ namespace BlackMisc
         Q_UNUSED(ok)
     }
 
-    CWorker *CWorker::fromTaskImpl(QObject *owner, const QString &name, int typeId, const std::function<QVariant()> &task)
+    CWorker *CWorker::fromTaskImpl(QObject *owner, const QString &name, int typeId, CThreadPool::Priority priority, bool ownThread, const std::function<QVariant()> &task)
     {
+        Q_ASSERT_X(owner, Q_FUNC_INFO, "Need owner");
         auto *worker = new CWorker(task);
         emit worker->aboutToStart();
         worker->setStarted();
-        auto *thread = new CRegularThread(owner);
 
         if (typeId != QMetaType::Void) { worker->m_result = QVariant(typeId, nullptr); }
+        worker->setObjectName(name);
+
+        // as with a thread owned by the owner, the task must not outlive the owner
+        connect(owner, &QObject::destroyed, worker, [worker] { worker->cancelOrWait(); }, Qt::DirectConnection);
+        if (!ownThread)
+        {
+            CThreadPool::instance().submit([worker] { worker->runTask(); }, priority);
+            return worker;
+        }
 
+        // long task, the thread ends with the task
+        auto *thread = new CRegularThread(owner);
         const QString ownerName = owner->objectName().isEmpty() ? owner->metaObject()->className() : owner->objectName();
         thread->setObjectName(ownerName + ":" + name);
-        worker->setObjectName(name);
-
-        worker->moveToThread(thread);
-        const bool s = QMetaObject::invokeMethod(worker, &CWorker::ps_runTask);
-        Q_ASSERT_X(s, Q_FUNC_INFO, "cannot invoke");
-        Q_UNUSED(s)
+        connect(thread, &QThread::started, thread, [worker, thread] {
+            worker->runTask();
+            thread->quit();
+        }, Qt::DirectConnection);
+        connect(thread, &QThread::finished, thread, &QObject::deleteLater);
         thread->start();
         return worker;
     }
 
-    void CWorker::ps_runTask()
+    void CWorker::runTask()
     {
-        m_result = m_task();
+        bool run = false;
+        {
+            QMutexLocker lock(&m_taskMutex);
+            if (!m_cancelled)
+            {
+                run = true;
+                m_taskThread = QThread::currentThread();
+                if (m_abandoned) { m_taskThread->requestInterruption(); }
+            }
+        }
+        if (run) { m_result = m_task(); }
+        {
+            QMutexLocker lock(&m_taskMutex);
+            m_taskThread = nullptr;
+        }
 
         this->setFinished();
 
-        QThread *workerThread = this->thread();
-        Q_ASSERT_X(workerThread->thread()->isRunning(), Q_FUNC_INFO, "Owner thread's event loop already ended");
-
-        // MS 2018-09 Now we post the DeferredDelete event from within the worker thread, but rely on it being dispatched
-        //            by the owner thread. Posted events are moved along with the object when moveToThread is called.
+        // the worker never left the thread which constructed it, the DeferredDelete event is dispatched there
+        // must not access the worker beyond this point, as it could be deleted at any moment
         this->deleteLater();
+    }
 
-        this->moveToThread(workerThread->thread()); // move worker back to the thread which constructed it, so there is no race on deletion
-        // must not access the worker beyond this point, as it now lives in the owner's thread and could be deleted at any moment
+    void CWorker::cancelOrWait()
+    {
+        {
+            QMutexLocker lock(&m_taskMutex);
+            if (!m_taskThread)
+            {
+                // not yet started (or already finished)
+                m_cancelled = true;
+                return;
+            }
+        }
 
-        QMetaObject::invokeMethod(workerThread, [workerThread] {
-            // quit and wait is redundant as the CRegularThread dtor will do that anyway, but put here for debugging
-            workerThread->quit();
-            const bool ok = workerThread->wait(5000);
-            const QString as = QStringLiteral("Worker thread '%2' refuses to stop after worker finished").arg(workerThread->objectName());
-            const QByteArray asBA = as.toLatin1();
-            BLACK_AUDIT_X(ok, Q_FUNC_INFO, asBA);
+        // the wait avoids the task accessing the destroyed owner
+        auto promise = std::make_shared<std::promise<void>>();
+        this->then([promise] { promise->set_value(); });
+        const int timeoutMs = 5 * 1000;
+        const bool ok = promise->get_future().wait_for(std::chrono::milliseconds(timeoutMs)) == std::future_status::ready;
+        const QString as = QStringLiteral("Wait timeout after %1ms for '%2'").arg(timeoutMs).arg(this->objectName());
+        const QByteArray asBA = as.toLatin1();
+        BLACK_AUDIT_X(ok, Q_FUNC_INFO, asBA);
+        Q_UNUSED(ok)
+    }
 
-            workerThread->deleteLater();
-        });
+    void CWorker::interrupt() noexcept
+    {
+        // the pool thread is only interrupted while running the task, CThreadPool replaces it afterwards
+        QMutexLocker lock(&m_taskMutex);
+        m_abandoned = true;
+        if (m_taskThread) { m_taskThread->requestInterruption(); }
     }
 
     CWorkerBase::CWorkerBase()
@@ -135,16 +185,21 @@ namespace BlackMisc
 
     void CWorkerBase::abandon() noexcept
     {
-        if (thread() != thread()->thread()) { thread()->requestInterruption(); }
+        interrupt();
         quit();
     }
 
     void CWorkerBase::abandonAndWait() noexcept
     {
-        if (thread() != thread()->thread()) { thread()->requestInterruption(); }
+        interrupt();
         quitAndWait();
     }
 
+    void CWorkerBase::interrupt() noexcept
+    {
+        if (thread() != thread()->thread()) { thread()->requestInterruption(); }
+    }
+
     bool CWorkerBase::isAbandoned() const
     {
         Q_ASSERT(thread() == QThread::currentThread());
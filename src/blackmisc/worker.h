@@ -12,6 +12,7 @@
 #include "blackmisc/invoke.h"
 #include "blackmisc/promise.h"
 #include "blackmisc/stacktrace.h"
+#include "blackmisc/threadpool.h"
 
 #include <QFuture>
 #include <QMetaObject>
@@ -45,17 +46,22 @@ namespace BlackMisc
 
     public:
         //! Constructor
-        CRegularThread(QObject *parent = nullptr) : QThread(parent) {}
+        CRegularThread(QObject *parent = nullptr);
 
         //! Destructor
         virtual ~CRegularThread() override;
 
+        //! Number of threads created so far
+        //! \threadsafe
+        static qint64 getThreadsCreatedCount();
+
     protected:
         //! \copydoc QThread::run
         virtual void run() override;
 
     private:
         std::atomic<void *> m_handle { nullptr };
+        static std::atomic<qint64> s_threadsCreated;
     };
 
     /*!
@@ -176,6 +182,7 @@ namespace BlackMisc
     private:
         virtual void quit() noexcept {}
         virtual void quitAndWait() noexcept { waitForFinished(); }
+        virtual void interrupt() noexcept;
 
         bool m_started = false;
         bool m_finished = false;
@@ -184,7 +191,7 @@ namespace BlackMisc
     };
 
     /*!
-     * Class for doing some arbitrary parcel of work in its own thread.
+     * Class for doing some arbitrary parcel of work in a thread of the CThreadPool.
      *
      * The task is exposed as a function object, so could be a lambda or a hand-written closure.
      * CWorker can not be subclassed, instead it can be extended with rich callable task objects.
@@ -195,25 +202,39 @@ namespace BlackMisc
 
     public:
         /*!
-         * Returns a new worker object which lives in a new thread.
+         * Returns a new worker object whose task is run by a thread of the process wide CThreadPool.
          * \note The worker calls its own deleteLater method when finished.
          *       Typically assign it to a QPointer if you want to store it.
-         * \param owner Will be the parent of the new thread (the worker has no parent).
-         * \param name A name for the task, which will be used to create a name for the thread.
-         * \param task A function object which will be run by the worker in its thread.
+         * \param owner When destroyed, waits for the running task or cancels the task not yet started (the worker has no parent).
+         * \param name A name for the task, which will be used as name of the worker.
+         * \param task A function object which will be run by the worker in a pool thread.
          */
         template <typename F>
         static CWorker *fromTask(QObject *owner, const QString &name, F &&task)
+        {
+            return fromTask(owner, name, CThreadPool::Background, std::forward<F>(task));
+        }
+
+        //! Returns a new worker object whose task is run with the given priority.
+        //! \copydetails CWorker::fromTask(QObject *, const QString &, F &&)
+        template <typename F>
+        static CWorker *fromTask(QObject *owner, const QString &name, CThreadPool::Priority priority, F &&task)
         {
             int typeId = qMetaTypeId<std::decay_t<decltype(std::forward<F>(task)())>>();
-            return fromTaskImpl(owner, name, typeId, [task = std::forward<F>(task)]() mutable {
-                if constexpr (std::is_void_v<decltype(task())>)
-                {
-                    std::move(task)();
-                    return QVariant();
-                }
-                else { return QVariant::fromValue(std::move(task)()); }
-            });
+            return fromTaskImpl(owner, name, typeId, priority, false, variantTask(std::forward<F>(task)));
+        }
+
+        /*!
+         * Returns a new worker object whose task is run in a new thread of its own, not in the CThreadPool.
+         * For long or blocking tasks like loading files from disk, which would occupy a pool thread for seconds
+         * and delay the interactive tasks.
+         * \copydetails CWorker::fromTask(QObject *, const QString &, F &&)
+         */
+        template <typename F>
+        static CWorker *fromLongTask(QObject *owner, const QString &name, F &&task)
+        {
+            int typeId = qMetaTypeId<std::decay_t<decltype(std::forward<F>(task)())>>();
+            return fromTaskImpl(owner, name, typeId, CThreadPool::Background, true, variantTask(std::forward<F>(task)));
         }
 
         //! Connects to a functor to which will be passed the result when the task is finished.
@@ -253,13 +274,32 @@ namespace BlackMisc
             return this->resultNoWait<R>();
         }
 
-    private slots:
-        //! Called when the worker has been moved into its new thread.
-        void ps_runTask();
-
     private:
         CWorker(const std::function<QVariant()> &task) : m_task(task) {}
-        static CWorker *fromTaskImpl(QObject *owner, const QString &name, int typeId, const std::function<QVariant()> &task);
+        static CWorker *fromTaskImpl(QObject *owner, const QString &name, int typeId, CThreadPool::Priority priority, bool ownThread, const std::function<QVariant()> &task);
+
+        //! Task returning its result as QVariant
+        template <typename F>
+        static std::function<QVariant()> variantTask(F &&task)
+        {
+            return [task = std::forward<F>(task)]() mutable {
+                if constexpr (std::is_void_v<decltype(task())>)
+                {
+                    std::move(task)();
+                    return QVariant();
+                }
+                else { return QVariant::fromValue(std::move(task)()); }
+            };
+        }
+
+        //! Called by the pool thread
+        void runTask();
+
+        //! Owner destroyed, cancel the task if not yet started, otherwise wait for it
+        void cancelOrWait();
+
+        //! Interrupt the pool thread while running the task
+        virtual void interrupt() noexcept override;
 
         template <typename R>
         R resultNoWait()
@@ -270,6 +310,10 @@ namespace BlackMisc
 
         std::function<QVariant()> m_task;
         QVariant m_result;
+        QMutex m_taskMutex; //!< protects the members below
+        QThread *m_taskThread = nullptr; //!< pool thread while running the task
+        bool m_abandoned = false; //!< interrupt the task
+        bool m_cancelled = false; //!< do not run the task
     };
 
     /*!
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
 
 #include "audioutilities.h"
+#include "blacksound/dsp/simdkernels.h"
 #include "blackmisc/audio/audiodeviceinfolist.h"
 #include "blackconfig/buildconfig.h"
 
@@ -42,9 +43,10 @@ namespace BlackSound
 
     QVector<qint16> convertFloatBytesTo16BitPCM(const QByteArray &input)
     {
-        Q_UNUSED(input)
-        // qFatal("Not implemented");
-        return {};
+        const int inputSamples = input.size() / 4; // 32 bit float input, so 4 bytes per sample
+        QVector<qint16> output(inputSamples);
+        Dsp::convertFloatToShort(reinterpret_cast<const float *>(input.constData()), output.data(), inputSamples);
+        return output;
     }
 
     QVector<float> convertFromMonoToStereo(const QVector<float> &mono)
@@ -72,11 +74,8 @@ namespace BlackSound
 
     QVector<float> convertFromShortToFloat(const QVector<qint16> &input)
     {
-        QVector<float> output;
-        for (auto sample : input)
-        {
-            output.push_back(sample / 32768.0f);
-        }
+        QVector<float> output(input.size());
+        Dsp::convertShortToFloat(input.constData(), output.data(), input.size());
         return output;
     }
 
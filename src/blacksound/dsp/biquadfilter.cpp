@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
 
 #include "biquadfilter.h"
+#include "simdkernels.h"
 #include "blackmisc/verify.h"
 #include "blackconfig/buildconfig.h"
 
@@ -29,6 +30,31 @@ namespace BlackSound::Dsp
         return m_y1;
     }
 
+    void BiQuadFilter::transform(float *samples, int count)
+    {
+        if (count < 1) { return; }
+        if (simdLevel() == SimdScalar)
+        {
+            for (int n = 0; n < count; n++) { samples[n] = this->transform(samples[n]); }
+            return;
+        }
+
+        const float x1 = m_x1;
+        const float x2 = m_x2;
+        m_x2 = count > 1 ? samples[count - 2] : m_x1;
+        m_x1 = samples[count - 1];
+        biQuadFeedForward(samples, count, static_cast<float>(m_a0), static_cast<float>(m_a1), static_cast<float>(m_a2), x1, x2);
+
+        // feedback is a recursion
+        for (int n = 0; n < count; n++)
+        {
+            const double result = samples[n] - m_a3 * m_y1 - m_a4 * m_y2;
+            m_y2 = m_y1;
+            m_y1 = static_cast<float>(result);
+            samples[n] = m_y1;
+        }
+    }
+
     void BiQuadFilter::setCoefficients(double aa0, double aa1, double aa2, double b0, double b1, double b2)
     {
         if (CBuildConfig::isLocalDeveloperDebugBuild()) { BLACK_VERIFY_X(qAbs(aa0) > 1E-06, Q_FUNC_INFO, "Div by zero?"); }
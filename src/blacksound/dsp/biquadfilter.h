@@ -11,7 +11,7 @@
 namespace BlackSound::Dsp
 {
     //! Digital biquad filter
-    class BiQuadFilter
+    class BLACKSOUND_EXPORT BiQuadFilter
     {
     public:
         //! Ctor
@@ -20,6 +20,10 @@ namespace BlackSound::Dsp
         //! Transform
         float transform(float inSample);
 
+        //! Transform samples in place
+        //! \remark feed forward part vectorized, \sa biQuadFeedForward
+        void transform(float *samples, int count);
+
         //! @{
         //! Set filter parameters
         void setCoefficients(double aa0, double aa1, double aa2, double b0, double b1, double b2);
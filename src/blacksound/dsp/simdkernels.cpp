@@ -0,0 +1,342 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+#include "simdkernels.h"
+
+#include <QtGlobal>
+#include <atomic>
+#include <cmath>
+
+// SSE2 is part of x86_64, for 32bit x86 only if enabled by the compiler
+#if defined(Q_PROCESSOR_X86_64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define BLACKSOUND_DSP_SSE2
+#    define BLACKSOUND_DSP_AVX2
+#    include <immintrin.h>
+#    if defined(Q_CC_MSVC) && !defined(Q_CC_CLANG)
+#        include <intrin.h>
+#        define BLACKSOUND_DSP_TARGET_AVX2
+#    else
+#        define BLACKSOUND_DSP_TARGET_AVX2 __attribute__((target("avx2")))
+#    endif
+#endif
+
+namespace BlackSound::Dsp
+{
+    namespace
+    {
+        constexpr float ShortToFloat = 1.0f / 32768.0f;
+        constexpr float FloatToShort = 32768.0f;
+        constexpr float ShortMin = -32768.0f;
+        constexpr float ShortMax = 32767.0f;
+
+        //! @{
+        //! Scalar kernels, also used for the remaining samples of the vectorized ones
+        void mixAddScalar(float *destination, const float *source, int count)
+        {
+            for (int n = 0; n < count; n++) { destination[n] += source[n]; }
+        }
+
+        void applyGainScalar(float *samples, int count, float gain)
+        {
+            for (int n = 0; n < count; n++) { samples[n] *= gain; }
+        }
+
+        void convertShortToFloatScalar(const qint16 *input, float *output, int count)
+        {
+            for (int n = 0; n < count; n++) { output[n] = input[n] * ShortToFloat; }
+        }
+
+        void convertFloatToShortScalar(const float *input, qint16 *output, int count)
+        {
+            for (int n = 0; n < count; n++)
+            {
+                const float value = qBound(ShortMin, input[n] * FloatToShort, ShortMax);
+                output[n] = static_cast<qint16>(std::lrint(value)); // rounds like the SIMD conversion
+            }
+        }
+
+        //! Samples [2, end) backwards, then the first two samples using the preceding inputs
+        void biQuadFeedForwardScalar(float *samples, int end, int count, float b0, float b1, float b2, float x1, float x2)
+        {
+            for (int n = end - 1; n >= 2; n--) { samples[n] = b0 * samples[n] + b1 * samples[n - 1] + b2 * samples[n - 2]; }
+            if (count > 1) { samples[1] = b0 * samples[1] + b1 * samples[0] + b2 * x1; }
+            if (count > 0) { samples[0] = b0 * samples[0] + b1 * x1 + b2 * x2; }
+        }
+        //! @}
+
+#ifdef BLACKSOUND_DSP_SSE2
+        //! @{
+        //! SSE2 kernels
+        void mixAddSse2(float *destination, const float *source, int count)
+        {
+            int n = 0;
+            for (; n + 4 <= count; n += 4)
+            {
+                _mm_storeu_ps(destination + n, _mm_add_ps(_mm_loadu_ps(destination + n), _mm_loadu_ps(source + n)));
+            }
+            mixAddScalar(destination + n, source + n, count - n);
+        }
+
+        void applyGainSse2(float *samples, int count, float gain)
+        {
+            const __m128 g = _mm_set1_ps(gain);
+            int n = 0;
+            for (; n + 4 <= count; n += 4) { _mm_storeu_ps(samples + n, _mm_mul_ps(_mm_loadu_ps(samples + n), g)); }
+            applyGainScalar(samples + n, count - n, gain);
+        }
+
+        void convertShortToFloatSse2(const qint16 *input, float *output, int count)
+        {
+            const __m128 scale = _mm_set1_ps(ShortToFloat);
+            int n = 0;
+            for (; n + 8 <= count; n += 8)
+            {
+                const __m128i shorts = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + n));
+                const __m128i low = _mm_srai_epi32(_mm_unpacklo_epi16(shorts, shorts), 16); // sign extended
+                const __m128i high = _mm_srai_epi32(_mm_unpackhi_epi16(shorts, shorts), 16);
+                _mm_storeu_ps(output + n, _mm_mul_ps(_mm_cvtepi32_ps(low), scale));
+                _mm_storeu_ps(output + n + 4, _mm_mul_ps(_mm_cvtepi32_ps(high), scale));
+            }
+            convertShortToFloatScalar(input + n, output + n, count - n);
+        }
+
+        void convertFloatToShortSse2(const float *input, qint16 *output, int count)
+        {
+            const __m128 scale = _mm_set1_ps(FloatToShort);
+            const __m128 min = _mm_set1_ps(ShortMin);
+            const __m128 max = _mm_set1_ps(ShortMax);
+            int n = 0;
+            for (; n + 8 <= count; n += 8)
+            {
+                const __m128 low = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(input + n), scale), min), max);
+                const __m128 high = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(input + n + 4), scale), min), max);
+                const __m128i shorts = _mm_packs_epi32(_mm_cvtps_epi32(low), _mm_cvtps_epi32(high));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(output + n), shorts);
+            }
+            convertFloatToShortScalar(input + n, output + n, count - n);
+        }
+
+        void biQuadFeedForwardSse2(float *samples, int count, float b0, float b1, float b2, float x1, float x2)
+        {
+            // backwards, so the inputs x[n-1] and x[n-2] are not yet overwritten
+            const __m128 c0 = _mm_set1_ps(b0);
+            const __m128 c1 = _mm_set1_ps(b1);
+            const __m128 c2 = _mm_set1_ps(b2);
+            int n = count;
+            while (n - 4 >= 2)
+            {
+                n -= 4;
+                const __m128 y = _mm_add_ps(_mm_add_ps(_mm_mul_ps(c0, _mm_loadu_ps(samples + n)), _mm_mul_ps(c1, _mm_loadu_ps(samples + n - 1))), _mm_mul_ps(c2, _mm_loadu_ps(samples + n - 2)));
+                _mm_storeu_ps(samples + n, y);
+            }
+            biQuadFeedForwardScalar(samples, n, count, b0, b1, b2, x1, x2);
+        }
+        //! @}
+#endif
+
+#ifdef BLACKSOUND_DSP_AVX2
+        //! @{
+        //! AVX2 kernels, only called if supported by the CPU
+        BLACKSOUND_DSP_TARGET_AVX2 void mixAddAvx2(float *destination, const float *source, int count)
+        {
+            int n = 0;
+            for (; n + 8 <= count; n += 8)
+            {
+                _mm256_storeu_ps(destination + n, _mm256_add_ps(_mm256_loadu_ps(destination + n), _mm256_loadu_ps(source + n)));
+            }
+            mixAddScalar(destination + n, source + n, count - n);
+        }
+
+        BLACKSOUND_DSP_TARGET_AVX2 void applyGainAvx2(float *samples, int count, float gain)
+        {
+            const __m256 g = _mm256_set1_ps(gain);
+            int n = 0;
+            for (; n + 8 <= count; n += 8) { _mm256_storeu_ps(samples + n, _mm256_mul_ps(_mm256_loadu_ps(samples + n), g)); }
+            applyGainScalar(samples + n, count - n, gain);
+        }
+
+        BLACKSOUND_DSP_TARGET_AVX2 void convertShortToFloatAvx2(const qint16 *input, float *output, int count)
+        {
+            const __m256 scale = _mm256_set1_ps(ShortToFloat);
+            int n = 0;
+            for (; n + 8 <= count; n += 8)
+            {
+                const __m256i ints = _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(input + n)));
+                _mm256_storeu_ps(output + n, _mm256_mul_ps(_mm256_cvtepi32_ps(ints), scale));
+            }
+            convertShortToFloatScalar(input + n, output + n, count - n);
+        }
+
+        BLACKSOUND_DSP_TARGET_AVX2 void convertFloatToShortAvx2(const float *input, qint16 *output, int count)
+        {
+            const __m256 scale = _mm256_set1_ps(FloatToShort);
+            const __m256 min = _mm256_set1_ps(ShortMin);
+            const __m256 max = _mm256_set1_ps(ShortMax);
+            int n = 0;
+            for (; n + 16 <= count; n += 16)
+            {
+                const __m256 low = _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(input + n), scale), min), max);
+                const __m256 high = _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(input + n + 8), scale), min), max);
+                // packs works per 128bit lane, the permute restores the order
+                const __m256i shorts = _mm256_packs_epi32(_mm256_cvtps_epi32(low), _mm256_cvtps_epi32(high));
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(output + n), _mm256_permute4x64_epi64(shorts, 0xD8));
+            }
+            convertFloatToShortScalar(input + n, output + n, count - n);
+        }
+
+        BLACKSOUND_DSP_TARGET_AVX2 void biQuadFeedForwardAvx2(float *samples, int count, float b0, float b1, float b2, float x1, float x2)
+        {
+            const __m256 c0 = _mm256_set1_ps(b0);
+            const __m256 c1 = _mm256_set1_ps(b1);
+            const __m256 c2 = _mm256_set1_ps(b2);
+            int n = count;
+            while (n - 8 >= 2)
+            {
+                n -= 8;
+                const __m256 y = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(c0, _mm256_loadu_ps(samples + n)), _mm256_mul_ps(c1, _mm256_loadu_ps(samples + n - 1))), _mm256_mul_ps(c2, _mm256_loadu_ps(samples + n - 2)));
+                _mm256_storeu_ps(samples + n, y);
+            }
+            biQuadFeedForwardScalar(samples, n, count, b0, b1, b2, x1, x2);
+        }
+        //! @}
+
+        //! AVX2 supported by CPU and OS?
+        bool cpuSupportsAvx2()
+        {
+#    if defined(Q_CC_MSVC) && !defined(Q_CC_CLANG)
+            int info[4];
+            __cpuid(info, 0);
+            if (info[0] < 7) { return false; }
+            __cpuid(info, 1);
+            const bool osxsave = info[2] & (1 << 27);
+            const bool avx = info[2] & (1 << 28);
+            if (!osxsave || !avx) { return false; }
+            if ((_xgetbv(0) & 6) != 6) { return false; } // YMM state enabled by OS
+            __cpuidex(info, 7, 0);
+            return info[1] & (1 << 5);
+#    else
+            return __builtin_cpu_supports("avx2");
+#    endif
+        }
+#endif
+
+        //! Level in use
+        std::atomic<int> &currentLevel()
+        {
+            static std::atomic<int> level { detectedSimdLevel() };
+            return level;
+        }
+    }
+
+    SimdLevel detectedSimdLevel()
+    {
+        static const SimdLevel level = [] {
+#if defined(BLACKSOUND_DSP_AVX2)
+            if (cpuSupportsAvx2()) { return SimdAvx2; }
+#endif
+#if defined(BLACKSOUND_DSP_SSE2)
+            return SimdSse2;
+#else
+            return SimdScalar;
+#endif
+        }();
+        return level;
+    }
+
+    SimdLevel simdLevel()
+    {
+        return static_cast<SimdLevel>(currentLevel().load(std::memory_order_relaxed));
+    }
+
+    SimdLevel setSimdLevel(SimdLevel level)
+    {
+        const SimdLevel used = qMin(level, detectedSimdLevel());
+        currentLevel().store(used, std::memory_order_relaxed);
+        return used;
+    }
+
+    const QString &toQString(SimdLevel level)
+    {
+        static const QString scalar("scalar");
+        static const QString sse2("SSE2");
+        static const QString avx2("AVX2");
+        switch (level)
+        {
+        case SimdSse2: return sse2;
+        case SimdAvx2: return avx2;
+        case SimdScalar:
+        default: break;
+        }
+        return scalar;
+    }
+
+    void mixAdd(float *destination, const float *source, int count)
+    {
+        switch (simdLevel())
+        {
+#ifdef BLACKSOUND_DSP_AVX2
+        case SimdAvx2: mixAddAvx2(destination, source, count); return;
+#endif
+#ifdef BLACKSOUND_DSP_SSE2
+        case SimdSse2: mixAddSse2(destination, source, count); return;
+#endif
+        default: mixAddScalar(destination, source, count); return;
+        }
+    }
+
+    void applyGain(float *samples, int count, float gain)
+    {
+        switch (simdLevel())
+        {
+#ifdef BLACKSOUND_DSP_AVX2
+        case SimdAvx2: applyGainAvx2(samples, count, gain); return;
+#endif
+#ifdef BLACKSOUND_DSP_SSE2
+        case SimdSse2: applyGainSse2(samples, count, gain); return;
+#endif
+        default: applyGainScalar(samples, count, gain); return;
+        }
+    }
+
+    void convertShortToFloat(const qint16 *input, float *output, int count)
+    {
+        switch (simdLevel())
+        {
+#ifdef BLACKSOUND_DSP_AVX2
+        case SimdAvx2: convertShortToFloatAvx2(input, output, count); return;
+#endif
+#ifdef BLACKSOUND_DSP_SSE2
+        case SimdSse2: convertShortToFloatSse2(input, output, count); return;
+#endif
+        default: convertShortToFloatScalar(input, output, count); return;
+        }
+    }
+
+    void convertFloatToShort(const float *input, qint16 *output, int count)
+    {
+        switch (simdLevel())
+        {
+#ifdef BLACKSOUND_DSP_AVX2
+        case SimdAvx2: convertFloatToShortAvx2(input, output, count); return;
+#endif
+#ifdef BLACKSOUND_DSP_SSE2
+        case SimdSse2: convertFloatToShortSse2(input, output, count); return;
+#endif
+        default: convertFloatToShortScalar(input, output, count); return;
+        }
+    }
+
+    void biQuadFeedForward(float *samples, int count, float b0, float b1, float b2, float x1, float x2)
+    {
+        switch (simdLevel())
+        {
+#ifdef BLACKSOUND_DSP_AVX2
+        case SimdAvx2: biQuadFeedForwardAvx2(samples, count, b0, b1, b2, x1, x2); return;
+#endif
+#ifdef BLACKSOUND_DSP_SSE2
+        case SimdSse2: biQuadFeedForwardSse2(samples, count, b0, b1, b2, x1, x2); return;
+#endif
+        default: biQuadFeedForwardScalar(samples, count, count, b0, b1, b2, x1, x2); return;
+        }
+    }
+} // ns
@@ -0,0 +1,58 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \file
+
+#ifndef BLACKSOUND_DSP_SIMDKERNELS_H
+#define BLACKSOUND_DSP_SIMDKERNELS_H
+
+#include "blacksound/blacksoundexport.h"
+
+#include <QString>
+#include <QtGlobal>
+
+namespace BlackSound::Dsp
+{
+    //! Instruction set used by the DSP kernels
+    enum SimdLevel
+    {
+        SimdScalar, //!< plain C++
+        SimdSse2, //!< 4 floats
+        SimdAvx2 //!< 8 floats
+    };
+
+    //! Best instruction set supported by the CPU (and the compiler)
+    BLACKSOUND_EXPORT SimdLevel detectedSimdLevel();
+
+    //! Instruction set used by the kernels, the detected one by default
+    BLACKSOUND_EXPORT SimdLevel simdLevel();
+
+    //! Use the given instruction set, capped at the detected one
+    //! \remark for tests and benchmarks, returns the instruction set in use
+    BLACKSOUND_EXPORT SimdLevel setSimdLevel(SimdLevel level);
+
+    //! Name of the instruction set
+    BLACKSOUND_EXPORT const QString &toQString(SimdLevel level);
+
+    //! Mix: destination[n] += source[n]
+    BLACKSOUND_EXPORT void mixAdd(float *destination, const float *source, int count);
+
+    //! Gain: samples[n] *= gain
+    BLACKSOUND_EXPORT void applyGain(float *samples, int count, float gain);
+
+    //! 16bit PCM to float -1..1
+    BLACKSOUND_EXPORT void convertShortToFloat(const qint16 *input, float *output, int count);
+
+    //! Float -1..1 to 16bit PCM, values out of range are clipped
+    BLACKSOUND_EXPORT void convertFloatToShort(const float *input, qint16 *output, int count);
+
+    //! Feed forward part of a biquad filter, in place: x[n] = b0 * x[n] + b1 * x[n-1] + b2 * x[n-2]
+    //! \param samples input, replaced by the result
+    //! \param count number of samples
+    //! \param b0 b1 b2 coefficients
+    //! \param x1 x2 the inputs x[-1] and x[-2] preceding the samples
+    //! \remark the feedback part is a recursion, it has to be calculated sample by sample, \sa BiQuadFilter::transform
+    BLACKSOUND_EXPORT void biQuadFeedForward(float *samples, int count, float b0, float b1, float b2, float x1, float x2);
+} // ns
+
+#endif // guard
@@ -4,40 +4,94 @@
 #include "bufferedwaveprovider.h"
 #include "blacksound/audioutilities.h"
 
-#include <QDebug>
+#include <algorithm>
 
 namespace BlackSound::SampleProvider
 {
-    CBufferedWaveProvider::CBufferedWaveProvider(const QAudioFormat &format, QObject *parent) : ISampleProvider(parent)
+    CBufferedWaveProvider::CBufferedWaveProvider(const QAudioFormat &format, int bufferDurationMs, QObject *parent) : ISampleProvider(parent)
     {
         const QString on = QStringLiteral("%1 format: '%2'").arg(this->metaObject()->className(), BlackSound::toQString(format));
         this->setObjectName(on);
 
-        // Set buffer size to 10 secs
-        m_maxBufferSize = format.bytesForDuration(10 * 1000 * 1000);
+        // samples, not bytes
+        const qint64 samplesPerSecond = static_cast<qint64>(qMax(format.sampleRate(), 1)) * qMax(format.channelCount(), 1);
+        m_capacity = static_cast<int>(qMax<qint64>(samplesPerSecond * qMax(bufferDurationMs, 1) / 1000, 1));
+        m_buffer.resize(m_capacity);
     }
 
-    void CBufferedWaveProvider::addSamples(const QVector<float> &samples)
+    template <class WRITER>
+    int CBufferedWaveProvider::write(int count, WRITER writer)
     {
-        int delta = m_audioBuffer.size() + samples.size() - m_maxBufferSize;
-        if (delta > 0)
+        if (count < 1) { return 0; }
+        const int free = this->freeSamples();
+        const int toWrite = qMin(count, free);
+        if (toWrite < count) { m_droppedSamples.fetch_add(count - toWrite, std::memory_order_relaxed); }
+        if (toWrite < 1) { return 0; }
+
+        const qint64 writePosition = m_writePosition.load(std::memory_order_relaxed);
+        const int start = static_cast<int>(writePosition % m_capacity);
+        const int firstPart = qMin(toWrite, m_capacity - start);
+        float *buffer = m_buffer.data();
+        writer(buffer + start, 0, firstPart);
+        if (firstPart < toWrite) { writer(buffer, firstPart, toWrite - firstPart); }
+
+        // publish the samples to the consumer
+        m_writePosition.store(writePosition + toWrite, std::memory_order_release);
+        return toWrite;
+    }
+
+    int CBufferedWaveProvider::addSamples(const float *samples, int count)
+    {
+        return this->write(count, [samples](float *destination, int offset, int length) {
+            std::copy(samples + offset, samples + offset + length, destination);
+        });
+    }
+
+    int CBufferedWaveProvider::addSilence(int count)
+    {
+        return this->write(count, [](float *destination, int, int length) {
+            std::fill(destination, destination + length, 0.0f);
+        });
+    }
+
+    int CBufferedWaveProvider::readSamples(float *samples, qint64 count)
+    {
+        qint64 readPosition = m_readPosition.load(std::memory_order_relaxed);
+        const qint64 clearPosition = m_clearPosition.load(std::memory_order_acquire);
+        if (clearPosition > readPosition) { readPosition = clearPosition; }
+
+        const qint64 writePosition = m_writePosition.load(std::memory_order_acquire);
+        const int len = static_cast<int>(qMin(count, writePosition - readPosition));
+        if (len > 0)
         {
-            m_audioBuffer.remove(0, delta);
+            const int start = static_cast<int>(readPosition % m_capacity);
+            const int firstPart = qMin(len, m_capacity - start);
+            const float *buffer = m_buffer.constData();
+            std::copy(buffer + start, buffer + start + firstPart, samples);
+            if (firstPart < len) { std::copy(buffer, buffer + len - firstPart, samples + firstPart); }
+            readPosition += len;
         }
-        m_audioBuffer.append(samples);
+
+        // release the space to the producer
+        m_readPosition.store(readPosition, std::memory_order_release);
+        return qMax(len, 0);
     }
 
-    int CBufferedWaveProvider::readSamples(QVector<float> &samples, qint64 count)
+    int CBufferedWaveProvider::getBufferedSamples() const
     {
-        const int len = static_cast<int>(qMin(count, static_cast<qint64>(m_audioBuffer.size())));
-        samples = m_audioBuffer.mid(0, len);
-        // if (len != 0) qDebug() << "Reading" << count << "samples." << m_audioBuffer.size() << "currently in the buffer.";
-        m_audioBuffer.remove(0, len);
-        return len;
+        const qint64 writePosition = m_writePosition.load(std::memory_order_acquire);
+        const qint64 readPosition = qMax(m_readPosition.load(std::memory_order_acquire), m_clearPosition.load(std::memory_order_acquire));
+        return static_cast<int>(qMax<qint64>(writePosition - readPosition, 0));
     }
 
     void CBufferedWaveProvider::clearBuffer()
     {
-        m_audioBuffer.clear();
+        m_clearPosition.store(m_writePosition.load(std::memory_order_acquire), std::memory_order_release);
+    }
+
+    int CBufferedWaveProvider::freeSamples() const
+    {
+        const qint64 used = m_writePosition.load(std::memory_order_relaxed) - m_readPosition.load(std::memory_order_acquire);
+        return static_cast<int>(qMax<qint64>(m_capacity - used, 0));
     }
 } // ns
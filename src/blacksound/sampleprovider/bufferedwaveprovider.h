@@ -10,35 +10,68 @@
 #include "blacksound/sampleprovider/sampleprovider.h"
 
 #include <QAudioFormat>
-#include <QByteArray>
 #include <QVector>
+#include <atomic>
 
 namespace BlackSound::SampleProvider
 {
     //! Buffered wave generator
+    //! \remark lock free ring buffer with one producer (adding samples) and one consumer (reading samples),
+    //!         the capacity is allocated once, adding or reading samples does not allocate memory
     class BLACKSOUND_EXPORT CBufferedWaveProvider : public ISampleProvider
     {
         Q_OBJECT
 
     public:
         //! Ctor
-        CBufferedWaveProvider(const QAudioFormat &format, QObject *parent = nullptr);
+        //! \param format audio format, used to calculate the capacity
+        //! \param bufferDurationMs buffered duration, samples exceeding the capacity are dropped
+        //! \param parent QObject parent
+        CBufferedWaveProvider(const QAudioFormat &format, int bufferDurationMs = 10 * 1000, QObject *parent = nullptr);
 
         //! Add samples
-        void addSamples(const QVector<float> &samples);
+        //! \remark producer side, returns the number of samples added
+        int addSamples(const float *samples, int count);
 
-        //! ISampleProvider::readSamples
-        virtual int readSamples(QVector<float> &samples, qint64 count) override;
+        //! Add samples
+        //! \remark producer side, returns the number of samples added
+        int addSamples(const QVector<float> &samples) { return this->addSamples(samples.constData(), samples.size()); }
+
+        //! Add silence
+        //! \remark producer side, returns the number of samples added
+        int addSilence(int count);
+
+        //! \copydoc ISampleProvider::readSamples
+        //! \remark consumer side
+        virtual int readSamples(float *samples, qint64 count) override;
+
+        //! Number of samples in the buffer
+        int getBufferedSamples() const;
 
-        //! Bytes from buffer
-        int getBufferedBytes() const { return m_audioBuffer.size(); }
+        //! Max. number of buffered samples
+        int getCapacity() const { return m_capacity; }
+
+        //! Number of samples dropped because the buffer was full
+        qint64 getDroppedSamples() const { return m_droppedSamples.load(std::memory_order_relaxed); }
 
         //! Clear the buffer
+        //! \remark the samples added so far are skipped by the consumer, can be called from the producer side
         void clearBuffer();
 
     private:
-        QVector<float> m_audioBuffer;
-        qint32 m_maxBufferSize;
+        //! Free space for the producer
+        int freeSamples() const;
+
+        //! Reserve space for count samples, calls writer with the contiguous parts of the ring buffer, then publishes them
+        template <class WRITER>
+        int write(int count, WRITER writer);
+
+        QVector<float> m_buffer; //!< ring buffer, allocated once
+        int m_capacity = 0; //!< buffer size
+        std::atomic<qint64> m_writePosition { 0 }; //!< total samples written, only changed by the producer
+        std::atomic<qint64> m_readPosition { 0 }; //!< total samples read, only changed by the consumer
+        std::atomic<qint64> m_clearPosition { 0 }; //!< samples before this position are skipped by the consumer
+        std::atomic<qint64> m_droppedSamples { 0 }; //!< statistics
     };
 } // ns
 
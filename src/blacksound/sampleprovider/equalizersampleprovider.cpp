@@ -3,6 +3,7 @@
 
 #include "equalizersampleprovider.h"
 #include "blacksound/audioutilities.h"
+#include "blacksound/dsp/simdkernels.h"
 #include <QDebug>
 
 using namespace BlackSound::Dsp;
@@ -19,19 +20,16 @@ namespace BlackSound::SampleProvider
         setupPreset(preset);
     }
 
-    int CEqualizerSampleProvider::readSamples(QVector<float> &samples, qint64 count)
+    int CEqualizerSampleProvider::readSamples(float *samples, qint64 count)
     {
         const int samplesRead = m_sourceProvider->readSamples(samples, count);
         if (m_bypass) return samplesRead;
 
-        for (int n = 0; n < samplesRead; n++)
+        for (BiQuadFilter &filter : m_filters)
         {
-            for (int band = 0; band < m_filters.size(); band++)
-            {
-                samples[n] = m_filters[band].transform(samples[n]);
-            }
-            samples[n] *= static_cast<float>(m_outputGain);
+            filter.transform(samples, samplesRead);
         }
+        applyGain(samples, samplesRead, static_cast<float>(m_outputGain));
         return samplesRead;
     }
 
@@ -2,8 +2,11 @@
 // SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
 
 #include "mixingsampleprovider.h"
+#include "blacksound/dsp/simdkernels.h"
 #include "blackmisc/metadatautils.h"
 
+#include <algorithm>
+
 using namespace BlackMisc;
 
 namespace BlackSound::SampleProvider
@@ -18,41 +21,43 @@ namespace BlackSound::SampleProvider
     {
         Q_ASSERT(provider);
         m_sources.append(provider);
+        m_finishedSources.reserve(m_sources.size());
 
         const QString on = QStringLiteral("%1 sources: %2").arg(classNameShort(this)).arg(m_sources.size());
         this->setObjectName(on);
     }
 
-    int CMixingSampleProvider::readSamples(QVector<float> &samples, qint64 count)
+    void CMixingSampleProvider::reserve(qint64 count)
+    {
+        if (count > m_sourceBuffer.size()) { m_sourceBuffer.resize(static_cast<int>(count)); }
+    }
+
+    int CMixingSampleProvider::readSamples(float *samples, qint64 count)
     {
-        samples.clear();
-        samples.fill(0, static_cast<int>(count));
+        std::fill(samples, samples + count, 0.0f);
+        this->reserve(count);
+        float *sourceBuffer = m_sourceBuffer.data();
         int outputLen = 0;
 
-        QVector<ISampleProvider *> finishedProviders;
         for (int i = 0; i < m_sources.size(); i++)
         {
             ISampleProvider *sampleProvider = m_sources.at(i);
-            QVector<float> sourceBuffer;
-
             const int len = sampleProvider->readSamples(sourceBuffer, count);
-            for (int n = 0; n < len; n++)
-            {
-                samples[n] += sourceBuffer[n];
-            }
+            Dsp::mixAdd(samples, sourceBuffer, len);
 
             outputLen = qMax(len, outputLen);
             if (sampleProvider->isFinished())
             {
-                finishedProviders.push_back(sampleProvider);
+                m_finishedSources.push_back(sampleProvider);
             }
         }
 
-        for (ISampleProvider *sampleProvider : finishedProviders)
+        for (ISampleProvider *sampleProvider : std::as_const(m_finishedSources))
         {
             sampleProvider->deleteLater();
             m_sources.removeAll(sampleProvider);
         }
+        m_finishedSources.clear(); // keeps the capacity (Qt >= 5.7)
 
         return outputLen;
     }
@@ -24,10 +24,16 @@ namespace BlackSound::SampleProvider
         void addMixerInput(ISampleProvider *provider);
 
         //! \copydoc ISampleProvider::readSamples
-        virtual int readSamples(QVector<float> &samples, qint64 count) override;
+        virtual int readSamples(float *samples, qint64 count) override;
+
+        //! Pre-allocate the buffers for reading count samples
+        //! \remark otherwise they are allocated with the first read of a larger count
+        void reserve(qint64 count);
 
     private:
         QVector<ISampleProvider *> m_sources;
+        QVector<ISampleProvider *> m_finishedSources; //!< reused, avoids allocations when reading
+        QVector<float> m_sourceBuffer; //!< reused, only grows
     };
 } // ns
 
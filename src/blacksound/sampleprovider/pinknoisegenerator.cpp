@@ -7,12 +7,9 @@
 
 namespace BlackSound::SampleProvider
 {
-    int CPinkNoiseGenerator::readSamples(QVector<float> &samples, qint64 count)
+    int CPinkNoiseGenerator::readSamples(float *samples, qint64 count)
     {
         const int c = static_cast<int>(count);
-        samples.clear();
-        samples.fill(0, c);
-
         for (int sampleCount = 0; sampleCount < count; sampleCount++)
         {
             double white = 2 * m_random.generateDouble() - 1;
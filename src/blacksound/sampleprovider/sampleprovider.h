@@ -25,8 +25,20 @@ namespace BlackSound::SampleProvider
         //! Dtor
         virtual ~ISampleProvider() override {}
 
-        //! Read samples
-        virtual int readSamples(QVector<float> &samples, qint64 count) = 0;
+        //! Read samples into a buffer owned by the caller
+        //! \param samples buffer for at least count samples
+        //! \param count number of requested samples
+        //! \return number of samples written, the remaining samples of the buffer are undefined
+        //! \remark called from the audio device, implementations must not allocate memory
+        virtual int readSamples(float *samples, qint64 count) = 0;
+
+        //! Read samples into a vector resized to count
+        //! \remark convenience function, the resize can allocate memory
+        int readSamples(QVector<float> &samples, qint64 count)
+        {
+            samples.resize(static_cast<int>(count));
+            return this->readSamples(samples.data(), count);
+        }
 
         //! Finished?
         virtual bool isFinished() const { return false; }
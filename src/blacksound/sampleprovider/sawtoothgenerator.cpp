@@ -12,11 +12,8 @@ namespace BlackSound::SampleProvider
         this->setObjectName("CSawToothGenerator");
     }
 
-    int CSawToothGenerator::readSamples(QVector<float> &samples, qint64 count)
+    int CSawToothGenerator::readSamples(float *samples, qint64 count)
     {
-        samples.clear();
-        samples.fill(0, static_cast<int>(count));
-
         for (int sampleCount = 0; sampleCount < count; sampleCount++)
         {
             double multiple = 2 * m_frequency / m_sampleRate;
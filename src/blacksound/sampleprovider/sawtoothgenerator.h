@@ -24,7 +24,7 @@ namespace BlackSound::SampleProvider
         CSawToothGenerator(double frequency, QObject *parent = nullptr);
 
         //! \copydoc ISampleProvider::readSamples
-        virtual int readSamples(QVector<float> &samples, qint64 count) override;
+        virtual int readSamples(float *samples, qint64 count) override;
 
         //! Set the gain
         void setGain(double gain) { m_gain = gain; }
@@ -25,7 +25,7 @@ namespace BlackSound::SampleProvider
         CSimpleCompressorEffect(ISampleProvider *source, QObject *parent = nullptr);
 
         //! \copydoc ISampleProvider::readSamples
-        virtual int readSamples(QVector<float> &samples, qint64 count) override;
+        virtual int readSamples(float *samples, qint64 count) override;
 
         //! Enable
         void setEnabled(bool enabled);
@@ -16,11 +16,8 @@ namespace BlackSound::SampleProvider
         this->setObjectName(on);
     }
 
-    int CSinusGenerator::readSamples(QVector<float> &samples, qint64 count)
+    int CSinusGenerator::readSamples(float *samples, qint64 count)
     {
-        samples.clear();
-        samples.fill(0, static_cast<int>(count));
-
         for (int sampleCount = 0; sampleCount < count; sampleCount++)
         {
             const double multiple = s_twoPi * m_frequencyHz / m_sampleRate;
@@ -4,6 +4,7 @@
 //! \file
 
 #include "volumesampleprovider.h"
+#include "blacksound/dsp/simdkernels.h"
 #include "blackmisc/metadatautils.h"
 
 using namespace BlackMisc;
@@ -18,15 +19,12 @@ namespace BlackSound::SampleProvider
         this->setObjectName(on);
     }
 
-    int CVolumeSampleProvider::readSamples(QVector<float> &samples, qint64 count)
+    int CVolumeSampleProvider::readSamples(float *samples, qint64 count)
     {
         const int samplesRead = m_sourceProvider->readSamples(samples, count);
         if (!qFuzzyCompare(m_gainRatio, 1.0))
         {
-            for (int n = 0; n < samplesRead; n++)
-            {
-                samples[n] = static_cast<float>(m_gainRatio * samples[n]);
-            }
+            Dsp::applyGain(samples, samplesRead, static_cast<float>(m_gainRatio));
         }
         return samplesRead;
     }
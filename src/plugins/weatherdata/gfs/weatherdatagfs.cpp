@@ -14,7 +14,12 @@
 #include <QNetworkReply>
 #include <QEventLoop>
 #include <QStringBuilder>
+#include <QThread>
+#include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <future>
+#include <vector>
 
 using namespace BlackConfig;
 using namespace BlackMisc;
@@ -111,6 +116,19 @@ namespace BlackWxPlugin::Gfs
         float surfacePrecipitationRate = 0;
         float pressureAtMsl = 0.0;
     };
+
+    struct GribFieldIndex
+    {
+        g2int messageOffset = 0; // start of the GRIB message
+        g2int fieldNumber = 0; // 1 based field number within the message
+    };
+
+    struct GribDecodedField
+    {
+        gribfield *gfld = nullptr; // sections 1 to 6 only, data not unpacked
+        QVector<g2float> values; // values at the positions of m_gfsWeatherGrid
+        g2int error = 0;
+    };
     //! \endcond
 
     const CWeatherDataGfs::Grib2ParameterTable CWeatherDataGfs::m_grib2ParameterTable {
@@ -133,12 +151,81 @@ namespace BlackWxPlugin::Gfs
         return altitude;
     }
 
+    //! Offset of the packed data of a field, i.e. behind the header of its section 7, -1 if not found
+    g2int findDataSectionOffset(unsigned char *message, g2int fieldNumber)
+    {
+        g2int messageLength = 0;
+        gbit(message, &messageLength, 12 * 8, 4 * 8);
+        g2int pos = 16; // behind section 0
+        g2int field = 0;
+        while (pos + 5 <= messageLength)
+        {
+            g2int sectionLength = 0;
+            g2int sectionNumber = 0;
+            gbit(message, &sectionLength, pos * 8, 4 * 8);
+            gbit(message, &sectionNumber, (pos + 4) * 8, 1 * 8);
+            if (sectionLength == 926365495 || sectionLength < 5) { return -1; } // '7777' or malformed
+            if (sectionNumber == 4) { field++; }
+            if (sectionNumber == 7 && field == fieldNumber) { return pos + 5; }
+            pos += sectionLength;
+        }
+        return -1;
+    }
+
+    //! Decode a field, values only at the given positions of the grid
+    //! \remark simple packing is decoded at the positions only, all other packings are unpacked completely
+    //! \threadsafe once rdieee has been called
+    void decodeGribField(unsigned char *message, g2int fieldNumber, const QVector<int> &positions, GribDecodedField &decoded)
+    {
+        decoded.error = g2_getfld(message, fieldNumber, 0, 0, &decoded.gfld);
+        if (decoded.error != 0 || !decoded.gfld) { return; }
+        const gribfield *gfld = decoded.gfld;
+        decoded.values.resize(positions.size());
+
+        if (gfld->idrtnum == 0 && gfld->ibmap == 255 && gfld->ndpts == gfld->ngrdpts)
+        {
+            const g2int dataOffset = findDataSectionOffset(message, fieldNumber);
+            if (dataOffset > 0)
+            {
+                // same as simunpack, but only for the requested positions
+                g2int referenceIeee = gfld->idrtmpl[0];
+                g2float reference = 0;
+                rdieee(&referenceIeee, &reference, 1);
+                const g2float bscale = static_cast<g2float>(int_power(2.0, gfld->idrtmpl[1]));
+                const g2float dscale = static_cast<g2float>(int_power(10.0, -gfld->idrtmpl[2]));
+                const g2int nbits = gfld->idrtmpl[3];
+                unsigned char *data = message + dataOffset;
+                for (int i = 0; i < positions.size(); i++)
+                {
+                    if (nbits == 0)
+                    {
+                        decoded.values[i] = reference;
+                        continue;
+                    }
+                    g2int packed = 0;
+                    gbit(data, &packed, positions[i] * nbits, nbits);
+                    decoded.values[i] = ((static_cast<g2float>(packed) * bscale) + reference) * dscale;
+                }
+                return;
+            }
+        }
+
+        gribfield *unpacked = nullptr;
+        decoded.error = g2_getfld(message, fieldNumber, 1, 1, &unpacked);
+        if (decoded.error == 0 && unpacked && unpacked->fld)
+        {
+            for (int i = 0; i < positions.size(); i++) { decoded.values[i] = unpacked->fld[positions[i]]; }
+        }
+        if (unpacked) { g2_free(unpacked); }
+    }
+
     CWeatherDataGfs::CWeatherDataGfs(QObject *parent) : IWeatherData(parent)
     {}
 
     CWeatherDataGfs::~CWeatherDataGfs()
     {
         if (m_parseGribFileWorker && !m_parseGribFileWorker->isFinished()) { m_parseGribFileWorker->abandonAndWait(); }
+        this->unmapGribFile();
     }
 
     void CWeatherDataGfs::fetchWeatherData(const CWeatherGrid &initialGrid, const CLength &range)
@@ -157,7 +244,7 @@ namespace BlackWxPlugin::Gfs
         {
             CLogMessage(this).debug() << "Using cached data";
             Q_ASSERT_X(!m_parseGribFileWorker, Q_FUNC_INFO, "Worker already running");
-            m_parseGribFileWorker = CWorker::fromTask(this, "parseGribFile", [this]() {
+            m_parseGribFileWorker = CWorker::fromLongTask(this, "parseGribFile", [this]() {
                 parseGfsFileImpl(m_gribData);
             });
             m_parseGribFileWorker->then(this, &CWeatherDataGfs::fetchingWeatherDataFinished);
@@ -169,12 +256,10 @@ namespace BlackWxPlugin::Gfs
         m_grid = grid;
         m_maxRange = range;
 
-        QFile file(filePath);
-        if (!file.exists() || !file.open(QIODevice::ReadOnly)) { return; }
-        m_gribData = file.readAll();
+        if (!this->mapGribFile(filePath)) { return; }
 
         Q_ASSERT_X(!m_parseGribFileWorker, Q_FUNC_INFO, "Worker already running");
-        m_parseGribFileWorker = CWorker::fromTask(this, "parseGribFile", [this]() {
+        m_parseGribFileWorker = CWorker::fromLongTask(this, "parseGribFile", [this]() {
             parseGfsFileImpl(m_gribData);
         });
         m_parseGribFileWorker->then(this, &CWeatherDataGfs::fetchingWeatherDataFinished);
@@ -210,9 +295,10 @@ namespace BlackWxPlugin::Gfs
         // required to use delete later as object is created in a different thread
         QScopedPointer<QNetworkReply, QScopedPointerDeleteLater> nwReply(nwReplyPtr);
 
+        this->unmapGribFile();
         m_gribData = nwReply->readAll();
         Q_ASSERT_X(!m_parseGribFileWorker, Q_FUNC_INFO, "Worker already running");
-        m_parseGribFileWorker = CWorker::fromTask(this, "parseGribFile", [this]() {
+        m_parseGribFileWorker = CWorker::fromLongTask(this, "parseGribFile", [this]() {
             parseGfsFileImpl(m_gribData);
         });
         m_parseGribFileWorker->then(this, &CWeatherDataGfs::fetchingWeatherDataFinished);
@@ -317,40 +403,48 @@ namespace BlackWxPlugin::Gfs
         // Messages should be 76. This is a combination
         // of requested values (e.g. temperature, clouds etc) at specific layers (2 mbar, 10 mbar, surface).
         constexpr int maxMessages = 76;
-        int messageNo = 0;
-        g2int iseek = 0;
-        for (;;)
-        {
-            if (QThread::currentThread()->isInterruptionRequested()) { return false; }
-
-            // Search next grib field
-            g2int lskip = 0;
-            g2int lgrib = 0;
-            auto constData = reinterpret_cast<unsigned char *>(const_cast<char *>(gribData.data()));
-            findNextGribMessage(constData, gribData.size(), iseek, &lskip, &lgrib);
-            if (lgrib == 0) { break; }
-
-            unsigned char *readPtr = constData + lskip;
-            iseek = lskip + lgrib;
+        auto constData = reinterpret_cast<unsigned char *>(const_cast<char *>(gribData.data()));
+        const QVector<GribFieldIndex> index = this->indexGribFields(constData, gribData.size());
+        if (QThread::currentThread()->isInterruptionRequested()) { return false; }
+        const int messageNo = static_cast<int>(std::count_if(index.cbegin(), index.cend(), [](const GribFieldIndex &field) { return field.fieldNumber == 1; }));
 
-            g2int sec0[3];
-            g2int sec1[13];
-            g2int numlocal = 0;
-            g2int numfields = 0;
-            g2_info(readPtr, sec0, sec1, &numfields, &numlocal);
+        if (!index.isEmpty())
+        {
+            // all fields share the same grid, the grid definition is read without unpacking the data
+            gribfield *gridField = nullptr;
+            g2_getfld(constData + index.first().messageOffset, index.first().fieldNumber, 0, 0, &gridField);
+            if (gridField)
+            {
+                createWeatherGrid(gridField);
+                g2_free(gridField);
+            }
+        }
 
-            for (int n = 0; n < numfields; n++)
+        QVector<GribDecodedField> decodedFields;
+        if (!m_gfsWeatherGrid.isEmpty() && !this->decodeGribFields(constData, index, decodedFields))
+        {
+            for (const GribDecodedField &decoded : std::as_const(decodedFields))
             {
-                g2int unpack = 1;
-                g2int expand = 1;
-                gribfield *gfld = nullptr;
-                g2_getfld(readPtr, n + 1, unpack, expand, &gfld);
-                if (gfld->idsectlen < 12)
-                {
-                    CLogMessage(this).warning(u"Identification section: wrong length!");
-                    continue;
-                }
+                if (decoded.gfld) { g2_free(decoded.gfld); }
+            }
+            return false;
+        }
 
+        // applied in file order
+        for (const GribDecodedField &decoded : std::as_const(decodedFields))
+        {
+            gribfield *gfld = decoded.gfld;
+            if (!gfld) { continue; }
+            if (decoded.error != 0)
+            {
+                CLogMessage(this).warning(u"Cannot decode GRIB field, error %1") << decoded.error;
+            }
+            else if (gfld->idsectlen < 12)
+            {
+                CLogMessage(this).warning(u"Identification section: wrong length!");
+            }
+            else
+            {
                 if (gfld->igdtnum != 0) { CLogMessage(this).warning(u"Can handle only grid definition template number = 0"); }
 
                 int nscan = gfld->igdtmpl[18];
@@ -360,19 +454,11 @@ namespace BlackWxPlugin::Gfs
                 if (nscan != 0) { CLogMessage(this).error(u"Can only handle scanning mode NS:WE."); }
                 if (npnts != nx * ny) { CLogMessage(this).error(u"Cannot handle non-regular grid."); }
 
-                if (m_gfsWeatherGrid.isEmpty()) { createWeatherGrid(gfld); }
-
-                if (gfld->ipdtnum == 0) { handleProductDefinitionTemplate40(gfld); }
-                else if (gfld->ipdtnum == 8) { handleProductDefinitionTemplate48(gfld); }
-                else
-                {
-                    CLogMessage(this).warning(u"Cannot handle product definition template %1") << gfld->ipdtnum;
-                    continue;
-                }
-
-                g2_free(gfld);
+                if (gfld->ipdtnum == 0) { handleProductDefinitionTemplate40(gfld, decoded.values.constData()); }
+                else if (gfld->ipdtnum == 8) { handleProductDefinitionTemplate48(gfld, decoded.values.constData()); }
+                else { CLogMessage(this).warning(u"Cannot handle product definition template %1") << gfld->ipdtnum; }
             }
-            messageNo++;
+            g2_free(gfld);
         }
 
         // validate
@@ -456,6 +542,88 @@ namespace BlackWxPlugin::Gfs
         return true;
     }
 
+    QVector<GribFieldIndex> CWeatherDataGfs::indexGribFields(unsigned char *buffer, g2int size)
+    {
+        QVector<GribFieldIndex> index;
+        g2int iseek = 0;
+        for (;;)
+        {
+            if (QThread::currentThread()->isInterruptionRequested()) { break; }
+
+            // Search next grib message
+            g2int lskip = 0;
+            g2int lgrib = 0;
+            findNextGribMessage(buffer, size, iseek, &lskip, &lgrib);
+            if (lgrib == 0) { break; }
+            iseek = lskip + lgrib;
+
+            g2int sec0[3];
+            g2int sec1[13];
+            g2int numlocal = 0;
+            g2int numfields = 0;
+            g2_info(buffer + lskip, sec0, sec1, &numfields, &numlocal);
+            for (g2int n = 1; n <= numfields; n++) { index.push_back({ lskip, n }); }
+        }
+        return index;
+    }
+
+    bool CWeatherDataGfs::decodeGribFields(unsigned char *buffer, const QVector<GribFieldIndex> &index, QVector<GribDecodedField> &decodedFields) const
+    {
+        QVector<int> positions;
+        positions.reserve(m_gfsWeatherGrid.size());
+        for (const GfsGridPoint &gridPoint : m_gfsWeatherGrid) { positions.push_back(gridPoint.fieldPosition); }
+
+        // rdieee initializes static constants on first use, make sure this happens before decoding in parallel
+        g2int ieee = 0;
+        g2float value = 0;
+        rdieee(&ieee, &value, 1);
+
+        decodedFields.resize(index.size());
+        QThread *parsingThread = QThread::currentThread();
+        std::atomic_int next { 0 };
+        const auto decodeNext = [&] {
+            for (int i = next++; i < index.size(); i = next++)
+            {
+                if (parsingThread->isInterruptionRequested()) { return; }
+                decodeGribField(buffer + index[i].messageOffset, index[i].fieldNumber, positions, decodedFields[i]);
+            }
+        };
+
+        const int threads = qBound(1, QThread::idealThreadCount(), index.size());
+        std::vector<std::future<void>> futures;
+        for (int t = 1; t < threads; t++) { futures.push_back(std::async(std::launch::async, decodeNext)); }
+        decodeNext();
+        for (std::future<void> &future : futures) { future.wait(); }
+        return !parsingThread->isInterruptionRequested();
+    }
+
+    bool CWeatherDataGfs::mapGribFile(const QString &filePath)
+    {
+        this->unmapGribFile();
+        m_gribFile.setFileName(filePath);
+        if (!m_gribFile.exists() || !m_gribFile.open(QIODevice::ReadOnly)) { return false; }
+        const qint64 size = m_gribFile.size();
+        m_gribFileMapping = size > 0 ? m_gribFile.map(0, size) : nullptr;
+        if (!m_gribFileMapping)
+        {
+            // mapping not possible, read the file instead
+            m_gribData = m_gribFile.readAll();
+            m_gribFile.close();
+            return !m_gribData.isEmpty();
+        }
+        m_gribData = QByteArray::fromRawData(reinterpret_cast<const char *>(m_gribFileMapping), static_cast<int>(size));
+        return true;
+    }
+
+    void CWeatherDataGfs::unmapGribFile()
+    {
+        if (!m_gribFileMapping) { return; }
+        m_gribData.clear();
+        m_gribFile.unmap(m_gribFileMapping);
+        m_gribFileMapping = nullptr;
+        m_gribFile.close();
+    }
+
     void CWeatherDataGfs::findNextGribMessage(unsigned char *buffer, g2int size, g2int iseek, g2int *lskip, g2int *lgrib)
     {
         *lgrib = 0;
@@ -630,7 +798,7 @@ namespace BlackWxPlugin::Gfs
         } // if
     }
 
-    void CWeatherDataGfs::handleProductDefinitionTemplate40(const gribfield *gfld)
+    void CWeatherDataGfs::handleProductDefinitionTemplate40(const gribfield *gfld, const g2float *values)
     {
         if (gfld->ipdtlen != 15)
         {
@@ -665,11 +833,11 @@ namespace BlackWxPlugin::Gfs
         auto parameterValue = m_grib2ParameterTable[key];
         switch (parameterValue.code)
         {
-        case TMP: setTemperature(gfld->fld, level); break;
-        case RH: setHumidity(gfld->fld, level); break;
-        case UGRD: setWindU(gfld->fld, level); break;
-        case VGRD: setWindV(gfld->fld, level); break;
-        case PRMSL: setPressureAtMsl(gfld->fld); break;
+        case TMP: setTemperature(values, level); break;
+        case RH: setHumidity(values, level); break;
+        case UGRD: setWindU(values, level); break;
+        case VGRD: setWindV(values, level); break;
+        case PRMSL: setPressureAtMsl(values); break;
         case PRES: /* Do nothing */ break;
         case TCDC: /* Do nothing */ break;
         case PRATE: /* Do nothing */ break;
@@ -679,7 +847,7 @@ namespace BlackWxPlugin::Gfs
         }
     }
 
-    void CWeatherDataGfs::handleProductDefinitionTemplate48(const gribfield *gfld)
+    void CWeatherDataGfs::handleProductDefinitionTemplate48(const gribfield *gfld, const g2float *values)
     {
         if (gfld->ipdtlen != 29)
         {
@@ -714,65 +882,71 @@ namespace BlackWxPlugin::Gfs
         auto parameterValue = m_grib2ParameterTable[key];
         switch (parameterValue.code)
         {
-        case TCDC: setCloudCoverage(gfld->fld, grib2CloudLevelHash.value(typeFirstFixedSurface)); break;
-        case PRES: setCloudLevel(gfld->fld, typeFirstFixedSurface, grib2CloudLevelHash.value(typeFirstFixedSurface)); break;
-        case PRATE: setPrecipitationRate(gfld->fld); break;
-        case CRAIN: setSurfaceRain(gfld->fld); break;
-        case CSNOW: setSurfaceSnow(gfld->fld); break;
-        case TMP: setCloudTemperature(gfld->fld, typeFirstFixedSurface, grib2CloudLevelHash.value(typeFirstFixedSurface)); break;
+        case TCDC: setCloudCoverage(values, grib2CloudLevelHash.value(typeFirstFixedSurface)); break;
+        case PRES: setCloudLevel(values, typeFirstFixedSurface, grib2CloudLevelHash.value(typeFirstFixedSurface)); break;
+        case PRATE: setPrecipitationRate(values); break;
+        case CRAIN: setSurfaceRain(values); break;
+        case CSNOW: setSurfaceSnow(values); break;
+        case TMP: setCloudTemperature(values, typeFirstFixedSurface, grib2CloudLevelHash.value(typeFirstFixedSurface)); break;
         default: CLogMessage(this).warning(u"Unexpected parameterValue in Template 4.8: %1 (%2)") << parameterValue.code << parameterValue.name; return;
         }
     }
 
-    void CWeatherDataGfs::setTemperature(const g2float *fld, float level)
+    void CWeatherDataGfs::setTemperature(const g2float *values, float level)
     {
-        for (auto &gridPoint : m_gfsWeatherGrid)
+        for (int i = 0; i < m_gfsWeatherGrid.size(); i++)
         {
-            if (level > 0) { gridPoint.isobaricLayers[level].temperature = fld[gridPoint.fieldPosition]; }
+            GfsGridPoint &gridPoint = m_gfsWeatherGrid[i];
+            if (level > 0) { gridPoint.isobaricLayers[level].temperature = values[i]; }
         }
     }
 
-    void CWeatherDataGfs::setHumidity(const g2float *fld, float level)
+    void CWeatherDataGfs::setHumidity(const g2float *values, float level)
     {
-        for (auto &gridPoint : m_gfsWeatherGrid)
+        for (int i = 0; i < m_gfsWeatherGrid.size(); i++)
         {
-            gridPoint.isobaricLayers[level].relativeHumidity = fld[gridPoint.fieldPosition];
+            GfsGridPoint &gridPoint = m_gfsWeatherGrid[i];
+            gridPoint.isobaricLayers[level].relativeHumidity = values[i];
         }
     }
 
-    void CWeatherDataGfs::setWindV(const g2float *fld, float level)
+    void CWeatherDataGfs::setWindV(const g2float *values, float level)
     {
-        for (auto &gridPoint : m_gfsWeatherGrid)
+        for (int i = 0; i < m_gfsWeatherGrid.size(); i++)
         {
-            gridPoint.isobaricLayers[level].windV = fld[gridPoint.fieldPosition];
+            GfsGridPoint &gridPoint = m_gfsWeatherGrid[i];
+            gridPoint.isobaricLayers[level].windV = values[i];
         }
     }
 
-    void CWeatherDataGfs::setWindU(const g2float *fld, float level)
+    void CWeatherDataGfs::setWindU(const g2float *values, float level)
     {
-        for (auto &gridPoint : m_gfsWeatherGrid)
+        for (int i = 0; i < m_gfsWeatherGrid.size(); i++)
         {
-            gridPoint.isobaricLayers[level].windU = fld[gridPoint.fieldPosition];
+            GfsGridPoint &gridPoint = m_gfsWeatherGrid[i];
+            gridPoint.isobaricLayers[level].windU = values[i];
         }
     }
 
-    void CWeatherDataGfs::setCloudCoverage(const g2float *fld, int level)
+    void CWeatherDataGfs::setCloudCoverage(const g2float *values, int level)
     {
-        for (auto &gridPoint : m_gfsWeatherGrid)
+        for (int i = 0; i < m_gfsWeatherGrid.size(); i++)
         {
-            if (fld[gridPoint.fieldPosition] > 0.0f) { gridPoint.cloudLayers[level].totalCoverage = fld[gridPoint.fieldPosition]; }
+            GfsGridPoint &gridPoint = m_gfsWeatherGrid[i];
+            if (values[i] > 0.0f) { gridPoint.cloudLayers[level].totalCoverage = values[i]; }
         }
     }
 
-    void CWeatherDataGfs::setCloudLevel(const g2float *fld, int surfaceType, int level)
+    void CWeatherDataGfs::setCloudLevel(const g2float *values, int surfaceType, int level)
     {
-        for (auto &gridPoint : m_gfsWeatherGrid)
+        for (int i = 0; i < m_gfsWeatherGrid.size(); i++)
         {
+            GfsGridPoint &gridPoint = m_gfsWeatherGrid[i];
             static const g2float minimumLevel = 1000.0;
             float levelPressure = std::numeric_limits<float>::quiet_NaN();
-            g2float fieldValue = fld[gridPoint.fieldPosition];
+            g2float fieldValue = values[i];
             // A value of 9.999e20 is undefined. Check that the pressure value is below
-            if (fieldValue < 9.998e20f && fieldValue > minimumLevel) { levelPressure = fld[gridPoint.fieldPosition]; }
+            if (fieldValue < 9.998e20f && fieldValue > minimumLevel) { levelPressure = values[i]; }
             switch (surfaceType)
             {
             case LowCloudBottomLevel:
@@ -792,13 +966,14 @@ namespace BlackWxPlugin::Gfs
         }
     }
 
-    void CWeatherDataGfs::setCloudTemperature(const g2float *fld, int surfaceType, int level)
+    void CWeatherDataGfs::setCloudTemperature(const g2float *values, int surfaceType, int level)
     {
-        for (auto &gridPoint : m_gfsWeatherGrid)
+        for (int i = 0; i < m_gfsWeatherGrid.size(); i++)
         {
+            GfsGridPoint &gridPoint = m_gfsWeatherGrid[i];
             float temperature = std::numeric_limits<float>::quiet_NaN();
-            g2float fieldValue = fld[gridPoint.fieldPosition];
-            if (fieldValue < 9.998e20f) { temperature = fld[gridPoint.fieldPosition]; }
+            g2float fieldValue = values[i];
+            if (fieldValue < 9.998e20f) { temperature = values[i]; }
             switch (surfaceType)
             {
             case LowCloudTopLevel:
@@ -813,35 +988,39 @@ namespace BlackWxPlugin::Gfs
         }
     }
 
-    void CWeatherDataGfs::setPressureAtMsl(const g2float *fld)
+    void CWeatherDataGfs::setPressureAtMsl(const g2float *values)
     {
-        for (auto &gridPoint : m_gfsWeatherGrid)
+        for (int i = 0; i < m_gfsWeatherGrid.size(); i++)
         {
-            gridPoint.pressureAtMsl = fld[gridPoint.fieldPosition];
+            GfsGridPoint &gridPoint = m_gfsWeatherGrid[i];
+            gridPoint.pressureAtMsl = values[i];
         }
     }
 
-    void CWeatherDataGfs::setSurfaceRain(const g2float *fld)
+    void CWeatherDataGfs::setSurfaceRain(const g2float *values)
     {
-        for (auto &gridPoint : m_gfsWeatherGrid)
+        for (int i = 0; i < m_gfsWeatherGrid.size(); i++)
         {
-            gridPoint.surfaceRain = fld[gridPoint.fieldPosition];
+            GfsGridPoint &gridPoint = m_gfsWeatherGrid[i];
+            gridPoint.surfaceRain = values[i];
         }
     }
 
-    void CWeatherDataGfs::setSurfaceSnow(const g2float *fld)
+    void CWeatherDataGfs::setSurfaceSnow(const g2float *values)
     {
-        for (auto &gridPoint : m_gfsWeatherGrid)
+        for (int i = 0; i < m_gfsWeatherGrid.size(); i++)
         {
-            gridPoint.surfaceSnow = fld[gridPoint.fieldPosition];
+            GfsGridPoint &gridPoint = m_gfsWeatherGrid[i];
+            gridPoint.surfaceSnow = values[i];
         }
     }
 
-    void CWeatherDataGfs::setPrecipitationRate(const g2float *fld)
+    void CWeatherDataGfs::setPrecipitationRate(const g2float *values)
     {
-        for (auto &gridPoint : m_gfsWeatherGrid)
+        for (int i = 0; i < m_gfsWeatherGrid.size(); i++)
         {
-            gridPoint.surfacePrecipitationRate = fld[gridPoint.fieldPosition];
+            GfsGridPoint &gridPoint = m_gfsWeatherGrid[i];
+            gridPoint.surfacePrecipitationRate = values[i];
         }
     }
 
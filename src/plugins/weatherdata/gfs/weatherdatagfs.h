@@ -16,6 +16,7 @@
 #include <QVector>
 #include <QUrl>
 #include <QByteArray>
+#include <QFile>
 #include <QNetworkReply>
 #include <QNetworkAccessManager>
 #include <QPointer>
@@ -30,6 +31,8 @@ namespace BlackWxPlugin::Gfs
     struct Grib2ParameterKey;
     struct Grib2ParameterValue;
     struct GfsGridPoint;
+    struct GribFieldIndex;
+    struct GribDecodedField;
 
     /*!
      * GFS implemenation
@@ -66,20 +69,34 @@ namespace BlackWxPlugin::Gfs
         BlackMisc::Network::CUrl getDownloadUrl() const;
         bool parseGfsFileImpl(const QByteArray &gribData);
         void findNextGribMessage(unsigned char *buffer, g2int size, g2int iseek, g2int *lskip, g2int *lgrib);
+
+        //! Phase 1: offsets of all fields in the GRIB data
+        QVector<GribFieldIndex> indexGribFields(unsigned char *buffer, g2int size);
+
+        //! Phase 2: decode the fields in parallel, values only at the positions of the weather grid points
+        //! \remark false if interrupted
+        bool decodeGribFields(unsigned char *buffer, const QVector<GribFieldIndex> &index, QVector<GribDecodedField> &decodedFields) const;
+
+        //! Memory map a GRIB file as m_gribData
+        bool mapGribFile(const QString &filePath);
+
+        //! Release the mapped GRIB file, if any
+        void unmapGribFile();
+
         void createWeatherGrid(const gribfield *gfld);
-        void handleProductDefinitionTemplate40(const gribfield *gfld);
-        void handleProductDefinitionTemplate48(const gribfield *gfld);
-        void setTemperature(const g2float *fld, float level);
-        void setHumidity(const g2float *fld, float level);
-        void setWindV(const g2float *fld, float level);
-        void setWindU(const g2float *fld, float level);
-        void setCloudCoverage(const g2float *fld, int level);
-        void setCloudLevel(const g2float *fld, int surfaceType, int level);
-        void setCloudTemperature(const g2float *fld, int surfaceType, int level);
-        void setPressureAtMsl(const g2float *fld);
-        void setSurfaceRain(const g2float *fld);
-        void setSurfaceSnow(const g2float *fld);
-        void setPrecipitationRate(const g2float *fld);
+        void handleProductDefinitionTemplate40(const gribfield *gfld, const g2float *values);
+        void handleProductDefinitionTemplate48(const gribfield *gfld, const g2float *values);
+        void setTemperature(const g2float *values, float level);
+        void setHumidity(const g2float *values, float level);
+        void setWindV(const g2float *values, float level);
+        void setWindU(const g2float *values, float level);
+        void setCloudCoverage(const g2float *values, int level);
+        void setCloudLevel(const g2float *values, int surfaceType, int level);
+        void setCloudTemperature(const g2float *values, int surfaceType, int level);
+        void setPressureAtMsl(const g2float *values);
+        void setSurfaceRain(const g2float *values);
+        void setSurfaceSnow(const g2float *values);
+        void setPrecipitationRate(const g2float *values);
 
         BlackMisc::PhysicalQuantities::CTemperature calculateDewPoint(const BlackMisc::PhysicalQuantities::CTemperature &temperature, double relativeHumidity);
 
@@ -87,7 +104,9 @@ namespace BlackWxPlugin::Gfs
         BlackMisc::PhysicalQuantities::CLength m_maxRange;
 
         mutable QReadWriteLock m_lockData;
-        QByteArray m_gribData;
+        QByteArray m_gribData; //!< downloaded data, or raw data of the mapped file
+        QFile m_gribFile; //!< mapped GRIB file
+        uchar *m_gribFileMapping = nullptr; //!< mapping of m_gribFile
 
         QVector<GfsGridPoint> m_gfsWeatherGrid;
         BlackMisc::Weather::CWeatherGrid m_weatherGrid;
@@ -0,0 +1,346 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \cond PRIVATE_TESTS
+
+/*!
+ * \file
+ * \ingroup testblackcore
+ */
+
+#include "blacksound/audioutilities.h"
+#include "blacksound/dsp/biquadfilter.h"
+#include "blacksound/dsp/simdkernels.h"
+#include "blacksound/sampleprovider/bufferedwaveprovider.h"
+#include "blacksound/sampleprovider/equalizersampleprovider.h"
+#include "blacksound/sampleprovider/mixingsampleprovider.h"
+#include "blacksound/sampleprovider/sawtoothgenerator.h"
+#include "blacksound/sampleprovider/simplecompressoreffect.h"
+#include "blacksound/sampleprovider/sinusgenerator.h"
+#include "blacksound/sampleprovider/volumesampleprovider.h"
+#include "test.h"
+
+#include <QAudioFormat>
+#include <QElapsedTimer>
+#include <QObject>
+#include <QTest>
+#include <QVector>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <new>
+
+using namespace BlackSound::Dsp;
+using namespace BlackSound::SampleProvider;
+
+namespace
+{
+    thread_local bool g_countAllocations = false;
+    std::atomic<int> g_allocations { 0 };
+
+    void countAllocation()
+    {
+        if (g_countAllocations) { g_allocations++; }
+    }
+
+    //! Counts the allocations of the current thread in its scope
+    class CAllocationCounter
+    {
+    public:
+        CAllocationCounter()
+        {
+            g_allocations = 0;
+            g_countAllocations = true;
+        }
+        ~CAllocationCounter() { g_countAllocations = false; }
+        int allocations() const { return g_allocations; }
+    };
+}
+
+// Qt containers allocate with malloc, not with operator new
+#if defined(__GLIBC__)
+extern "C"
+{
+    void *__libc_malloc(size_t size);
+    void *__libc_calloc(size_t number, size_t size);
+    void *__libc_realloc(void *ptr, size_t size);
+
+    void *malloc(size_t size)
+    {
+        countAllocation();
+        return __libc_malloc(size);
+    }
+
+    void *calloc(size_t number, size_t size)
+    {
+        countAllocation();
+        return __libc_calloc(number, size);
+    }
+
+    void *realloc(void *ptr, size_t size)
+    {
+        countAllocation();
+        return __libc_realloc(ptr, size);
+    }
+}
+#endif
+
+void *operator new(size_t size)
+{
+    countAllocation();
+    if (void *ptr = std::malloc(size ? size : 1)) { return ptr; }
+    throw std::bad_alloc();
+}
+
+void *operator new[](size_t size)
+{
+    countAllocation();
+    if (void *ptr = std::malloc(size ? size : 1)) { return ptr; }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+void operator delete[](void *ptr) noexcept { std::free(ptr); }
+void operator delete(void *ptr, size_t) noexcept { std::free(ptr); }
+void operator delete[](void *ptr, size_t) noexcept { std::free(ptr); }
+
+namespace BlackCoreTest
+{
+    //! AFV audio sample provider pipeline
+    class CTestAfvAudio : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Ring buffer of CBufferedWaveProvider
+        void bufferedWaveProvider();
+
+        //! Mixing voice inputs does not allocate in the audio callback
+        void mixingWithoutAllocations();
+
+        //! Vectorized DSP kernels give the same results as the scalar ones
+        void dspKernels();
+
+        //! Samples per second of the DSP kernels
+        void dspKernelsBenchmark();
+
+        //! Restore the detected instruction set
+        void cleanup();
+
+    private:
+        //! Mono float format
+        static QAudioFormat audioFormat(int sampleRate);
+    };
+
+    void CTestAfvAudio::bufferedWaveProvider()
+    {
+        CBufferedWaveProvider provider(audioFormat(1000), 10); // 10 samples
+        QCOMPARE(provider.getCapacity(), 10);
+
+        const QVector<float> input { 1, 2, 3, 4, 5, 6 };
+        QVector<float> output(10, -1);
+        QCOMPARE(provider.addSamples(input), 6);
+        QCOMPARE(provider.readSamples(output.data(), 4), 4);
+        QCOMPARE(output.mid(0, 4), QVector<float>({ 1, 2, 3, 4 }));
+
+        // wraps around
+        QCOMPARE(provider.addSamples(input), 6);
+        QCOMPARE(provider.getBufferedSamples(), 8);
+        QCOMPARE(provider.readSamples(output.data(), 10), 8);
+        QCOMPARE(output.mid(0, 8), QVector<float>({ 5, 6, 1, 2, 3, 4, 5, 6 }));
+        QCOMPARE(provider.readSamples(output.data(), 10), 0);
+
+        // full buffer drops the new samples
+        QCOMPARE(provider.addSamples(input), 6);
+        QCOMPARE(provider.addSilence(6), 4);
+        QCOMPARE(provider.getDroppedSamples(), static_cast<qint64>(2));
+        QCOMPARE(provider.readSamples(output.data(), 10), 10);
+        QCOMPARE(output, QVector<float>({ 1, 2, 3, 4, 5, 6, 0, 0, 0, 0 }));
+
+        // cleared samples are skipped
+        provider.addSamples(input);
+        provider.clearBuffer();
+        QCOMPARE(provider.getBufferedSamples(), 0);
+        provider.addSamples(input.constData(), 2);
+        QCOMPARE(provider.readSamples(output.data(), 10), 2);
+        QCOMPARE(output.mid(0, 2), QVector<float>({ 1, 2 }));
+    }
+
+    void CTestAfvAudio::mixingWithoutAllocations()
+    {
+        constexpr int voiceInputs = 8;
+        constexpr int samplesPerCallback = 960; // 20ms
+        const QAudioFormat format = audioFormat(48000);
+
+        // same chain as the AFV receivers: buffered voice, compressor and equalizer per voice input, noise and block tone
+        CMixingSampleProvider mixer;
+        QVector<CBufferedWaveProvider *> inputs;
+        for (int i = 0; i < voiceInputs; i++)
+        {
+            CBufferedWaveProvider *input = new CBufferedWaveProvider(format, 2000, &mixer);
+            CSimpleCompressorEffect *compressor = new CSimpleCompressorEffect(input, &mixer);
+            CEqualizerSampleProvider *equalizer = new CEqualizerSampleProvider(compressor, EqualizerPresets::VHFEmulation, &mixer);
+            mixer.addMixerInput(equalizer);
+            inputs.push_back(input);
+        }
+        CSawToothGenerator *acBusNoise = new CSawToothGenerator(400, &mixer);
+        acBusNoise->setGain(0.001);
+        mixer.addMixerInput(acBusNoise);
+        mixer.addMixerInput(new CSinusGenerator(180, &mixer));
+        mixer.reserve(samplesPerCallback);
+        CVolumeSampleProvider volume(&mixer);
+        volume.setGainRatio(0.5);
+
+        QVector<float> packet(samplesPerCallback);
+        for (int i = 0; i < packet.size(); i++) { packet[i] = static_cast<float>((i % 100) / 100.0 - 0.5); }
+        QVector<float> output(samplesPerCallback);
+
+        for (int callback = 0; callback < 50; callback++)
+        {
+            int allocations = 0;
+            int samplesRead = 0;
+            {
+                const CAllocationCounter counter;
+                for (CBufferedWaveProvider *input : std::as_const(inputs))
+                {
+                    input->addSamples(packet.constData(), packet.size());
+                }
+                samplesRead = volume.readSamples(output.data(), samplesPerCallback);
+                allocations = counter.allocations();
+            }
+            QCOMPARE(samplesRead, samplesPerCallback);
+            QCOMPARE(allocations, 0);
+        }
+
+        for (const CBufferedWaveProvider *input : std::as_const(inputs))
+        {
+            QCOMPARE(input->getBufferedSamples(), 0);
+            QCOMPARE(input->getDroppedSamples(), static_cast<qint64>(0));
+        }
+    }
+
+    void CTestAfvAudio::dspKernels()
+    {
+        constexpr int count = 1021; // not a multiple of the vector sizes
+        QVector<float> input(count);
+        QVector<float> source(count);
+        QVector<qint16> shorts(count);
+        for (int i = 0; i < count; i++)
+        {
+            input[i] = static_cast<float>(1.2 * std::sin(i * 0.05)); // some values out of range
+            source[i] = static_cast<float>(std::cos(i * 0.3));
+            shorts[i] = static_cast<qint16>((i * 977) % 65536 - 32768);
+        }
+
+        // scalar reference
+        QCOMPARE(setSimdLevel(SimdScalar), SimdScalar);
+        QVector<float> mixed = input;
+        mixAdd(mixed.data(), source.constData(), count);
+        QVector<float> gained = input;
+        applyGain(gained.data(), count, 0.7f);
+        QVector<float> floats(count);
+        convertShortToFloat(shorts.constData(), floats.data(), count);
+        QVector<qint16> converted(count);
+        convertFloatToShort(input.constData(), converted.data(), count);
+        QVector<float> filtered = input;
+        BiQuadFilter filter = BiQuadFilter::peakingEQ(44100, 1450, 1.0, 25.0);
+        for (float &sample : filtered) { sample = filter.transform(sample); }
+
+        QCOMPARE(converted.at(31), static_cast<qint16>(32767)); // clipped
+        const QByteArray floatBytes(reinterpret_cast<const char *>(input.constData()), count * static_cast<int>(sizeof(float)));
+        QCOMPARE(BlackSound::convertFloatBytesTo16BitPCM(floatBytes), converted);
+        for (const SimdLevel level : { SimdSse2, SimdAvx2 })
+        {
+            if (setSimdLevel(level) != level) { continue; } // not supported here
+
+            QVector<float> v = input;
+            mixAdd(v.data(), source.constData(), count);
+            QCOMPARE(v, mixed);
+            v = input;
+            applyGain(v.data(), count, 0.7f);
+            QCOMPARE(v, gained);
+            QVector<float> f(count);
+            convertShortToFloat(shorts.constData(), f.data(), count);
+            QCOMPARE(f, floats);
+            QVector<qint16> c(count);
+            convertFloatToShort(input.constData(), c.data(), count);
+            QCOMPARE(c, converted);
+
+            // block wise, feed forward in float
+            BiQuadFilter blockFilter = BiQuadFilter::peakingEQ(44100, 1450, 1.0, 25.0);
+            v = input;
+            blockFilter.transform(v.data(), 500);
+            blockFilter.transform(v.data() + 500, count - 500);
+            for (int i = 0; i < count; i++) { QVERIFY2(std::abs(v.at(i) - filtered.at(i)) < 1e-3f, qPrintable(QString::number(i))); }
+        }
+    }
+
+    void CTestAfvAudio::dspKernelsBenchmark()
+    {
+        constexpr int count = 960;
+        constexpr int rounds = 20000;
+        constexpr qint64 samples = static_cast<qint64>(count) * rounds;
+        QVector<float> buffer(count, 0.25f);
+        QVector<float> source(count, 0.5f);
+        QVector<qint16> shorts(count, 1000);
+        BiQuadFilter filter = BiQuadFilter::peakingEQ(44100, 1450, 1.0, 25.0);
+
+        const auto samplesPerSecond = [](qint64 ns) { return samples * 1000000000LL / qMax(ns, 1LL); };
+        for (const SimdLevel level : { SimdScalar, SimdSse2, SimdAvx2 })
+        {
+            if (setSimdLevel(level) != level) { continue; }
+            QElapsedTimer timer;
+
+            timer.start();
+            for (int r = 0; r < rounds; r++) { mixAdd(buffer.data(), source.constData(), count); }
+            const qint64 mixNs = timer.nsecsElapsed();
+
+            timer.start();
+            for (int r = 0; r < rounds; r++) { applyGain(buffer.data(), count, 1.0f); }
+            const qint64 gainNs = timer.nsecsElapsed();
+
+            timer.start();
+            for (int r = 0; r < rounds; r++) { convertShortToFloat(shorts.constData(), buffer.data(), count); }
+            const qint64 toFloatNs = timer.nsecsElapsed();
+
+            timer.start();
+            for (int r = 0; r < rounds; r++) { convertFloatToShort(buffer.constData(), shorts.data(), count); }
+            const qint64 toShortNs = timer.nsecsElapsed();
+
+            timer.start();
+            for (int r = 0; r < rounds; r++) { filter.transform(buffer.data(), count); }
+            const qint64 biQuadNs = timer.nsecsElapsed();
+
+            qDebug() << toQString(level) << "samples/s"
+                     << "mix:" << samplesPerSecond(mixNs)
+                     << "gain:" << samplesPerSecond(gainNs)
+                     << "int16->float:" << samplesPerSecond(toFloatNs)
+                     << "float->int16:" << samplesPerSecond(toShortNs)
+                     << "biquad:" << samplesPerSecond(biQuadNs);
+        }
+    }
+
+    void CTestAfvAudio::cleanup()
+    {
+        setSimdLevel(detectedSimdLevel());
+    }
+
+    QAudioFormat CTestAfvAudio::audioFormat(int sampleRate)
+    {
+        QAudioFormat format;
+        format.setSampleRate(sampleRate);
+        format.setChannelCount(1);
+        format.setSampleSize(32);
+        format.setSampleType(QAudioFormat::Float);
+        format.setByteOrder(QAudioFormat::LittleEndian);
+        format.setCodec("audio/pcm");
+        return format;
+    }
+} // ns
+
+//! main
+BLACKTEST_MAIN(BlackCoreTest::CTestAfvAudio);
+
+#include "testafvaudio.moc"
+
+//! \endcond
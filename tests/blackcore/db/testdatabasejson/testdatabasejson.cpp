@@ -0,0 +1,127 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \cond PRIVATE_TESTS
+
+/*!
+ * \file
+ * \ingroup testblackcore
+ */
+
+#include "blackcore/db/databaseutils.h"
+#include "blackmisc/simulation/aircraftmodellist.h"
+#include "blackmisc/swiftdirectories.h"
+#include "test.h"
+
+#include <QElapsedTimer>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QObject>
+#include <QTest>
+
+using namespace BlackCore::Db;
+using namespace BlackMisc;
+using namespace BlackMisc::Aviation;
+using namespace BlackMisc::Simulation;
+
+namespace BlackCoreTest
+{
+    //! Decoding DB JSON data
+    class CTestDatabaseJson : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Read the captured models
+        void initTestCase();
+
+        //! Single model with all related objects
+        void decodeModel();
+
+        //! Parallel decoding yields the same models as decoding row by row
+        void decodeModelsParallel();
+
+        //! Row by row vs. parallel decoding of the captured models
+        void decodeModelsBenchmark();
+
+    private:
+        //! Decode row by row, like before the parallel decoding
+        CAircraftModelList decodeRowByRow() const;
+
+        QJsonArray m_models; //!< captured DB models
+    };
+
+    void CTestDatabaseJson::initTestCase()
+    {
+        const QJsonObject json = CDatabaseUtils::readQJsonObjectFromDatabaseFile(CSwiftDirectories::staticDbFilesDirectory(), "models.json");
+        m_models = json.value("data").toArray();
+        QVERIFY2(m_models.size() > 1000, "Missing captured models");
+    }
+
+    void CTestDatabaseJson::decodeModel()
+    {
+        const QJsonObject json = m_models.first().toObject();
+        const CAircraftModel model = CAircraftModel::fromDatabaseJson(json);
+        QVERIFY(model.hasValidDbKey());
+        QCOMPARE(model.getDbKey(), json.value("mod_id").toInt());
+        QCOMPARE(model.getModelString(), json.value("mod_modelstring").toString());
+        QCOMPARE(model.getAircraftIcaoCodeDesignator(), json.value("ac_designator").toString());
+        QCOMPARE(model.getLivery().getCombinedCode(), json.value("liv_combinedcode").toString());
+        QCOMPARE(model.getDistributor().getDbKey(), json.value("dist_id").toString());
+        QCOMPARE(model.getLivery().getAirlineIcaoCodeDesignator(), json.value("al_designator").toString());
+        QVERIFY(model.getSimulator().isFSX());
+        QVERIFY(!model.getSimulator().isXPlane());
+    }
+
+    void CTestDatabaseJson::decodeModelsParallel()
+    {
+        const CAircraftModelList rowByRow = this->decodeRowByRow();
+        const CAircraftModelList parallel = CAircraftModelList::fromDatabaseJsonCaching(m_models);
+        QCOMPARE(parallel.size(), rowByRow.size());
+        for (int i = 0; i < parallel.size(); ++i)
+        {
+            const CAircraftModel &p = parallel[i];
+            const CAircraftModel &r = rowByRow[i];
+            QCOMPARE(p.getDbKey(), r.getDbKey());
+            QCOMPARE(p.getModelString(), r.getModelString());
+            QCOMPARE(p.getAircraftIcaoCode().getDbKey(), r.getAircraftIcaoCode().getDbKey());
+            QCOMPARE(p.getLivery().getDbKey(), r.getLivery().getDbKey());
+            QCOMPARE(p.getDistributor().getDbKey(), r.getDistributor().getDbKey());
+        }
+    }
+
+    void CTestDatabaseJson::decodeModelsBenchmark()
+    {
+        QElapsedTimer timer;
+        timer.start();
+        const CAircraftModelList rowByRow = this->decodeRowByRow();
+        const qint64 rowByRowMs = timer.restart();
+        const CAircraftModelList parallel = CAircraftModelList::fromDatabaseJsonCaching(m_models);
+        const qint64 parallelMs = timer.elapsed();
+        QCOMPARE(parallel.size(), rowByRow.size());
+
+        qDebug() << "Decoded models:" << m_models.size();
+        qDebug() << "Row by row:" << rowByRowMs << "ms, parallel:" << parallelMs << "ms";
+    }
+
+    CAircraftModelList CTestDatabaseJson::decodeRowByRow() const
+    {
+        AircraftIcaoIdMap aircraftIcaos;
+        LiveryIdMap liveries;
+        DistributorIdMap distributors;
+        const AircraftCategoryIdMap categories;
+        CAircraftModelList models;
+        for (const QJsonValue &value : m_models)
+        {
+            models.push_back(CAircraftModel::fromDatabaseJsonCaching(value.toObject(), aircraftIcaos, categories, liveries, distributors));
+        }
+        return models;
+    }
+} // namespace
+
+//! main
+BLACKTEST_MAIN(BlackCoreTest::CTestDatabaseJson);
+
+#include "testdatabasejson.moc"
+
+//! \endcond
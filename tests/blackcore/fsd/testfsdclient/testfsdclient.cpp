@@ -59,6 +59,7 @@ namespace BlackFsdTest
         void testClientQueryAtis();
         void testClientResponseAtis();
         void testPilotDataUpdate();
+        void testPilotDataUpdateCoalesced();
         void testAtcDataUpdate();
         void testPong();
         void testClientResponseEmptyType();
@@ -313,6 +314,29 @@ namespace BlackFsdTest
         //        QCOMPARE(arguments.at(12).toBool(), false);
     }
 
+    void CTestFSDClient::testPilotDataUpdateCoalesced()
+    {
+        QSignalSpy spy(m_client, &CFSDClient::pilotDataUpdateReceived);
+        QSignalSpy spyDelete(m_client, &CFSDClient::deletePilotReceived);
+        m_client->m_readBuffer = "@N:ABCD:1200:1:48.353855:11.786155:110:0:4290769188:1\r\n"
+                                 "@N:EFGH:1200:1:50.033220:8.570460:364:0:4290769188:1\r\n"
+                                 "#DPOEHAB:1234567\r\n"
+                                 "@N:ABCD:1200:1:48.353900:11.786200:120:0:4290769188:1\r\n"
+                                 "@N:ABCD:1200:1:48.353950:11.78625";
+        m_client->m_readBufferOffset = 0;
+        m_client->setReadTimeBudgetMs(1000);
+        QVERIFY(!m_client->processReadBuffer());
+
+        // older position of ABCD dropped, incomplete line kept
+        QCOMPARE(spy.count(), 2);
+        QCOMPARE(spyDelete.count(), 1);
+        QCOMPARE(spy.at(0).at(0).value<CAircraftSituation>().getCallsign().asString(), "EFGH");
+        const CAircraftSituation situation = spy.at(1).at(0).value<CAircraftSituation>();
+        QCOMPARE(situation.getCallsign().asString(), "ABCD");
+        QCOMPARE(situation.getAltitude(), CAltitude(120, CLengthUnit::ft()));
+        QCOMPARE(m_client->m_readBuffer.mid(m_client->m_readBufferOffset), QByteArray("@N:ABCD:1200:1:48.353950:11.78625"));
+    }
+
     void CTestFSDClient::testAtcDataUpdate()
     {
         QSignalSpy spy(m_client, &CFSDClient::atcDataUpdateReceived);
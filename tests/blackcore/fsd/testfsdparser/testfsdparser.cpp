@@ -0,0 +1,269 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \cond PRIVATE_TESTS
+
+/*!
+ * \file
+ * \ingroup testblackfsd
+ */
+
+#include "blackcore/fsd/messagetokens.h"
+#include "blackcore/fsd/pilotdataupdate.h"
+#include "blackcore/fsd/enums.h"
+#include "test.h"
+
+#include <QElapsedTimer>
+#include <QHash>
+#include <QObject>
+#include <QTest>
+#include <QTextCodec>
+
+using namespace BlackMisc::Aviation;
+using namespace BlackCore::Fsd;
+
+namespace BlackFsdTest
+{
+    //! Testing the raw FSD line parser
+    class CTestFsdParser : public QObject
+    {
+        Q_OBJECT
+
+    public:
+        //! Constructor
+        explicit CTestFsdParser(QObject *parent = nullptr) : QObject(parent) {}
+
+    private slots:
+        void testMessageTypes();
+        void testTokens();
+        void testNumbers();
+        void testPilotDataUpdate();
+        void benchmarkReplay();
+
+    private:
+        //! Recorded FSD stream (excerpt), as received from the socket
+        static const QList<QByteArray> &recordedStream();
+
+        //! Former parser: decode, prefix scan over all PDU identifiers, split
+        static int parseLegacy(const QByteArray &line, QTextCodec *codec, const QHash<QString, MessageType> &mapping);
+
+        //! Current parser: classify and tokenize the raw line
+        static int parseRaw(const QByteArray &line, QTextCodec *codec);
+    };
+
+    void CTestFsdParser::testMessageTypes()
+    {
+        const QList<QPair<QByteArray, MessageType>> types = {
+            { "#AA", MessageType::AddAtc }, { "#AP", MessageType::AddPilot }, { "%", MessageType::AtcDataUpdate },
+            { "$ZC", MessageType::AuthChallenge }, { "$ZR", MessageType::AuthResponse }, { "$ID", MessageType::ClientIdentification },
+            { "$CQ", MessageType::ClientQuery }, { "$CR", MessageType::ClientResponse }, { "#DA", MessageType::DeleteATC },
+            { "#DP", MessageType::DeletePilot }, { "$FP", MessageType::FlightPlan }, { "#PC", MessageType::ProController },
+            { "$DI", MessageType::FsdIdentification }, { "$!!", MessageType::KillRequest }, { "@", MessageType::PilotDataUpdate },
+            { "^", MessageType::VisualPilotDataUpdate }, { "#SL", MessageType::VisualPilotDataPeriodic }, { "#ST", MessageType::VisualPilotDataStopped },
+            { "$SF", MessageType::VisualPilotDataToggle }, { "$PI", MessageType::Ping }, { "$PO", MessageType::Pong },
+            { "$ER", MessageType::ServerError }, { "#DL", MessageType::ServerHeartbeat }, { "#TM", MessageType::TextMessage },
+            { "#SB", MessageType::PilotClientCom }, { "$XX", MessageType::Rehost }, { "#MU", MessageType::Mute },
+            { "SIMDATA", MessageType::EuroscopeSimData }, { "!R", MessageType::RegistrationInfo }, { "-MD", MessageType::RevBClientParts },
+            { "-PD", MessageType::RevBPilotDescription }
+        };
+
+        for (const auto &type : types)
+        {
+            const QByteArray line = type.first + "ABCD:SERVER:1";
+            int pduLength = -1;
+            QCOMPARE(messageTypeFromRawLine(line.constData(), line.size(), pduLength), type.second);
+            QCOMPARE(pduLength, type.first.size());
+        }
+
+        const QList<QByteArray> unknown = { "", "#", "#X", "$C", "$CX", "SIMDAT", "-M", "XYZ:1:2" };
+        for (const QByteArray &line : unknown)
+        {
+            int pduLength = -1;
+            QCOMPARE(messageTypeFromRawLine(line.constData(), line.size(), pduLength), MessageType::Unknown);
+            QCOMPARE(pduLength, 0);
+        }
+    }
+
+    void CTestFsdParser::testTokens()
+    {
+        const QByteArray line("#TMEDMM_CTR::@24050:Hey, how are you doing?:");
+        const MessageTokens tokens(line, 3, line.size(), nullptr);
+        const QStringList expected = QString::fromUtf8(line.mid(3)).split(':');
+        QCOMPARE(tokens.size(), 5);
+        QCOMPARE(tokens.toStringList(), expected);
+        QCOMPARE(tokens.toQString(0), QString("EDMM_CTR"));
+        QVERIFY(tokens.toQString(1).isEmpty());
+        QVERIFY(tokens.toQString(4).isEmpty());
+        QCOMPARE(tokens.raw(2), QByteArray("@24050"));
+
+        // codec is used for decoding
+        QTextCodec *latin1 = QTextCodec::codecForName("latin1");
+        QVERIFY(latin1);
+        const QByteArray encoded = latin1->fromUnicode(QStringLiteral("$CQURRR_R_APP:@94835:SC:VTD740:ÈËÑ"));
+        const MessageTokens tokensLatin1(encoded, 3, encoded.size(), latin1);
+        QCOMPARE(tokensLatin1.size(), 5);
+        QCOMPARE(tokensLatin1.toQString(4), QStringLiteral("ÈËÑ"));
+
+        const QByteArray single("$PIABCD");
+        const MessageTokens tokensSingle(single, 3, single.size(), nullptr);
+        QCOMPARE(tokensSingle.size(), 1);
+        QCOMPARE(tokensSingle.toQString(0), QString("ABCD"));
+    }
+
+    void CTestFsdParser::testNumbers()
+    {
+        const QByteArray line("42:-17:+3: 12 :abc::4294967295:4294967296:-1:53.10591:-2.50108:x1.0");
+        const MessageTokens tokens(line, 0, line.size(), nullptr);
+        const QStringList strings = tokens.toStringList();
+        QCOMPARE(tokens.size(), strings.size());
+        for (int i = 0; i < tokens.size(); ++i)
+        {
+            QCOMPARE(tokens.toInt(i), strings[i].toInt());
+            QCOMPARE(tokens.toUInt(i), strings[i].toUInt());
+            QCOMPARE(tokens.toDouble(i), strings[i].toDouble());
+        }
+    }
+
+    void CTestFsdParser::testPilotDataUpdate()
+    {
+        const QByteArray line("@N:SVA732:346:1:53.10591:2.50108:37010:529:4261225460:42");
+        const MessageTokens tokens(line, 1, line.size(), nullptr);
+        const PilotDataUpdate fromRaw = PilotDataUpdate::fromTokens(tokens);
+        const PilotDataUpdate fromStrings = PilotDataUpdate::fromTokens(QString::fromUtf8(line.mid(1)).split(':'));
+        QCOMPARE(fromRaw, fromStrings);
+        QCOMPARE(fromRaw.sender(), QString("SVA732"));
+        QCOMPARE(fromRaw.m_transponderMode, CTransponder::ModeC);
+        QCOMPARE(fromRaw.m_altitudePressure, 37052);
+    }
+
+    void CTestFsdParser::benchmarkReplay()
+    {
+        QHash<QString, MessageType> mapping;
+        mapping["#AA"] = MessageType::AddAtc;
+        mapping["#AP"] = MessageType::AddPilot;
+        mapping["%"] = MessageType::AtcDataUpdate;
+        mapping["$ZC"] = MessageType::AuthChallenge;
+        mapping["$ZR"] = MessageType::AuthResponse;
+        mapping["$ID"] = MessageType::ClientIdentification;
+        mapping["$CQ"] = MessageType::ClientQuery;
+        mapping["$CR"] = MessageType::ClientResponse;
+        mapping["#DA"] = MessageType::DeleteATC;
+        mapping["#DP"] = MessageType::DeletePilot;
+        mapping["$FP"] = MessageType::FlightPlan;
+        mapping["#PC"] = MessageType::ProController;
+        mapping["$DI"] = MessageType::FsdIdentification;
+        mapping["$!!"] = MessageType::KillRequest;
+        mapping["@"] = MessageType::PilotDataUpdate;
+        mapping["^"] = MessageType::VisualPilotDataUpdate;
+        mapping["#SL"] = MessageType::VisualPilotDataPeriodic;
+        mapping["#ST"] = MessageType::VisualPilotDataStopped;
+        mapping["$SF"] = MessageType::VisualPilotDataToggle;
+        mapping["$PI"] = MessageType::Ping;
+        mapping["$PO"] = MessageType::Pong;
+        mapping["$ER"] = MessageType::ServerError;
+        mapping["#DL"] = MessageType::ServerHeartbeat;
+        mapping["#TM"] = MessageType::TextMessage;
+        mapping["#SB"] = MessageType::PilotClientCom;
+        mapping["$XX"] = MessageType::Rehost;
+        mapping["#MU"] = MessageType::Mute;
+        mapping["SIMDATA"] = MessageType::EuroscopeSimData;
+        mapping["!R"] = MessageType::RegistrationInfo;
+        mapping["-MD"] = MessageType::RevBClientParts;
+        mapping["-PD"] = MessageType::RevBPilotDescription;
+
+        QTextCodec *codec = QTextCodec::codecForName("utf-8");
+        const QList<QByteArray> &stream = recordedStream();
+        const int replays = 5000;
+        const int lines = replays * stream.size();
+
+        QElapsedTimer timer;
+        int checksumLegacy = 0;
+        timer.start();
+        for (int r = 0; r < replays; ++r)
+        {
+            for (const QByteArray &line : stream) { checksumLegacy += parseLegacy(line, codec, mapping); }
+        }
+        const qint64 legacyMs = qMax(timer.elapsed(), 1LL);
+
+        int checksumRaw = 0;
+        timer.start();
+        for (int r = 0; r < replays; ++r)
+        {
+            for (const QByteArray &line : stream) { checksumRaw += parseRaw(line, codec); }
+        }
+        const qint64 rawMs = qMax(timer.elapsed(), 1LL);
+
+        QCOMPARE(checksumRaw, checksumLegacy);
+        qDebug() << "Replayed" << lines << "FSD lines";
+        qDebug() << "prefix scan + QStringList:" << legacyMs << "ms," << (lines * 1000LL / legacyMs) << "lines/s";
+        qDebug() << "raw dispatch + tokens:    " << rawMs << "ms," << (lines * 1000LL / rawMs) << "lines/s";
+    }
+
+    const QList<QByteArray> &CTestFsdParser::recordedStream()
+    {
+        static const QList<QByteArray> stream = {
+            "@N:SVA732:346:1:53.10591:2.50108:37010:529:4261225460:42\r\n",
+            "@N:DLH4AB:2000:1:50.03322:8.57046:364:0:4290769188:-3\r\n",
+            "@S:N172SP:1200:1:47.45012:-122.30923:443:0:4282421252:12\r\n",
+            "#SBBAW106:LHA449:PI:GEN:EQUIPMENT=B744:AIRLINE=BAW:LIVERY=UNION\r\n",
+            "@N:BAW106:4523:1:51.47002:-0.45429:24987:451:4265556004:-111\r\n",
+            "%EDDM_TWR:18700:3:20:5:48.35378:11.78609:0\r\n",
+            "$CQDLH123:@94836:ACC:{\"request\":\"full\"}\r\n",
+            "@Y:AFR529:7000:1:49.00971:2.54786:392:12:4290769188:12\r\n",
+            "#TMAFR529:@20500&@26000:taxi to entry N1 via M A4\r\n",
+            "@N:UAE5:3345:1:25.25528:55.36435:36012:488:4261225460:-240\r\n",
+            "$CRLHA449:LOWW_TWR:RN:Peter Buchegger - LOWL:NONE:1\r\n",
+            "@N:QTR8:2256:1:25.27307:51.60811:41000:503:4261225460:-202\r\n",
+            "#DL:0:0\r\n",
+            "@N:KLM1234:1000:1:52.30806:4.76417:11000:300:4290769188:18\r\n",
+            "@N:EZY81PF:6741:1:45.63006:8.72811:29998:441:4261225460:-93\r\n",
+            "$CRN1234:BAW345:CAPS:INTERIMPOS=1:MODELDESC=1:ATCINFO=1:STEALTH=1:ACCONFIG=1\r\n",
+            "@N:RYR4GX:5612:1:41.29742:2.07846:2311:178:4278194872:-10\r\n",
+            "#DPOEHAB:1234567\r\n"
+        };
+        return stream;
+    }
+
+    int CTestFsdParser::parseLegacy(const QByteArray &lineEncoded, QTextCodec *codec, const QHash<QString, MessageType> &mapping)
+    {
+        const QString line = codec->toUnicode(lineEncoded).trimmed();
+        QString cmd;
+        MessageType messageType = MessageType::Unknown;
+        for (auto it = mapping.constBegin(); it != mapping.constEnd(); ++it)
+        {
+            if (line.startsWith(it.key()))
+            {
+                cmd = it.key();
+                messageType = it.value();
+                break;
+            }
+        }
+        if (messageType == MessageType::Unknown) { return 0; }
+
+        const QString payload = line.mid(cmd.size()).trimmed();
+        const QStringList tokens = payload.split(':');
+        if (messageType == MessageType::PilotDataUpdate) { return PilotDataUpdate::fromTokens(tokens).m_altitudeTrue; }
+        return tokens.size();
+    }
+
+    int CTestFsdParser::parseRaw(const QByteArray &lineEncoded, QTextCodec *codec)
+    {
+        int end = lineEncoded.size();
+        while (end > 0 && (lineEncoded[end - 1] == '\n' || lineEncoded[end - 1] == '\r')) { --end; }
+
+        int pduLength = 0;
+        const MessageType messageType = messageTypeFromRawLine(lineEncoded.constData(), end, pduLength);
+        if (messageType == MessageType::Unknown) { return 0; }
+
+        const MessageTokens tokens(lineEncoded, pduLength, end, codec);
+        if (messageType == MessageType::PilotDataUpdate) { return PilotDataUpdate::fromTokens(tokens).m_altitudeTrue; }
+        return tokens.size();
+    }
+} // ns
+
+//! main
+BLACKTEST_APPLESS_MAIN(BlackFsdTest::CTestFsdParser);
+
+#include "testfsdparser.moc"
+
+//! \endcond
@@ -0,0 +1,186 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \cond PRIVATE_TESTS
+
+/*!
+ * \file
+ * \ingroup testblackfsd
+ */
+
+#include "blackcore/fsd/messagewriter.h"
+#include "blackcore/fsd/pilotdataupdate.h"
+#include "blackcore/fsd/interimpilotdataupdate.h"
+#include "blackcore/fsd/visualpilotdataupdate.h"
+#include "blackcore/fsd/visualpilotdataperiodic.h"
+#include "blackcore/fsd/visualpilotdatastopped.h"
+#include "blackcore/fsd/enums.h"
+#include "test.h"
+
+#include <QElapsedTimer>
+#include <QObject>
+#include <QRandomGenerator>
+#include <QTest>
+#include <QTextCodec>
+#include <limits>
+
+using namespace BlackMisc::Aviation;
+using namespace BlackCore::Fsd;
+
+namespace BlackFsdTest
+{
+    //! Testing the pre-serialized FSD message writer
+    class CTestFsdWriter : public QObject
+    {
+        Q_OBJECT
+
+    public:
+        //! Constructor
+        explicit CTestFsdWriter(QObject *parent = nullptr) : QObject(parent) {}
+
+    private slots:
+        void testIntegers();
+        void testFixed();
+        void testStrings();
+        void testMessages();
+        void benchmarkMessages();
+
+    private:
+        //! Former path: tokens joined to a string, then encoded
+        template <class T>
+        static QByteArray encodeTokens(const T &message, QTextCodec *codec)
+        {
+            return codec->fromUnicode(messageToFSDString(message));
+        }
+
+        //! Time both paths for one message type
+        template <class T>
+        static void benchmark(const char *name, const T &message, QTextCodec *codec);
+
+        static PilotDataUpdate pilotDataUpdate();
+        static InterimPilotDataUpdate interimPilotDataUpdate();
+        static VisualPilotDataUpdate visualPilotDataUpdate();
+    };
+
+    void CTestFsdWriter::testIntegers()
+    {
+        MessageWriter writer;
+        writer.begin("X").add(0).add(-1).add(1234567).add(std::numeric_limits<int>::min()).add(std::numeric_limits<quint32>::max());
+        QCOMPARE(writer.finish(), QByteArray("X0:-1:1234567:-2147483648:4294967295\r\n"));
+    }
+
+    void CTestFsdWriter::testFixed()
+    {
+        const QList<double> values = { 0.0, -0.0, 0.5, -0.5, 1.005, 2.675, 48.353855, 11.786155, -72.158405, 179.9999999, -0.000001, 0.0000049,
+                                       123456.78915, 1e13, -1e13, 1e-20 };
+        for (int precision : { 0, 2, 4, 5, 7 })
+        {
+            for (double value : values)
+            {
+                MessageWriter writer;
+                writer.begin("").addFixed(value, precision);
+                const QByteArray expected = QString::number(value, 'f', precision).toLatin1() + "\r\n";
+                QCOMPARE(writer.finish(), expected);
+            }
+        }
+
+        // positions and velocities as sent to the network
+        QRandomGenerator random(4711);
+        MessageWriter writer;
+        for (int i = 0; i < 100000; ++i)
+        {
+            const double value = random.bounded(360.0) - 180.0;
+            const int precision = 2 + i % 6;
+            writer.begin("").addFixed(value, precision);
+            const QByteArray expected = QString::number(value, 'f', precision).toLatin1() + "\r\n";
+            QCOMPARE(writer.finish(), expected);
+        }
+    }
+
+    void CTestFsdWriter::testStrings()
+    {
+        QTextCodec *latin1 = QTextCodec::codecForName("ISO-8859-1");
+        MessageWriter writer(latin1);
+        writer.begin("#TM").add(QString("ABCD")).add(QString()).add(QString::fromUtf8("Grüße")).add(QLatin1String("VI"));
+        QCOMPARE(writer.finish(), latin1->fromUnicode(QString::fromUtf8("#TMABCD::Grüße:VI\r\n")));
+
+        writer.setCodec(nullptr);
+        writer.begin("#TM").addTokens({ "A", QString::fromUtf8("ü") });
+        QCOMPARE(writer.finish(), QString::fromUtf8("#TMA:ü\r\n").toUtf8());
+    }
+
+    void CTestFsdWriter::testMessages()
+    {
+        QTextCodec *codec = QTextCodec::codecForName("utf-8");
+        MessageWriter writer(codec);
+
+        const PilotDataUpdate pdu = pilotDataUpdate();
+        QCOMPARE(messageToFSDBytes(pdu, writer), encodeTokens(pdu, codec));
+
+        const InterimPilotDataUpdate interim = interimPilotDataUpdate();
+        QCOMPARE(messageToFSDBytes(interim, writer), encodeTokens(interim, codec));
+
+        const VisualPilotDataUpdate visual = visualPilotDataUpdate();
+        QCOMPARE(messageToFSDBytes(visual, writer), encodeTokens(visual, codec));
+        QCOMPARE(messageToFSDBytes(visual.toPeriodic(), writer), encodeTokens(visual.toPeriodic(), codec));
+        QCOMPARE(messageToFSDBytes(visual.toStopped(), writer), encodeTokens(visual.toStopped(), codec));
+
+        // invalid messages are not sent
+        QVERIFY(messageToFSDBytes(PilotDataUpdate(), writer).isEmpty());
+    }
+
+    void CTestFsdWriter::benchmarkMessages()
+    {
+        QTextCodec *codec = QTextCodec::codecForName("utf-8");
+        benchmark("PilotDataUpdate", pilotDataUpdate(), codec);
+        benchmark("InterimPilotDataUpdate", interimPilotDataUpdate(), codec);
+        benchmark("VisualPilotDataUpdate", visualPilotDataUpdate(), codec);
+        benchmark("VisualPilotDataPeriodic", visualPilotDataUpdate().toPeriodic(), codec);
+        benchmark("VisualPilotDataStopped", visualPilotDataUpdate().toStopped(), codec);
+    }
+
+    template <class T>
+    void CTestFsdWriter::benchmark(const char *name, const T &message, QTextCodec *codec)
+    {
+        const int messages = 100000;
+        MessageWriter writer(codec);
+        QElapsedTimer timer;
+
+        int sizeTokens = 0;
+        timer.start();
+        for (int i = 0; i < messages; ++i) { sizeTokens += encodeTokens(message, codec).size(); }
+        const qint64 tokensNs = qMax(timer.nsecsElapsed(), 1LL);
+
+        int sizeWriter = 0;
+        timer.start();
+        for (int i = 0; i < messages; ++i) { sizeWriter += messageToFSDBytes(message, writer).size(); }
+        const qint64 writerNs = qMax(timer.nsecsElapsed(), 1LL);
+
+        QCOMPARE(sizeWriter, sizeTokens);
+        qDebug() << name << "tokens + join + encode:" << (tokensNs / messages) << "ns/msg,"
+                 << "writer:" << (writerNs / messages) << "ns/msg";
+    }
+
+    PilotDataUpdate CTestFsdWriter::pilotDataUpdate()
+    {
+        return PilotDataUpdate(CTransponder::ModeC, "ABCD", 7000, PilotRating::Student, 48.353855, 11.786155, 1200, 1250, 120, -2, 2, 250, false);
+    }
+
+    InterimPilotDataUpdate CTestFsdWriter::interimPilotDataUpdate()
+    {
+        return InterimPilotDataUpdate("ABCD", "XYZ", 48.353855, 11.786155, 1200, 120, -2, 2, 250, false);
+    }
+
+    VisualPilotDataUpdate CTestFsdWriter::visualPilotDataUpdate()
+    {
+        return VisualPilotDataUpdate("ABCD", 48.3538553, -11.7861554, 1234.567, 12.345, -2.5, 2.5, 250.0,
+                                     -0.0002, 0.0003, -0.0031, 0.0012, -0.0021, 0.00005, 3.5);
+    }
+} // ns
+
+//! main
+BLACKTEST_APPLESS_MAIN(BlackFsdTest::CTestFsdWriter);
+
+#include "testfsdwriter.moc"
+
+//! \endcond
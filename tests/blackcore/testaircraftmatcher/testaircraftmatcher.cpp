@@ -0,0 +1,157 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \cond PRIVATE_TESTS
+
+/*!
+ * \file
+ * \ingroup testblackcore
+ */
+
+#include "blackcore/aircraftmatcher.h"
+#include "blackcore/db/databaseutils.h"
+#include "blackmisc/simulation/aircraftmatchersetup.h"
+#include "blackmisc/simulation/aircraftmodelsetindex.h"
+#include "blackmisc/simulation/simulatorinfo.h"
+#include "blackmisc/swiftdirectories.h"
+#include "test.h"
+
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QObject>
+#include <QTest>
+
+using namespace BlackCore;
+using namespace BlackCore::Db;
+using namespace BlackMisc;
+using namespace BlackMisc::Aviation;
+using namespace BlackMisc::Simulation;
+
+namespace BlackCoreTest
+{
+    //! Model matching on the model set indexes
+    class CTestAircraftMatcher : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Read the captured models
+        void initTestCase();
+
+        //! Index finders yield the same models as the model list finders
+        void indexFinders();
+
+        //! Batch matching yields the same models as matching one by one
+        void batchMatching();
+
+        //! Results of cancelled batches are dropped
+        void cancelBatchMatching();
+
+    private:
+        //! Remote aircraft without model string, built from every n-th model of the set
+        CSimulatedAircraftList createRemoteAircraft(int step) const;
+
+        CAircraftModelList m_models; //!< captured DB models
+    };
+
+    void CTestAircraftMatcher::initTestCase()
+    {
+        const QJsonObject json = CDatabaseUtils::readQJsonObjectFromDatabaseFile(CSwiftDirectories::staticDbFilesDirectory(), "models.json");
+        m_models = CAircraftModelList::fromDatabaseJsonCaching(json.value("data").toArray());
+        QVERIFY2(m_models.size() > 1000, "Missing captured models");
+    }
+
+    void CTestAircraftMatcher::indexFinders()
+    {
+        const CAircraftModelSetIndex index(m_models);
+        const CAircraftModelSetIndex::ModelIds all = index.allIds();
+        QCOMPARE(index.models(all), m_models);
+
+        for (int i = 0; i < m_models.sizeInt(); i += 97)
+        {
+            const CAircraftModel &model = m_models[i];
+            const CAircraftIcaoCode &icao = model.getAircraftIcaoCode();
+            const QString &designator = icao.getDesignator();
+            const QString &combinedCode = model.getLivery().getCombinedCode();
+            QCOMPARE(index.models(index.findByAircraftDesignatorAndLiveryCombinedCode(all, designator, combinedCode)), m_models.findByAircraftDesignatorAndLiveryCombinedCode(designator, combinedCode));
+            QCOMPARE(index.models(index.findByFamily(all, icao.getFamily())), m_models.findByFamily(icao.getFamily()));
+            QCOMPARE(index.models(index.findByManufacturer(all, icao.getManufacturer())), m_models.findByManufacturer(icao.getManufacturer()));
+            QCOMPARE(index.models(index.findByCombinedType(all, icao.getCombinedType())), m_models.findByCombinedType(icao.getCombinedType()));
+            const int id = index.findFirstByModelStringOrAlias(model.getModelString().toLower());
+            QVERIFY(id >= 0);
+            QCOMPARE(index.model(id), m_models.findFirstByModelStringOrDefault(model.getModelString()));
+
+            // reduced views keep their order
+            const CAircraftModelSetIndex::ModelIds byCombinedType = index.findByCombinedType(all, icao.getCombinedType());
+            QCOMPARE(index.models(index.findByManufacturer(byCombinedType, icao.getManufacturer())), m_models.findByCombinedType(icao.getCombinedType()).findByManufacturer(icao.getManufacturer()));
+        }
+        QCOMPARE(index.models(index.findByCombinedType(all, "L*J")), m_models.findByCombinedType("L*J"));
+        QCOMPARE(index.models(index.findByMilitaryFlag(all, true)), m_models.findByMilitaryFlag(true));
+    }
+
+    void CTestAircraftMatcher::batchMatching()
+    {
+        CAircraftMatcherSetup setup;
+        setup.setPickStrategy(CAircraftMatcherSetup::PickFirst);
+        CAircraftMatcher matcher(setup);
+        matcher.setModelSet(m_models, CSimulatorInfo::fsx(), true);
+
+        const CSimulatedAircraftList remoteAircraft = this->createRemoteAircraft(53);
+        CAircraftModelList batchModels;
+        matcher.getClosestMatchesAsync(remoteAircraft, MatchingLogNothing, false, this, [&](const CAircraftMatcher::MatchingResult &result) {
+            batchModels.push_back(result.matchedModel);
+        });
+        QTRY_COMPARE_WITH_TIMEOUT(batchModels.size(), remoteAircraft.size(), 30 * 1000);
+
+        for (const CSimulatedAircraft &aircraft : remoteAircraft)
+        {
+            const CAircraftModel serial = matcher.getClosestMatch(aircraft, MatchingLogNothing, nullptr, false);
+            const CAircraftModel batch = batchModels.findFirstByCallsignOrDefault(aircraft.getCallsign());
+            QCOMPARE(batch.getModelString(), serial.getModelString());
+        }
+    }
+
+    void CTestAircraftMatcher::cancelBatchMatching()
+    {
+        CAircraftMatcher matcher;
+        matcher.setModelSet(m_models, CSimulatorInfo::fsx(), true);
+
+        const CSimulatedAircraftList remoteAircraft = this->createRemoteAircraft(101);
+        int results = 0;
+        matcher.getClosestMatchesAsync(remoteAircraft, MatchingLogNothing, false, this, [&](const CAircraftMatcher::MatchingResult &) {
+            ++results;
+        });
+        matcher.cancelBatchMatching();
+
+        // the next batch is not affected
+        int nextResults = 0;
+        matcher.getClosestMatchesAsync(remoteAircraft, MatchingLogNothing, false, this, [&](const CAircraftMatcher::MatchingResult &) {
+            ++nextResults;
+        });
+        QTRY_COMPARE_WITH_TIMEOUT(nextResults, remoteAircraft.sizeInt(), 30 * 1000);
+        QCOMPARE(results, 0);
+    }
+
+    CSimulatedAircraftList CTestAircraftMatcher::createRemoteAircraft(int step) const
+    {
+        CSimulatedAircraftList aircraft;
+        for (int i = 0; i < m_models.sizeInt(); i += step)
+        {
+            CAircraftModel model(m_models[i]);
+            model.setModelString({});
+            model.setModelStringAlias({});
+            model.setDbKey(-1);
+            CSimulatedAircraft remote(model);
+            remote.setCallsign(CCallsign(QStringLiteral("TST%1").arg(i)));
+            aircraft.push_back(remote);
+        }
+        return aircraft;
+    }
+} // namespace
+
+//! main
+BLACKTEST_MAIN(BlackCoreTest::CTestAircraftMatcher);
+
+#include "testaircraftmatcher.moc"
+
+//! \endcond
@@ -0,0 +1,456 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testblackgui
+
+#include "blackgui/models/aircraftmodellistmodel.h"
+#include "blackgui/models/columnformatters.h"
+#include "blackgui/models/columns.h"
+#include "blackgui/models/namevariantpairlistmodel.h"
+#include "blackgui/models/simulatedaircraftlistmodel.h"
+#include "blackmisc/namevariantpairlist.h"
+#include "blackmisc/aviation/callsign.h"
+#include "blackmisc/pq/length.h"
+#include "blackmisc/simulation/simulatedaircraft.h"
+#include "blackmisc/simulation/aircraftmodellist.h"
+#include "blackmisc/simulation/simulatedaircraftlist.h"
+#include "test.h"
+
+#include <QApplication>
+#include <QElapsedTimer>
+#include <QItemSelectionModel>
+#include <QObject>
+#include <QPersistentModelIndex>
+#include <QScrollBar>
+#include <QSignalSpy>
+#include <QTableView>
+#include <QTest>
+#include <QtDebug>
+#include <algorithm>
+
+using namespace BlackMisc;
+using namespace BlackMisc::Aviation;
+using namespace BlackMisc::PhysicalQuantities;
+using namespace BlackMisc::Simulation;
+using namespace BlackGui::Models;
+
+namespace BlackGuiTest
+{
+    //! List model base tests
+    class CTestListModelBase : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Keyed update only signals the changed rows
+        void keyedUpdate();
+
+        //! Moved rows keep persistent indexes
+        void movedRows();
+
+        //! Sorted merge equals a full sort
+        void sortedMerge();
+
+        //! Without key function the model is reset
+        void resetWithoutKey();
+
+        //! Aircraft in range model with view, updated at 1Hz
+        void benchmarkAircraftUpdates();
+
+        //! Cached display values follow the rows
+        void displayCache();
+
+        //! Sorting by positions and fetched values
+        void sortByColumn();
+
+        //! Sort keys order like comparePropertyByIndex
+        void sortKeys();
+
+        //! Model set model, sorting
+        void benchmarkModelSetSort();
+
+        //! Model set model, scrolling with cached display values
+        void benchmarkModelSetScroll();
+
+    private:
+        //! Aircraft "TST<i>" with distance in km
+        static CSimulatedAircraft createAircraft(int i, double distanceKm);
+
+        //! Aircraft, ascending distance
+        static CSimulatedAircraftList createAircraft(int number);
+
+        //! Next second, some aircraft moved, left or joined
+        static CSimulatedAircraftList nextSecond(const CSimulatedAircraftList &aircraft, int second);
+
+        //! Updates of a model shown in a view
+        static qint64 runUpdates(CSimulatedAircraftListModel &model, const CSimulatedAircraftList &start, int updates);
+
+        //! Models with unique model strings, in random order
+        static CAircraftModelList createModels(int number);
+
+        //! Display values of the model are the formatted values of the objects
+        static bool hasFormattedDisplayValues(const CSimulatedAircraftListModel &model);
+
+        //! Scroll through all rows
+        static qint64 scrollAll(QTableView &view);
+    };
+
+    CSimulatedAircraft CTestListModelBase::createAircraft(int i, double distanceKm)
+    {
+        CSimulatedAircraft aircraft;
+        aircraft.setCallsign(CCallsign(QStringLiteral("TST%1").arg(i)));
+        aircraft.setRelativeDistance(CLength(distanceKm, CLengthUnit::km()));
+        return aircraft;
+    }
+
+    CSimulatedAircraftList CTestListModelBase::createAircraft(int number)
+    {
+        CSimulatedAircraftList aircraft;
+        for (int i = 0; i < number; ++i) { aircraft.push_back(createAircraft(i, i + 1)); }
+        return aircraft;
+    }
+
+    CSimulatedAircraftList CTestListModelBase::nextSecond(const CSimulatedAircraftList &aircraft, int second)
+    {
+        CSimulatedAircraftList next;
+        for (int i = 0; i < aircraft.size(); ++i)
+        {
+            CSimulatedAircraft a = aircraft[i];
+            if (i % 200 == second % 200) { continue; } // leaves
+            if (i % 10 == second % 10)
+            {
+                // moved, distinct distances
+                a.setRelativeDistance(CLength(a.getRelativeDistance().value(CLengthUnit::km()) + 0.001 * (i % 7 + 1), CLengthUnit::km()));
+            }
+            next.push_back(a);
+        }
+        next.push_back(createAircraft(100000 + second, 0.5 + second)); // joins
+        return next;
+    }
+
+    void CTestListModelBase::keyedUpdate()
+    {
+        CSimulatedAircraftListModel model;
+        QVERIFY(model.hasKeyFunction());
+        model.update(createAircraft(10));
+        QCOMPARE(model.rowCount(), 10);
+
+        QSignalSpy resetSpy(&model, &QAbstractItemModel::modelReset);
+        QSignalSpy removedSpy(&model, &QAbstractItemModel::rowsRemoved);
+        QSignalSpy insertedSpy(&model, &QAbstractItemModel::rowsInserted);
+        QSignalSpy changedSpy(&model, &QAbstractItemModel::dataChanged);
+        QSignalSpy layoutSpy(&model, &QAbstractItemModel::layoutChanged);
+        QSignalSpy modelDataChangedSpy(&model, &CListModelBaseNonTemplate::modelDataChanged);
+
+        // unchanged
+        model.update(createAircraft(10));
+        QCOMPARE(removedSpy.count() + insertedSpy.count() + changedSpy.count() + layoutSpy.count() + modelDataChangedSpy.count(), 0);
+
+        // one leaves, one joins between TST2 and TST3, TST7 changes
+        CSimulatedAircraftList aircraft = createAircraft(10);
+        aircraft.removeByCallsign(CCallsign("TST5"));
+        aircraft.push_back(createAircraft(99, 3.5));
+        CSimulatedAircraft changed = aircraft.findFirstByCallsign(CCallsign("TST7"));
+        changed.setTransponderCode(7000);
+        aircraft.replaceOrAddObjectByCallsign(changed);
+
+        const QPersistentModelIndex tst8 = model.index(8, 0);
+        QCOMPARE(model.at(tst8).getCallsign().asString(), QStringLiteral("TST8"));
+        model.update(aircraft);
+
+        QCOMPARE(resetSpy.count(), 0);
+        QCOMPARE(layoutSpy.count(), 0);
+        QCOMPARE(removedSpy.count(), 1);
+        QCOMPARE(removedSpy.front().at(1).toInt(), 5);
+        QCOMPARE(insertedSpy.count(), 1);
+        QCOMPARE(insertedSpy.front().at(1).toInt(), 3);
+        QCOMPARE(changedSpy.count(), 1);
+        QCOMPARE(changedSpy.front().at(0).value<QModelIndex>().row(), 7);
+        QCOMPARE(changedSpy.front().at(1).value<QModelIndex>().row(), 7);
+        QCOMPARE(modelDataChangedSpy.count(), 1);
+        QCOMPARE(model.container(), model.sortContainerByColumn(aircraft, model.getSortColumn(), model.getSortOrder()));
+        QCOMPARE(model.at(tst8).getCallsign().asString(), QStringLiteral("TST8"));
+    }
+
+    void CTestListModelBase::movedRows()
+    {
+        CSimulatedAircraftListModel model;
+        model.update(createAircraft(10));
+        const QPersistentModelIndex tst2 = model.index(2, 0);
+
+        // TST2 becomes the farthest aircraft
+        CSimulatedAircraftList aircraft = createAircraft(10);
+        aircraft.replaceOrAddObjectByCallsign(createAircraft(2, 20));
+
+        QSignalSpy resetSpy(&model, &QAbstractItemModel::modelReset);
+        QSignalSpy layoutSpy(&model, &QAbstractItemModel::layoutChanged);
+        QSignalSpy changedSpy(&model, &QAbstractItemModel::dataChanged);
+        model.update(aircraft);
+
+        QCOMPARE(resetSpy.count(), 0);
+        QCOMPARE(layoutSpy.count(), 1);
+        QCOMPARE(changedSpy.count(), 1);
+        QCOMPARE(tst2.row(), 9);
+        QCOMPARE(model.at(tst2).getCallsign().asString(), QStringLiteral("TST2"));
+    }
+
+    void CTestListModelBase::sortedMerge()
+    {
+        CSimulatedAircraftListModel model;
+        const int column = model.getSortColumn();
+        CSimulatedAircraftList aircraft = createAircraft(500);
+        for (int second = 1; second <= 20; ++second)
+        {
+            const CSimulatedAircraftList next = nextSecond(aircraft, second);
+            const CSimulatedAircraftList merged = model.sortContainerByColumnMerged(next, aircraft, column, Qt::AscendingOrder);
+            QCOMPARE(merged, model.sortContainerByColumn(next, column, Qt::AscendingOrder));
+            aircraft = merged;
+        }
+
+        // previous container not sorted by column
+        const CSimulatedAircraftList descending = model.sortContainerByColumn(aircraft, column, Qt::DescendingOrder);
+        QCOMPARE(model.sortContainerByColumnMerged(aircraft, aircraft, column, Qt::DescendingOrder), descending);
+    }
+
+    void CTestListModelBase::resetWithoutKey()
+    {
+        CSimulatedAircraftListModel model;
+        model.setKeyFunction({});
+        QVERIFY(!model.hasKeyFunction());
+        model.update(createAircraft(10));
+
+        QSignalSpy resetSpy(&model, &QAbstractItemModel::modelReset);
+        model.update(createAircraft(11));
+        QCOMPARE(resetSpy.count(), 1);
+        QCOMPARE(model.rowCount(), 11);
+
+        // redundant keys also reset
+        CSimulatedAircraftListModel keyedModel;
+        keyedModel.update(createAircraft(10));
+        QSignalSpy keyedResetSpy(&keyedModel, &QAbstractItemModel::modelReset);
+        CSimulatedAircraftList redundant = createAircraft(10);
+        redundant.push_back(createAircraft(1, 50));
+        keyedModel.update(redundant);
+        QCOMPARE(keyedResetSpy.count(), 1);
+        QCOMPARE(keyedModel.rowCount(), 11);
+    }
+
+    qint64 CTestListModelBase::runUpdates(CSimulatedAircraftListModel &model, const CSimulatedAircraftList &start, int updates)
+    {
+        QTableView view;
+        view.setModel(&model);
+        view.resize(800, 600);
+        model.update(start);
+        view.show();
+        QCoreApplication::processEvents();
+        view.selectRow(10);
+        const CCallsign selected = model.at(model.index(10, 0)).getCallsign();
+
+        QElapsedTimer timer;
+        qint64 ns = 0;
+        CSimulatedAircraftList aircraft = start;
+        for (int second = 1; second <= updates; ++second)
+        {
+            aircraft = nextSecond(aircraft, second);
+            timer.start();
+            model.update(aircraft);
+            QCoreApplication::processEvents(); // layout and paint
+            ns += timer.nsecsElapsed();
+        }
+
+        const QModelIndexList selection = view.selectionModel()->selectedRows();
+        const bool keptSelection = selection.size() == 1 && model.at(selection.front()).getCallsign() == selected;
+        qDebug() << (model.hasKeyFunction() ? "keyed" : "reset") << "updates of" << start.size() << "rows:" << (ns / updates / 1000) << "us/update,"
+                 << "selection kept:" << keptSelection;
+        return ns;
+    }
+
+    void CTestListModelBase::benchmarkAircraftUpdates()
+    {
+        const int updates = 60; // 1 minute at 1Hz
+        const CSimulatedAircraftList aircraft = createAircraft(2000);
+
+        CSimulatedAircraftListModel resetModel;
+        resetModel.setKeyFunction({});
+        const qint64 resetNs = runUpdates(resetModel, aircraft, updates);
+
+        CSimulatedAircraftListModel keyedModel;
+        const qint64 keyedNs = runUpdates(keyedModel, aircraft, updates);
+
+        QCOMPARE(keyedModel.container(), resetModel.container());
+        QVERIFY(resetNs > 0 && keyedNs > 0);
+    }
+
+    CAircraftModelList CTestListModelBase::createModels(int number)
+    {
+        CAircraftModelList models;
+        models.reserve(number);
+        for (int i = 0; i < number; ++i)
+        {
+            const int id = (i * 7919) % number; // 7919 is a prime, so ids are unique
+            CAircraftModel model(QStringLiteral("MODEL_%1").arg(id, 6, 10, QChar('0')), CAircraftModel::TypeOwnSimulatorModel, CSimulatorInfo::xplane(),
+                                 QStringLiteral("name %1").arg(id % 1000), QStringLiteral("description %1").arg(id % 97),
+                                 CAircraftIcaoCode(id % 2 ? "B737" : "A320", "L2J"));
+            models.push_back(model);
+        }
+        return models;
+    }
+
+    bool CTestListModelBase::hasFormattedDisplayValues(const CSimulatedAircraftListModel &model)
+    {
+        const CColumns &columns = model.getColumns();
+        for (int row = 0; row < model.rowCount(); ++row)
+        {
+            const QModelIndex index = model.index(row, 0);
+            for (int column = 0; column < model.columnCount(); ++column)
+            {
+                const CDefaultFormatter *formatter = columns.getFormatter(index.siblingAtColumn(column));
+                if (!formatter->supportsRole(Qt::DisplayRole)) { continue; }
+                const QVariant expected = formatter->data(Qt::DisplayRole, model.at(index).propertyByIndex(columns.columnToPropertyIndex(column))).getQVariant();
+                if (model.data(index.siblingAtColumn(column), Qt::DisplayRole) != expected) { return false; }
+            }
+        }
+        return true;
+    }
+
+    void CTestListModelBase::displayCache()
+    {
+        CSimulatedAircraftListModel model;
+        model.update(createAircraft(10));
+        QVERIFY(hasFormattedDisplayValues(model)); // all cached now
+        QCOMPARE(model.data(model.index(0, 0), Qt::DisplayRole).toString(), QStringLiteral("TST0"));
+
+        // rows removed, inserted, changed by the keyed update
+        CSimulatedAircraftList aircraft = createAircraft(10);
+        aircraft.removeByCallsign(CCallsign("TST0"));
+        aircraft.push_back(createAircraft(99, 5.5));
+        aircraft.replaceOrAddObjectByCallsign(createAircraft(3, 4.2));
+        model.update(aircraft);
+        QCOMPARE(model.data(model.index(0, 0), Qt::DisplayRole).toString(), QStringLiteral("TST1"));
+        QVERIFY(hasFormattedDisplayValues(model));
+
+        // moved rows
+        aircraft.replaceOrAddObjectByCallsign(createAircraft(1, 50));
+        model.update(aircraft);
+        QVERIFY(hasFormattedDisplayValues(model));
+
+        // changed without signal
+        model.setInContainer(model.index(0, 0), createAircraft(77, 0.1));
+        QCOMPARE(model.data(model.index(0, 0), Qt::DisplayRole).toString(), QStringLiteral("TST77"));
+
+        // other columns
+        model.setAircraftMode(CSimulatedAircraftListModel::RenderedMode);
+        QVERIFY(hasFormattedDisplayValues(model));
+    }
+
+    void CTestListModelBase::sortByColumn()
+    {
+        // compare function
+        CAircraftModelListModel modelsModel(CAircraftModelListModel::OwnAircraftModelClient);
+        const CAircraftModelList models = createModels(1000);
+        const int column = modelsModel.getSortColumn();
+        const CPropertyIndex index = modelsModel.getColumns().columnToSortPropertyIndex(column);
+        const CAircraftModelList ascending = modelsModel.sortContainerByColumn(models, column, Qt::AscendingOrder);
+        QCOMPARE(ascending, models.sorted([&](const CAircraftModel &a, const CAircraftModel &b) { return a.comparePropertyByIndex(index, b) < 0; }));
+        const CAircraftModelList descending = modelsModel.sortContainerByColumn(models, column, Qt::DescendingOrder);
+        QCOMPARE(descending.front(), ascending.back());
+        QCOMPARE(descending.back(), ascending.front());
+
+        // variant values with tie breakers
+        CNameVariantPairModel pairsModel(false);
+        CNameVariantPairList pairs;
+        for (int i = 0; i < 100; ++i) { pairs.push_back(CNameVariantPair(QStringLiteral("name %1").arg((i * 7) % 100, 3, 10, QChar('0')), CVariant::fromValue(i))); }
+        const CNameVariantPairList sortedPairs = pairsModel.sortContainerByColumn(pairs, pairsModel.getSortColumn(), Qt::AscendingOrder);
+        QCOMPARE(sortedPairs.size(), pairs.size());
+        for (int i = 0; i < sortedPairs.size(); ++i) { QCOMPARE(sortedPairs[i].getName(), QStringLiteral("name %1").arg(i, 3, 10, QChar('0'))); }
+    }
+
+    qint64 CTestListModelBase::scrollAll(QTableView &view)
+    {
+        QElapsedTimer timer;
+        timer.start();
+        QScrollBar *scrollBar = view.verticalScrollBar();
+        for (int value = scrollBar->minimum(); value <= scrollBar->maximum(); value += scrollBar->pageStep())
+        {
+            scrollBar->setValue(value);
+            view.viewport()->repaint();
+        }
+        return timer.nsecsElapsed();
+    }
+
+    void CTestListModelBase::sortKeys()
+    {
+        // every sortable column, keyed or compared
+        CAircraftModelListModel modelsModel(CAircraftModelListModel::OwnModelSet);
+        const CAircraftModelList models = createModels(500);
+        const CColumns &modelColumns = modelsModel.getColumns();
+        for (int column = 0; column < modelColumns.size(); ++column)
+        {
+            if (!modelColumns.isSortable(column)) { continue; }
+            const CPropertyIndex index = modelColumns.columnToSortPropertyIndex(column);
+            const CAircraftModelList sorted = modelsModel.sortContainerByColumn(models, column, Qt::AscendingOrder);
+            QCOMPARE(sorted.size(), models.size());
+            QVERIFY(std::is_sorted(sorted.cbegin(), sorted.cend(), [&](const CAircraftModel &a, const CAircraftModel &b) { return a.comparePropertyByIndex(index, b) < 0; }));
+        }
+
+        CSimulatedAircraftListModel aircraftModel;
+        aircraftModel.setAircraftMode(CSimulatedAircraftListModel::RenderedMode);
+        const CSimulatedAircraftList aircraft = createAircraft(200);
+        const CColumns &aircraftColumns = aircraftModel.getColumns();
+        for (int column = 0; column < aircraftColumns.size(); ++column)
+        {
+            if (!aircraftColumns.isSortable(column)) { continue; }
+            const CPropertyIndex index = aircraftColumns.columnToSortPropertyIndex(column);
+            const CSimulatedAircraftList sorted = aircraftModel.sortContainerByColumn(aircraft, column, Qt::DescendingOrder);
+            QCOMPARE(sorted.size(), aircraft.size());
+            QVERIFY(std::is_sorted(sorted.cbegin(), sorted.cend(), [&](const CSimulatedAircraft &a, const CSimulatedAircraft &b) { return a.comparePropertyByIndex(index, b) > 0; }));
+        }
+    }
+
+    void CTestListModelBase::benchmarkModelSetSort()
+    {
+        const int number = 50000;
+        const CAircraftModelList models = createModels(number);
+        CAircraftModelListModel model(CAircraftModelListModel::OwnAircraftModelClient);
+        const int column = model.getSortColumn();
+        CAircraftModelList sorted;
+        QBENCHMARK
+        {
+            sorted = model.sortContainerByColumn(models, column, Qt::AscendingOrder);
+        }
+        QCOMPARE(sorted.size(), number);
+    }
+
+    void CTestListModelBase::benchmarkModelSetScroll()
+    {
+        const int number = 50000;
+        CAircraftModelListModel model(CAircraftModelListModel::OwnAircraftModelClient);
+        QTableView view;
+        view.setModel(&model);
+        view.resize(1200, 800);
+        model.update(createModels(number));
+        view.show();
+        QCoreApplication::processEvents();
+
+        QVERIFY(scrollAll(view) > 0); // formats the values once
+        QBENCHMARK
+        {
+            scrollAll(view);
+        }
+    }
+} // namespace
+
+//! main, the views need a QApplication, runs offscreen unless a platform is set
+int main(int argc, char *argv[])
+{
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) { qputenv("QT_QPA_PLATFORM", "offscreen"); }
+    QApplication app(argc, argv);
+    BLACKTEST_INIT(BlackGuiTest::CTestListModelBase)
+    return QTest::qExec(&to, args);
+}
+
+#include "testlistmodelbase.moc"
+
+//! \endcond
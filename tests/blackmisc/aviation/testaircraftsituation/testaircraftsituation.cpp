@@ -8,6 +8,7 @@
 #include "blackconfig/buildconfig.h"
 #include "blackmisc/aviation/aircraftsituationchange.h"
 #include "blackmisc/aviation/aircraftsituationlist.h"
+#include "blackmisc/aviation/compactaircraftsituation.h"
 #include "blackmisc/network/fsdsetup.h"
 #include "blackmisc/cputime.h"
 // #include "blackmisc/math/mathutils.h"
@@ -59,6 +60,9 @@ namespace BlackMiscTest
         //! Using sort hint
         void sortHint();
 
+        //! Conversion to and from the compact representation
+        void compactRoundTrip();
+
     private:
         //! Test situations (ascending)
         static BlackMisc::Aviation::CAircraftSituationList testSituations();
@@ -222,6 +226,41 @@ namespace BlackMiscTest
         QVERIFY2(corAlt == (ep.getAltitude() + cg), "Expect correction by CG");
     }
 
+    void CTestAircraftSituation::compactRoundTrip()
+    {
+        const CCallsign cs("DAMBZ");
+        CAircraftSituation situation = testSituations().front();
+        situation.setCallsign(cs);
+        situation.setPressureAltitude(CAltitude(5000, CAltitude::MeanSeaLevel, CAltitude::PressureAltitude, CLengthUnit::ft()));
+        situation.setHeading(CHeading(123, CHeading::Magnetic, CAngleUnit::deg()));
+        situation.setPitch(CAngle(-2.5, CAngleUnit::deg()));
+        situation.setBank(CAngle(12, CAngleUnit::deg()));
+        situation.setGroundSpeed(CSpeed(250, CSpeedUnit::kts()));
+        situation.setCG(cg());
+        situation.setSceneryOffset(CLength(1.5, CLengthUnit::m()));
+        situation.setVelocity(CAircraftVelocity(1, 2, 3, CSpeedUnit::m_s(), 0.1, 0.2, 0.3, CAngleUnit::rad(), CTimeUnit::s()));
+        situation.setGroundElevation(CElevationPlane(situation, CElevationPlane::singlePointRadius()), CAircraftSituation::Test, true);
+        situation.setOnGround(CAircraftSituation::OnGround, CAircraftSituation::InFromNetwork);
+        situation.setInterimFlag(true);
+        situation.setTimeOffsetMs(4321);
+
+        const CompactAircraftSituation compact = CompactAircraftSituation::fromSituation(situation);
+        QVERIFY2(compact.hasFlag(CompactAircraftSituation::HasVelocity) && compact.hasFlag(CompactAircraftSituation::Interim), "Expect flags");
+        QVERIFY2(compact.hasGroundElevation() && compact.isOnGround(), "Expect elevation and on ground");
+        QCOMPARE(compact.getAdjustedMSecsSinceEpoch(), situation.getAdjustedMSecsSinceEpoch());
+        QVERIFY2(qAbs(compact.headingRad - situation.getHeading().value(CAngleUnit::rad())) < 1e-12, "Expect heading in rad");
+        QVERIFY2(qAbs(compact.altitudeM - situation.getAltitude().value(CLengthUnit::m())) < 1e-9, "Expect altitude in m");
+
+        const CAircraftSituation roundTrip = compact.toSituation(cs);
+        QVERIFY2(roundTrip == situation, "Expect equal situation after round trip");
+
+        // null values stay null
+        const CAircraftSituation nullSituation(cs);
+        const CompactAircraftSituation nullCompact = CompactAircraftSituation::fromSituation(nullSituation);
+        QVERIFY2(nullCompact.isPositionNull() && CompactAircraftSituation::isNull(nullCompact.pitchRad), "Expect null values");
+        QVERIFY2(nullCompact.toSituation(cs) == nullSituation, "Expect equal null situation");
+    }
+
     void CTestAircraftSituation::sortHint()
     {
         constexpr int Lists = 50000;
@@ -6,13 +6,19 @@
 //! \ingroup testblackmisc
 
 #include "blackmisc/geo/coordinategeodetic.h"
+#include "blackmisc/geo/coordinategeodeticlist.h"
 #include "blackmisc/geo/earthangle.h"
+#include "blackmisc/geo/elevationtilecache.h"
+#include "blackmisc/geo/geoobjectlist.h"
 #include "blackmisc/geo/latitude.h"
 #include "blackmisc/pq/physicalquantity.h"
 #include "blackmisc/pq/units.h"
 #include "test.h"
 
+#include <QRandomGenerator>
 #include <QTest>
+#include <QtMath>
+#include <utility>
 
 using namespace BlackMisc::Geo;
 using namespace BlackMisc::PhysicalQuantities;
@@ -31,6 +37,12 @@ namespace BlackMiscTest
 
         //! CCoordinateGeodetic unit tests
         void coordinateGeodetic();
+
+        //! Range queries with spatial index
+        void spatialIndex();
+
+        //! Tile based elevation cache
+        void elevationTileCache();
     };
 
     void CTestGeo::geoBasics()
@@ -74,6 +86,144 @@ namespace BlackMiscTest
         latValue = testCoordinate.latitude().value(CAngleUnit::deg());
         QCOMPARE(latValue, newLat.value(CAngleUnit::deg()));
     }
+
+    void CTestGeo::spatialIndex()
+    {
+        // world wide plus a dense cluster, some NULL positions (NULL height is a NULL position as well)
+        QRandomGenerator random(4711);
+        CCoordinateGeodeticList list;
+        for (int i = 0; i < 2000; ++i)
+        {
+            list.push_back(CCoordinateGeodetic(std::asin(random.bounded(2.0) - 1.0) * 180.0 / M_PI, random.bounded(360.0) - 180.0, 0));
+            list.push_back(CCoordinateGeodetic(48.0 + random.bounded(1.0), 11.0 + random.bounded(1.0), 0));
+            if (i % 100 == 0) { list.push_back(CCoordinateGeodetic()); }
+        }
+        const CGeoKdTree index = list.createSpatialIndex();
+        QCOMPARE(index.listSize(), list.size());
+        QCOMPARE(index.size(), list.size() - 20);
+
+        const QList<CLength> ranges = { CLength(0, CLengthUnit::m()), CLength(1, CLengthUnit::km()), CLength(25, CLengthUnit::NM()), CLength(500, CLengthUnit::km()),
+                                        CLength(5000, CLengthUnit::km()), CLength(30000, CLengthUnit::km()), CLength::null() };
+        QList<CCoordinateGeodetic> queries = { CCoordinateGeodetic(48.5, 11.5, 0), CCoordinateGeodetic(90.0, 0.0, 0), CCoordinateGeodetic(0.0, 180.0, 0), CCoordinateGeodetic(), list[1] };
+        for (int i = 0; i < 20; ++i) { queries.push_back(CCoordinateGeodetic(random.bounded(180.0) - 90.0, random.bounded(360.0) - 180.0, 0)); }
+
+        for (const CCoordinateGeodetic &query : std::as_const(queries))
+        {
+            for (const CLength &range : ranges)
+            {
+                QCOMPARE(list.findWithinRange(query, range, index), list.findWithinRange(query, range));
+                QCOMPARE(list.findFirstWithinRangeOrDefault(query, range, index), list.findFirstWithinRangeOrDefault(query, range));
+                QCOMPARE(list.findClosestWithinRange(query, range, index), list.findClosestWithinRange(query, range));
+            }
+        }
+
+        // closest objects, none of the skipped objects is closer than the farthest one returned
+        const auto distance2 = [](const ICoordinateGeodetic &a, const ICoordinateGeodetic &b) {
+            const std::array<double, 3> va = a.normalVectorDouble();
+            const std::array<double, 3> vb = b.normalVectorDouble();
+            return (va[0] - vb[0]) * (va[0] - vb[0]) + (va[1] - vb[1]) * (va[1] - vb[1]) + (va[2] - vb[2]) * (va[2] - vb[2]);
+        };
+        for (const CCoordinateGeodetic &query : std::as_const(queries))
+        {
+            if (query.isNull()) { continue; }
+            for (int number : { 0, 1, 20, 5000 })
+            {
+                const CCoordinateGeodeticList closest = list.findClosest(number, query, index);
+                QCOMPARE(closest.size(), qMin(number, index.size()));
+                if (closest.isEmpty()) { continue; }
+                QVERIFY2(!closest.containsNullPosition(), "Expect no NULL positions");
+                for (int i = 1; i < closest.size(); ++i) { QVERIFY2(distance2(closest[i - 1], query) <= distance2(closest[i], query), "Expect closest first"); }
+                const double farthest = distance2(closest.back(), query);
+                int closer = 0;
+                for (const CCoordinateGeodetic &c : list)
+                {
+                    if (!c.isNull() && distance2(c, query) < farthest) { closer++; }
+                }
+                QVERIFY2(closer < closest.size(), "Expect no closer object skipped");
+            }
+        }
+
+        // lazily built index, dropped when modified
+        const CLength range(100, CLengthUnit::km());
+        CGeoIndexedList<CCoordinateGeodeticList> indexed(list);
+        QVERIFY(!indexed.hasIndex());
+        QCOMPARE(indexed.findWithinRange(queries[0], range), list.findWithinRange(queries[0], range));
+        QVERIFY(indexed.hasIndex());
+        indexed.modify([&](CCoordinateGeodeticList &l) { l.push_back(queries[0]); });
+        QVERIFY(!indexed.hasIndex());
+        QCOMPARE(indexed.findClosestWithinRange(queries[0], range), queries[0]);
+        QCOMPARE(indexed.findClosest(1, queries[0]).frontOrDefault(), queries[0]);
+        indexed.clear();
+        QVERIFY(indexed.findWithinRange(queries[0], range).isEmpty());
+    }
+
+    void CTestGeo::elevationTileCache()
+    {
+        // about 220m north/south and east/west of the reference
+        CElevationTileCache cache(100, 400);
+        const CCoordinateGeodetic reference(48.0, 11.0, 0);
+        QVERIFY(cache.insert(CCoordinateGeodetic(48.002, 10.997, 100), true)); // NW
+        QVERIFY(cache.insert(CCoordinateGeodetic(48.002, 11.003, 200), true)); // NE
+        QVERIFY(cache.insert(CCoordinateGeodetic(47.998, 10.997, 300), false)); // SW
+        QVERIFY(cache.insert(CCoordinateGeodetic(47.998, 11.003, 400), false)); // SE
+        QVERIFY(!cache.insert(CCoordinateGeodetic(), false));
+        QCOMPARE(cache.size(), 4);
+        QCOMPARE(cache.size(CElevationTileCache::OnGroundElevations), 2);
+
+        // bilinear between the 4 quadrants
+        const CElevationPlane interpolated = cache.findElevationPlane(reference, CLength(1, CLengthUnit::km()));
+        QVERIFY(!interpolated.isNull());
+        QVERIFY(qAbs(interpolated.getAltitude().value(CLengthUnit::ft()) - 250.0) < 0.5);
+        QCOMPARE(cache.getStatistics().interpolated, 1);
+
+        // closest only if a quadrant is missing, single point directly
+        const CElevationPlane closest = cache.findElevationPlane(CCoordinateGeodetic(48.0025, 11.0035, 0), CLength(1, CLengthUnit::km()));
+        QVERIFY(qAbs(closest.getAltitude().value(CLengthUnit::ft()) - 200.0) < 0.5);
+        const CElevationPlane single = cache.findElevationPlane(CCoordinateGeodetic(48.0021, 10.997, 0), CElevationPlane::singlePointRadius());
+        QVERIFY(qAbs(single.getAltitude().value(CLengthUnit::ft()) - 100.0) < 0.5);
+        QVERIFY(cache.findElevationPlane(reference, CElevationPlane::singlePointRadius()).isNull());
+        QCOMPARE(cache.getStatistics().hits, 2);
+        QCOMPARE(cache.getStatistics().misses, 1);
+
+        // selection
+        QVERIFY(cache.findClosestWithinRange(reference, CLength(1, CLengthUnit::km()), CElevationTileCache::OnGroundElevations).latitude().value(CAngleUnit::deg()) > 48.0);
+        QVERIFY(cache.findClosestWithinRange(reference, CLength(1, CLengthUnit::km()), CElevationTileCache::OtherElevations).latitude().value(CAngleUnit::deg()) < 48.0);
+        QCOMPARE(cache.removeOutsideRange(CCoordinateGeodetic(48.002, 11.0, 0), CLength(300, CLengthUnit::m()), CElevationTileCache::OnGroundElevations), 0);
+        QCOMPARE(cache.removeOutsideRange(CCoordinateGeodetic(48.002, 11.0, 0), CLength(300, CLengthUnit::m())), 2);
+        QCOMPARE(cache.getElevations().size(), 2);
+
+        // least recently used is evicted, lookups count as use
+        CElevationTileCache lru(2, 2);
+        const CCoordinateGeodetic a(10.0, 10.0, 10);
+        const CCoordinateGeodetic b(20.0, 20.0, 20);
+        const CCoordinateGeodetic c(30.0, 30.0, 30);
+        lru.insert(a, false);
+        lru.insert(b, false);
+        QVERIFY(!lru.findClosestWithinRange(a, CElevationPlane::singlePointRadius()).isNull());
+        lru.insert(c, false);
+        QCOMPARE(lru.size(), 2);
+        QCOMPARE(lru.getStatistics().evictions, 1);
+        QVERIFY(lru.findClosestWithinRange(b, CElevationPlane::singlePointRadius()).isNull());
+        QVERIFY(!lru.findClosestWithinRange(a, CElevationPlane::singlePointRadius()).isNull());
+        QCOMPARE(lru.getElevations().front(), a);
+
+        // lookups on the const cache, a used again after it was queued is kept
+        const CElevationTileCache &constLru = lru;
+        const CCoordinateGeodetic d(40.0, 40.0, 40);
+        QVERIFY(!constLru.findClosestWithinRange(a, CElevationPlane::singlePointRadius()).isNull());
+        lru.insert(d, false);
+        QCOMPARE(lru.getStatistics().evictions, 2);
+        QVERIFY(constLru.findClosestWithinRange(c, CElevationPlane::singlePointRadius()).isNull());
+        QVERIFY(!constLru.findClosestWithinRange(a, CElevationPlane::singlePointRadius()).isNull());
+
+        // cells at the antimeridian are neighbours
+        CElevationTileCache world(100, 100);
+        world.insert(CCoordinateGeodetic(0.0, 179.9999, 1), false);
+        for (int i = 1; i <= 4; ++i) { world.insert(CCoordinateGeodetic(10.0 * i, 10.0 * i, 1), false); }
+        QVERIFY(!world.findClosestWithinRange(CCoordinateGeodetic(0.0, -179.9999, 0), CLength(100, CLengthUnit::m())).isNull());
+        QCOMPARE(world.keepClosest(CCoordinateGeodetic(0.0, 179.0, 0), 2), 3);
+        QCOMPARE(world.size(), 2);
+    }
 } // ns
 
 //! main
@@ -0,0 +1,142 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testblackmisc
+
+#include "blackmisc/aviation/aircrafticaocode.h"
+#include "blackmisc/simulation/airspaceaircraftsnapshot.h"
+#include "blackmisc/simulation/airspaceaircraftsnapshotbuilder.h"
+#include "blackmisc/simulation/simulatedaircraftlist.h"
+#include "test.h"
+
+#include <QObject>
+#include <QTest>
+
+using namespace BlackMisc::Aviation;
+using namespace BlackMisc::PhysicalQuantities;
+using namespace BlackMisc::Simulation;
+
+namespace BlackMiscTest
+{
+    //! Airspace aircraft snapshot tests
+    class CTestAirspaceAircraftSnapshot : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Unrestricted snapshot, aircraft by attributes
+        void unrestricted();
+
+        //! Restricted snapshot, closest enabled aircraft
+        void restricted();
+
+        //! Diff between consecutive snapshots
+        void diff();
+
+    private:
+        //! Test aircraft, every 3rd disabled, every 4th a helicopter
+        static CSimulatedAircraftList createAircraft(int number);
+    };
+
+    CSimulatedAircraftList CTestAirspaceAircraftSnapshot::createAircraft(int number)
+    {
+        const CAircraftModel airplane("B737", CAircraftModel::TypeUnknown, "", CAircraftIcaoCode("B737", "L2J"));
+        const CAircraftModel helicopter("EC35", CAircraftModel::TypeUnknown, "", CAircraftIcaoCode("EC35", "H2T"));
+        CSimulatedAircraftList aircraft;
+        for (int i = 0; i < number; ++i)
+        {
+            CSimulatedAircraft a(i % 4 == 0 ? helicopter : airplane);
+            a.setCallsign(CCallsign(QStringLiteral("TST%1").arg(i)));
+            a.setRelativeDistance(CLength((number - i) * 1000, CLengthUnit::m())); // last one is closest
+            a.setEnabled(i % 3 != 0);
+            a.setRendered(i % 2 == 0);
+            aircraft.push_back(a);
+        }
+        return aircraft;
+    }
+
+    void CTestAirspaceAircraftSnapshot::unrestricted()
+    {
+        const CSimulatedAircraftList aircraft = createAircraft(50);
+        const CAirspaceAircraftSnapshot snapshot(aircraft);
+        QVERIFY(snapshot.isValidSnapshot());
+        QVERIFY(!snapshot.hasDiff());
+        QCOMPARE(snapshot.getAircraftCallsignsByDistance(), aircraft.getCallsigns());
+        QCOMPARE(snapshot.getEnabledAircraftCallsignsByDistance(), aircraft.findByEnabled(true).getCallsigns());
+        QCOMPARE(snapshot.getDisabledAircraftCallsignsByDistance(), aircraft.findByEnabled(false).getCallsigns());
+        QCOMPARE(snapshot.getVtolAircraftCallsignsByDistance(), aircraft.findBy(&CSimulatedAircraft::isVtol, true).getCallsigns());
+        QCOMPARE(snapshot.getEnabledVtolAircraftCallsignsByDistance(), aircraft.findByEnabled(true).findBy(&CSimulatedAircraft::isVtol, true).getCallsigns());
+    }
+
+    void CTestAirspaceAircraftSnapshot::restricted()
+    {
+        CSimulatedAircraftList aircraft = createAircraft(50);
+        const CLength maxDistance(40500, CLengthUnit::m());
+        const int maxAircraft = 10;
+        const CAirspaceAircraftSnapshot snapshot(aircraft, true, true, maxAircraft, maxDistance);
+
+        // closest enabled aircraft within the distance
+        aircraft.sortByDistanceToReferencePositionRenderedCallsign();
+        CCallsignSet expected;
+        for (const CSimulatedAircraft &a : aircraft)
+        {
+            if (expected.size() >= maxAircraft) { break; }
+            if (a.isEnabled() && a.getRelativeDistance() < maxDistance) { expected.push_back(a.getCallsign()); }
+        }
+        QCOMPARE(expected.size(), maxAircraft);
+        QCOMPARE(snapshot.getEnabledAircraftCallsignsByDistance(), expected);
+        QCOMPARE(snapshot.getDisabledAircraftCallsignsByDistance(), aircraft.getCallsigns().difference(expected));
+
+        // no rendering at all
+        const CAirspaceAircraftSnapshot noRendering(aircraft, true, false, maxAircraft, maxDistance);
+        QVERIFY(noRendering.getEnabledAircraftCallsignsByDistance().isEmpty());
+        QCOMPARE(noRendering.getDisabledAircraftCallsignsByDistance().size(), aircraft.size());
+    }
+
+    void CTestAirspaceAircraftSnapshot::diff()
+    {
+        CSimulatedAircraftList aircraft = createAircraft(20);
+        CAirspaceAircraftSnapshotBuilder builder;
+        const CAirspaceAircraftSnapshot first = builder.buildSnapshot(aircraft, true, true, 5);
+        QVERIFY(!first.hasDiff());
+        QCOMPARE(first.getEnabledAircraftCallsignsByDistance().size(), 5);
+
+        const CAirspaceAircraftSnapshot unchanged = builder.buildSnapshot(aircraft, true, true, 5);
+        QVERIFY(unchanged.hasDiff());
+        QVERIFY(!unchanged.hasChanges());
+
+        // closest aircraft leaves, another one joins, the next closest one gets enabled
+        const CCallsign closest = aircraft.back().getCallsign();
+        aircraft.removeByCallsign(closest);
+        CSimulatedAircraft joining = createAircraft(1).front();
+        joining.setCallsign("JOIN1");
+        joining.setRelativeDistance(CLength(1, CLengthUnit::km()));
+        joining.setEnabled(true);
+        aircraft.push_back(joining);
+
+        const CAirspaceAircraftSnapshot next = builder.buildSnapshot(aircraft, true, true, 5);
+        QVERIFY(next.hasDiff());
+        QVERIFY(next.hasChanges());
+        QCOMPARE(next.getAddedCallsigns(), CCallsignSet({ joining.getCallsign() }));
+        QCOMPARE(next.getRemovedCallsigns(), CCallsignSet({ closest }));
+        QVERIFY(next.getEnabledAircraftCallsignsByDistance().contains(joining.getCallsign()));
+        QVERIFY(next.getChangedCallsigns().isEmpty());
+        QCOMPARE(builder.getRecordCount(), aircraft.size());
+
+        // restriction lifted, all enabled aircraft change
+        const CAirspaceAircraftSnapshot unrestricted = builder.buildSnapshot(aircraft);
+        QCOMPARE(unrestricted.getChangedCallsigns(), aircraft.findByEnabled(true).getCallsigns().difference(next.getEnabledAircraftCallsignsByDistance()));
+
+        builder.clear();
+        QVERIFY(!builder.buildSnapshot(aircraft).hasDiff());
+    }
+} // namespace
+
+//! main
+BLACKTEST_APPLESS_MAIN(BlackMiscTest::CTestAirspaceAircraftSnapshot);
+
+#include "testairspaceaircraftsnapshot.moc"
+
+//! \endcond
@@ -55,6 +55,9 @@ namespace BlackMiscTest
         //! Interpolator PBH
         void pbhInterpolatorTest();
 
+        //! Interpolation on the compact copies yields the values of the value object arithmetic
+        void compactInterpolation();
+
     private:
         //! Test situation for testing
         static BlackMisc::Aviation::CAircraftSituation getTestSituation(const BlackMisc::Aviation::CCallsign &callsign, int number, qint64 ts, qint64 deltaT, qint64 offset);
@@ -345,6 +348,40 @@ namespace BlackMiscTest
         }
     }
 
+    void CTestInterpolatorLinear::compactInterpolation()
+    {
+        const CCallsign cs("SWIFT");
+        const qint64 ts = 1425000000000;
+        CAircraftSituation oldSituation = getTestSituation(cs, 1, ts, 5000, 0);
+        CAircraftSituation newSituation = getTestSituation(cs, 0, ts, 5000, 0);
+        oldSituation.setOnGround(true);
+        newSituation.setOnGround(false);
+
+        for (double tf : { 0.0, 0.25, 0.5, 0.9, 1.0 })
+        {
+            const qint64 interpolatedTime = oldSituation.getMSecsSinceEpoch() + qRound64(5000 * tf);
+            const CInterpolatorLinear::CInterpolant interpolant(oldSituation, newSituation, tf, interpolatedTime);
+            const double oldAltM = oldSituation.getCorrectedAltitude().value(CLengthUnit::m());
+            const double newAltM = newSituation.getCorrectedAltitude().value(CLengthUnit::m());
+            const std::array<double, 3> oldVec = oldSituation.getPosition().normalVectorDouble();
+            const std::array<double, 3> newVec = newSituation.getPosition().normalVectorDouble();
+            for (bool gnd : { false, true })
+            {
+                const CAircraftSituation situation = interpolant.interpolatePositionAndAltitude(oldSituation, gnd);
+                const std::array<double, 3> v = situation.getPosition().normalVectorDouble();
+                for (int i = 0; i < 3; i++) { QVERIFY2(qAbs(v[i] - ((newVec[i] - oldVec[i]) * tf + oldVec[i])) < 1e-6, "Expect interpolated position"); }
+                QVERIFY2(qAbs(situation.getAltitude().value(CLengthUnit::m()) - ((newAltM - oldAltM) * tf + oldAltM)) < 1e-6, "Expect interpolated altitude");
+                QCOMPARE(situation.getMSecsSinceEpoch(), interpolatedTime);
+                if (gnd) { QVERIFY2(qAbs(situation.getOnGroundFactor() - (1.0 - tf)) < 1e-6, "Expect interpolated ground factor"); }
+            }
+
+            // the next interpolant of the same situations takes over the compact copies
+            CInterpolatorLinear::CInterpolant next(oldSituation, newSituation, tf, interpolatedTime);
+            next.reuseCompacts(interpolant);
+            QVERIFY2(next.interpolatePositionAndAltitude(oldSituation, true).getPosition() == interpolant.interpolatePositionAndAltitude(oldSituation, true).getPosition(), "Expect same position");
+        }
+    }
+
     CAircraftSituation CTestInterpolatorLinear::getTestSituation(const CCallsign &callsign, int number, qint64 ts, qint64 deltaT, qint64 offset)
     {
         const CAltitude alt(number, CAltitude::MeanSeaLevel, CLengthUnit::m());
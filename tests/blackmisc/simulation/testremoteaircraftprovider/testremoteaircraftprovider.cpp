@@ -0,0 +1,105 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testblackmisc
+
+#include "blackmisc/aviation/aircraftsituation.h"
+#include "blackmisc/aviation/aircraftvelocity.h"
+#include "blackmisc/aviation/transponder.h"
+#include "blackmisc/geo/coordinategeodetic.h"
+#include "blackmisc/simulation/remoteaircraftproviderdummy.h"
+#include "blackmisc/simulation/simulatedaircraft.h"
+#include "blackmisc/registermetadata.h"
+#include "test.h"
+
+#include <QObject>
+#include <QSignalSpy>
+#include <QTest>
+
+using namespace BlackMisc;
+using namespace BlackMisc::Aviation;
+using namespace BlackMisc::Geo;
+using namespace BlackMisc::PhysicalQuantities;
+using namespace BlackMisc::Simulation;
+
+namespace BlackMiscTest
+{
+    //! Remote aircraft provider tests
+    class CTestRemoteAircraftProvider : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Init test case environment
+        void initTestCase();
+
+        //! Typed kinematics update
+        void kinematicsUpdate();
+    };
+
+    void CTestRemoteAircraftProvider::initTestCase()
+    {
+        BlackMisc::registerMetadata();
+    }
+
+    void CTestRemoteAircraftProvider::kinematicsUpdate()
+    {
+        const CCallsign callsign("TST1");
+        CAircraftSituation situation(callsign, CCoordinateGeodetic(48.0, 11.0, 1000.0));
+        const CTransponder transponder(7000, CTransponder::ModeC);
+        const CLength distance(1000, CLengthUnit::m());
+        const CAngle bearing(90, CAngleUnit::deg());
+
+        CRemoteAircraftProviderDummy provider;
+        CSimulatedAircraft aircraft;
+        aircraft.setCallsign(callsign);
+        aircraft.setSituation(situation);
+        aircraft.setTransponder(transponder);
+        aircraft.setRelativeDistance(distance);
+        aircraft.setRelativeBearing(bearing);
+        QVERIFY(provider.addNewAircraftInRange(aircraft));
+
+        QSignalSpy changedSpy(&provider, &CRemoteAircraftProvider::changedAircraftInRange);
+
+        // unknown aircraft
+        QVERIFY(!provider.updateAircraftKinematics(CCallsign("TST2"), situation, transponder, distance, bearing));
+        QCOMPARE(changedSpy.count(), 0);
+
+        // equal values, nothing changed
+        QVERIFY(!provider.updateAircraftKinematics(callsign, situation, transponder, distance, bearing));
+        QCOMPARE(changedSpy.count(), 0);
+
+        // moved aircraft
+        situation.setPosition(CCoordinateGeodetic(48.1, 11.0, 1000.0));
+        QVERIFY(provider.updateAircraftKinematics(callsign, situation, transponder, distance, bearing));
+        QCOMPARE(changedSpy.count(), 1);
+        QCOMPARE(provider.getAircraftInRangeForCallsign(callsign).getSituation(), situation);
+
+        // changed transponder
+        const CTransponder squawk(7700, CTransponder::ModeC);
+        QVERIFY(provider.updateAircraftKinematics(callsign, situation, squawk, distance, bearing));
+        QCOMPARE(changedSpy.count(), 2);
+        QCOMPARE(provider.getAircraftInRangeForCallsign(callsign).getTransponder(), squawk);
+
+        // stored velocity is kept for a situation without velocity, this is no change
+        CAircraftSituation withVelocity(situation);
+        withVelocity.setVelocity(CAircraftVelocity(1.0, 2.0, 3.0, CSpeedUnit::m_s(), 0.0, 0.0, 0.0, CAngleUnit::rad(), CTimeUnit::s()));
+        QVERIFY(provider.updateAircraftKinematics(callsign, withVelocity, squawk, distance, bearing));
+        QCOMPARE(changedSpy.count(), 3);
+        QVERIFY(!provider.updateAircraftKinematics(callsign, situation, squawk, distance, bearing));
+        QCOMPARE(changedSpy.count(), 3);
+
+        // same update again
+        QVERIFY(!provider.updateAircraftKinematics(callsign, withVelocity, squawk, distance, bearing));
+        QCOMPARE(changedSpy.count(), 3);
+    }
+} // namespace
+
+//! main
+BLACKTEST_MAIN(BlackMiscTest::CTestRemoteAircraftProvider);
+
+#include "testremoteaircraftprovider.moc"
+
+//! \endcond
@@ -0,0 +1,182 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testblackmisc
+
+#include "blackmisc/aviation/aircrafticaocode.h"
+#include "blackmisc/aviation/selcal.h"
+#include "blackmisc/geo/coordinategeodetic.h"
+#include "blackmisc/sharedstate/datalinklocal.h"
+#include "blackmisc/sharedstate/passivemutator.h"
+#include "blackmisc/simulation/aircraftinrangejournal.h"
+#include "blackmisc/simulation/simulatedaircraftlistdelta.h"
+#include "blackmisc/registermetadata.h"
+#include "test.h"
+
+#include <QObject>
+#include <QTest>
+
+using namespace BlackMisc;
+using namespace BlackMisc::Aviation;
+using namespace BlackMisc::Geo;
+using namespace BlackMisc::PhysicalQuantities;
+using namespace BlackMisc::SharedState;
+using namespace BlackMisc::Simulation;
+
+namespace BlackMiscTest
+{
+    //! Posts events on the aircraft in range channel, to simulate a lost delta
+    class CTestDeltaInjector : public QObject
+    {
+        Q_OBJECT
+        BLACK_SHARED_STATE_CHANNEL("swift.aircraft.inrange")
+
+    public:
+        //! Ctor
+        CTestDeltaInjector(IDataLink *dataLink) { dataLink->publish(m_mutator.data()); }
+
+        //! Post a delta with the given sequence number
+        void postDelta(qint64 sequence) { m_mutator->postEvent(CVariant::from(CDeltaEvent(sequence, false, CVariant::from(CSimulatedAircraftListDelta())))); }
+
+    private:
+        QSharedPointer<CPassiveMutator> m_mutator = CPassiveMutator::create(this);
+    };
+
+    //! Aircraft list delta tests
+    class CTestSimulatedAircraftListDelta : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Init test case environment
+        void initTestCase();
+
+        //! Diff and apply
+        void diffAndApply();
+
+        //! Journal and replica over local datalink
+        void journalAndReplica();
+
+    private:
+        //! Test aircraft
+        static CSimulatedAircraftList createAircraft(int number);
+
+        //! Move the aircraft
+        static void move(CSimulatedAircraftList &aircraft, int step);
+    };
+
+    void CTestSimulatedAircraftListDelta::initTestCase()
+    {
+        BlackMisc::registerMetadata();
+    }
+
+    CSimulatedAircraftList CTestSimulatedAircraftListDelta::createAircraft(int number)
+    {
+        CSimulatedAircraftList aircraft;
+        for (int i = 0; i < number; ++i)
+        {
+            CSimulatedAircraft a(CAircraftModel(QStringLiteral("MODEL%1").arg(i % 5), CAircraftModel::TypeUnknown, "", CAircraftIcaoCode("B737", "L2J")));
+            a.setCallsign(CCallsign(QStringLiteral("TST%1").arg(i)));
+            a.setPosition(CCoordinateGeodetic(48.0 + i * 0.01, 11.0, 1000.0));
+            a.setRelativeDistance(CLength(i * 1000, CLengthUnit::m()));
+            aircraft.push_back(a);
+        }
+        return aircraft;
+    }
+
+    void CTestSimulatedAircraftListDelta::move(CSimulatedAircraftList &aircraft, int step)
+    {
+        for (CSimulatedAircraft &a : aircraft)
+        {
+            a.setPosition(CCoordinateGeodetic(a.latitude().value(CAngleUnit::deg()), 11.0 + step * 0.001, 1000.0));
+        }
+    }
+
+    void CTestSimulatedAircraftListDelta::diffAndApply()
+    {
+        const CSimulatedAircraftList previous = createAircraft(20);
+        QVERIFY(CSimulatedAircraftListDelta::fromDiff(previous, previous).isEmpty());
+
+        // all new
+        CSimulatedAircraftList replica;
+        const CSimulatedAircraftListDelta initial = CSimulatedAircraftListDelta::fromDiff(replica, previous);
+        QCOMPARE(initial.getAircraft().size(), previous.size());
+        initial.applyTo(replica);
+        QCOMPARE(replica, previous);
+
+        CSimulatedAircraftList current(previous);
+        move(current, 1);
+        current[1].setTransponderCode(7000);
+        current[2].setRendered(true);
+        current[3].setSelcal(CSelcal("ABCD"));
+        current[4].setModelString("CHANGED");
+        current.removeByCallsign(current[5].getCallsign());
+        CSimulatedAircraft joining = createAircraft(1).front();
+        joining.setCallsign("JOIN1");
+        current.push_back(joining);
+
+        const CSimulatedAircraftListDelta delta = CSimulatedAircraftListDelta::fromDiff(previous, current);
+        QCOMPARE(delta.getRemovedCallsigns(), CCallsignSet({ previous[5].getCallsign() }));
+        QCOMPARE(delta.getAircraft().getCallsigns(), CCallsignSet({ current[3].getCallsign(), current[4].getCallsign(), joining.getCallsign() }));
+        QCOMPARE(delta.getChangedCount(), current.size() - 3);
+
+        delta.applyTo(replica);
+        QCOMPARE(replica, current);
+    }
+
+    void CTestSimulatedAircraftListDelta::journalAndReplica()
+    {
+        CDataLinkLocal dataLink;
+        CAircraftInRangeJournal journal(this);
+        CAircraftInRangeReplica replica(this);
+        CTestDeltaInjector injector(&dataLink);
+
+        CSimulatedAircraftList aircraft = createAircraft(10);
+        journal.initialize(&dataLink);
+
+        // no observers yet, only kept for the snapshot
+        QVERIFY(!journal.hasObservers());
+        QVERIFY(!journal.update(aircraft));
+        QCOMPARE(journal.getAircraft(), aircraft);
+        QCOMPARE(journal.getSequence(), 0);
+
+        // snapshot on initialization
+        replica.initialize(&dataLink);
+        bool ok = QTest::qWaitFor([&] { return replica.isSynchronized(); });
+        QVERIFY2(ok, "snapshot received");
+        QVERIFY(journal.hasObservers());
+        QCOMPARE(replica.getAircraftInRange(), aircraft);
+        QCOMPARE(replica.getSequence(), journal.getSequence());
+        QVERIFY(!journal.update(aircraft));
+
+        // deltas
+        for (int step = 1; step <= 5; ++step)
+        {
+            move(aircraft, step);
+            QVERIFY(journal.update(aircraft));
+        }
+        ok = QTest::qWaitFor([&] { return replica.getSequence() == journal.getSequence(); });
+        QVERIFY2(ok, "deltas received");
+        QCOMPARE(replica.getAircraftInRange(), aircraft);
+        QCOMPARE(replica.getResyncCount(), 0);
+
+        // gap in the sequence numbers, replica requests a new snapshot
+        injector.postDelta(journal.getSequence() + 2);
+        ok = QTest::qWaitFor([&] { return replica.getResyncCount() == 1 && replica.isSynchronized(); });
+        QVERIFY2(ok, "resynchronized");
+        aircraft.removeByCallsign(aircraft.front().getCallsign());
+        QVERIFY(journal.update(aircraft));
+        ok = QTest::qWaitFor([&] { return replica.getSequence() == journal.getSequence(); });
+        QVERIFY2(ok, "deltas received after resync");
+        QCOMPARE(replica.getAircraftInRange(), aircraft);
+    }
+} // namespace
+
+//! main
+BLACKTEST_MAIN(BlackMiscTest::CTestSimulatedAircraftListDelta);
+
+#include "testsimulatedaircraftlistdelta.moc"
+
+//! \endcond
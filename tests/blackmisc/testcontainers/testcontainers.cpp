@@ -13,10 +13,13 @@
 #include "blackmisc/aviation/aircraftsituationlist.h"
 #include "blackmisc/aviation/callsign.h"
 #include "blackmisc/aviation/callsignset.h"
+#include "blackmisc/aviation/livery.h"
 #include "blackmisc/collection.h"
 #include "blackmisc/dictionary.h"
 #include "blackmisc/iterator.h"
+#include "blackmisc/memotable.h"
 #include "blackmisc/range.h"
+#include "blackmisc/ringsequence.h"
 #include "blackmisc/registermetadata.h"
 #include "blackmisc/sequence.h"
 #include "blackmisc/math/mathutils.h"
@@ -57,11 +60,13 @@ namespace BlackMiscTest
 
         void collectionBasics();
         void sequenceBasics();
+        void ringSequence();
         void joinAndSplit();
         void findTests();
         void sortTests();
         void removeTests();
         void dictionaryBasics();
+        void memoTable();
         void timestampList();
         void offsetTimestampList();
     };
@@ -113,6 +118,49 @@ namespace BlackMiscTest
         QVERIFY2(s1.back() == 1, "Last element has expected value");
     }
 
+    void CTestContainers::ringSequence()
+    {
+        CRingSequence<int> r1(3);
+        QVERIFY2(r1.isEmpty(), "Ring is empty");
+        QVERIFY2(r1.capacity() == 3, "Ring has expected capacity");
+        r1.push_front(1);
+        r1.push_front(2);
+        r1.push_front(3);
+        QVERIFY2(r1.isFull(), "Ring is full");
+        QVERIFY2(r1.toSequence() == CSequence<int>({ 3, 2, 1 }), "Latest element first");
+
+        r1.push_front(4);
+        QVERIFY2(r1.size() == 3, "Full ring keeps its size");
+        QVERIFY2(r1.front() == 4 && r1.back() == 2, "Oldest element dropped");
+        QVERIFY2(std::equal(r1.begin(), r1.end(), CSequence<int>({ 4, 3, 2 }).begin()), "Iterators in latest first order");
+
+        r1.insert(1, 5);
+        QVERIFY2(r1.toSequence() == CSequence<int>({ 4, 5, 3 }), "Inserted in the middle, oldest dropped");
+        r1.insert(3, 6);
+        QVERIFY2(r1.toSequence() == CSequence<int>({ 4, 5, 3 }), "Insert behind a full ring is dropped");
+
+        r1.pop_back();
+        r1.insert(2, 7);
+        QVERIFY2(r1.toSequence() == CSequence<int>({ 4, 5, 7 }), "Inserted as oldest element");
+
+        auto r2 = r1;
+        QVERIFY2(r1 == r2, "Copy of ring is equal");
+        r2[0] = 8;
+        QVERIFY2(r1 != r2 && r1.front() == 4, "Copy is independent");
+
+        r1.truncate(1);
+        QVERIFY2(r1.size() == 1 && r1.front() == 4, "Truncated to latest element");
+        r1.clear();
+        QVERIFY2(r1.isEmpty() && r1.capacity() == 3, "Cleared ring keeps its capacity");
+
+        const CRingSequence<int> r3(CSequence<int>({ 1, 2, 3, 4 }), 2);
+        QVERIFY2(r3.toSequence() == CSequence<int>({ 1, 2 }), "Constructed from latest elements");
+
+        CRingSequence<int> r4;
+        r4.push_front(1);
+        QVERIFY2(r4.isEmpty(), "Ring without capacity stays empty");
+    }
+
     void CTestContainers::joinAndSplit()
     {
         CSequence<int> s1, s2;
@@ -289,6 +337,24 @@ namespace BlackMiscTest
         QVERIFY2(d1 == d4, "JSON serialization/deserialization failed");
     }
 
+    void CTestContainers::memoTable()
+    {
+        const CLivery withKey(1, "DLH.STD", CAirlineIcaoCode("DLH"), "Lufthansa", "red", "blue", false);
+        CLivery sameKey(withKey);
+        sameKey.setDescription("Lufthansa changed"); // same DB key, but different value
+        const CLivery noKey("BAW.STD", CAirlineIcaoCode("BAW"), "Speedbird", "red", "blue", false);
+
+        CMemoTable<CLivery> table;
+        QCOMPARE(table.getIndex(withKey), 0);
+        QCOMPARE(table.getIndex(noKey), 1);
+        QCOMPARE(table.getIndex(sameKey), 2);
+        QCOMPARE(table.getIndex(noKey), 1);
+        QCOMPARE(table.getIndex(withKey), 0);
+        QCOMPARE(table.getIndex(sameKey), 2);
+        QCOMPARE(table.getTable().size(), 3);
+        QCOMPARE(table.getTable()[2], sameKey);
+    }
+
     void CTestContainers::timestampList()
     {
         CAircraftSituationList situations;
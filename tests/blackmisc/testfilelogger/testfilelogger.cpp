@@ -0,0 +1,137 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \cond PRIVATE_TESTS
+
+/*!
+ * \file
+ * \ingroup testblackmisc
+ */
+
+#include "blackmisc/filelogger.h"
+#include "blackmisc/logcategorylist.h"
+#include "blackmisc/statusmessage.h"
+#include "test.h"
+
+#include <QFile>
+#include <QIODevice>
+#include <QString>
+#include <QTest>
+
+using namespace BlackMisc;
+
+namespace BlackMiscTest
+{
+    //! Testing the asynchronous writing of the file logger
+    class CTestFileLogger : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Records are dropped and counted if the buffer is full
+        void droppedRecords();
+
+        //! Records are written in batches
+        void batches();
+
+        //! All pending records are written when the writer is stopped
+        void flushOnStop();
+
+        //! All pending records are written when the file is closed
+        void flushOnClose();
+
+    private:
+        //! Log the given number of messages with a marker
+        static void writeMessages(CFileLogger &logger, const QString &marker, int number);
+
+        //! Occurrences of the marker in the log file
+        static int countInLogFile(const QString &marker);
+    };
+
+    void CTestFileLogger::droppedRecords()
+    {
+        constexpr int Messages = 10000;
+        CFileLogger logger;
+        logger.setAsynchronous(true, 2);
+        QVERIFY(logger.isAsynchronous());
+        writeMessages(logger, QStringLiteral("dropped"), Messages);
+
+        // the writer drains the buffer every 100ms, a tight loop is faster
+        logger.setAsynchronous(false);
+        const CFileLogger::Statistics statistics = logger.getStatistics();
+        QVERIFY2(statistics.dropped > 0, "Full buffer drops records");
+        QVERIFY2(statistics.records > 0, "Buffered records are written");
+        QVERIFY2(statistics.records + statistics.dropped >= Messages, "Every record is written or counted as dropped");
+
+        // the written records are the messages and their repeated category lines
+        const int written = countInLogFile(QStringLiteral(" dropped-"));
+        QVERIFY(written > 0 && written < Messages);
+        QCOMPARE(written + countInLogFile(QStringLiteral("[swift.test.filelogger.dropped]")), static_cast<int>(statistics.records));
+    }
+
+    void CTestFileLogger::batches()
+    {
+        constexpr int Messages = 100;
+        CFileLogger logger;
+        logger.setAsynchronous(true);
+        writeMessages(logger, QStringLiteral("batch"), Messages);
+
+        // one category line and the messages, written by the timer of the writer thread
+        QTRY_COMPARE(logger.getStatistics().records, static_cast<qint64>(Messages + 1));
+        const CFileLogger::Statistics statistics = logger.getStatistics();
+        QVERIFY(statistics.batches >= 1);
+        QVERIFY2(statistics.batches < statistics.records, "Several records per file write");
+        QCOMPARE(statistics.dropped, Q_INT64_C(0));
+        QVERIFY(statistics.bytes > 0);
+        QCOMPARE(countInLogFile(QStringLiteral(" batch-")), Messages);
+    }
+
+    void CTestFileLogger::flushOnStop()
+    {
+        constexpr int Messages = 1000;
+        CFileLogger logger;
+        logger.setAsynchronous(true);
+        writeMessages(logger, QStringLiteral("stop"), Messages);
+        logger.setAsynchronous(false);
+        QVERIFY(!logger.isAsynchronous());
+
+        const CFileLogger::Statistics statistics = logger.getStatistics();
+        QCOMPARE(statistics.records, static_cast<qint64>(Messages + 1));
+        QCOMPARE(statistics.dropped, Q_INT64_C(0));
+        QCOMPARE(countInLogFile(QStringLiteral(" stop-")), Messages);
+    }
+
+    void CTestFileLogger::flushOnClose()
+    {
+        constexpr int Messages = 1000;
+        CFileLogger logger;
+        logger.setAsynchronous(true);
+        writeMessages(logger, QStringLiteral("close"), Messages);
+        logger.close();
+        QVERIFY(!logger.isAsynchronous());
+        QCOMPARE(countInLogFile(QStringLiteral(" close-")), Messages);
+    }
+
+    void CTestFileLogger::writeMessages(CFileLogger &logger, const QString &marker, int number)
+    {
+        const CLogCategoryList categories { CLogCategory(QStringLiteral("swift.test.filelogger.") + marker) };
+        for (int i = 0; i < number; ++i)
+        {
+            logger.writeStatusMessageToFile(CStatusMessage(categories, CStatusMessage::SeverityInfo, marker + u'-' + QString::number(i)));
+        }
+    }
+
+    int CTestFileLogger::countInLogFile(const QString &marker)
+    {
+        QFile file(CFileLogger::getLogFilePath());
+        if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) { return -1; }
+        return QString::fromUtf8(file.readAll()).count(marker);
+    }
+} // namespace
+
+//! main
+BLACKTEST_MAIN(BlackMiscTest::CTestFileLogger);
+
+#include "testfilelogger.moc"
+
+//! \endcond
@@ -0,0 +1,172 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \cond PRIVATE_TESTS
+
+/*!
+ * \file
+ * \ingroup testblackmisc
+ */
+
+#include "blackmisc/jsonstreamreader.h"
+#include "test.h"
+
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QObject>
+#include <QTest>
+
+using namespace BlackMisc;
+
+namespace BlackMiscTest
+{
+    //! Streaming JSON reader tests
+    class CTestJsonStreamReader : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Objects of top level arrays and top level values
+        void objectDocument();
+
+        //! Document being an array
+        void arrayDocument();
+
+        //! Streamed objects are the same as in the DOM
+        void sameAsDom();
+
+        //! Handler stopping the parsing
+        void stopped();
+
+        //! Malformed JSON
+        void malformed();
+
+        //! Empty documents, like QJsonDocument::isEmpty
+        void emptyDocument();
+    };
+
+    namespace
+    {
+        const QByteArray &feed()
+        {
+            static const QByteArray f(R"({"general":{"version":3,"update_timestamp":"2023-01-01T12:00:00.0000000Z"},"latest":"2023-01-01 12:00:00","restricted":true,)"
+                                      R"("pilots":[{"callsign":"DLH123","altitude":35000,"flight_plan":{"aircraft":"A320/M","remarks":"RMK \"quoted\" ü"}},)"
+                                      R"({"callsign":"BAW1","altitude":-12.5,"flight_plan":null},17,"skipped"],)"
+                                      R"("controllers":[{"callsign":"EDDM_TWR","text_atis":["line 1","line 2"],"nested":{"a":[1,[2,3],{"b":false}]}}],)"
+                                      R"("servers":[{"name":"GERMANY"}],"atis":[]})");
+            return f;
+        }
+    } // ns
+
+    void CTestJsonStreamReader::objectDocument()
+    {
+        QStringList pilots;
+        QStringList controllers;
+        QString timestamp;
+        QString latest;
+        bool restricted = false;
+
+        CJsonStreamReader reader;
+        reader.onArrayObject("pilots", [&](const QJsonObject &o) { pilots.push_back(o["callsign"].toString()); return true; });
+        reader.onArrayObject("controllers", [&](const QJsonObject &o) { controllers.push_back(o["callsign"].toString()); return true; });
+        reader.onValue("general", [&](const QJsonValue &v) { timestamp = v["update_timestamp"].toString(); return true; });
+        reader.onValue("latest", [&](const QJsonValue &v) { latest = v.toString(); return true; });
+        reader.onValue("restricted", [&](const QJsonValue &v) { restricted = v.toBool(); return true; });
+
+        QVERIFY2(reader.parse(feed()), qPrintable(reader.getLastError()));
+        QVERIFY(!reader.isArrayDocument());
+        QVERIFY(!reader.hasError());
+        QCOMPARE(pilots, QStringList({ "DLH123", "BAW1" }));
+        QCOMPARE(controllers, QStringList({ "EDDM_TWR" }));
+        QCOMPARE(timestamp, QString("2023-01-01T12:00:00.0000000Z"));
+        QCOMPARE(latest, QString("2023-01-01 12:00:00"));
+        QVERIFY(restricted);
+    }
+
+    void CTestJsonStreamReader::arrayDocument()
+    {
+        QList<int> ids;
+        CJsonStreamReader reader;
+        reader.onArrayObject({}, [&](const QJsonObject &o) { ids.push_back(o["id"].toInt()); return true; });
+        QVERIFY(reader.parse(R"([{"id":1},{"id":2,"sub":[{"id":99}]},{"id":3}])"));
+        QVERIFY(reader.isArrayDocument());
+        QCOMPARE(ids, QList<int>({ 1, 2, 3 }));
+    }
+
+    void CTestJsonStreamReader::sameAsDom()
+    {
+        const QJsonDocument dom = QJsonDocument::fromJson(feed());
+        QJsonArray pilots;
+        QJsonArray controllers;
+        QJsonValue general;
+        CJsonStreamReader reader;
+        reader.onArrayObject("pilots", [&](const QJsonObject &o) { pilots.append(o); return true; });
+        reader.onArrayObject("controllers", [&](const QJsonObject &o) { controllers.append(o); return true; });
+        reader.onValue("general", [&](const QJsonValue &v) { general = v; return true; });
+        QVERIFY(reader.parse(feed()));
+
+        // elements which are no objects are skipped
+        QJsonArray domPilots = dom["pilots"].toArray();
+        domPilots.removeLast();
+        domPilots.removeLast();
+        QCOMPARE(pilots, domPilots);
+        QCOMPARE(controllers, dom["controllers"].toArray());
+        QCOMPARE(general, dom["general"]);
+    }
+
+    void CTestJsonStreamReader::stopped()
+    {
+        int pilots = 0;
+        bool controllers = false;
+        CJsonStreamReader reader;
+        reader.onArrayObject("pilots", [&](const QJsonObject &) { pilots++; return false; });
+        reader.onArrayObject("controllers", [&](const QJsonObject &) { controllers = true; return true; });
+        QVERIFY(!reader.parse(feed()));
+        QVERIFY(reader.isStopped());
+        QVERIFY(!reader.hasError());
+        QCOMPARE(pilots, 1);
+        QVERIFY(!controllers);
+    }
+
+    void CTestJsonStreamReader::malformed()
+    {
+        int pilots = 0;
+        CJsonStreamReader reader;
+        reader.onArrayObject("pilots", [&](const QJsonObject &) { pilots++; return true; });
+        QVERIFY(!reader.parse(R"({"pilots":[{"callsign":"DLH1"},{"callsign":)"));
+        QVERIFY(!reader.isStopped());
+        QVERIFY(reader.hasError());
+        QCOMPARE(pilots, 1);
+
+        QVERIFY(!reader.parse(QByteArray()));
+        QVERIFY(reader.hasError());
+    }
+
+    void CTestJsonStreamReader::emptyDocument()
+    {
+        CJsonStreamReader reader;
+        QVERIFY(reader.parse("{}"));
+        QVERIFY(reader.isEmptyDocument());
+        QVERIFY(reader.parse("[]"));
+        QVERIFY(reader.isEmptyDocument());
+        QVERIFY(reader.parse("17"));
+        QVERIFY(reader.isEmptyDocument());
+
+        QVERIFY(reader.parse(R"({"latest":"2023-01-01 12:00:00"})"));
+        QVERIFY(!reader.isEmptyDocument());
+        QVERIFY(reader.parse(R"({"data":[]})"));
+        QVERIFY(!reader.isEmptyDocument());
+        QVERIFY(reader.parse("[17]"));
+        QVERIFY(!reader.isEmptyDocument());
+        QVERIFY(reader.parse(feed()));
+        QVERIFY(!reader.isEmptyDocument());
+    }
+} // namespace
+
+//! main
+BLACKTEST_APPLESS_MAIN(BlackMiscTest::CTestJsonStreamReader);
+
+#include "testjsonstreamreader.moc"
+
+//! \endcond
@@ -0,0 +1,138 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \cond PRIVATE_TESTS
+
+/*!
+ * \file
+ * \ingroup testblackmisc
+ */
+
+#include "blackmisc/loghandler.h"
+#include "blackmisc/logmessage.h"
+#include "blackmisc/logpattern.h"
+#include "test.h"
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QTest>
+
+using namespace BlackMisc;
+
+namespace BlackMiscTest
+{
+    //! Testing the filtering of log messages nobody consumes
+    class CTestLogMessage : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Install the log handler without console output
+        void initTestCase();
+
+        //! Restore the console output
+        void cleanupTestCase();
+
+        //! Messages enabled by the local listener pattern
+        void localListenerPattern();
+
+        //! Messages enabled by subscriptions
+        void subscriptions();
+
+        //! Streamed values of suppressed debug messages are not formatted
+        void skippedArguments();
+
+        //! 1M suppressed debug messages
+        void suppressedBenchmark();
+    };
+
+    //! Counts its stringifications
+    struct CCountedValue
+    {
+        //! Stringification
+        QString toQString() const
+        {
+            ++s_count;
+            return QStringLiteral("value");
+        }
+
+        //! Number of stringifications
+        static int s_count;
+    };
+
+    int CCountedValue::s_count = 0;
+
+    void CTestLogMessage::initTestCase()
+    {
+        CLogHandler::instance()->install(true);
+        CLogHandler::instance()->enableConsoleOutput(false);
+        CLogHandler::instance()->setLocalListenerPatterns({ CLogPattern().withSeverityAtOrAbove(CStatusMessage::SeverityInfo) });
+    }
+
+    void CTestLogMessage::cleanupTestCase()
+    {
+        CLogHandler::instance()->setLocalListenerPatterns({ CLogPattern() });
+        CLogHandler::instance()->enableConsoleOutput(true);
+    }
+
+    void CTestLogMessage::localListenerPattern()
+    {
+        const CLogCategoryList categories { CLogCategory("swift.test.log") };
+        QVERIFY2(!CLogHandler::isEnabled(CStatusMessage::SeverityDebug, categories), "Nobody consumes debug messages");
+        QVERIFY2(CLogHandler::isEnabled(CStatusMessage::SeverityInfo, categories), "Info messages are consumed");
+        QVERIFY2(CLogHandler::isEnabled(CStatusMessage::SeverityError, categories), "Error messages are consumed");
+
+        CLogHandler::instance()->enableConsoleOutput(true);
+        QVERIFY2(CLogHandler::isEnabled(CStatusMessage::SeverityDebug, categories), "Console consumes debug messages");
+        CLogHandler::instance()->enableConsoleOutput(false);
+        QVERIFY2(!CLogHandler::isEnabled(CStatusMessage::SeverityDebug, categories), "Nobody consumes debug messages");
+    }
+
+    void CTestLogMessage::subscriptions()
+    {
+        const CLogCategoryList categories { CLogCategory("swift.test.log") };
+        CLogSubscriber subscriber(this, [](const CStatusMessage &) {});
+        subscriber.changeSubscription(CLogPattern::exactMatch(CLogCategory("swift.test.log")));
+        QVERIFY2(CLogHandler::isEnabled(CStatusMessage::SeverityDebug, categories), "Subscriber consumes debug messages");
+        QVERIFY2(!CLogHandler::isEnabled(CStatusMessage::SeverityDebug, {}), "Nobody consumes uncategorized debug messages");
+
+        subscriber.unsubscribe();
+        QTRY_VERIFY2(!CLogHandler::isEnabled(CStatusMessage::SeverityDebug, categories), "Nobody consumes debug messages after unsubscribing");
+    }
+
+    void CTestLogMessage::skippedArguments()
+    {
+        const CCountedValue value;
+        CCountedValue::s_count = 0;
+        CLogMessage(this).debug(u"Suppressed %1") << value;
+        QCOMPARE(CCountedValue::s_count, 0);
+        CLogMessage(this).info(u"Consumed %1") << value;
+        QCOMPARE(CCountedValue::s_count, 1);
+        QCoreApplication::processEvents();
+    }
+
+    void CTestLogMessage::suppressedBenchmark()
+    {
+        constexpr int Messages = 1000 * 1000;
+        const QString text("some text");
+        QElapsedTimer timer;
+        timer.start();
+        for (int i = 0; i < Messages; ++i)
+        {
+            CLogMessage(this).debug(u"Message %1 %2 %3") << i << text << 1.5;
+        }
+        const qint64 elapsedMs = timer.elapsed();
+        QVERIFY2(!CLogHandler::isEnabled(CStatusMessage::SeverityDebug, CLogCategoryList(this)), "Nobody consumes debug messages");
+
+        CLogHandler::instance()->enableConsoleOutput(true);
+        qDebug() << "Suppressed debug messages:" << Messages << "in" << elapsedMs << "ms";
+        CLogHandler::instance()->enableConsoleOutput(false);
+    }
+} // namespace
+
+//! main
+BLACKTEST_MAIN(BlackMiscTest::CTestLogMessage);
+
+#include "testlogmessage.moc"
+
+//! \endcond
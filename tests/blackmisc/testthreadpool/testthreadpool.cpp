@@ -0,0 +1,238 @@
+// SPDX-FileCopyrightText: Copyright (C) 2023 swift Project Community / Contributors
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-swift-pilot-client-1
+
+//! \cond PRIVATE_TESTS
+
+/*!
+ * \file
+ * \ingroup testblackmisc
+ */
+
+#include "blackmisc/threadpool.h"
+#include "blackmisc/worker.h"
+#include "test.h"
+
+#include <QElapsedTimer>
+#include <QMutex>
+#include <QObject>
+#include <QTest>
+#include <QThread>
+#include <QVector>
+#include <atomic>
+#include <future>
+#include <memory>
+
+using namespace BlackMisc;
+
+namespace BlackMiscTest
+{
+    //! Thread pool and the workers running on it
+    class CTestThreadPool : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! All tasks are run, also tasks submitted by tasks
+        void runTasks();
+
+        //! Interactive tasks are taken before background tasks
+        void priorities();
+
+        //! Interrupted threads are replaced
+        void interruption();
+
+        //! Worker result and abandoning
+        void worker();
+
+        //! Worker of a destroyed owner is cancelled
+        void workerOwnerDestroyed();
+
+        //! Long tasks run in threads of their own and do not block interactive tasks
+        void longTasks();
+
+        //! 10,000 tiny tasks, thread per task vs. pool
+        void tinyTasksBenchmark();
+    };
+
+    void CTestThreadPool::runTasks()
+    {
+        CThreadPool pool(4);
+        QCOMPARE(pool.getThreadCount(), 4);
+        QVERIFY(!pool.isPoolThread());
+
+        std::atomic_int count { 0 };
+        std::atomic_int inPool { 0 };
+        for (int i = 0; i < 100; ++i)
+        {
+            pool.submit([&] {
+                if (pool.isPoolThread()) { ++inPool; }
+                for (int j = 0; j < 10; ++j) { pool.submit([&] { ++count; }); }
+                ++count;
+            });
+        }
+        QTRY_COMPARE(count.load(), 1100);
+        QCOMPARE(inPool.load(), 100);
+
+        const CThreadPool::Statistics statistics = pool.getStatistics();
+        QCOMPARE(statistics.threadsCreated, qint64(4));
+        QCOMPARE(statistics.tasksSubmitted, qint64(1100));
+        QTRY_COMPARE(pool.getStatistics().tasksExecuted, qint64(1100));
+        QVERIFY(statistics.maxLatencyNs >= 0);
+    }
+
+    void CTestThreadPool::priorities()
+    {
+        CThreadPool pool(1);
+        std::promise<void> release;
+        std::shared_future<void> released = release.get_future().share();
+        pool.submit([released] { released.wait(); }); // blocks the only thread
+
+        QMutex mutex;
+        QVector<CThreadPool::Priority> order;
+        const auto record = [&](CThreadPool::Priority priority) {
+            QMutexLocker lock(&mutex);
+            order.push_back(priority);
+        };
+        for (int i = 0; i < 5; ++i) { pool.submit([&] { record(CThreadPool::Background); }, CThreadPool::Background); }
+        for (int i = 0; i < 5; ++i) { pool.submit([&] { record(CThreadPool::Interactive); }, CThreadPool::Interactive); }
+        release.set_value();
+
+        QTRY_COMPARE(pool.getStatistics().tasksExecuted, qint64(11));
+        QMutexLocker lock(&mutex);
+        QCOMPARE(order.size(), 10);
+        for (int i = 0; i < 5; ++i) { QCOMPARE(order[i], CThreadPool::Interactive); }
+        for (int i = 5; i < 10; ++i) { QCOMPARE(order[i], CThreadPool::Background); }
+    }
+
+    void CTestThreadPool::interruption()
+    {
+        CThreadPool pool(1);
+        pool.submit([] { QThread::currentThread()->requestInterruption(); });
+
+        std::atomic_int interrupted { -1 };
+        pool.submit([&] { interrupted = QThread::currentThread()->isInterruptionRequested() ? 1 : 0; });
+        QTRY_COMPARE(interrupted.load(), 0);
+        QCOMPARE(pool.getStatistics().threadsCreated, qint64(2));
+    }
+
+    void CTestThreadPool::worker()
+    {
+        CWorker *worker = CWorker::fromTask(this, "result", [] { return 42; });
+        QCOMPARE(worker->result<int>(), 42);
+
+        std::atomic_bool started { false };
+        CWorker *abandoned = CWorker::fromTask(this, "abandoned", [&started] {
+            started = true;
+            while (!QThread::currentThread()->isInterruptionRequested()) { QThread::msleep(1); }
+        });
+        QTRY_VERIFY(started.load());
+        abandoned->abandonAndWait();
+        QVERIFY(abandoned->isFinished());
+    }
+
+    void CTestThreadPool::workerOwnerDestroyed()
+    {
+        // block all pool threads, so the task can not start before its owner is destroyed
+        CThreadPool &pool = CThreadPool::instance();
+        std::promise<void> release;
+        std::shared_future<void> released = release.get_future().share();
+        std::atomic_int blocked { 0 };
+        for (int i = 0; i < pool.getThreadCount(); ++i)
+        {
+            pool.submit([&blocked, released] {
+                ++blocked;
+                released.wait();
+            });
+        }
+        QTRY_COMPARE(blocked.load(), pool.getThreadCount());
+
+        std::atomic_bool run { false };
+        auto owner = std::make_unique<QObject>();
+        CWorker *worker = CWorker::fromTask(owner.get(), "cancelled", [&run] { run = true; });
+        std::atomic_bool finished { false };
+        worker->then([&finished] { finished = true; });
+        owner.reset();
+        release.set_value();
+
+        QTRY_VERIFY(finished.load());
+        QVERIFY(!run.load());
+    }
+
+    void CTestThreadPool::longTasks()
+    {
+        // more long tasks than pool threads
+        CThreadPool &pool = CThreadPool::instance();
+        std::promise<void> release;
+        std::shared_future<void> released = release.get_future().share();
+        std::atomic_int blocked { 0 };
+        std::atomic_int inPool { 0 };
+        const int longTasks = pool.getThreadCount() + 1;
+        for (int i = 0; i < longTasks; ++i)
+        {
+            CWorker::fromLongTask(this, "long", [&pool, &blocked, &inPool, released] {
+                if (pool.isPoolThread()) { ++inPool; }
+                ++blocked;
+                released.wait();
+            });
+        }
+        QTRY_COMPARE(blocked.load(), longTasks);
+        QCOMPARE(inPool.load(), 0);
+
+        std::atomic_bool interactive { false };
+        CWorker *worker = CWorker::fromTask(this, "interactive", CThreadPool::Interactive, [] { return 1; });
+        worker->then([&interactive] { interactive = true; });
+        QTRY_VERIFY(interactive.load());
+        release.set_value();
+    }
+
+    void CTestThreadPool::tinyTasksBenchmark()
+    {
+        const int tasks = 10000;
+        const int maxThreads = 64;
+        std::atomic_int count { 0 };
+        QElapsedTimer timer;
+        timer.start();
+
+        // like CWorker did before, a thread per task, but not more than maxThreads at a time
+        for (int i = 0; i < tasks; i += maxThreads)
+        {
+            std::vector<std::unique_ptr<QThread>> threads;
+            for (int t = 0; t < maxThreads && i + t < tasks; ++t)
+            {
+                threads.emplace_back(QThread::create([&count] { ++count; }));
+                threads.back()->start();
+            }
+            for (const auto &thread : threads) { thread->wait(); }
+        }
+        const qint64 threadPerTaskMs = timer.restart();
+        QCOMPARE(count.load(), tasks);
+
+        CThreadPool &pool = CThreadPool::instance();
+        pool.resetStatistics();
+        const qint64 threadsBefore = pool.getStatistics().threadsCreated + CRegularThread::getThreadsCreatedCount();
+        std::atomic_int finished { 0 };
+        count = 0;
+        timer.restart();
+        for (int i = 0; i < tasks; ++i)
+        {
+            CWorker *worker = CWorker::fromTask(this, "tiny", [&count] { ++count; });
+            worker->then([&finished] { ++finished; });
+        }
+        QTRY_COMPARE_WITH_TIMEOUT(finished.load(), tasks, 30 * 1000);
+        const qint64 poolMs = timer.elapsed();
+        QCOMPARE(count.load(), tasks);
+
+        const CThreadPool::Statistics statistics = pool.getStatistics();
+        QCOMPARE(statistics.threadsCreated + CRegularThread::getThreadsCreatedCount(), threadsBefore);
+        qDebug() << "Tasks:" << tasks << "thread per task:" << threadPerTaskMs << "ms, pool:" << poolMs << "ms";
+        qDebug() << "Pool threads:" << pool.getThreadCount() << "stolen:" << statistics.tasksStolen
+                 << "latency avg:" << statistics.averageLatencyUs() << "us, max:" << statistics.maxLatencyNs / 1000 << "us";
+    }
+} // namespace
+
+//! main
+BLACKTEST_MAIN(BlackMiscTest::CTestThreadPool);
+
+#include "testthreadpool.moc"
+
+//! \endcond
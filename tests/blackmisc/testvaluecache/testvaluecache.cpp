@@ -73,6 +73,9 @@ namespace BlackMiscTest
 
         //! Test saving to and loading from files.
         void saveAndLoad();
+
+        //! Test saving to and loading from binary files, and migration from Json files.
+        void saveAndLoadBinary();
     };
 
     //! Simple class which uses CCached, for testing.
@@ -299,6 +302,56 @@ namespace BlackMiscTest
         QCOMPARE(test2Values, testData);
     }
 
+    void CTestValueCache::saveAndLoadBinary()
+    {
+        CSimulatedAircraftList aircraft({ CSimulatedAircraft("BAW001", {}, {}) });
+        CAtcStationList atcStations({ CAtcStation("EGLL_TWR") });
+        const CVariantMap testData {
+            { "namespace1/value1", CVariant::from(1) },
+            { "namespace1/value2", CVariant::from(2) },
+            { "namespace2/aircraft", CVariant::from(aircraft) },
+            { "namespace2/atcstations", CVariant::from(atcStations) }
+        };
+        CValueCache cache(1);
+        cache.insertValues({ testData, QDateTime::currentMSecsSinceEpoch() });
+
+        QDir dir(QDir::currentPath() + "/testcachebinary");
+        if (dir.exists()) { dir.removeRecursively(); }
+
+        // Json files, then namespace1 migrated to a binary file
+        auto status = cache.saveToFiles(dir.absolutePath());
+        QVERIFY(status.isSuccess());
+        cache.setBinaryFiles(true);
+        QCOMPARE(cache.filenameForKey("namespace1/value1"), QString("namespace1.bin"));
+        status = cache.saveToFiles(dir.absolutePath(), QStringList { "namespace1/value1" });
+        QVERIFY(status.isSuccess());
+
+        auto files = dir.entryInfoList(QDir::AllEntries | QDir::NoDotAndDotDot, QDir::Name);
+        QCOMPARE(files.size(), 2);
+        QCOMPARE(files[0].fileName(), QString("namespace1.bin"));
+        QCOMPARE(files[1].fileName(), QString("namespace2.json"));
+
+        // value not saved explicitly was migrated from the Json file
+        CVariantMap binaryValues;
+        status = CValueCache::readBinaryFile(files[0].absoluteFilePath(), binaryValues);
+        QVERIFY(status.isSuccess());
+        QCOMPARE(binaryValues.keys().to<QStringList>(), QStringList({ "namespace1/value1", "namespace1/value2" }));
+
+        // both formats are loaded
+        CValueCache cache2(1);
+        status = cache2.loadFromFiles(dir.absolutePath());
+        QVERIFY(status.isSuccess());
+        QCOMPARE(cache2.getAllValues(), testData);
+
+        status = cache.saveToFiles(dir.absolutePath());
+        QVERIFY(status.isSuccess());
+        CValueCache cache3(1);
+        status = cache3.loadFromFiles(dir.absolutePath());
+        QVERIFY(status.isSuccess());
+        QCOMPARE(cache3.getAllValues(), testData);
+        QVERIFY(!QFile::exists(dir.absoluteFilePath("namespace2.json")));
+    }
+
     //! Is value between 0 - 100?
     bool validator(int value, QString &)
     {